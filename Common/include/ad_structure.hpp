@@ -85,6 +85,11 @@ namespace AD{
    */
   void Reset();
 
+  /*!
+   * \brief Print the statistics of the tape (memory, number of statements and adjoint vector size).
+   */
+  void PrintStatistics();
+
   /*!
    * \brief Reset the variable (set index to zero).
    * \param[in] data - the variable to be unregistered from the tape.
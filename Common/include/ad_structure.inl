@@ -92,6 +92,8 @@ namespace AD{
     }
   }
 
+  inline void PrintStatistics() {AD::globalTape.printStatistics();}
+
   inline void SetPreaccIn(const su2double &data) {
     if (PreaccActive) {
       if (data.isActive()) {
@@ -182,6 +184,8 @@ namespace AD{
 
   inline void Reset() {}
 
+  inline void PrintStatistics() {}
+
   inline void ResetInput(su2double &data) {}
 
   inline void SetPreaccIn(const su2double &data) {}
@@ -421,8 +421,52 @@ public:
                                unsigned short  &markerID,
                                unsigned long   &elemID,
                                int             &rankID);
+
+  /*!
+   * \brief Function, which determines the nearest element in the ADT for the
+            given coordinate within a given distance. Used for batched queries,
+            in which the nearest element of the previous point is a good guess.
+   * \param[in]     coor      Coordinate for which the nearest element in the ADT must be determined.
+   * \param[in]     maxDist   Upper bound of the distance, elements further away are not considered.
+   * \param[in,out] adtElemID On input the ID in the ADT of a guess of the nearest element
+                              (ignored if out of range), on output the ID of the nearest element.
+   * \param[out]    dist      Distance to the nearest element in the ADT. If no element is
+                              found, the square of the distance bound of the search.
+   * \param[out]    markerID  Local marker ID of the nearest element in the ADT.
+   * \param[out]    elemID    Local element ID of the nearest element in the ADT.
+   * \param[out]    rankID    Rank on which the nearest element in the ADT is stored.
+   * \return                  True if an element within maxDist is found, false if not.
+   */
+  bool DetermineNearestElement(const su2double *coor,
+                               const su2double maxDist,
+                               unsigned long   &adtElemID,
+                               su2double       &dist,
+                               unsigned short  &markerID,
+                               unsigned long   &elemID,
+                               int             &rankID);
 private:
 
+  /*!
+   * \brief Function, which carries out the nearest element search.
+   * \param[in]     coor      Coordinate for which the nearest element in the ADT must be determined.
+   * \param[in]     useBound  Whether or not maxDist2 bounds the search.
+   * \param[in]     maxDist2  Upper bound of the distance squared.
+   * \param[in,out] adtElemID Guess of the nearest element on input, nearest element on output.
+   * \param[out]    dist      Distance to the nearest element in the ADT.
+   * \param[out]    markerID  Local marker ID of the nearest element in the ADT.
+   * \param[out]    elemID    Local element ID of the nearest element in the ADT.
+   * \param[out]    rankID    Rank on which the nearest element in the ADT is stored.
+   * \return                  True if an element is found, false if not.
+   */
+  bool NearestElementSearch(const su2double *coor,
+                            const bool      useBound,
+                            const su2double maxDist2,
+                            unsigned long   &adtElemID,
+                            su2double       &dist,
+                            unsigned short  &markerID,
+                            unsigned long   &elemID,
+                            int             &rankID);
+
   /*!
    * \brief Function, which checks whether or not the given coordinate is
             inside the given element.
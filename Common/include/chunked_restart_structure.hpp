@@ -0,0 +1,111 @@
+/*!
+ * \file chunked_restart_structure.hpp
+ * \brief Headers of the routines for the chunked (and compressed) binary restart files.
+ *        The subroutines and functions are in the <i>chunked_restart_structure.cpp</i> file.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "./mpi_structure.hpp"
+#include "./config_structure.hpp"
+#include "./io_aggregator_structure.hpp"
+#include "./toolboxes/compression_toolbox.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CChunkedRestart
+ * \brief Reading and writing of the chunked binary restart format. The data is stored by field
+ *        in chunks of consecutive points (one chunk per writing rank), each field of each chunk
+ *        is an independently encoded block (optionally shuffled and compressed). An index of the
+ *        blocks follows the header, so that the readers only access the fields they need.
+ *
+ *        Layout: int[5] {magic, nFields, nPoint, nChunk, compressed}, the field names
+ *        (CGNS_STRING_SIZE chars each), long long[nChunk+1] first point of each chunk,
+ *        long long[nChunk*nFields+1] offsets of the blocks (chunk major), the blocks, and
+ *        the same footer as the plain binary restarts (int ExtIter, 8 doubles of metadata).
+ * \author SU2 contributors
+ */
+class CChunkedRestart {
+
+public:
+
+  static const int MagicNumber = 535533; /*!< \brief First int of the chunked restart files (plain files use 535532). */
+
+  /*!
+   * \brief Check if a file is a chunked restart file, collective over all ranks.
+   * \param[in] val_filename - Name of the file.
+   * \return True if the file starts with the magic number of the chunked format.
+   */
+  static bool IsChunked(const char *val_filename);
+
+  /*!
+   * \brief Write a chunked restart file, collective over all ranks. The ranks hold linear
+   *        partitions of the points, in the order of the ranks.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the file.
+   * \param[in] nFields - Number of fields.
+   * \param[in] Field_Names - Names of the fields.
+   * \param[in] nPoint_Global - Total number of points.
+   * \param[in] nPoint - Number of points of this rank.
+   * \param[in] data - Data of this rank, nFields values per point.
+   * \param[in] ExtIter - Iteration stored in the footer.
+   * \param[in] Metadata - 8 values stored in the footer.
+   * \return Number of bytes written by this rank.
+   */
+  static unsigned long Write(CConfig *config, const char *val_filename, int nFields, const string *Field_Names,
+                             unsigned long nPoint_Global, unsigned long nPoint, const passivedouble *data,
+                             int ExtIter, const passivedouble *Metadata);
+
+  /*!
+   * \brief Read a chunked restart file, collective over all ranks.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the file.
+   * \param[in] nPoint - Number of points of this rank.
+   * \param[in] Point_Global - Global indices of the points of this rank, in ascending order.
+   * \param[in] val_iField - First field to read.
+   * \param[in] val_nField - Number of fields to read (0 for all), the others are set to zero.
+   * \param[out] Restart_Vars - The header of the file (5 ints).
+   * \param[out] Field_Names - Names of all the fields of the file.
+   * \param[out] Restart_Data - Data of the points of this rank (all fields), allocated here.
+   */
+  static void Read(CConfig *config, const char *val_filename, unsigned long nPoint, const unsigned long *Point_Global,
+                   unsigned short val_iField, unsigned short val_nField, int *Restart_Vars,
+                   vector<string> &Field_Names, passivedouble *&Restart_Data);
+
+};
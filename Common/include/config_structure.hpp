@@ -403,6 +403,11 @@ private:
   unsigned long Dyn_nIntIter;			/*!< \brief Number of internal iterations (Newton-Raphson Method for nonlinear structural analysis). */
   long Unst_RestartIter;			/*!< \brief Iteration number to restart an unsteady simulation (Dual time Method). */
   long Unst_AdjointIter;			/*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  bool Unst_AdjointCheckpointing;   /*!< \brief Recompute the direct solutions of the unsteady adjoint from checkpoints. */
+  unsigned long Unst_AdjointCheckpointFreq;  /*!< \brief Interval of the direct restart files used as checkpoints by the unsteady adjoint. */
+  unsigned long Unst_AdjointSnapshots;       /*!< \brief Number of direct solutions kept in memory by the unsteady adjoint. */
+  su2double Unst_AdjointCheckpointVerify;    /*!< \brief Tolerance of the comparison of recomputed direct solutions with existing restart files (0 disables it). */
+  bool Wrt_AD_Statistics;           /*!< \brief Write the statistics of the AD tape after the recording. */
   long Iter_Avg_Objective;			/*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   long Dyn_RestartIter;                         /*!< \brief Iteration number to restart a dynamic structural analysis. */
   unsigned short nLevels_TimeAccurateLTS;       /*!< \brief Number of time levels for time accurate local time stepping. */
@@ -424,6 +429,7 @@ private:
   Max_DeltaTime,  		/*!< \brief Max delta time. */
   Unst_CFL;		/*!< \brief Unsteady CFL number. */
   bool ReorientElements;		/*!< \brief Flag for enabling element reorientation. */
+  unsigned short Kind_Renumbering;		/*!< \brief Kind of local point renumbering after the partitioning. */
   bool AddIndNeighbor;			/*!< \brief Include indirect neighbor in the agglomeration process. */
   unsigned short nDV,		/*!< \brief Number of design variables. */
   nObj, nObjW;              /*! \brief Number of objective functions. */
@@ -559,6 +565,17 @@ private:
   unsigned long Linear_Solver_Iter_Heat;       /*!< \brief Max iterations of the linear solver for the implicit formulation in the fvm heat solver. */
   unsigned long Linear_Solver_Restart_Frequency;   /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned short Linear_Solver_ILU_n;		/*!< \brief ILU fill=in level. */
+  unsigned short AMG_MaxLevels;        /*!< \brief Maximum number of levels of the AMG preconditioner (including the finest). */
+  unsigned long AMG_MinPoints;         /*!< \brief Number of points below which an AMG level is not coarsened further. */
+  su2double AMG_Strength;              /*!< \brief Strength of connection threshold of the AMG aggregation. */
+  su2double AMG_CoarseningRatio;       /*!< \brief Largest ratio of coarse to fine points for which an AMG level is kept. */
+  unsigned short AMG_CoarseSweeps;     /*!< \brief Symmetric Gauss-Seidel sweeps on the coarsest AMG level. */
+  bool Linear_Solver_Mixed_Precision;		/*!< \brief Store the preconditioner of the linear solver in single precision. */
+  unsigned long Jacobian_Reuse_Freq;   /*!< \brief Maximum number of iterations between two assemblies of the flow Jacobian. */
+  su2double Jacobian_Reuse_Stall;      /*!< \brief Residual ratio of an iteration above which the flow Jacobian is assembled again. */
+  bool Newton_Krylov;                  /*!< \brief Jacobian-free Newton-Krylov method for the flow equations. */
+  su2double Newton_Krylov_Step;        /*!< \brief Relative step of the finite difference Jacobian-vector products. */
+  unsigned long Newton_Krylov_StartUp_Iter;  /*!< \brief Iterations with the assembled Jacobian before starting the Newton-Krylov method. */
   su2double SemiSpan;		/*!< \brief Wing Semi span. */
   su2double Roe_Kappa;		/*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Flow;		/*!< \brief Relaxation coefficient of the linear solver mean flow. */
@@ -643,8 +660,14 @@ private:
   bool Wrt_Dynamic;  		/*!< \brief Write dynamic data adding header and prefix. */
   bool Restart,	/*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Wrt_Binary_Restart,	/*!< \brief Write binary SU2 native restart files.*/
+  Wrt_Async_Output,	/*!< \brief Write the restart and volume solution files on a background thread.*/
+  Wrt_Chunked_Restart,	/*!< \brief Write the binary restart files in the chunked format (per field blocks).*/
+  Restart_Compression,	/*!< \brief Compress the blocks of the chunked restart files.*/
   Read_Binary_Restart,	/*!< \brief Read binary SU2 native restart files.*/
+  Wrt_Binary_Mesh,	/*!< \brief Write the output mesh in the binary SU2 format.*/
   Restart_Flow;	/*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned long IO_Aggregators,	/*!< \brief Number of ranks that access the file system in the parallel binary I/O (0 for all ranks). */
+  IO_Stripe_Size;	/*!< \brief Stripe size of the file system in bytes, the aggregated writes are aligned to it. */
   unsigned short nMarker_Monitoring,	/*!< \brief Number of markers to monitor. */
   nMarker_Designing,					/*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,					/*!< \brief Number of markers for the objective function. */
@@ -768,6 +791,9 @@ private:
   Wrt_Slice,                   /*!< \brief Write 1D slice of a 2D cartesian solution */
   Wrt_Projected_Sensitivity,   /*!< \brief Write projected sensitivities (dJ/dx) on surfaces to ASCII file. */
   Plot_Section_Forces;       /*!< \brief Write sectional forces for specified markers. */
+  bool Profiling,             /*!< \brief Accumulate timings of the profiled regions. */
+  Profiling_Trace;            /*!< \brief Write a timeline of the profiled regions. */
+  unsigned long Profiling_Trace_Size; /*!< \brief Number of events kept per rank for the timeline. */
   unsigned short Console_Output_Verb,  /*!< \brief Level of verbosity for console output */
   Kind_Average;        /*!< \brief Particular average for the marker analyze. */
   unsigned short nPolyCoeffs; /*!< \brief Number of coefficients in temperature polynomial fits for fluid models. */
@@ -796,6 +822,7 @@ private:
   Pressure_Critical,   /*!< \brief Critical Pressure for real fluid model.  */
   Density_Critical,   /*!< \brief Critical Density for real fluid model.  */
   Acentric_Factor,   /*!< \brief Acentric Factor for real fluid model.  */
+  LUT_Tolerance,     /*!< \brief Relative interpolation error that triggers a refinement of the fluid tables.  */
   Mu_Constant,     /*!< \brief Constant viscosity for ConstantViscosity model.  */
   Mu_ConstantND,   /*!< \brief Non-dimensional constant viscosity for ConstantViscosity model.  */
   Kt_Constant,     /*!< \brief Constant thermal conductivity for ConstantConductivity model.  */
@@ -990,6 +1017,10 @@ private:
   unsigned short Kind_RadialBasisFunction; /*!\brief type of radial basis function to use for radial basis FSI. */
   bool RadialBasisFunction_PolynomialOption; /*!\brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter; /*!\brief Radial basis function parameter. */
+  bool RadialBasisFunction_Sparse; /*!\brief Option of whether to solve the interpolation system of compactly supported radial basis functions in sparse form. */
+  su2double RadialBasisFunction_PruneTol; /*!\brief Relative tolerance below which the radial basis function interpolation coefficients are discarded. */
+  su2double RadialBasisFunction_Patch; /*!\brief Radius (in support radii) of the patch of donor points of the sparse radial basis function interpolation. */
+  bool SlidingMesh_Incremental; /*!\brief Option of whether the sliding mesh interpolation reuses the interface connectivity and donor search of the previous update. */
   bool Prestretch;            /*!< Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;         /*!< \brief File name for reference geometry. */
   string FEA_FileName;         /*!< \brief File name for element-based properties. */
@@ -1043,6 +1074,13 @@ private:
   su2double FinalOutletPressure; /*!< \brief Final outlet pressure if Ramp outlet pressure is activated. */
   su2double MonitorOutletPressure; /*!< \brief Monitor outlet pressure if Ramp outlet pressure is activated. */
   su2double *default_body_force;        /*!< \brief Default body force vector for the COption class. */
+  su2double *default_lut_pressure;      /*!< \brief Default pressure range of the fluid tables for the COption class. */
+  su2double *default_lut_temperature;   /*!< \brief Default temperature range of the fluid tables for the COption class. */
+  su2double *LUT_Pressure_Range;        /*!< \brief Pressure range (min, max) covered by the fluid tables. */
+  su2double *LUT_Temperature_Range;     /*!< \brief Temperature range (min, max) covered by the fluid tables. */
+  unsigned short Kind_LUT_Donor;        /*!< \brief Analytic fluid model from which the fluid tables are generated. */
+  unsigned short LUT_MaxRefinement;     /*!< \brief Maximum number of refinements of a root cell of the fluid tables. */
+  string LUT_FileName;                  /*!< \brief File in which the fluid tables are stored. */
   su2double *default_nacelle_location;        /*!< \brief Location of the nacelle. */
   su2double *default_cp_polycoeffs;        /*!< \brief Array for specific heat polynomial coefficients. */
   su2double *default_mu_polycoeffs;        /*!< \brief Array for viscosity polynomial coefficients. */
@@ -1073,6 +1111,7 @@ private:
   su2double Theta_Interior_Penalty_DGFEM;    /*!< \brief Factor for the symmetrizing terms in the DG discretization of the viscous fluxes. */
   unsigned short byteAlignmentMatMul;        /*!< \brief Number of bytes in the vectorization direction for the matrix multiplication. Multipe of 64. */
   unsigned short sizeMatMulPadding;          /*!< \brief The matrix size in the vectorization direction padded to a multiple of 8. Computed from byteAlignmentMatMul. */
+  unsigned long ElemChunkSize_DGFEM;         /*!< \brief Number of elements per chunk handed to a thread by the threaded DG task executor. */
   bool Compute_Entropy;                      /*!< \brief Whether or not to compute the entropy in the fluid model. */
   bool Use_Lumped_MassMatrix_DGFEM;          /*!< \brief Whether or not to use the lumped mass matrix for DGFEM. */
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
@@ -2778,6 +2817,12 @@ public:
    * \return 	<code>TRUE</code> means that elements can be reoriented if suspected unhealthy
    */
   bool GetReorientElements(void);
+
+  /*!
+   * \brief Get the kind of local point renumbering applied after the partitioning.
+   * \return Kind of renumbering (NONE, RCM or HILBERT).
+   */
+  unsigned short GetKind_Renumbering(void);
   
   /*!
    * \brief Get the Courant Friedrich Levi number for unsteady simulations.
@@ -3057,6 +3102,36 @@ public:
    */
   long GetUnst_AdjointIter(void);
   
+  /*!
+   * \brief Get whether the unsteady adjoint recomputes the direct solutions from checkpoints.
+   * \return <code>TRUE</code> if the direct solutions are recomputed; otherwise <code>FALSE</code>.
+   */
+  bool GetUnst_AdjointCheckpointing(void);
+  
+  /*!
+   * \brief Get the interval of the direct restart files used as checkpoints by the unsteady adjoint.
+   * \return Interval (in time steps) of the direct restart files.
+   */
+  unsigned long GetUnst_AdjointCheckpointFreq(void);
+  
+  /*!
+   * \brief Get the number of direct solutions that the unsteady adjoint keeps in memory.
+   * \return Number of in-memory snapshots.
+   */
+  unsigned long GetUnst_AdjointSnapshots(void);
+  
+  /*!
+   * \brief Get the tolerance of the comparison of recomputed direct solutions with existing restart files.
+   * \return Maximum relative difference allowed, 0 if the recomputed solutions are not compared.
+   */
+  su2double GetUnst_AdjointCheckpointVerify(void);
+  
+  /*!
+   * \brief Get whether the statistics of the AD tape are written after the recording.
+   * \return <code>TRUE</code> if the statistics are written; otherwise <code>FALSE</code>.
+   */
+  bool GetWrt_AD_Statistics(void);
+  
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -3763,6 +3838,42 @@ public:
    */
   su2double GetAcentric_Factor(void);
   
+  /*!
+   * \brief Get the analytic fluid model from which the look-up tables are generated.
+   * \return Kind of the donor fluid model.
+   */
+  unsigned short GetKind_LUT_Donor(void);
+  
+  /*!
+   * \brief Get the pressure range covered by the look-up tables.
+   * \return Pointer to the minimum and maximum pressure.
+   */
+  su2double* GetLUT_Pressure_Range(void);
+  
+  /*!
+   * \brief Get the temperature range covered by the look-up tables.
+   * \return Pointer to the minimum and maximum temperature.
+   */
+  su2double* GetLUT_Temperature_Range(void);
+  
+  /*!
+   * \brief Get the relative interpolation error that triggers a refinement of the look-up tables.
+   * \return Tolerance of the look-up tables.
+   */
+  su2double GetLUT_Tolerance(void);
+  
+  /*!
+   * \brief Get the maximum number of refinements of a root cell of the look-up tables.
+   * \return Maximum refinement level.
+   */
+  unsigned short GetLUT_MaxRefinement(void);
+  
+  /*!
+   * \brief Get the name of the file in which the look-up tables are stored.
+   * \return File name of the look-up tables.
+   */
+  string GetLUT_FileName(void);
+  
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -4013,6 +4124,72 @@ public:
    * \return Fill in level of the ILU preconditioner for the linear solver.
    */
   unsigned short GetLinear_Solver_ILU_n(void);
+  
+  /*!
+   * \brief Get the maximum number of levels of the AMG preconditioner.
+   * \return Maximum number of levels, including the finest.
+   */
+  unsigned short GetAMG_MaxLevels(void);
+  
+  /*!
+   * \brief Get the number of points below which an AMG level is not coarsened further.
+   * \return Minimum number of points of a level to be coarsened.
+   */
+  unsigned long GetAMG_MinPoints(void);
+  
+  /*!
+   * \brief Get the strength of connection threshold of the AMG aggregation.
+   * \return Threshold, a block is strong if |Aij| >= threshold*sqrt(|Aii||Ajj|).
+   */
+  su2double GetAMG_Strength(void);
+  
+  /*!
+   * \brief Get the largest ratio of coarse to fine points for which a coarse AMG level is kept.
+   * \return Coarsening ratio.
+   */
+  su2double GetAMG_CoarseningRatio(void);
+  
+  /*!
+   * \brief Get the number of symmetric Gauss-Seidel sweeps on the coarsest AMG level.
+   * \return Number of sweeps.
+   */
+  unsigned short GetAMG_CoarseSweeps(void);
+
+  /*!
+   * \brief Check if the preconditioner factors of the linear solver are stored in single precision.
+   * \return <code>TRUE</code> if the preconditioner uses single precision storage.
+   */
+  bool GetLinear_Solver_Mixed_Precision(void);
+
+  /*!
+   * \brief Get the maximum number of iterations between two assemblies of the flow Jacobian.
+   * \return 1 if the Jacobian and its preconditioner are assembled in every iteration.
+   */
+  unsigned long GetJacobian_Reuse_Freq(void);
+
+  /*!
+   * \brief Get the residual ratio (current over previous iteration) above which a frozen flow Jacobian is assembled again.
+   * \return Residual ratio that indicates a stalled convergence.
+   */
+  su2double GetJacobian_Reuse_Stall(void);
+
+  /*!
+   * \brief Check if the flow equations are solved with the Jacobian-free Newton-Krylov method.
+   * \return <code>TRUE</code> if the Jacobian-vector products are computed by finite differences of the residual.
+   */
+  bool GetNewton_Krylov(void);
+
+  /*!
+   * \brief Get the relative step of the finite difference Jacobian-vector products.
+   * \return Relative step of the Newton-Krylov method.
+   */
+  su2double GetNewton_Krylov_Step(void);
+
+  /*!
+   * \brief Get the number of iterations with the assembled Jacobian before starting the Newton-Krylov method.
+   * \return Number of start up iterations.
+   */
+  unsigned long GetNewton_Krylov_StartUp_Iter(void);
 
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
@@ -5248,6 +5425,42 @@ public:
    */
   bool GetWrt_Binary_Restart(void);
 
+  /*!
+   * \brief Flag for whether the restart and volume solution files are written asynchronously.
+   * \return <code>TRUE</code> if the files are written by a background thread while the solver continues.
+   */
+  bool GetWrt_Async_Output(void);
+
+  /*!
+   * \brief Flag for whether binary restart files are written in the chunked format.
+   * \return <code>TRUE</code> if the fields are written in separate (compressed) blocks that can be read individually.
+   */
+  bool GetWrt_Chunked_Restart(void);
+
+  /*!
+   * \brief Flag for whether the blocks of the chunked restart files are compressed.
+   * \return <code>TRUE</code> if the blocks are shuffled and compressed (lossless).
+   */
+  bool GetRestart_Compression(void);
+
+  /*!
+   * \brief Get the number of I/O aggregator ranks of the parallel binary files.
+   * \return Number of aggregators, 0 if every rank accesses the file.
+   */
+  unsigned long GetnIO_Aggregators(void);
+
+  /*!
+   * \brief Get the stripe size of the file system used to align the aggregated writes.
+   * \return Stripe size in bytes, 0 if unknown.
+   */
+  unsigned long GetIO_Stripe_Size(void);
+
+  /*!
+   * \brief Flag for whether the output mesh is written in the binary SU2 format.
+   * \return Flag for whether the output mesh is binary, if <code>TRUE</code> then MESH_OUT_FILENAME is written in the SU2_BINARY format.
+   */
+  bool GetWrt_Binary_Mesh(void);
+
   /*!
    * \brief Flag for whether binary SU2 native restart files are read.
    * \return Flag for whether binary SU2 native restart files are read, if <code>TRUE</code> then the code will load binary restart files.
@@ -8438,24 +8651,42 @@ public:
   su2double GetSpline(vector<su2double> &xa, vector<su2double> &ya, vector<su2double> &y2a, unsigned long n, su2double x);
 
   /*!
-   * \brief Start the timer for profiling subroutines.
+   * \brief Initialize the profiler and preregister the regions of ENUM_PROFILE_REGION.
+   */
+  void InitProfiling(void);
+
+  /*!
+   * \brief Register a profiled region (no-op if it already exists).
+   * \param[in] val_region_name - Name of the region.
+   * \param[in] val_group_id - Group ID of the region.
+   * \return ID of the region, to be used with Tock.
+   */
+  unsigned short RegisterProfileRegion(string val_region_name, int val_group_id);
+
+  /*!
+   * \brief Start the timer of a profiled region, regions can be nested.
    * \param[in] val_start_time - the value of the start time.
+   * \param[in] val_region_id - ID of the region.
    */
-  void Tick(double *val_start_time);
+  void Tick(double *val_start_time, unsigned short val_region_id);
 
   /*!
-   * \brief Stop the timer for profiling subroutines and store results.
+   * \brief Stop the timer of a profiled region and accumulate its statistics.
    * \param[in] val_start_time - the value of the start time.
-   * \param[in] val_function_name - string for the name of the profiled subroutine.
-   * \param[in] val_group_id - string for the name of the profiled subroutine.
+   * \param[in] val_region_id - ID of the region.
    */
-  void Tock(double val_start_time, string val_function_name, int val_group_id);
+  void Tock(double val_start_time, unsigned short val_region_id);
 
   /*!
    * \brief Write a CSV file containing the results of the profiling.
    */
   void SetProfilingCSV(void);
 
+  /*!
+   * \brief Write the timeline of the profiled regions of all ranks (Chrome trace format).
+   */
+  void SetProfilingTrace(void);
+
   /*!
    * \brief Start the timer for profiling subroutines.
    * \param[in] val_start_time - the value of the start time.
@@ -8517,6 +8748,13 @@ public:
    */
   bool GetDiscrete_Adjoint(void);
   
+  /*!
+   * \brief Set the indicator whether we are solving an discrete adjoint problem, e.g. to run
+   *        iterations of the direct problem as the direct solver does.
+   * \param[in] val_discrete_adjoint - the discrete adjoint indicator.
+   */
+  void SetDiscrete_Adjoint(bool val_discrete_adjoint);
+  
   /*!
    * \brief Get the indicator whether we want to benchmark the MPI performance of FSI problems
    * \return The value for checking
@@ -8873,6 +9111,12 @@ public:
    */
   unsigned short GetSizeMatMulPadding(void);
 
+  /*!
+   * \brief Function to make available the number of elements per chunk in the threaded DG task executor.
+   * \return The number of elements per chunk.
+   */
+  unsigned long GetElemChunkSize_DGFEM(void);
+
   /*!
    * \brief Function to make available whether or not the entropy must be computed.
    * \return The boolean whether or not the entropy must be computed.
@@ -8918,6 +9162,26 @@ public:
    */
   inline su2double GetRadialBasisFunctionParameter(void);
 
+  /*!
+   * \brief Get option of whether to solve the Radial Basis Function interpolation system in sparse form.
+   */
+  inline bool GetRadialBasisFunctionSparse(void);
+
+  /*!
+   * \brief Get the relative tolerance below which Radial Basis Function interpolation coefficients are pruned.
+   */
+  inline su2double GetRadialBasisFunctionPruneTol(void);
+
+  /*!
+   * \brief Get the radius, in support radii, of the patch of donor points of the sparse Radial Basis Function interpolation.
+   */
+  inline su2double GetRadialBasisFunctionPatch(void);
+
+  /*!
+   * \brief Get option of whether the sliding mesh interpolation is updated incrementally.
+   */
+  inline bool GetSlidingMesh_Incremental(void);
+
   /*!
    * \brief Get information about using UQ methodology
    * \return <code>TRUE</code> means that UQ methodology of eigenspace perturbation will be used
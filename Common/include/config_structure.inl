@@ -327,8 +327,20 @@ inline long CConfig::GetUnst_RestartIter(void) { return Unst_RestartIter; }
 
 inline long CConfig::GetUnst_AdjointIter(void) { return Unst_AdjointIter; }
 
+inline bool CConfig::GetUnst_AdjointCheckpointing(void) { return Unst_AdjointCheckpointing; }
+
+inline unsigned long CConfig::GetUnst_AdjointCheckpointFreq(void) { return Unst_AdjointCheckpointFreq; }
+
+inline unsigned long CConfig::GetUnst_AdjointSnapshots(void) { return Unst_AdjointSnapshots; }
+
+inline su2double CConfig::GetUnst_AdjointCheckpointVerify(void) { return Unst_AdjointCheckpointVerify; }
+
+inline bool CConfig::GetWrt_AD_Statistics(void) { return Wrt_AD_Statistics; }
+
 inline bool CConfig::GetReorientElements(void) { return ReorientElements; }
 
+inline unsigned short CConfig::GetKind_Renumbering(void) { return Kind_Renumbering; }
+
 inline unsigned long CConfig::GetIter_Avg_Objective(void) { return Iter_Avg_Objective ; }
 
 inline long CConfig::GetDyn_RestartIter(void) { return Dyn_RestartIter; }
@@ -873,6 +885,18 @@ inline su2double CConfig::GetTemperature_Critical(void) { return Temperature_Cri
 
 inline su2double CConfig::GetAcentric_Factor(void) { return Acentric_Factor; }
 
+inline unsigned short CConfig::GetKind_LUT_Donor(void) { return Kind_LUT_Donor; }
+
+inline su2double* CConfig::GetLUT_Pressure_Range(void) { return LUT_Pressure_Range; }
+
+inline su2double* CConfig::GetLUT_Temperature_Range(void) { return LUT_Temperature_Range; }
+
+inline su2double CConfig::GetLUT_Tolerance(void) { return LUT_Tolerance; }
+
+inline unsigned short CConfig::GetLUT_MaxRefinement(void) { return LUT_MaxRefinement; }
+
+inline string CConfig::GetLUT_FileName(void) { return LUT_FileName; }
+
 inline unsigned short CConfig::GetKind_ViscosityModel(void) { return Kind_ViscosityModel; }
 
 inline unsigned short CConfig::GetKind_ConductivityModel(void) { return Kind_ConductivityModel; }
@@ -1029,6 +1053,28 @@ inline unsigned long CConfig::GetDeform_Linear_Solver_Iter(void) { return Deform
 
 inline unsigned short CConfig::GetLinear_Solver_ILU_n(void) { return Linear_Solver_ILU_n; }
 
+inline unsigned short CConfig::GetAMG_MaxLevels(void) { return AMG_MaxLevels; }
+
+inline unsigned long CConfig::GetAMG_MinPoints(void) { return AMG_MinPoints; }
+
+inline su2double CConfig::GetAMG_Strength(void) { return AMG_Strength; }
+
+inline su2double CConfig::GetAMG_CoarseningRatio(void) { return AMG_CoarseningRatio; }
+
+inline unsigned short CConfig::GetAMG_CoarseSweeps(void) { return AMG_CoarseSweeps; }
+
+inline bool CConfig::GetLinear_Solver_Mixed_Precision(void) { return Linear_Solver_Mixed_Precision; }
+
+inline unsigned long CConfig::GetJacobian_Reuse_Freq(void) { return Jacobian_Reuse_Freq; }
+
+inline su2double CConfig::GetJacobian_Reuse_Stall(void) { return Jacobian_Reuse_Stall; }
+
+inline bool CConfig::GetNewton_Krylov(void) { return Newton_Krylov; }
+
+inline su2double CConfig::GetNewton_Krylov_Step(void) { return Newton_Krylov_Step; }
+
+inline unsigned long CConfig::GetNewton_Krylov_StartUp_Iter(void) { return Newton_Krylov_StartUp_Iter; }
+
 inline unsigned long CConfig::GetLinear_Solver_Restart_Frequency(void) { return Linear_Solver_Restart_Frequency; }
 
 inline su2double CConfig::GetRelaxation_Factor_Flow(void) { return Relaxation_Factor_Flow; }
@@ -1319,6 +1365,18 @@ inline bool CConfig::GetRestart(void) {	return Restart; }
 
 inline bool CConfig::GetWrt_Binary_Restart(void) {	return Wrt_Binary_Restart; }
 
+inline bool CConfig::GetWrt_Async_Output(void) {	return Wrt_Async_Output; }
+
+inline bool CConfig::GetWrt_Chunked_Restart(void) {	return Wrt_Chunked_Restart; }
+
+inline bool CConfig::GetRestart_Compression(void) {	return Restart_Compression; }
+
+inline unsigned long CConfig::GetnIO_Aggregators(void) {	return IO_Aggregators; }
+
+inline unsigned long CConfig::GetIO_Stripe_Size(void) {	return IO_Stripe_Size; }
+
+inline bool CConfig::GetWrt_Binary_Mesh(void) {	return Wrt_Binary_Mesh; }
+
 inline bool CConfig::GetRead_Binary_Restart(void) {	return Read_Binary_Restart; }
 
 inline bool CConfig::GetRestart_Flow(void) { return Restart_Flow; }
@@ -1930,6 +1988,14 @@ inline bool CConfig::GetRadialBasisFunctionPolynomialOption(void) {return Radial
 
 inline su2double CConfig::GetRadialBasisFunctionParameter(void) {return RadialBasisFunction_Parameter; }
 
+inline bool CConfig::GetRadialBasisFunctionSparse(void) {return RadialBasisFunction_Sparse; }
+
+inline su2double CConfig::GetRadialBasisFunctionPruneTol(void) {return RadialBasisFunction_PruneTol; }
+
+inline su2double CConfig::GetRadialBasisFunctionPatch(void) {return RadialBasisFunction_Patch; }
+
+inline bool CConfig::GetSlidingMesh_Incremental(void) {return SlidingMesh_Incremental; }
+
 inline bool CConfig::GetConservativeInterpolation(void) { return ConservativeInterpolation; }
 
 inline unsigned short CConfig::GetRelaxation_Method_FSI(void) { return Kind_BGS_RelaxMethod; }
@@ -1960,6 +2026,8 @@ inline unsigned short CConfig::GetDirectDiff() { return DirectDiff;}
 
 inline bool CConfig::GetDiscrete_Adjoint() { return DiscreteAdjoint;}
 
+inline void CConfig::SetDiscrete_Adjoint(bool val_discrete_adjoint) { DiscreteAdjoint = val_discrete_adjoint; }
+
 inline unsigned short CConfig::GetRiemann_Solver_FEM(void) {return Riemann_Solver_FEM;}
 
 inline su2double CConfig::GetQuadrature_Factor_Straight(void) {return Quadrature_Factor_Straight;}
@@ -1972,6 +2040,8 @@ inline su2double CConfig::GetTheta_Interior_Penalty_DGFEM(void) {return Theta_In
 
 inline unsigned short CConfig::GetSizeMatMulPadding(void) {return sizeMatMulPadding;}
 
+inline unsigned long CConfig::GetElemChunkSize_DGFEM(void) {return ElemChunkSize_DGFEM;}
+
 inline bool CConfig::GetCompute_Entropy(void) {return Compute_Entropy;}
 
 inline bool CConfig::GetUse_Lumped_MassMatrix_DGFEM(void) {return Use_Lumped_MassMatrix_DGFEM;}
@@ -63,6 +63,15 @@
 
 typedef double passivedouble;
 
+/*--- Reduced precision type for data whose accuracy is not critical (e.g. the preconditioners of the linear
+ * solvers). In AD builds it falls back to su2double, so that the data remains active. ---*/
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+typedef su2double su2mixedfloat;
+#else
+typedef float su2mixedfloat;
+#endif
+
 /*!
  * \namespace SU2_TYPE
  * \brief Namespace for defining the datatype wrapper routines; this class features as a base class for
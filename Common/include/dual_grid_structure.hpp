@@ -44,6 +44,7 @@
 #include <iostream>
 #include <cstdlib>
 #include <vector>
+#include <algorithm>
 
 #include "config_structure.hpp"
 
@@ -343,6 +344,12 @@ public:
 	 */
 	void ResetPoint(void);
 
+  /*!
+	 * \brief Sort the points that compose the control volume by increasing index, so that
+	 *        the edges are later numbered in the order of the points. Must be called before the edges are set.
+	 */
+	void SortPoint(void);
+
 	/*! 
 	 * \brief Set the points that compose the control volume.
 	 * \param[in] val_point - Point to be added.		 
@@ -45,6 +45,8 @@ inline void CPoint::ResetElem(void) { Elem.clear(); nElem = 0; }
 
 inline void CPoint::ResetPoint(void) { Point.clear(); Edge.clear(); nPoint = 0; }
 
+inline void CPoint::SortPoint(void) { sort(Point.begin(), Point.end()); }
+
 inline su2double CPoint::GetCoord(unsigned short val_dim) { return Coord[val_dim]; }
 
 inline su2double *CPoint::GetCoord(void) { return Coord; }
@@ -64,8 +64,11 @@ extern "C" {
 #include "primal_grid_structure.hpp"
 #include "dual_grid_structure.hpp"
 #include "config_structure.hpp"
+#include "chunked_restart_structure.hpp"
 #include "fem_standard_element.hpp"
 
+class CADTElemClass;
+
 using namespace std;
 
 /*!
@@ -371,6 +374,37 @@ public:
 #endif
 #endif
   
+  /*--- Data structures for point-to-point MPI communications (halo exchange). ---*/
+  
+  bool P2PComms_Preprocessed;      /*!< \brief Flag to indicate whether the point-to-point comm. pattern has been built. */
+  int countPerPoint;               /*!< \brief Maximum number of pieces of data sent per vertex in point-to-point comms. */
+  int nP2PSend;                    /*!< \brief Number of sends (send markers) during point-to-point comms. */
+  int nP2PRecv;                    /*!< \brief Number of receives (receive markers) during point-to-point comms. */
+  int *nPoint_P2PSend;             /*!< \brief Number of vertices for each send in point-to-point comms (cumulative storage format). */
+  int *nPoint_P2PRecv;             /*!< \brief Number of vertices for each recv in point-to-point comms (cumulative storage format). */
+  int *Neighbors_P2PSend;          /*!< \brief Rank of the destination of each send in point-to-point comms. */
+  int *Neighbors_P2PRecv;          /*!< \brief Rank of the source of each recv in point-to-point comms. */
+  unsigned long *Local_Point_P2PSend;       /*!< \brief Local index of the points to be packed in the send buffer. */
+  unsigned long *Local_Point_P2PRecv;       /*!< \brief Local index of the points to be unpacked from the recv buffer. */
+  unsigned short *Local_Rotation_P2PRecv;   /*!< \brief Periodic rotation type of the points in the recv buffer. */
+  su2double *bufD_P2PSend;         /*!< \brief Preallocated send buffer (su2double) for point-to-point comms. */
+  su2double *bufD_P2PRecv;         /*!< \brief Preallocated recv buffer (su2double) for point-to-point comms. */
+  SU2_MPI::Request *req_P2PSend;   /*!< \brief Send requests of the communication currently in flight. */
+  SU2_MPI::Request *req_P2PRecv;   /*!< \brief Recv requests of the communication currently in flight. */
+  map<unsigned short, SU2_MPI::Request*> req_P2PPersistent;  /*!< \brief Persistent requests (sends followed by recvs) for each message size. */
+  
+  /*--- Edge coloring for the threaded (shared-memory) edge loops. ---*/
+  
+  unsigned short nEdgeColor;       /*!< \brief Number of edge colors (0 if the edges have not been colored). */
+  unsigned long *EdgeColorStart;   /*!< \brief Start of each color in EdgeColorList (cumulative storage format, size nEdgeColor+1). */
+  unsigned long *EdgeColorList;    /*!< \brief Edge indices grouped by color, edges of the same color share no point. */
+  
+  /*--- Geometric weights of the least-squares gradients, shared by all the solvers of the zone. ---*/
+  
+  bool LSWeights_Updated;          /*!< \brief Whether the least-squares weights correspond to the current coordinates. */
+  unsigned long *LSWeightsStart;   /*!< \brief Start of the weights of each point in LSWeights (cumulative storage format, size nPointDomain+1). */
+  su2double *LSWeights;            /*!< \brief Least-squares weights (nDim per neighbor), in the order of the neighbors of each point. */
+  
 	/*!
 	 * \brief Constructor of the class.
 	 */
@@ -380,6 +414,82 @@ public:
 	 * \brief Destructor of the class.
 	 */
 	virtual ~CGeometry(void);
+  
+  /*!
+   * \brief Build the point-to-point communication pattern (halo exchange) from the SEND_RECEIVE markers.
+   *        Meant to be called once after partitioning; the result is reused by every solver living on this grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PreprocessP2PComms(CConfig *config);
+  
+  /*!
+   * \brief Make sure the point-to-point buffers can hold the requested amount of data per vertex.
+   * \param[in] val_countPerPoint - Number of su2double values sent per vertex.
+   */
+  void AllocateP2PComms(unsigned short val_countPerPoint);
+  
+  /*!
+   * \brief Post all the receives and sends of a point-to-point exchange at once (non-blocking).
+   *        The send buffer bufD_P2PSend must have been packed by the caller.
+   * \param[in] val_countPerPoint - Number of su2double values sent per vertex.
+   */
+  void StartP2PComms(unsigned short val_countPerPoint);
+  
+  /*!
+   * \brief Wait for the completion of the point-to-point exchange launched with StartP2PComms().
+   *        On return bufD_P2PRecv can be unpacked.
+   */
+  void CompleteP2PComms(void);
+  
+  /*!
+   * \brief Release the persistent requests and buffers used by the point-to-point comms.
+   */
+  void FreeP2PComms(void);
+  
+  /*!
+   * \brief Greedy edge coloring: group the edges such that no two edges of one color share a point.
+   *        The edges of a color can then be processed concurrently by several threads, each one
+   *        scattering its residual and Jacobian contributions without write conflicts.
+   */
+  void SetEdgeColoring(void);
+  
+  /*!
+   * \brief Get the number of edge colors.
+   * \return Number of colors (0 if the edges have not been colored).
+   */
+  unsigned short GetnEdgeColor(void);
+  
+  /*!
+   * \brief Get the position in the colored edge list where a color starts.
+   * \param[in] val_color - Color (val_color = nEdgeColor returns the end of the last color).
+   * \return Position in the colored edge list.
+   */
+  unsigned long GetEdgeColorStart(unsigned short val_color);
+  
+  /*!
+   * \brief Get an edge from the colored edge list.
+   * \param[in] val_index - Position in the colored edge list.
+   * \return Index of the edge.
+   */
+  unsigned long GetEdgeColorList(unsigned long val_index);
+
+  /*!
+   * \brief Compute the geometric weights of the least-squares gradients, S_i*(x_j-x_i)/|x_j-x_i|^2 for
+   *        each neighbor j of each point i, with S_i the inverse of the least-squares matrix of the point.
+   *        The gradient of any variable is then the sum of these weights times the differences of the
+   *        variable. Nothing is done if the weights are up to date, i.e. they are only recomputed after
+   *        the grid moved (or always for the discrete adjoint, to record them).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLSWeights(CConfig *config);
+
+  /*!
+   * \brief Get the least-squares weights of a neighbor of a point.
+   * \param[in] val_point - Point.
+   * \param[in] val_neigh - Neighbor, in the order of CPoint::GetPoint.
+   * \return Pointer to the nDim weights.
+   */
+  su2double *GetLSWeights(unsigned long val_point, unsigned short val_neigh);
 
 	/*! 
 	 * \brief Get number of coordinates.
@@ -610,6 +720,17 @@ public:
    * \param[in] config - Definition of the particular problem.
 	 */
 	virtual void SetRCM_Ordering(CConfig *config);
+
+  /*!
+	 * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+	 */
+	virtual void SetHilbert_Ordering(CConfig *config);
+
+  /*!
+	 * \brief A virtual member.
+	 */
+	virtual void SortPoint_Connectivity(void);
   
 	/*!
 	 * \brief A virtual member.
@@ -1646,6 +1767,9 @@ class CPhysicalGeometry : public CGeometry {
   unsigned long *Elem_ID_BoundTria_Linear;
   unsigned long *Elem_ID_BoundQuad_Linear;
 
+  vector<passivedouble> WallDist_Coor;     /*!< \brief Coordinates of the points at the last wall distance computation. */
+  vector<passivedouble> WallDist_SurfCoor; /*!< \brief Coordinates of the local wall points at the last wall distance computation. */
+
 public:
   
 	/*!
@@ -1833,6 +1957,29 @@ public:
    */
   void Read_SU2_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
 
+  /*!
+   * \brief Reads a binary SU2 mesh in parallel. Every rank reads only its linear partition
+   *        of the points and elements at explicit offsets (MPI-IO), the elements are then
+   *        exchanged so that each rank holds all the elements touching its points.
+   *
+   *        File layout (unsigned long integers and doubles in native byte order):
+   *        - header of SU2_BINARY_MESH_HEADER integers: ID, version, nDim, nPoint, nPointDomain,
+   *          nElem, nMarker, nPeriodic, offsets of the coordinates, element offsets, element
+   *          connectivity and markers, size of the marker block, offset of the periodic info;
+   *        - AoA and AoS offsets (2 doubles);
+   *        - coordinates (nPoint*nDim doubles);
+   *        - element offsets (nElem+1 integers) into the connectivity, which holds the VTK type
+   *          followed by the nodes of each element;
+   *        - markers, each with a tag of SU2_BINARY_MESH_TAG_SIZE chars, the number of elements,
+   *          the SEND_TO value and the elements (VTK type followed by the nodes);
+   *        - periodic center, rotation and translation (nPeriodic*9 doubles).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_iZone - Domain to be read from the grid file.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   */
+  void Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
+
   /*!
    * \brief Reads the geometry of the grid and adjust the boundary
    *        conditions with the configuration file in parallel (for parmetis).
@@ -1881,6 +2028,32 @@ public:
 	 */
 	void ComputeWall_Distance(CConfig *config);
 
+  /*!
+   * \brief Determine the points whose wall distance must be (re)computed, i.e. all points on the
+   *        first call and, after a mesh deformation, the points that moved or that may now be
+   *        closer to a moved wall element than to their previous nearest wall element.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] surfaceCoor - Coordinates of the local wall points.
+   * \param[in] surfaceConn - Connectivity of the local wall elements.
+   * \param[in] VTK_TypeElem - Type of the local wall elements.
+   * \param[out] pointList - Points whose wall distance must be computed.
+   */
+  void SetWall_Distance_Points(CConfig *config, const vector<su2double> &surfaceCoor,
+                               const vector<unsigned long> &surfaceConn,
+                               const vector<unsigned short> &VTK_TypeElem,
+                               vector<unsigned long> &pointList);
+
+  /*!
+   * \brief Compute the wall distance of the given points with an ADT of the local wall elements
+   *        only. Points are queried against the other ranks whose wall elements may be closer than
+   *        the local ones, in a single batched exchange.
+   * \param[in] WallADT - ADT of the wall elements of this rank.
+   * \param[in] wallBBox - Bounding box (min, max) of the wall elements of this rank.
+   * \param[in] pointList - Points whose wall distance must be computed.
+   */
+  void ComputeWall_Distance_Distributed(CADTElemClass &WallADT, vector<su2double> &wallBBox,
+                                        const vector<unsigned long> &pointList);
+
 	/*! 
 	 * \brief Compute surface area (positive z-direction) for force coefficient non-dimensionalization.
 	 * \param[in] config - Definition of the particular problem.
@@ -1897,6 +2070,25 @@ public:
    * \param[in] config - Definition of the particular problem.
 	 */
 	void SetRCM_Ordering(CConfig *config);
+
+  /*!
+	 * \brief Set a renumbering of the domain points along a Hilbert space-filling curve through their coordinates.
+   * \param[in] config - Definition of the particular problem.
+	 */
+	void SetHilbert_Ordering(CConfig *config);
+
+  /*!
+	 * \brief Sort the points which surround each point by increasing index, so that the edges
+	 *        are numbered in the order of the points. Must be called before the edges are set.
+	 */
+	void SortPoint_Connectivity(void);
+
+  /*!
+	 * \brief Apply a renumbering of the points to the coordinates, the global indices and the element connectivities.
+   * \param[in] Result - Old index of the point that takes each new position (halo points must stay at the end).
+   * \param[in] config - Definition of the particular problem.
+	 */
+	void SetPoint_Ordering(const vector<unsigned long> & Result, CConfig *config);
   
 	/*!
 	 * \brief Function declaration to avoid partially overridden classes.
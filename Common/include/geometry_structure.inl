@@ -163,6 +163,10 @@ inline void CGeometry::SetPoint_Connectivity(void) { }
 
 inline void CGeometry::SetRCM_Ordering(CConfig *config) { }
 
+inline void CGeometry::SetHilbert_Ordering(CConfig *config) { }
+
+inline void CGeometry::SortPoint_Connectivity(void) { }
+
 inline void CGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) { }
 
 inline void CGeometry::SetCoord(CGeometry *geometry) { }
@@ -225,6 +229,14 @@ inline void CGeometry::SetnVertexSpanMax(unsigned short marker_flag, unsigned lo
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline unsigned short CGeometry::GetnEdgeColor(void) { return nEdgeColor; }
+
+inline unsigned long CGeometry::GetEdgeColorStart(unsigned short val_color) { return EdgeColorStart[val_color]; }
+
+inline unsigned long CGeometry::GetEdgeColorList(unsigned long val_index) { return EdgeColorList[val_index]; }
+
+inline su2double* CGeometry::GetLSWeights(unsigned long val_point, unsigned short val_neigh) { return &LSWeights[nDim*(LSWeightsStart[val_point]+val_neigh)]; }
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) { return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
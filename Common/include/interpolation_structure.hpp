@@ -49,6 +49,7 @@
 #include "config_structure.hpp"
 #include "geometry_structure.hpp"
 #include "vector_structure.hpp"
+#include "adt_structure.hpp"
 
 #ifdef HAVE_LAPACK
 /*--- Lapack / Blas routines used in RBF interpolation. ---*/
@@ -191,6 +192,15 @@ public:
    */
   void Collect_VertexInfo(bool faces, int markDonor, int markTarget, unsigned long nVertexDonor, unsigned short nDim);
 
+  /*!
+   * \brief Extract the donor vertices collected by Collect_VertexInfo, without the padding of the
+   *        receive buffers, e.g. to build an ADT of the donor points or a map of their global indices.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[out] val_coor - Coordinates of the donor vertices.
+   * \param[out] val_index - Position of the donor vertices in the receive buffers.
+   */
+  void Collect_DonorPoints(unsigned short nDim, vector<su2double> &val_coor, vector<unsigned long> &val_index);
+
 };
 
 /*!
@@ -306,6 +316,56 @@ public:
  * \brief Sliding mesh approach
   */
 class CSlidingMesh : public CInterpolator {
+protected:
+
+  /*!
+   * \brief Gathered connectivity of one side of a sliding interface.
+   */
+  struct CInterfaceSide {
+    unsigned long nGlobalVertex;              /*!< \brief Global number of vertices of the boundary. */
+    vector<unsigned long> GlobalPoint,        /*!< \brief Global index of the vertices. */
+    Proc,                                     /*!< \brief Rank that owns the vertices. */
+    nLinkedNodes,                             /*!< \brief Number of boundary neighbors of the vertices. */
+    StartLinkedNodes,                         /*!< \brief Start of the neighbors of the vertices in LinkedNodes. */
+    LinkedNodes;                              /*!< \brief Boundary neighbors of the vertices. */
+  };
+
+  bool Incremental;                           /*!< \brief Reuse the connectivity and the donor search of the previous update. */
+  vector<bool> InterfaceStored;               /*!< \brief Whether the connectivity of an interface has been stored. */
+  vector<CInterfaceSide> TargetSide,          /*!< \brief Stored target side of each interface. */
+  DonorSide;                                  /*!< \brief Stored donor side of each interface. */
+  vector<vector<unsigned long> > TargetGlobalVertex, /*!< \brief Position of the local target vertices in the gathered target boundary. */
+  DonorClosestPoint;                          /*!< \brief Closest donor point of the local target vertices at the previous update. */
+
+  /*!
+   * \brief Store the boundary gathered by ReconstructBoundary.
+   * \param[out] side - Container for the connectivity.
+   */
+  void StoreBoundary(CInterfaceSide &side);
+
+  /*!
+   * \brief Gather the coordinates of a boundary in the order of ReconstructBoundary.
+   * \param[in] val_zone   - index of the zone
+   * \param[in] val_marker - index of the marker
+   * \param[in] val_nGlobalVertex - global number of vertices of the boundary
+   * \return Coordinates of all vertices of the boundary, to be deleted by the caller.
+   */
+  su2double* GatherBoundaryCoord(unsigned long val_zone, int val_marker, unsigned long val_nGlobalVertex);
+
+  /*!
+   * \brief Find the donor point closest to a given point.
+   * \param[in] Coord - coordinates of the query point
+   * \param[in] DonorCoord - coordinates of the donor boundary
+   * \param[in] nDonor - number of points of the donor boundary
+   * \param[in] nLinkedNodes - number of boundary neighbors of the donor points
+   * \param[in] StartLinkedNodes - start of the neighbors of the donor points
+   * \param[in] LinkedNodes - boundary neighbors of the donor points
+   * \param[in] val_guess - closest donor of a previous update, if larger than nDonor a full search is made
+   * \return Index of the closest donor point.
+   */
+  unsigned long FindClosestDonor(su2double *Coord, su2double *DonorCoord, unsigned long nDonor, unsigned long *nLinkedNodes,
+                                 unsigned long *StartLinkedNodes, unsigned long *LinkedNodes, unsigned long val_guess);
+
 public:
 
   /*!
@@ -446,6 +506,25 @@ private:
    */
   void Check_PolynomialTerms(int m, unsigned long n, const int *skip_row, su2double max_diff_tol_in, int *keep_row, int &n_polynomial, su2double *P);
 
+  /*!
+   * \brief Set up the transfer matrix with a basis function of compact support. The weights of each target point are
+   * obtained from the donor points of a patch around it, whose interpolation matrix is assembled in sparse form.
+   * \param[in] config - Definition of the particular problem (donor zone).
+   * \param[in] mark_target - Index of the target marker.
+   * \param[in] nVertexTarget - Number of vertices of the target marker.
+   * \param[in] nDim - Number of physical dimensions.
+   */
+  void Set_SparseTransferCoeff(CConfig *config, int mark_target, unsigned long nVertexTarget, unsigned short nDim);
+
+  /*!
+   * \brief Discard the coefficients smaller than a fraction of the largest one, the remaining coefficients are
+   * scaled such that their sum is not changed (this keeps the interpolation of constant fields exact).
+   * \param[in] tol - Fraction of the largest coefficient (in absolute value) below which coefficients are discarded.
+   * \param[in] n - Number of coefficients.
+   * \param[in,out] coeff - The coefficients, discarded ones are set to 0.
+   */
+  void Prune_Coefficients(su2double tol, unsigned long n, su2double *coeff);
+
 };
 
 /*!
@@ -503,3 +582,101 @@ class CSymmetricMatrix{
     void Invert(const bool is_spd);
 
 };
+
+/*!
+ * \brief Helper class used by CRadialBasisFunction to solve the interpolation system of basis functions of compact support.
+ * The matrix is stored in compressed row format (all entries, not only one triangle) and the systems are solved with the
+ * Jacobi preconditioned conjugate gradient method. It holds the donor points of the patch of one target point.
+ */
+class CSparseSymmetricMatrix{
+
+  private:
+
+    unsigned long sz;
+    vector<unsigned long> row_ptr, col_ind;
+    vector<passivedouble> val_vec, inv_diag;
+    vector<passivedouble> r, z, p, Ap; // work vectors of the conjugate gradient method
+    vector<passivedouble> dense_inv;   // inverse of the matrix, formed only if the iterative method fails
+
+    void MatVecMult(const passivedouble *v, passivedouble *prod) const;
+
+  public:
+
+    /*--- Methods ---*/
+    CSparseSymmetricMatrix();
+
+    /*!
+     * \brief Set the matrix from its compressed row representation, the vectors are swapped into the class.
+     * \param[in] N - Size of the matrix.
+     * \param[in,out] val_row_ptr - Start of each row in col_ind and val (N+1 entries).
+     * \param[in,out] val_col_ind - Column indices of the non zeros.
+     * \param[in,out] val - Values of the non zeros.
+     */
+    void Initialize(unsigned long N, vector<unsigned long> &val_row_ptr, vector<unsigned long> &val_col_ind, vector<passivedouble> &val);
+
+    inline unsigned long GetSize() const { return sz; }
+
+    /*!
+     * \brief Solve A x = b, starting from x = 0.
+     * \param[in] b - Right hand side.
+     * \param[out] x - Solution.
+     * \param[in] tol - Tolerance on the norm of the residual relative to the norm of b.
+     * \param[in] max_iter - Maximum number of iterations.
+     * \return True if the tolerance was reached.
+     */
+    bool Solve(const passivedouble *b, passivedouble *x, passivedouble tol, unsigned long max_iter);
+
+    /*!
+     * \brief Solve A x = b with the dense inverse of the matrix, which is formed on the first call after Initialize.
+     * \param[in] b - Right hand side.
+     * \param[out] x - Solution.
+     */
+    void SolveDense(const passivedouble *b, passivedouble *x);
+
+};
+
+/*!
+ * \brief Helper class used by CRadialBasisFunction to find the points within the support radius of a basis function
+ * of compact support. The points are sorted into a uniform grid of bins no smaller than the radius, such that only the
+ * bins around the query point need to be searched.
+ */
+class CRadialBasisSupport{
+
+  private:
+
+    unsigned short nDim;
+    su2double radius;
+    const su2double *coord;
+    passivedouble min_coord[3], bin_size[3];
+    unsigned long nBin[3];
+    vector<pair<unsigned long, unsigned long> > bin_point; // (bin, point) sorted by bin
+
+  public:
+
+    /*!
+     * \brief Constructor of the class, the coordinates are not copied.
+     * \param[in] val_nDim - Number of physical dimensions.
+     * \param[in] nPoint - Number of points.
+     * \param[in] val_coord - Coordinates of the points (nDim per point).
+     * \param[in] val_radius - Support radius.
+     */
+    CRadialBasisSupport(unsigned short val_nDim, unsigned long nPoint, const su2double *val_coord, su2double val_radius);
+
+    /*!
+     * \brief Find the points closer to coor than the support radius.
+     * \param[in] coor - Coordinates of the query point.
+     * \param[out] points - Indices of the points found, in ascending order.
+     * \param[out] dist - Distance from the query point to each point found.
+     */
+    void FindPoints(const su2double *coor, vector<unsigned long> &points, vector<su2double> &dist) const;
+
+    /*!
+     * \brief Find the points closer to coor than a search radius, which may exceed the support radius.
+     * \param[in] coor - Coordinates of the query point.
+     * \param[in] search_radius - Search radius.
+     * \param[out] points - Indices of the points found, in ascending order.
+     * \param[out] dist - Distance from the query point to each point found.
+     */
+    void FindPoints(const su2double *coor, su2double search_radius, vector<unsigned long> &points, vector<su2double> &dist) const;
+
+};
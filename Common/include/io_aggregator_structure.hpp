@@ -0,0 +1,240 @@
+/*!
+ * \file io_aggregator_structure.hpp
+ * \brief Headers of the class for the parallel file I/O through a set of aggregator ranks.
+ *        The subroutines and functions are in the <i>io_aggregator_structure.cpp</i> file.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "./mpi_structure.hpp"
+#include "./option_structure.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+#ifdef HAVE_MPI
+
+/*!
+ * \class CIOAggregator
+ * \brief Parallel file I/O in which only a subset of the ranks accesses the file system.
+ *        The ranks are split into contiguous groups, the first rank of each group is the
+ *        aggregator of the group. The aggregators collect the data of their group, so that
+ *        the file system sees few large (stripe aligned) requests instead of one small request
+ *        per rank. When the number of aggregators is zero every rank is its own aggregator.
+ * \author SU2 contributors
+ */
+class CIOAggregator {
+
+private:
+
+  int rank,                /*!< \brief MPI rank of this process. */
+  size;                    /*!< \brief Number of MPI ranks. */
+  int nGroup,              /*!< \brief Number of groups, i.e. the actual number of aggregators. */
+  groupSize,               /*!< \brief Number of ranks in a group (the last group may be smaller). */
+  groupID;                 /*!< \brief Group of this rank, also its index among the aggregators. */
+  bool isAggregator;       /*!< \brief Whether this rank is the aggregator of its group. */
+  unsigned long stripeSize; /*!< \brief Stripe size of the file system in bytes (0 if unknown). */
+
+  MPI_Comm aggrComm;       /*!< \brief Communicator of the aggregators (MPI_COMM_NULL on the other ranks). */
+  MPI_Info fileInfo;       /*!< \brief Hints passed to MPI when opening files. */
+  MPI_File fhw;            /*!< \brief File handle, only valid on the aggregators. */
+  bool fileOpen;           /*!< \brief Whether fhw is open on this rank. */
+
+  /*!
+   * \brief Redistribute the contiguous data held by the aggregators such that the range written by
+   *        each of them starts at a stripe boundary. Collective over the aggregators.
+   * \param[in,out] disp - Offset in the file of the data in buffer, modified to the new offset.
+   * \param[in,out] buffer - Data of the aggregator, replaced by the redistributed data.
+   */
+  void AlignToStripes(MPI_Offset &disp, vector<char> &buffer);
+
+  /*!
+   * \brief Collective write of the aggregators in chunks that fit an int count.
+   * \param[in] disp - Offset in the file, in bytes.
+   * \param[in] buf - Data to write.
+   * \param[in] nBytes - Number of bytes to write.
+   */
+  void WriteChunks(MPI_Offset disp, const char *buf, unsigned long nBytes);
+
+  /*!
+   * \brief Collective read of the aggregators in chunks that fit an int count.
+   * \param[in] disp - Offset in the file, in bytes.
+   * \param[out] buf - Data read.
+   * \param[in] nBytes - Number of bytes to read.
+   */
+  void ReadChunks(MPI_Offset disp, char *buf, unsigned long nBytes);
+
+  /*!
+   * \brief Non-blocking send of a byte buffer as messages whose counts fit an int.
+   * \param[in] buf - Data to send.
+   * \param[in] nBytes - Number of bytes to send.
+   * \param[in] dest - Destination rank in comm.
+   * \param[in] tag - Tag of the messages.
+   * \param[in] comm - Communicator.
+   * \param[in,out] req - Requests of the messages are appended.
+   */
+  static void IsendBytes(const char *buf, unsigned long nBytes, int dest, int tag,
+                         MPI_Comm comm, vector<MPI_Request> &req);
+
+  /*!
+   * \brief Non-blocking receive of a byte buffer sent with IsendBytes.
+   * \param[out] buf - Received data.
+   * \param[in] nBytes - Number of bytes to receive.
+   * \param[in] source - Source rank in comm.
+   * \param[in] tag - Tag of the messages.
+   * \param[in] comm - Communicator.
+   * \param[in,out] req - Requests of the messages are appended.
+   */
+  static void IrecvBytes(char *buf, unsigned long nBytes, int source, int tag,
+                         MPI_Comm comm, vector<MPI_Request> &req);
+
+  /*!
+   * \brief Copy constructor and assignment operator, disabled (the class owns MPI handles).
+   */
+  CIOAggregator(const CIOAggregator &);
+  CIOAggregator& operator=(const CIOAggregator &);
+
+public:
+
+  /*!
+   * \brief Constructor of the class, collective over MPI_COMM_WORLD.
+   * \param[in] val_nAggregator - Requested number of aggregators (0 for every rank).
+   * \param[in] val_stripeSize - Stripe size of the file system in bytes (0 if unknown).
+   */
+  CIOAggregator(unsigned long val_nAggregator, unsigned long val_stripeSize);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CIOAggregator(void);
+
+  /*!
+   * \brief Open a file on the aggregators, collective over all ranks. Files opened for
+   *        writing are always created from scratch.
+   * \param[in] val_filename - Name of the file.
+   * \param[in] val_write - Whether the file is opened for writing or for reading.
+   * \return True on all ranks if the file was opened successfully.
+   */
+  bool Open(const char *val_filename, bool val_write);
+
+  /*!
+   * \brief Close the file, collective over all ranks.
+   */
+  void Close(void);
+
+  /*!
+   * \brief Write data at an offset, only the master rank writes (e.g. headers).
+   * \param[in] disp - Offset in the file, in bytes.
+   * \param[in] buf - Data to write.
+   * \param[in] nBytes - Number of bytes to write.
+   */
+  void WriteAt_Master(MPI_Offset disp, const void *buf, unsigned long nBytes);
+
+  /*!
+   * \brief Read data at an offset, only the master rank reads (e.g. headers).
+   * \param[in] disp - Offset in the file, in bytes.
+   * \param[out] buf - Data read.
+   * \param[in] nBytes - Number of bytes to read.
+   */
+  void ReadAt_Master(MPI_Offset disp, void *buf, unsigned long nBytes);
+
+  /*!
+   * \brief Independent read on the aggregators, the other ranks return immediately.
+   * \param[in] disp - Offset in the file, in bytes.
+   * \param[out] buf - Data read.
+   * \param[in] nBytes - Number of bytes to read.
+   */
+  void ReadAt_Aggregator(MPI_Offset disp, void *buf, unsigned long nBytes);
+
+  /*!
+   * \brief Collective write of a contiguous chunk per rank. The chunks of the ranks must
+   *        follow each other in the file in the order of the ranks (linear partitions).
+   * \param[in] disp - Offset in the file of the chunk of this rank, in bytes.
+   * \param[in] buf - Data of this rank.
+   * \param[in] nBytes - Number of bytes of this rank.
+   */
+  void WriteAt_All(MPI_Offset disp, const void *buf, unsigned long nBytes);
+
+  /*!
+   * \brief Collective read of a set of fixed size records, e.g. the points of a restart file.
+   * \param[in] disp - Offset in the file of the first record, in bytes.
+   * \param[in] recordBytes - Size of a record, in bytes.
+   * \param[in] nRecord_Global - Total number of records in the file.
+   * \param[in] nRecord - Number of records requested by this rank.
+   * \param[in] record - Global indices of the requested records, in ascending order.
+   * \param[out] buf - Data of the requested records, in the order of record.
+   */
+  void ReadRecords_All(MPI_Offset disp, unsigned long recordBytes, unsigned long nRecord_Global,
+                       unsigned long nRecord, const unsigned long *record, void *buf);
+
+  /*!
+   * \brief Collective exchange of fixed size records held by the aggregators, each aggregator holds
+   *        a contiguous range of records in memory (e.g. decompressed from the file).
+   * \param[in] first - First record of each aggregator's range, size GetnAggregator()+1.
+   * \param[in] recordBytes - Size of a record, in bytes.
+   * \param[in] nRecord - Number of records requested by this rank.
+   * \param[in] record - Global indices of the requested records, in ascending order.
+   * \param[in] rangeBuf - Records of the range of this aggregator (unused on the other ranks).
+   * \param[out] buf - Data of the requested records, in the order of record.
+   */
+  void ExchangeRecords(const unsigned long *first, unsigned long recordBytes, unsigned long nRecord,
+                       const unsigned long *record, const char *rangeBuf, void *buf);
+
+  /*!
+   * \brief Whether this rank is an aggregator.
+   * \return True if the rank accesses the file.
+   */
+  inline bool GetAggregator(void) const;
+
+  /*!
+   * \brief Get the actual number of aggregators.
+   * \return Number of aggregators.
+   */
+  inline int GetnAggregator(void) const;
+
+  /*!
+   * \brief Get the index among the aggregators of the aggregator of this rank.
+   * \return Index of the group of this rank.
+   */
+  inline int GetiAggregator(void) const;
+
+};
+
+#include "io_aggregator_structure.inl"
+
+#endif
@@ -137,6 +137,39 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w);
   
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization
+   *
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in, out] Hsbg - the upper Hessenberg begin updated
+   * \param[in, out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * \pre the vectors w[0:i] are orthonormal
+   * \post the vectors w[0:i+1] are orthonormal
+   *
+   * All the projections and the norm of w[i+1] are summed over the processors in a
+   * single reduction, the norm of the orthogonalized vector follows from Pythagoras.
+   * A second pass (CGS2) is done when the cancellation is large.
+   */
+  void ClassicalGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w);
+  
+  /*!
+   * \brief Start the sum over all processors of an array of local inner products,
+   *        the communication is non-blocking when the MPI library allows it
+   * \param[in] loc_prod - local inner products (see dotProdLocal)
+   * \param[out] prod - global inner products, valid after FinishReduction
+   * \param[in] count - number of inner products
+   * \param[out] request - handle of the reduction
+   */
+  void StartReduction(su2double *loc_prod, su2double *prod, int count, SU2_MPI::Request *request);
+  
+  /*!
+   * \brief Wait for a reduction started with StartReduction
+   * \param[in, out] request - handle of the reduction
+   */
+  void FinishReduction(SU2_MPI::Request *request);
+  
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -157,6 +190,19 @@ private:
    */
   void WriteHistory(const int & iter, const su2double & res, const su2double & resinit);
   
+  /*!
+   * \brief Build the preconditioner from the Jacobian and run the Krylov method selected in the config.
+   * \param[in] Jacobian - Jacobian Matrix for the linear system, used to build the preconditioner.
+   * \param[in] mat_vec - Matrix-vector product of the linear system.
+   * \param[in] LinSysRes - Linear system residual
+   * \param[in] LinSysSol - Linear system solution
+   * \param[in] geometry -  Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Number of iterations of the linear solver.
+   */
+  unsigned long Solve_Krylov(CSysMatrix & Jacobian, CMatrixVectorProduct & mat_vec, CSysVector & LinSysRes,
+                             CSysVector & LinSysSol, CGeometry *geometry, CConfig *config);
+  
 public:
   
   /*! \brief Conjugate Gradient method
@@ -171,6 +217,23 @@ public:
   unsigned long CG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
                                   CPreconditioner & precond, su2double tol,
                                   unsigned long m, su2double *residual, bool monitoring);
+  
+  /*! \brief Pipelined Conjugate Gradient method (Ghysels and Vanroose)
+   *
+   * Mathematically equivalent to CG_LinSolver, but the three inner products of each
+   * iteration are summed in a single non-blocking reduction that is overlapped with
+   * the preconditioner and the matrix-vector product.
+   * \param[in] b - the right hand size vector
+   * \param[in, out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   */
+  unsigned long PipelinedCG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                      CPreconditioner & precond, su2double tol,
+                                      unsigned long m, su2double *residual, bool monitoring);
 	
   /*!
    * \brief Flexible Generalized Minimal Residual method
@@ -182,10 +245,11 @@ public:
    * \param[in] m - maximum size of the search subspace
    * \param[in] residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] classical_gs - orthogonalize with ClassicalGramSchmidt instead of ModGramSchmidt.
    */
   unsigned long FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
                       CPreconditioner & precond, su2double tol,
-                      unsigned long m, su2double *residual, bool monitoring);
+                      unsigned long m, su2double *residual, bool monitoring, bool classical_gs = false);
 	
 	/*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
@@ -211,6 +275,19 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   unsigned long Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Solve the linear system using a Krylov subspace method with a user supplied matrix-vector
+   *        product (e.g. matrix free), the preconditioner is built from the assembled Jacobian.
+   * \param[in] Jacobian - Assembled (approximate) Jacobian, used to build the preconditioner.
+   * \param[in] mat_vec - Matrix-vector product of the linear system.
+   * \param[in] LinSysRes - Linear system residual
+   * \param[in] LinSysSol - Linear system solution
+   * \param[in] geometry -  Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long Solve(CSysMatrix & Jacobian, CMatrixVectorProduct & mat_vec, CSysVector & LinSysRes,
+                      CSysVector & LinSysSol, CGeometry *geometry, CConfig *config);
   
 
   /*!
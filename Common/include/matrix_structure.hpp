@@ -80,6 +80,9 @@ private:
   unsigned long *row_ptr_ilu;        /*!< \brief Pointers to the first element in each row (ILU). */
   unsigned long *col_ind_ilu;        /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;        /*!< \brief Fill in level for the ILU preconditioner. */
+  bool mixed_precision;              /*!< \brief Store the preconditioner factors in single precision. */
+  su2mixedfloat *ILU_matrix_mixed;   /*!< \brief Entries of the ILU sparse matrix in single precision (inverted diagonal blocks). */
+  bool frozen;                       /*!< \brief The entries and the preconditioner are kept, assembly and build calls have no effect. */
   
   su2double *block;             /*!< \brief Internal array to store a subblock of the matrix. */
   su2double *block_inverse;             /*!< \brief Internal array to store a subblock of the matrix. */
@@ -89,6 +92,7 @@ private:
   su2double *aux_vector;         /*!< \brief Auxiliary array to store intermediate results. */
   su2double *sum_vector;         /*!< \brief Auxiliary array to store intermediate results. */
   su2double *invM;              /*!< \brief Inverse of (Jacobi) preconditioner. */
+  su2mixedfloat *invM_mixed;    /*!< \brief Inverse of (Jacobi) preconditioner in single precision. */
   
   bool *LineletBool;                          /*!< \brief Identify if a point belong to a linelet. */
   vector<unsigned long> *LineletPoint;        /*!< \brief Linelet structure. */
@@ -98,6 +102,106 @@ private:
   *LyVector, *FzVector;           /*!< \brief Arrays of the Linelet preconditioner methodology. */
   unsigned long max_nElem;
 
+  CSysMatrix *AMG_Coarse;         /*!< \brief Next (coarser) level of the algebraic multigrid preconditioner. */
+  unsigned long *AMG_Aggregate;   /*!< \brief Aggregate (coarse point) of each domain point of this level. */
+  unsigned long *AMG_Index;       /*!< \brief Position in the coarse matrix of each block of this level. */
+  su2double *AMG_Rhs,             /*!< \brief Right hand side of the multigrid correction on this level. */
+  *AMG_Sol,                       /*!< \brief Multigrid correction on this level. */
+  *AMG_Res;                       /*!< \brief Residual of this level, restricted to the coarse level. */
+  unsigned short AMG_CoarseSweeps;  /*!< \brief Symmetric Gauss-Seidel sweeps when this level is the coarsest. */
+  CSysMatrix *AMG_Transposed;     /*!< \brief Transpose of the domain part of the matrix, finest level of the transposed hierarchy. */
+  bool AMG_Use_Transposed;        /*!< \brief The last build was for the transposed matrix. */
+
+  /*--- Dense kernels on the nVar x nVar blocks, specialised for the block size and
+   selected once when the matrix is sized (see SetBlockKernels). ---*/
+
+  void (*BlockVectorKernel)(unsigned short, const su2double*, const su2double*, su2double*);             /*!< \brief c = A*b. */
+  void (*BlockVectorAddKernel)(unsigned short, const su2double*, const su2double*, su2double*);          /*!< \brief c += A*b. */
+  void (*BlockTransposedVectorAddKernel)(unsigned short, const su2double*, const su2double*, su2double*);/*!< \brief c += A^T*b. */
+  void (*BlockBlockKernel)(unsigned short, const su2double*, const su2double*, su2double*);              /*!< \brief C = A*B. */
+  void (*GaussEliminationKernel)(unsigned short, su2double*, su2double*);                                /*!< \brief Solve A*x = b in place, A is overwritten. */
+  void (*BlockVectorMixedKernel)(unsigned short, const su2mixedfloat*, const su2double*, su2double*);    /*!< \brief c = A*b, single precision A. */
+  void (*BlockVectorAddMixedKernel)(unsigned short, const su2mixedfloat*, const su2double*, su2double*); /*!< \brief c += A*b, single precision A. */
+
+  /*!
+   * \brief Select the block kernels for the current block size. Unrolled versions exist for
+   *        nVar = 1, 2, 4, 5, 6 and 7, any other size uses the generic (runtime size) version.
+   */
+  void SetBlockKernels(void);
+
+  /*!
+   * \brief Get the pointer to a block of the single precision ILU matrix.
+   * \param[in] block_i - Row index of the block.
+   * \param[in] block_j - Column index of the block.
+   * \return Pointer to the block, NULL if it is not part of the ILU sparse pattern.
+   */
+  su2mixedfloat *GetBlock_ILUMatrix_Mixed(unsigned long block_i, unsigned long block_j);
+
+  /*!
+   * \brief Build the ILU factorization in single precision. The diagonal blocks are stored already
+   *        inverted, hence the triangular solves only require block-vector products.
+   * \param[in] transposed - Flag to use the transposed matrix.
+   */
+  void BuildILUPreconditioner_Mixed(bool transposed);
+
+  /*!
+   * \brief Forward and backward substitution with the double precision ILU factors.
+   * \param[in,out] vec - Right hand side on input, solution on output.
+   */
+  void ILUSolve(CSysVector & vec);
+
+  /*!
+   * \brief Forward and backward substitution with the single precision ILU factors.
+   * \param[in,out] vec - Right hand side on input, solution on output.
+   */
+  void ILUSolve_Mixed(CSysVector & vec);
+
+  /*!
+   * \brief Group the domain points of this level into aggregates, using the strength of the
+   *        couplings between the blocks (Frobenius norm). Points without strong couplings are
+   *        left out of the coarse level (they are only smoothed).
+   * \param[in] strength - Threshold of the strength of connection.
+   * \return Number of aggregates, i.e. number of points of the coarse level.
+   */
+  unsigned long SetAMGAggregates(su2double strength);
+
+  /*!
+   * \brief Build a level of the AMG preconditioner (inverse diagonal blocks for the smoother,
+   *        Galerkin coarse operator) and recurse to the coarser levels.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iLevel - Index of this level, 0 is the finest.
+   */
+  void SetAMGLevel(CConfig *config, unsigned short iLevel);
+
+  /*!
+   * \brief Sparse structure of a coarse level of the AMG preconditioner, or of the transposed
+   *        finest level. Only the matrix and the inverse diagonal blocks used by the smoother
+   *        are allocated, independently of the preconditioner set in the config.
+   * \param[in] val_nPoint - Number of points, all of them are domain points.
+   * \param[in] val_nVar - Number of nVar x nVar variables in each subblock of the matrix-by-block structure.
+   * \param[in] val_nEq - Number of nEqn x nVar variables in each subblock of the matrix-by-block structure.
+   * \param[in] val_row_ptr - Pointers to the first element in each row.
+   * \param[in] val_col_ind - Column index for each of the elements in val().
+   * \param[in] val_nnz - Number of possible nonzero entries in the matrix.
+   */
+  void SetIndexes_AMG(unsigned long val_nPoint, unsigned short val_nVar, unsigned short val_nEq,
+                      unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz);
+
+  /*!
+   * \brief Block Gauss-Seidel sweep on the domain points of this level.
+   * \param[in] b - Right hand side.
+   * \param[in,out] x - Solution, updated in place.
+   * \param[in] forward - Sweep direction, the backward sweep is the adjoint of the forward one.
+   */
+  void AMG_Smoother(const su2double *b, su2double *x, bool forward);
+
+  /*!
+   * \brief Symmetric V-cycle starting at this level.
+   * \param[in] b - Right hand side.
+   * \param[out] x - Approximate solution, must be zero on input.
+   */
+  void AMG_Cycle(const su2double *b, su2double *x);
+
 #if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
   void * MatrixMatrixProductJitter;                   		/*!< \brief Jitter handle for MKL JIT based GEMM. */
   dgemm_jit_kernel_t MatrixMatrixProductKernel;               	/*!< \brief MKL JIT based GEMM kernel. */
@@ -157,6 +261,20 @@ public:
    * \brief Sets to zero all the entries of the sparse matrix.
    */
   void SetValZero(void);
+
+  /*!
+   * \brief Freeze (or release) the matrix. While frozen the calls that assemble the matrix
+   *        (SetValZero, AddBlock, AddVal2Diag, ...) and the calls that build the Jacobi, ILU
+   *        and AMG preconditioners return immediately, the last assembled values and factors are reused.
+   * \param[in] val_frozen - <code>TRUE</code> to keep the current values and preconditioner.
+   */
+  void SetFrozen(bool val_frozen);
+
+  /*!
+   * \brief Check if the matrix is frozen.
+   * \return <code>TRUE</code> if the current values and preconditioner are being reused.
+   */
+  bool GetFrozen(void) const;
   
   /*!
    * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
@@ -542,6 +660,23 @@ public:
    */
   void ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Build the algebraic multigrid preconditioner (aggregation based). The hierarchy is
+   *        local to each rank, as for the ILU and LU-SGS preconditioners.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] transposed - Flag to build the hierarchy of the transposed matrix.
+   */
+  void BuildAMGPreconditioner(CConfig *config, bool transposed = false);
+  
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Compute the residual Ax-b
    * \param[in] sol - CSysVector to be multiplied by the preconditioner.
@@ -783,4 +918,37 @@ public:
   void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+class CAMGPreconditioner : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CAMGPreconditioner() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 #include "matrix_structure.inl"
@@ -38,12 +38,16 @@
 #pragma once
 
 inline void CSysMatrix::SetValZero(void) { 
-  if(NULL != matrix) {
+  if(NULL != matrix && !frozen) {
 	  for (unsigned long index = 0; index < nnz*nVar*nEqn; index++)
 		matrix[index] = 0.0;
   }
 }
 
+inline void CSysMatrix::SetFrozen(bool val_frozen) { frozen = val_frozen; }
+
+inline bool CSysMatrix::GetFrozen(void) const { return frozen; }
+
 inline CSysMatrixVectorProduct::CSysMatrixVectorProduct(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
   sparse_matrix = &matrix_ref;
   geometry = geometry_ref;
@@ -134,3 +138,18 @@ inline void CLineletPreconditioner::operator()(const CSysVector & u, CSysVector
   }
   sparse_matrix->ComputeLineletPreconditioner(u, v, geometry, config);
 }
+
+inline CAMGPreconditioner::CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CAMGPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CAMGPreconditioner::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeAMGPreconditioner(u, v, geometry, config);
+}
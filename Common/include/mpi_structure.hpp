@@ -46,6 +46,9 @@
 #include "./datatype_structure.hpp"
 #include <stdlib.h>
 #include <unistd.h>
+#ifdef HAVE_OMP
+#include <omp.h>
+#endif
 
 #ifdef HAVE_MPI
 
@@ -138,6 +141,16 @@ public:
   static void Irecv(void *buf, int count, Datatype datatype, int source,
                     int tag, Comm comm, Request* request);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Startall(int nrequests, Request *request);
+
+  static void Request_free(Request *request);
+
   static void Wait(Request *request, Status *status);
 
   static void Waitall(int nrequests, Request *request, Status *status);
@@ -167,6 +180,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request *request);
+
   static void Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -365,6 +381,16 @@ public:
   static void Irecv(void *buf, int count, Datatype datatype, int source,
                     int tag, Comm comm, Request* request);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Startall(int nrequests, Request *request);
+
+  static void Request_free(Request *request);
+
   static void Wait(Request *request, Status *status);
 
   static void Waitall(int nrequests, Request *request, Status *status);
@@ -392,6 +418,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request *request);
+
   static void Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -127,10 +127,26 @@ inline CBaseMPIWrapper::Comm CBaseMPIWrapper::GetComm(){
 }
 
 inline void CBaseMPIWrapper::Init(int *argc, char ***argv) {
+#ifdef HAVE_OMP
+  /*--- The threaded sections only call MPI from the master thread. ---*/
+  int provided;
+  MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &provided);
+#else
   MPI_Init(argc,argv);
+#endif
   MPI_Comm_rank(currentComm, &Rank);    
   MPI_Comm_size(currentComm, &Size);  
 
+#ifdef HAVE_OMP
+  /*--- Without the required thread support the tasks are executed serially. ---*/
+  if (provided < MPI_THREAD_FUNNELED) {
+    omp_set_num_threads(1);
+    if (Rank == 0)
+      std::cout << "WARNING: The MPI library does not support MPI_THREAD_FUNNELED, "
+                << "the OpenMP threads are disabled." << std::endl;
+  }
+#endif
+
   MinRankError = Size;
   MPI_Win_create(&MinRankError, sizeof(int), sizeof(int), MPI_INFO_NULL,
                  currentComm, &winMinRankError);
@@ -180,6 +196,24 @@ inline void CBaseMPIWrapper::Irecv(void *buf, int count, Datatype datatype,
   MPI_Irecv(buf,count,datatype,dest,tag,comm, request);
 }
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype,
+                                   int dest, int tag, Comm comm, Request *request) {
+  MPI_Send_init(buf,count,datatype,dest,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype,
+                                   int dest, int tag, Comm comm, Request *request) {
+  MPI_Recv_init(buf,count,datatype,dest,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Startall(int nrequests, Request *request) {
+  MPI_Startall(nrequests, request);
+}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {
+  MPI_Request_free(request);
+}
+
 inline void CBaseMPIWrapper::Wait(Request *request, Status *status) {
   MPI_Wait(request,status);
 }
@@ -226,6 +260,11 @@ inline void CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
 }
 
+inline void CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                    Datatype datatype, Op op, Comm comm, Request *request) {
+  MPI_Iallreduce(sendbuf,recvbuf,count,datatype,op,comm,request);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                                 void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm) {
   MPI_Gather(sendbuf,sendcnt,sendtype,recvbuf,recvcnt,recvtype,root,comm);
@@ -526,6 +565,16 @@ inline void CBaseMPIWrapper::Isend(void *buf, int count, Datatype datatype, int
 inline void CBaseMPIWrapper::Irecv(void *buf, int count, Datatype datatype, int source,
                                int tag, Comm comm, Request* request) {}
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype, int dest,
+                                   int tag, Comm comm, Request* request) {}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype, int source,
+                                   int tag, Comm comm, Request* request) {}
+
+inline void CBaseMPIWrapper::Startall(int nrequests, Request *request) {}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {}
+
 inline void CBaseMPIWrapper::Wait(Request *request, Status *status) {}
 
 inline void CBaseMPIWrapper::Waitall(int nrequests, Request *request, Status *status) {}
@@ -555,6 +604,11 @@ inline void  CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
    CopyData(sendbuf, recvbuf, count, datatype);
 }
 
+inline void  CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                     Datatype datatype, Op op, Comm comm, Request *request){
+   CopyData(sendbuf, recvbuf, count, datatype);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                    void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm){
   CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -0,0 +1,76 @@
+/*!
+ * \file omp_structure.hpp
+ * \brief Thin wrappers of the OpenMP runtime used by the threaded (hybrid MPI+threads) loops.
+ *        Without OpenMP the wrappers describe a single thread, so the same code compiles in both cases.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_OMP
+#include <omp.h>
+#endif
+
+/*!
+ * \brief Maximum number of threads that a parallel region may use.
+ * \return Number of threads (1 without OpenMP).
+ */
+inline unsigned short SU2_OMP_GetMaxThreads(void) {
+#if defined(HAVE_OMP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  return static_cast<unsigned short>(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
+/*!
+ * \brief Index of the calling thread within the current parallel region.
+ * \return Thread index (0 outside a parallel region or without OpenMP).
+ */
+inline unsigned short SU2_OMP_GetThreadID(void) {
+#if defined(HAVE_OMP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  return static_cast<unsigned short>(omp_get_thread_num());
+#else
+  return 0;
+#endif
+}
+
+/*--- Vectorization hint for the loops over the lanes of the batched kernels
+ (the AD types cannot be packed into SIMD registers). ---*/
+
+#if defined(HAVE_OMP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define SU2_OMP_SIMD _Pragma("omp simd")
+#else
+#define SU2_OMP_SIMD
+#endif
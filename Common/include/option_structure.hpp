@@ -156,6 +156,22 @@ const unsigned short COMM_TYPE_CHAR           = 5; /*!< \brief Communication typ
 const unsigned short COMM_TYPE_SHORT          = 6; /*!< \brief Communication type for short. */
 const unsigned short COMM_TYPE_INT            = 7; /*!< \brief Communication type for int. */
 
+/*!
+ * \brief Types of quantities exchanged across the SEND_RECEIVE (halo) markers.
+ */
+enum MPI_QUANTITIES {
+  SOLUTION            =  0,  /*!< \brief Conservative solution communication. */
+  SOLUTION_OLD        =  1,  /*!< \brief Solution old communication. */
+  SOLUTION_EDDY       =  2,  /*!< \brief Turbulent solution plus eddy viscosity communication. */
+  UNDIVIDED_LAPLACIAN =  3,  /*!< \brief Undivided Laplacian communication. */
+  SOLUTION_LIMITER    =  4,  /*!< \brief Solution limiter communication. */
+  PRIMITIVE_LIMITER   =  5,  /*!< \brief Primitive limiter communication. */
+  SOLUTION_GRADIENT   =  6,  /*!< \brief Solution gradient communication. */
+  PRIMITIVE_GRADIENT  =  7,  /*!< \brief Primitive gradient communication. */
+  MAX_EIGENVALUE      =  8,  /*!< \brief Maximum eigenvalue (and number of neighbors) communication. */
+  SENSOR              =  9   /*!< \brief Dissipation sensor communication. */
+};
+
 const unsigned short N_ELEM_TYPES = 7;           /*!< \brief General output & CGNS defines. */
 const unsigned short N_POINTS_LINE = 2;          /*!< \brief General output & CGNS defines. */
 const unsigned short N_POINTS_TRIANGLE = 3;      /*!< \brief General output & CGNS defines. */
@@ -187,6 +203,20 @@ static const map<string, VERB_LEVEL> Verb_Map = CCreateMap<string, VERB_LEVEL>
 ("MEDIUM", VERB_MEDIUM)
 ("HIGH", VERB_HIGH);
 
+/*!
+ * \brief Regions preregistered by the profiler (CConfig::Tick/Tock)
+ */
+enum ENUM_PROFILE_REGION {
+  PROFILE_ITERATION = 0,        /*!< \brief Complete iteration of the driver. */
+  PROFILE_PREPROCESS = 1,       /*!< \brief Preprocessing of an iteration. */
+  PROFILE_RUN = 2,              /*!< \brief Run of an iteration. */
+  PROFILE_UPDATE = 3,           /*!< \brief Update (dual time stepping) of an iteration. */
+  PROFILE_MONITOR = 4,          /*!< \brief Convergence monitoring of an iteration. */
+  PROFILE_OUTPUT = 5,           /*!< \brief File output of an iteration. */
+  PROFILE_LINEAR_SOLVER = 6,    /*!< \brief Solution of a linear system. */
+  PROFILE_MESH_DEFORMATION = 7  /*!< \brief Volumetric mesh deformation. */
+};
+
 /*!
  * \brief Average method for marker analyze
  */
@@ -549,7 +579,8 @@ enum ENUM_FLUIDMODEL {
 	PR_GAS = 3,
   CONSTANT_DENSITY = 4,
   INC_IDEAL_GAS = 5,
-  INC_IDEAL_GAS_POLY = 6
+  INC_IDEAL_GAS_POLY = 6,
+  LUT_GAS = 7           /*!< \brief Look-up tables generated from (or stored for) one of the analytic models. */
 };
 
 static const map<string, ENUM_FLUIDMODEL> FluidModel_Map = CCreateMap<string, ENUM_FLUIDMODEL>
@@ -559,7 +590,8 @@ static const map<string, ENUM_FLUIDMODEL> FluidModel_Map = CCreateMap<string, EN
 ("PR_GAS", PR_GAS)
 ("CONSTANT_DENSITY", CONSTANT_DENSITY)
 ("INC_IDEAL_GAS", INC_IDEAL_GAS)
-("INC_IDEAL_GAS_POLY", INC_IDEAL_GAS_POLY);
+("INC_IDEAL_GAS_POLY", INC_IDEAL_GAS_POLY)
+("LUT_GAS", LUT_GAS);
 
 /*!
  * \brief types of density models
@@ -1525,14 +1557,21 @@ static const map<string, ENUM_ADAPT> Adapt_Map = CCreateMap<string, ENUM_ADAPT>
  */
 enum ENUM_INPUT {
   SU2 = 1,                       /*!< \brief SU2 input format. */
-  CGNS = 2                     /*!< \brief CGNS input format for the computational grid. */
+  CGNS = 2,                    /*!< \brief CGNS input format for the computational grid. */
+  SU2_BINARY = 3               /*!< \brief Binary SU2 input format, read in parallel by all ranks. */
 };
 static const map<string, ENUM_INPUT> Input_Map = CCreateMap<string, ENUM_INPUT>
 ("SU2", SU2)
-("CGNS", CGNS);
+("CGNS", CGNS)
+("SU2_BINARY", SU2_BINARY);
 
 const int CGNS_STRING_SIZE = 33;/*!< \brief Length of strings used in the CGNS format. */
 
+const unsigned long SU2_BINARY_MESH_ID = 1398092354; /*!< \brief Identifier stored first in a binary SU2 mesh file ("SU2B"). */
+const unsigned long SU2_BINARY_MESH_VERSION = 1;     /*!< \brief Version of the binary SU2 mesh file layout. */
+const int SU2_BINARY_MESH_HEADER = 16;               /*!< \brief Number of integers in the header of a binary SU2 mesh file. */
+const int SU2_BINARY_MESH_TAG_SIZE = 64;             /*!< \brief Length of the marker tags in a binary SU2 mesh file. */
+
 /*!
  * \brief type of solution output file formats
  */
@@ -1727,7 +1766,9 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER_LUSGS = 8,  /*!< \brief LU_SGS smoother. */
   SMOOTHER_JACOBI = 9,  /*!< \brief Jacobi smoother. */
   SMOOTHER_ILU = 10,  /*!< \brief ILU smoother. */
-  SMOOTHER_LINELET = 11  /*!< \brief Linelet smoother. */
+  SMOOTHER_LINELET = 11,  /*!< \brief Linelet smoother. */
+  PIPELINED_CG = 12,  /*!< \brief Pipelined conjugate gradient, one non-blocking reduction per iteration. */
+  FGMRES_CGS = 13  /*!< \brief FGMRES with classical Gram-Schmidt, one fused reduction per iteration. */
 };
 static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<string, ENUM_LINEAR_SOLVER>
 ("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1740,7 +1781,9 @@ static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<stri
 ("SMOOTHER_LUSGS", SMOOTHER_LUSGS)
 ("SMOOTHER_JACOBI", SMOOTHER_JACOBI)
 ("SMOOTHER_LINELET", SMOOTHER_LINELET)
-("SMOOTHER_ILU", SMOOTHER_ILU);
+("SMOOTHER_ILU", SMOOTHER_ILU)
+("PIPELINED_CG", PIPELINED_CG)
+("FGMRES_CGS", FGMRES_CGS);
 
 /*!
  * \brief types surface continuity at the intersection with the FFD
@@ -1792,13 +1835,30 @@ enum ENUM_LINEAR_SOLVER_PREC {
   JACOBI = 1,		/*!< \brief Jacobi preconditioner. */
   LU_SGS = 2,		/*!< \brief LU SGS preconditioner. */
   LINELET = 3,  /*!< \brief Line implicit preconditioner. */
-  ILU = 4       /*!< \brief ILU(0) preconditioner. */
+  ILU = 4,      /*!< \brief ILU(0) preconditioner. */
+  AMG = 5       /*!< \brief Algebraic multigrid (aggregation) preconditioner. */
 };
 static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
 ("JACOBI", JACOBI)
 ("LU_SGS", LU_SGS)
 ("LINELET", LINELET)
-("ILU", ILU);
+("ILU", ILU)
+("AMG", AMG);
+
+/*!
+ * \brief types of local point renumbering applied after the partitioning
+ */
+enum ENUM_RENUMBERING {
+  NO_RENUMBERING = 0,       /*!< \brief Keep the points in the order they were read. */
+  RCM_RENUMBERING = 1,      /*!< \brief Reverse Cuthill-McKee ordering of the point graph. */
+  HILBERT_RENUMBERING = 2,  /*!< \brief Ordering along a Hilbert space-filling curve through the coordinates. */
+  LEGACY_RCM_RENUMBERING = 3 /*!< \brief Reverse Cuthill-McKee ordering of the first component, unsorted edges. */
+};
+static const map<string, ENUM_RENUMBERING> Renumbering_Map = CCreateMap<string, ENUM_RENUMBERING>
+("NONE", NO_RENUMBERING)
+("LEGACY_RCM", LEGACY_RCM_RENUMBERING)
+("RCM", RCM_RENUMBERING)
+("HILBERT", HILBERT_RENUMBERING);
 
 /*!
  * \brief types of analytic definitions for various geometries
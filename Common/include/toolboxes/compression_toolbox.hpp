@@ -0,0 +1,106 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Lossless compression of blocks of binary data (byte shuffle + LZ77),
+ *        self contained so that the files do not depend on an external library.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstring>
+
+namespace CompressionToolbox {
+
+/*!
+ * \brief Transpose the bytes of an array of elements, i.e. store the first byte of all
+ *        elements, then the second byte, etc. The exponents and leading mantissa bytes of
+ *        smooth floating point fields end up next to each other, which the LZ stage exploits.
+ * \param[in] src - Array of nElem elements of elemSize bytes.
+ * \param[in] nElem - Number of elements.
+ * \param[in] elemSize - Size of an element in bytes.
+ * \param[out] dst - Shuffled bytes (same size as src).
+ */
+void Shuffle(const char *src, unsigned long nElem, unsigned short elemSize, char *dst);
+
+/*!
+ * \brief Inverse of Shuffle.
+ * \param[in] src - Shuffled bytes.
+ * \param[in] nElem - Number of elements.
+ * \param[in] elemSize - Size of an element in bytes.
+ * \param[out] dst - Array of elements.
+ */
+void Unshuffle(const char *src, unsigned long nElem, unsigned short elemSize, char *dst);
+
+/*!
+ * \brief Compress a block with a byte oriented LZ77 coder (LZ4-like sequences of literals and matches).
+ * \param[in] src - Data to compress.
+ * \param[in] nBytes - Size of the data.
+ * \param[out] dst - Compressed data (resized).
+ */
+void CompressLZ(const char *src, unsigned long nBytes, std::vector<char> &dst);
+
+/*!
+ * \brief Decompress a block written by CompressLZ.
+ * \param[in] src - Compressed data.
+ * \param[in] srcBytes - Size of the compressed data.
+ * \param[out] dst - Decompressed data.
+ * \param[in] dstBytes - Expected size of the decompressed data.
+ * \return False if the block is corrupt.
+ */
+bool DecompressLZ(const char *src, unsigned long srcBytes, char *dst, unsigned long dstBytes);
+
+/*!
+ * \brief Encode an array of elements: shuffle + LZ if requested and if it makes the block smaller,
+ *        otherwise the raw bytes are stored. The two cases are told apart by the size of the block.
+ * \param[in] src - Array of elements.
+ * \param[in] nElem - Number of elements.
+ * \param[in] elemSize - Size of an element in bytes.
+ * \param[in] compress - Whether to try the compression.
+ * \param[out] dst - Encoded block.
+ */
+void Encode(const char *src, unsigned long nElem, unsigned short elemSize, bool compress, std::vector<char> &dst);
+
+/*!
+ * \brief Decode a block written by Encode.
+ * \param[in] src - Encoded block.
+ * \param[in] srcBytes - Size of the encoded block.
+ * \param[in] nElem - Number of elements.
+ * \param[in] elemSize - Size of an element in bytes.
+ * \param[out] dst - Array of elements.
+ * \return False if the block is corrupt.
+ */
+bool Decode(const char *src, unsigned long srcBytes, unsigned long nElem, unsigned short elemSize, char *dst);
+
+}
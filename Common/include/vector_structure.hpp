@@ -343,6 +343,14 @@ public:
    */
   friend su2double dotProd(const CSysVector & u, const CSysVector & v);
   
+  /*!
+   * \brief dot-product between the domain (non halo) entries of two CSysVectors, without the
+   *        sum over processors, so that several of them can be reduced in a single communication
+   * \param[in] u - first CSysVector in dot product
+   * \param[in] v - second CSysVector in dot product
+   */
+  friend su2double dotProdLocal(const CSysVector & u, const CSysVector & v);
+  
 };
 
 /*!
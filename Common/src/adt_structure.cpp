@@ -801,17 +801,45 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
                                             unsigned long   &elemID,
                                             int             &rankID) {
 
+  /* No guess of the nearest element and no bound of the distance. */
+  unsigned long adtElemID = elemVTK_Type.size();
+  NearestElementSearch(coor, false, 0.0, adtElemID, dist, markerID, elemID, rankID);
+}
+
+bool CADTElemClass::DetermineNearestElement(const su2double *coor,
+                                            const su2double maxDist,
+                                            unsigned long   &adtElemID,
+                                            su2double       &dist,
+                                            unsigned short  &markerID,
+                                            unsigned long   &elemID,
+                                            int             &rankID) {
+
+  return NearestElementSearch(coor, true, maxDist*maxDist, adtElemID, dist,
+                              markerID, elemID, rankID);
+}
+
+bool CADTElemClass::NearestElementSearch(const su2double *coor,
+                                         const bool      useBound,
+                                         const su2double maxDist2,
+                                         unsigned long   &adtElemID,
+                                         su2double       &dist,
+                                         unsigned short  &markerID,
+                                         unsigned long   &elemID,
+                                         int             &rankID) {
+
   AD_BEGIN_PASSIVE
 
   /*----------------------------------------------------------------------------*/
   /*--- Step 1: Initialize the distance (squared) to the quaranteed distance ---*/
-  /*---         of the central bounding box of the root element.             ---*/
+  /*---         of the central bounding box of the root element, the given   ---*/
+  /*---         bound and the distance to the guessed element.               ---*/
   /*----------------------------------------------------------------------------*/
 
   unsigned long kk = leaves[0].centralNodeID;
   const su2double *coorBBMin = BBoxCoor.data() + nDimADT*kk;
   const su2double *coorBBMax = coorBBMin + nDim;
   unsigned long jj = 0;
+  bool found = !useBound;
 
   dist = 0.0;
   for(unsigned short k=0; k<nDim; ++k) {
@@ -822,6 +850,23 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
     dist += ds*ds;
   }
 
+  if( useBound ) dist = min(dist, maxDist2);
+
+  /* The guess, typically the nearest element of the previous point, gives a
+     tight initial bound for nearby points, which prunes most of the tree. */
+  if(adtElemID < elemVTK_Type.size()) {
+    su2double dist2Elem;
+    Dist2ToElement(adtElemID, coor, dist2Elem);
+    if(dist2Elem <= dist) {
+      jj       = adtElemID;
+      dist     = dist2Elem;
+      markerID = localMarkers[jj];
+      elemID   = localElemIDs[jj];
+      rankID   = ranksOfElems[jj];
+      found    = true;
+    }
+  }
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and store the bounding boxes for which the ---*/
   /*---         possible minimum distance is less than the currently stored  ---*/
@@ -975,15 +1020,20 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
       markerID = localMarkers[ii];
       elemID   = localElemIDs[ii];
       rankID   = ranksOfElems[ii];
+      found    = true;
     }
   }
 
   AD_END_PASSIVE
 
+  if( !found ) return false;
+
   /* At the moment the square of the distance is stored in dist. Compute
      the correct value. */
+  adtElemID = jj;
   Dist2ToElement(jj, coor, dist);
   dist = sqrt(dist);
+  return true;
 }
 
 bool CADTElemClass::CoorInElement(const unsigned long elemID,
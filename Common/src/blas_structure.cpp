@@ -62,11 +62,10 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
                           const su2double *A, const su2double *B, su2double *C,
                           CConfig *config) {
 
-  /* Initialize the variable for the timing, if profiling is active. */
-#ifdef PROFILE
-  double timeGemm;
+  /* Initialize the variable for the timing, the timer is only
+     read if profiling is active. */
+  double timeGemm = 0.0;
   if( config ) config->GEMM_Tick(&timeGemm);
-#endif
 
 #if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
   /* Native implementation of the matrix product. This optimized implementation
@@ -102,9 +101,7 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
 #endif
 
   /* Store the profiling information, if needed. */
-#ifdef PROFILE
   if( config ) config->GEMM_Tock(timeGemm, M, N, K);
-#endif
 }
 
 /* Dense matrix vector multiplication, gemv functionality. */
@@ -0,0 +1,330 @@
+/*!
+ * \file chunked_restart_structure.cpp
+ * \brief Main subroutines for the chunked (and compressed) binary restart files.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/chunked_restart_structure.hpp"
+
+bool CChunkedRestart::IsChunked(const char *val_filename) {
+
+  /*--- Only the master looks at the first int of the file. ---*/
+
+  int magic_number = 0;
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    FILE *fhw = fopen(val_filename, "rb");
+    if (fhw) {
+      if (fread(&magic_number, sizeof(int), 1, fhw) != 1) magic_number = 0;
+      fclose(fhw);
+    }
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(&magic_number, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+
+  return (magic_number == MagicNumber);
+
+}
+
+unsigned long CChunkedRestart::Write(CConfig *config, const char *val_filename, int nFields, const string *Field_Names,
+                                     unsigned long nPoint_Global, unsigned long nPoint, const passivedouble *data,
+                                     int ExtIter, const passivedouble *Metadata) {
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const bool compress = config->GetRestart_Compression();
+  int iField, iRank;
+  unsigned long iPoint;
+
+  /*--- Encode each field of the points of this rank into a block. ---*/
+
+  vector<char> local, block;
+  vector<unsigned long> blockBytes(nFields);
+  vector<passivedouble> column(nPoint);
+
+  for (iField = 0; iField < nFields; iField++) {
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      column[iPoint] = data[iPoint*nFields+iField];
+    CompressionToolbox::Encode(reinterpret_cast<const char*>(column.data()), nPoint,
+                               sizeof(passivedouble), compress, block);
+    blockBytes[iField] = block.size();
+    local.insert(local.end(), block.begin(), block.end());
+  }
+
+  /*--- Sizes of all the chunks (one per rank), the master needs the sizes of
+   all the blocks to write the index. ---*/
+
+  unsigned long myBytes = local.size(), myPoint = nPoint;
+  vector<unsigned long> allBytes(size), allPoint(size), allBlockBytes(size*nFields);
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(&myBytes, 1, MPI_UNSIGNED_LONG, allBytes.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&myPoint, 1, MPI_UNSIGNED_LONG, allPoint.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Gather(blockBytes.data(), nFields, MPI_UNSIGNED_LONG,
+                  allBlockBytes.data(), nFields, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  allBytes[0] = myBytes;
+  allPoint[0] = myPoint;
+  allBlockBytes = blockBytes;
+#endif
+
+  const int nChunk = size;
+  const unsigned long headerBytes = 5*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                                    (nChunk+1)*sizeof(long long) + (nChunk*nFields+1)*sizeof(long long);
+
+  unsigned long chunkOffset = headerBytes, footerOffset = headerBytes;
+  for (iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) chunkOffset += allBytes[iRank];
+    footerOffset += allBytes[iRank];
+  }
+
+  /*--- Header with the index of the blocks, and footer with the metadata. ---*/
+
+  vector<char> header, footer;
+
+  if (rank == MASTER_NODE) {
+
+    header.resize(headerBytes, 0);
+    char *pos = header.data();
+
+    int var_buf[5] = {MagicNumber, nFields, (int)nPoint_Global, nChunk, compress};
+    memcpy(pos, var_buf, 5*sizeof(int));
+    pos += 5*sizeof(int);
+
+    for (iField = 0; iField < nFields; iField++) {
+      strncpy(pos, Field_Names[iField].c_str(), CGNS_STRING_SIZE);
+      pos += CGNS_STRING_SIZE;
+    }
+
+    long long first = 0;
+    for (iRank = 0; iRank <= nChunk; iRank++) {
+      memcpy(pos, &first, sizeof(long long));
+      pos += sizeof(long long);
+      if (iRank < nChunk) first += allPoint[iRank];
+    }
+
+    long long offset = headerBytes;
+    for (unsigned long iBlock = 0; iBlock <= (unsigned long)nChunk*nFields; iBlock++) {
+      memcpy(pos, &offset, sizeof(long long));
+      pos += sizeof(long long);
+      if (iBlock < (unsigned long)nChunk*nFields) offset += allBlockBytes[iBlock];
+    }
+
+    footer.resize(sizeof(int) + 8*sizeof(passivedouble));
+    memcpy(footer.data(), &ExtIter, sizeof(int));
+    memcpy(footer.data()+sizeof(int), Metadata, 8*sizeof(passivedouble));
+  }
+
+#ifdef HAVE_MPI
+
+  /*--- Parallel output through the I/O aggregators, the chunks follow each other
+   in the order of the ranks. ---*/
+
+  CIOAggregator IO_Aggregator(config->GetnIO_Aggregators(), config->GetIO_Stripe_Size());
+
+  if (!IO_Aggregator.Open(val_filename, true)) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(val_filename), CURRENT_FUNCTION);
+  }
+
+  if (rank == MASTER_NODE) IO_Aggregator.WriteAt_Master(0, header.data(), header.size());
+
+  IO_Aggregator.WriteAt_All(chunkOffset, local.data(), local.size());
+
+  if (rank == MASTER_NODE) IO_Aggregator.WriteAt_Master(footerOffset, footer.data(), footer.size());
+
+  IO_Aggregator.Close();
+
+#else
+
+  FILE *fhw = fopen(val_filename, "wb");
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(val_filename), CURRENT_FUNCTION);
+  }
+
+  fwrite(header.data(), sizeof(char), header.size(), fhw);
+  fwrite(local.data(), sizeof(char), local.size(), fhw);
+  fwrite(footer.data(), sizeof(char), footer.size(), fhw);
+  fclose(fhw);
+
+#endif
+
+  return local.size() + header.size() + footer.size();
+
+}
+
+void CChunkedRestart::Read(CConfig *config, const char *val_filename, unsigned long nPoint, const unsigned long *Point_Global,
+                           unsigned short val_iField, unsigned short val_nField, int *Restart_Vars,
+                           vector<string> &Field_Names, passivedouble *&Restart_Data) {
+
+  const int nRestart_Vars = 5;
+  int iField, iChunk;
+  unsigned long iPoint;
+
+  /*--- Read the header. ---*/
+
+#ifdef HAVE_MPI
+  CIOAggregator IO_Aggregator(config->GetnIO_Aggregators(), config->GetIO_Stripe_Size());
+
+  if (!IO_Aggregator.Open(val_filename, false)) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(val_filename), CURRENT_FUNCTION);
+  }
+
+  IO_Aggregator.ReadAt_Master(0, Restart_Vars, nRestart_Vars*sizeof(int));
+  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  FILE *fhw = fopen(val_filename, "rb");
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(val_filename), CURRENT_FUNCTION);
+  }
+
+  if (fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw) != (unsigned long)nRestart_Vars) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+#endif
+
+  if (Restart_Vars[0] != MagicNumber) {
+    SU2_MPI::Error(string("File ") + string(val_filename) + string(" is not a chunked SU2 restart file."),
+                   CURRENT_FUNCTION);
+  }
+
+  const int nFields = Restart_Vars[1], nChunk = Restart_Vars[3];
+
+  vector<char> names(nFields*CGNS_STRING_SIZE);
+  vector<long long> chunkFirst(nChunk+1), blockOffset(nChunk*nFields+1);
+
+  unsigned long disp_names = nRestart_Vars*sizeof(int);
+  unsigned long disp_chunk = disp_names + names.size();
+  unsigned long disp_block = disp_chunk + chunkFirst.size()*sizeof(long long);
+
+#ifdef HAVE_MPI
+  IO_Aggregator.ReadAt_Master(disp_names, names.data(), names.size());
+  IO_Aggregator.ReadAt_Master(disp_chunk, chunkFirst.data(), chunkFirst.size()*sizeof(long long));
+  IO_Aggregator.ReadAt_Master(disp_block, blockOffset.data(), blockOffset.size()*sizeof(long long));
+
+  SU2_MPI::Bcast(names.data(), names.size(), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(chunkFirst.data(), chunkFirst.size(), MPI_LONG_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(blockOffset.data(), blockOffset.size(), MPI_LONG_LONG, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  if ((fread(names.data(), sizeof(char), names.size(), fhw) != names.size()) ||
+      (fread(chunkFirst.data(), sizeof(long long), chunkFirst.size(), fhw) != chunkFirst.size()) ||
+      (fread(blockOffset.data(), sizeof(long long), blockOffset.size(), fhw) != blockOffset.size())) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+#endif
+
+  Field_Names.resize(nFields);
+  for (iField = 0; iField < nFields; iField++) {
+    const char *name = &names[iField*CGNS_STRING_SIZE];
+    Field_Names[iField] = string(name, strnlen(name, CGNS_STRING_SIZE));
+  }
+
+  /*--- Range of fields to read. ---*/
+
+  const int iFieldBegin = min<int>(val_iField, nFields);
+  const int iFieldEnd = (val_nField > 0)? min<int>(val_iField+val_nField, nFields) : nFields;
+
+  /*--- The readers (the aggregators) decode a contiguous range of chunks into
+   records of nFields values per point, and serve the points to their owners. ---*/
+
+#ifdef HAVE_MPI
+  const int nReader = IO_Aggregator.GetnAggregator(), iReader = IO_Aggregator.GetiAggregator();
+  const bool isReader = IO_Aggregator.GetAggregator();
+#else
+  const int nReader = 1, iReader = 0;
+  const bool isReader = true;
+#endif
+
+  vector<unsigned long> firstChunk(nReader+1), firstPoint(nReader+1);
+  for (int jReader = 0; jReader <= nReader; jReader++) {
+    firstChunk[jReader] = ((unsigned long)jReader*nChunk)/nReader;
+    firstPoint[jReader] = chunkFirst[firstChunk[jReader]];
+  }
+
+  vector<passivedouble> rangeBuf, column;
+  vector<char> block;
+
+  if (isReader) {
+
+    rangeBuf.resize((firstPoint[iReader+1]-firstPoint[iReader])*nFields, 0.0);
+
+    for (iChunk = firstChunk[iReader]; iChunk < (int)firstChunk[iReader+1]; iChunk++) {
+
+      const unsigned long nChunkPoint = chunkFirst[iChunk+1]-chunkFirst[iChunk];
+      const unsigned long offset = chunkFirst[iChunk]-firstPoint[iReader];
+      column.resize(nChunkPoint);
+
+      for (iField = iFieldBegin; iField < iFieldEnd; iField++) {
+
+        const unsigned long iBlock = (unsigned long)iChunk*nFields+iField;
+        block.resize(blockOffset[iBlock+1]-blockOffset[iBlock]);
+
+#ifdef HAVE_MPI
+        IO_Aggregator.ReadAt_Aggregator(blockOffset[iBlock], block.data(), block.size());
+#else
+        fseek(fhw, blockOffset[iBlock], SEEK_SET);
+        if (fread(block.data(), sizeof(char), block.size(), fhw) != block.size()) {
+          SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+        }
+#endif
+
+        if (!CompressionToolbox::Decode(block.data(), block.size(), nChunkPoint,
+                                        sizeof(passivedouble), reinterpret_cast<char*>(column.data()))) {
+          SU2_MPI::Error(string("Corrupt data in the restart file ") + string(val_filename), CURRENT_FUNCTION);
+        }
+
+        for (iPoint = 0; iPoint < nChunkPoint; iPoint++)
+          rangeBuf[(offset+iPoint)*nFields+iField] = column[iPoint];
+      }
+    }
+  }
+
+  /*--- Hand the records to the ranks that own the points. ---*/
+
+  Restart_Data = new passivedouble[nPoint*nFields];
+
+#ifdef HAVE_MPI
+  IO_Aggregator.ExchangeRecords(firstPoint.data(), nFields*sizeof(passivedouble), nPoint, Point_Global,
+                                reinterpret_cast<const char*>(rangeBuf.data()), Restart_Data);
+  IO_Aggregator.Close();
+#else
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iField = 0; iField < nFields; iField++)
+      Restart_Data[iPoint*nFields+iField] = rangeBuf[Point_Global[iPoint]*nFields+iField];
+  fclose(fhw);
+#endif
+
+}
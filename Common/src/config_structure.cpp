@@ -38,11 +38,31 @@
 #include "../include/config_structure.hpp"
 #include "../include/fem_gauss_jacobi_quadrature.hpp"
 #include "../include/fem_geometry_structure.hpp"
-
-vector<string> Profile_Function_tp;       /*!< \brief Vector of string names for profiled functions. */
-vector<double> Profile_Time_tp;           /*!< \brief Vector of elapsed time for profiled functions. */
-vector<double> Profile_ID_tp;             /*!< \brief Vector of group ID number for profiled functions. */
-map<string, vector<int> > Profile_Map_tp; /*!< \brief Map containing the final results for profiled functions. */
+#include "../include/omp_structure.hpp"
+
+bool Profile_Initialized = false;          /*!< \brief Whether the profiler was initialized. */
+bool Profile_Enabled = false;              /*!< \brief Whether the regions are timed. */
+bool Profile_Trace = false;                /*!< \brief Whether the timeline of the regions is recorded. */
+unsigned long Profile_Trace_Size = 0;      /*!< \brief Capacity of the ring buffer of the timeline. */
+unsigned long Profile_Trace_Count = 0;     /*!< \brief Number of events recorded in the timeline. */
+double Profile_Start_Time = 0.0;           /*!< \brief Time at which the profiler was initialized. */
+
+vector<string>         Profile_Name;       /*!< \brief Name of the profiled regions. */
+vector<int>            Profile_Group;      /*!< \brief Group ID of the profiled regions. */
+vector<short>          Profile_Parent;     /*!< \brief Region from which a region was first called (-1 if none). */
+vector<unsigned long>  Profile_NCalls;     /*!< \brief Number of calls of the profiled regions. */
+vector<double>         Profile_TotTime;    /*!< \brief Total time spent in the profiled regions. */
+vector<double>         Profile_SelfTime;   /*!< \brief Time spent in the regions excluding nested regions. */
+vector<double>         Profile_MinTime;    /*!< \brief Minimum time of one call of the profiled regions. */
+vector<double>         Profile_MaxTime;    /*!< \brief Maximum time of one call of the profiled regions. */
+map<string, unsigned short> Profile_Region_Map; /*!< \brief Map from the region names to their IDs. */
+
+vector<unsigned short> Profile_Stack_Region; /*!< \brief Stack of the currently open regions. */
+vector<double> Profile_Stack_Child;        /*!< \brief Time spent in nested regions of the open regions. */
+
+vector<unsigned short> Profile_Trace_Region;   /*!< \brief Ring buffer of the timeline, region IDs. */
+vector<double>         Profile_Trace_Begin;    /*!< \brief Ring buffer of the timeline, start times. */
+vector<double>         Profile_Trace_Duration; /*!< \brief Ring buffer of the timeline, durations. */
 
 map<CLong3T, int> GEMM_Profile_MNK;       /*!< \brief Map, which maps the GEMM size to the index where
                                                       the data for this GEMM is stored in several vectors. */
@@ -52,8 +72,6 @@ vector<double> GEMM_Profile_TotTime;      /*!< \brief Total time spent for this
 vector<double> GEMM_Profile_MinTime;      /*!< \brief Minimum time spent for this GEMM size. */
 vector<double> GEMM_Profile_MaxTime;      /*!< \brief Maximum time spent for this GEMM size. */
 
-//#pragma omp threadprivate(Profile_Function_tp, Profile_Time_tp, Profile_ID_tp, Profile_Map_tp)
-
 #include "../include/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
 
@@ -332,6 +350,26 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
 
       break;
     }
+
+    case SU2_BINARY: {
+
+      /*--- The dimension is stored in the fixed-size header. ---*/
+      unsigned long header[SU2_BINARY_MESH_HEADER];
+      FILE *fhw = fopen(val_mesh_filename.c_str(), "rb");
+      if (!fhw) {
+        SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+      size_t ret = fread(header, sizeof(unsigned long), SU2_BINARY_MESH_HEADER, fhw);
+      fclose(fhw);
+
+      if ((ret != (size_t)SU2_BINARY_MESH_HEADER) || (header[0] != SU2_BINARY_MESH_ID)) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not a binary SU2 mesh file. Please check MESH_FORMAT."),
+                       CURRENT_FUNCTION);
+      }
+      nDim = header[2];
+
+      break;
+    }
   }
 
   /*--- After reading the mesh, assert that the dimension is equal to 2 or 3. ---*/
@@ -569,6 +607,8 @@ void CConfig::SetPointersNull(void) {
   default_inc_crit           = NULL;
   default_htp_axis           = NULL;
   default_body_force         = NULL;
+  default_lut_pressure       = NULL;
+  default_lut_temperature    = NULL;
   default_sineload_coeff     = NULL;
   default_nacelle_location   = NULL;
   
@@ -678,6 +718,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   default_inc_crit           = new su2double[3];
   default_htp_axis           = new su2double[2];
   default_body_force         = new su2double[3];
+  default_lut_pressure       = new su2double[2];
+  default_lut_temperature    = new su2double[2];
   default_sineload_coeff     = new su2double[3];
   default_nacelle_location   = new su2double[5];
   
@@ -754,8 +796,20 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("RESTART_SOL", Restart, false);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read / write binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_BINARY_RESTART", Wrt_Binary_Restart, true);
+  /*!\brief WRT_ASYNC_OUTPUT \n DESCRIPTION: Write the restart and volume solution files on a background thread while the solver continues. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_ASYNC_OUTPUT", Wrt_Async_Output, false);
+  /*!\brief WRT_CHUNKED_RESTART \n DESCRIPTION: Write the binary restart files in the chunked format, the fields can be read individually. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_CHUNKED_RESTART", Wrt_Chunked_Restart, false);
+  /*!\brief RESTART_COMPRESSION \n DESCRIPTION: Lossless compression of the chunked restart files. \n Options: YES, NO \ingroup Config */
+  addBoolOption("RESTART_COMPRESSION", Restart_Compression, true);
+  /*!\brief IO_AGGREGATORS \n DESCRIPTION: Number of ranks that gather the data of the others and access the parallel binary files (0 for all ranks). \ingroup Config */
+  addUnsignedLongOption("IO_AGGREGATORS", IO_Aggregators, 0);
+  /*!\brief IO_STRIPE_SIZE \n DESCRIPTION: Stripe size of the file system in bytes, the aggregated writes start at stripe boundaries (0 if unknown). \ingroup Config */
+  addUnsignedLongOption("IO_STRIPE_SIZE", IO_Stripe_Size, 0);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read / write binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief WRT_BINARY_MESH \n DESCRIPTION: Write the output mesh (MESH_OUT_FILENAME) in the binary SU2 format. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_BINARY_MESH", Wrt_Binary_Mesh, false);
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -795,6 +849,22 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the look-up table (LUT_GAS) fluid model ---*/
+  /*!\brief LUT_DONOR_MODEL \n DESCRIPTION: Analytic fluid model from which the tables are generated (IDEAL_GAS, VW_GAS, PR_GAS) \ingroup Config*/
+  addEnumOption("LUT_DONOR_MODEL", Kind_LUT_Donor, FluidModel_Map, PR_GAS);
+  /* DESCRIPTION: Pressure range (min, max) covered by the tables */
+  default_lut_pressure[0] = 1.0E4; default_lut_pressure[1] = 1.0E7;
+  addDoubleArrayOption("LUT_PRESSURE_RANGE", 2, LUT_Pressure_Range, default_lut_pressure);
+  /* DESCRIPTION: Temperature range (min, max) covered by the tables */
+  default_lut_temperature[0] = 250.0; default_lut_temperature[1] = 700.0;
+  addDoubleArrayOption("LUT_TEMPERATURE_RANGE", 2, LUT_Temperature_Range, default_lut_temperature);
+  /* DESCRIPTION: Relative interpolation error that triggers a refinement of the tables */
+  addDoubleOption("LUT_TOLERANCE", LUT_Tolerance, 1.0E-4);
+  /* DESCRIPTION: Maximum number of refinements of a root cell of the tables */
+  addUnsignedShortOption("LUT_MAX_REFINEMENT", LUT_MaxRefinement, 6);
+  /* DESCRIPTION: File in which the tables are stored, it is generated when absent or outdated */
+  addStringOption("LUT_FILENAME", LUT_FileName, string("fluid_tables.lut"));
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -1261,6 +1331,15 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addLongOption("UNST_RESTART_ITER", Unst_RestartIter, 0);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Recompute the direct solutions of the unsteady adjoint from checkpoints instead of reading every restart file */
+  addBoolOption("UNST_ADJOINT_CHECKPOINTING", Unst_AdjointCheckpointing, false);
+  /* DESCRIPTION: Interval of the direct restart files used as checkpoints (WRT_SOL_FREQ_DUALTIME of the direct run) */
+  addUnsignedLongOption("UNST_ADJOINT_CHECKPOINT_FREQ", Unst_AdjointCheckpointFreq, 1);
+  /* DESCRIPTION: Number of direct solutions kept in memory during the recomputation */
+  addUnsignedLongOption("UNST_ADJOINT_SNAPSHOTS", Unst_AdjointSnapshots, 10);
+  /* DESCRIPTION: Compare the recomputed direct solutions with the restart files that exist for them, stop if the
+   maximum relative difference exceeds this tolerance (0 disables the comparison) */
+  addDoubleOption("UNST_ADJOINT_CHECKPOINT_VERIFY", Unst_AdjointCheckpointVerify, 0.0);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Iteration number to begin unsteady restarts (structural analysis) */
@@ -1303,6 +1382,28 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("LINEAR_SOLVER_ITER_HEAT", Linear_Solver_Iter_Heat, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Maximum number of levels of the AMG preconditioner, including the finest */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", AMG_MaxLevels, 10);
+  /* DESCRIPTION: Number of points below which an AMG level is not coarsened further */
+  addUnsignedLongOption("LINEAR_SOLVER_AMG_MIN_POINTS", AMG_MinPoints, 100);
+  /* DESCRIPTION: Strength of connection threshold of the AMG aggregation */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", AMG_Strength, 0.08);
+  /* DESCRIPTION: Largest ratio of coarse to fine points for which a coarse AMG level is kept */
+  addDoubleOption("LINEAR_SOLVER_AMG_COARSENING_RATIO", AMG_CoarseningRatio, 0.8);
+  /* DESCRIPTION: Symmetric Gauss-Seidel sweeps on the coarsest AMG level */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_COARSE_SWEEPS", AMG_CoarseSweeps, 10);
+  /* DESCRIPTION: Store the preconditioner factors (ILU, Jacobi, linelet) in single precision */
+  addBoolOption("LINEAR_SOLVER_MIXED_PRECISION", Linear_Solver_Mixed_Precision, false);
+  /* DESCRIPTION: Number of iterations between two assemblies of the flow Jacobian and its preconditioner (1 assembles every iteration) */
+  addUnsignedLongOption("JACOBIAN_REUSE_FREQ", Jacobian_Reuse_Freq, 1);
+  /* DESCRIPTION: The flow Jacobian is assembled again when the residual of an iteration is above this fraction of the previous one */
+  addDoubleOption("JACOBIAN_REUSE_STALL", Jacobian_Reuse_Stall, 1.0);
+  /* DESCRIPTION: Jacobian-free Newton-Krylov for the flow equations, the assembled Jacobian is only used as preconditioner */
+  addBoolOption("NEWTON_KRYLOV", Newton_Krylov, false);
+  /* DESCRIPTION: Relative step of the finite difference Jacobian-vector products of the Newton-Krylov method */
+  addDoubleOption("NEWTON_KRYLOV_STEP", Newton_Krylov_Step, 1E-7);
+  /* DESCRIPTION: Number of iterations with the assembled Jacobian before switching to Newton-Krylov */
+  addUnsignedLongOption("NEWTON_KRYLOV_STARTUP_ITER", Newton_Krylov_StartUp_Iter, 0);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
@@ -1548,6 +1649,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("FROZEN_LIMITER_DISC", Frozen_Limiter_Disc, false);
   /* DESCRIPTION: Use an inconsistent (primal/dual) discrete adjoint formulation */
   addBoolOption("INCONSISTENT_DISC", Inconsistent_Disc, false);
+  /* DESCRIPTION: Write the statistics (size, number of statements) of the AD tape after the recording */
+  addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
    /* DESCRIPTION:  */
   addDoubleOption("FIX_AZIMUTHAL_LINE", FixAzimuthalLine, 90.0);
   /*!\brief SENS_REMOVE_SHARP
@@ -1557,6 +1660,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Automatically reorient elements that seem flipped */
   addBoolOption("REORIENT_ELEMENTS",ReorientElements, true);
 
+  /*!\brief POINT_RENUMBERING \n DESCRIPTION: Local renumbering of the points after the partitioning, to improve the memory locality of the edge loops and the bandwidth of the Jacobian. \n OPTIONS: see \link Renumbering_Map \endlink \n DEFAULT: LEGACY_RCM \ingroup Config */
+  addEnumOption("POINT_RENUMBERING", Kind_Renumbering, Renumbering_Map, LEGACY_RCM_RENUMBERING);
+
   /*!\par CONFIG_CATEGORY: Input/output files and formats \ingroup Config */
   /*--- Options related to input/output files and formats ---*/
 
@@ -1696,6 +1802,15 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief CONSOLE_OUTPUT_VERBOSITY
    *  \n DESCRIPTION: Verbosity level for console output  \ingroup Config*/
   addEnumOption("CONSOLE_OUTPUT_VERBOSITY", Console_Output_Verb, Verb_Map, VERB_HIGH);
+  /*!\brief PROFILING
+   *  \n DESCRIPTION: Accumulate the timings of the profiled regions and write profiling.csv  \ingroup Config*/
+  addBoolOption("PROFILING", Profiling, false);
+  /*!\brief PROFILING_TRACE
+   *  \n DESCRIPTION: Write a timeline of the profiled regions to profiling_trace.json  \ingroup Config*/
+  addBoolOption("PROFILING_TRACE", Profiling_Trace, false);
+  /*!\brief PROFILING_TRACE_SIZE
+   *  \n DESCRIPTION: Number of events kept per rank for the timeline  \ingroup Config*/
+  addUnsignedLongOption("PROFILING_TRACE_SIZE", Profiling_Trace_Size, 100000);
 
 
   /*!\par CONFIG_CATEGORY: Dynamic mesh definition \ingroup Config*/
@@ -1940,6 +2055,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
 
   /* DESCRIPTION: Number of aligned bytes for the matrix multiplications. Multiple of 64. (128 by default) */
   addUnsignedShortOption("ALIGNED_BYTES_MATMUL", byteAlignmentMatMul, 128);
+  /* DESCRIPTION: Number of elements per chunk of the threaded DG task executor (64 by default) */
+  addUnsignedLongOption("ELEM_CHUNK_SIZE_DGFEM", ElemChunkSize_DGFEM, 64);
 
   /*!\par CONFIG_CATEGORY: FEA solver \ingroup Config*/
   /*--- Options related to the FEA solver ---*/
@@ -2148,6 +2265,21 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Radius for radial basis function */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PARAMETER", RadialBasisFunction_Parameter, 1);
 
+  /*  DESCRIPTION: Solve the radial basis function interpolation system in sparse form (only for basis functions of compact support).
+  *  Options: NO, YES \ingroup Config */
+  addBoolOption("RADIAL_BASIS_FUNCTION_SPARSE", RadialBasisFunction_Sparse, false);
+
+  /* DESCRIPTION: Relative magnitude below which radial basis function interpolation coefficients are discarded
+   (negative: 1E-6 for the sparse form, 0 for the dense form) */
+  addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, -1.0);
+
+  /* DESCRIPTION: Radius of the patch of donor points of the sparse radial basis function interpolation, in support radii */
+  addDoubleOption("RADIAL_BASIS_FUNCTION_SPARSE_PATCH", RadialBasisFunction_Patch, 3.0);
+
+  /*  DESCRIPTION: Keep the interface connectivity and the donor search of the sliding mesh interpolation between updates.
+  *  Options: NO, YES \ingroup Config */
+  addBoolOption("SLIDING_INTERFACE_INCREMENTAL", SlidingMesh_Incremental, false);
+
   /* DESCRIPTION: Maximum number of FSI iterations */
   addUnsignedShortOption("FSI_ITER", nIterFSI, 1);
   /* DESCRIPTION: Number of FSI iterations during which a ramp is applied */
@@ -2588,6 +2720,23 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
 
+  /*--- The asynchronous output needs threads. ---*/
+
+#ifndef HAVE_PTHREAD
+  if (Wrt_Async_Output) {
+    cout << "Asynchronous output requested but SU2 was built without thread support." << "\n";
+    Wrt_Async_Output = false;
+  }
+#endif
+
+  /*--- The chunked format is a binary format. It is always written synchronously (also
+   with WRT_ASYNC_OUTPUT), the index of the blocks needs the compressed sizes of all the ranks. ---*/
+
+  if (Wrt_Chunked_Restart && !Wrt_Binary_Restart) {
+    cout << "Chunked restart output is only available for binary restart files." << "\n";
+    Wrt_Chunked_Restart = false;
+  }
+
   /*--- Set the boolean Wall_Functions equal to true if there is a
    definition for the wall founctions ---*/
 
@@ -2604,7 +2753,28 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
 
     }
   }
-  
+
+  /*--- The sparse form of the radial basis function interpolation requires a basis of compact support ---*/
+
+  if (RadialBasisFunction_Sparse && (Kind_RadialBasisFunction != WENDLAND_C2))
+    SU2_MPI::Error(string("RADIAL_BASIS_FUNCTION_SPARSE requires a basis function of compact support (WENDLAND_C2).\n"), CURRENT_FUNCTION);
+
+  if (RadialBasisFunction_Sparse && (RadialBasisFunction_Patch < 1.0))
+    SU2_MPI::Error(string("RADIAL_BASIS_FUNCTION_SPARSE_PATCH must be at least 1 (one support radius).\n"), CURRENT_FUNCTION);
+
+  /*--- By default the weights of the sparse form are pruned, which bounds the number of donors of each target point ---*/
+
+  if (RadialBasisFunction_PruneTol < 0.0)
+    RadialBasisFunction_PruneTol = RadialBasisFunction_Sparse? 1E-6 : 0.0;
+
+  /*--- Parameters of the AMG preconditioner ---*/
+
+  if ((AMG_MaxLevels < 1) || (AMG_CoarseSweeps < 1))
+    SU2_MPI::Error(string("LINEAR_SOLVER_AMG_LEVELS and LINEAR_SOLVER_AMG_COARSE_SWEEPS must be at least 1.\n"), CURRENT_FUNCTION);
+
+  if ((AMG_CoarseningRatio <= 0.0) || (AMG_CoarseningRatio > 1.0) || (AMG_Strength < 0.0))
+    SU2_MPI::Error(string("LINEAR_SOLVER_AMG_COARSENING_RATIO must be in (0,1] and LINEAR_SOLVER_AMG_STRENGTH non negative.\n"), CURRENT_FUNCTION);
+
   /*--- Fixed CM mode requires a static movement of the grid ---*/
   
   if (Fixed_CM_Mode) {
@@ -3745,6 +3915,13 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     exit(EXIT_FAILURE);
   }
 
+  /* The element chunks of the threaded DG task executor cannot be empty. */
+  if( ElemChunkSize_DGFEM == 0 ) {
+    if(rank == MASTER_NODE)
+      cout << "ELEM_CHUNK_SIZE_DGFEM must be positive." << endl;
+    exit(EXIT_FAILURE);
+  }
+
   /* Determine the value of sizeMatMulPadding, which is the matrix size in
      the vectorization direction when padding is applied to have optimal
      performance in the matrix multiplications. */
@@ -4012,6 +4189,21 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                        CURRENT_FUNCTION);
       }
 
+      if (Unst_AdjointCheckpointing) {
+        if ((Unsteady_Simulation != DT_STEPPING_1ST) && (Unsteady_Simulation != DT_STEPPING_2ND)) {
+          SU2_MPI::Error("Checkpointing of the unsteady adjoint requires dual time stepping.", CURRENT_FUNCTION);
+        }
+        if (Weakly_Coupled_Heat || (nZone > 1)) {
+          SU2_MPI::Error("Checkpointing of the unsteady adjoint is only available for single zone flow problems.", CURRENT_FUNCTION);
+        }
+        if ((Kind_Turb_Model != NONE) && Frozen_Visc_Disc) {
+          SU2_MPI::Error("Checkpointing of the unsteady adjoint requires the turbulence model to be solved (FROZEN_VISC_DISC= NO).", CURRENT_FUNCTION);
+        }
+        if (Unst_AdjointCheckpointFreq == 0) {
+          SU2_MPI::Error("UNST_ADJOINT_CHECKPOINT_FREQ must be larger than 0.", CURRENT_FUNCTION);
+        }
+      }
+
       /*--- If the averaging interval is not set, we average over all time-steps ---*/
 
       if (Iter_Avg_Objective == 0.0) {
@@ -4061,6 +4253,40 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
      Kind_TimeIntScheme_Flow = Kind_TimeIntScheme_FEM_Flow;
   }
 
+  /*--- The flow Jacobian can only be frozen by the implicit finite volume solvers
+   of the primal problem, the discrete adjoint needs the exact linearization. ---*/
+
+  if (Jacobian_Reuse_Freq == 0) Jacobian_Reuse_Freq = 1;
+
+  if ((Jacobian_Reuse_Freq > 1) &&
+      (((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)) ||
+       (Kind_TimeIntScheme_Flow != EULER_IMPLICIT))) {
+    Jacobian_Reuse_Freq = 1;
+  }
+
+  /*--- The Newton-Krylov method needs a Krylov linear solver, and the diagonal of its
+   matrix-vector products does not include the low Mach number preconditioners. The
+   discrete adjoint of a Newton-Krylov primal uses the usual fixed point iteration. ---*/
+
+  if ((Kind_Solver == DISC_ADJ_EULER) || (Kind_Solver == DISC_ADJ_NAVIER_STOKES) ||
+      (Kind_Solver == DISC_ADJ_RANS)) {
+    Newton_Krylov = false;
+  }
+
+  if (Newton_Krylov) {
+    if (((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)) ||
+        (Kind_Regime != COMPRESSIBLE) || (Kind_TimeIntScheme_Flow != EULER_IMPLICIT)) {
+      SU2_MPI::Error("NEWTON_KRYLOV is only available for the implicit compressible flow solvers.", CURRENT_FUNCTION);
+    }
+    if ((Kind_Linear_Solver != BCGSTAB) && (Kind_Linear_Solver != FGMRES) &&
+        (Kind_Linear_Solver != RESTARTED_FGMRES) && (Kind_Linear_Solver != FGMRES_CGS)) {
+      SU2_MPI::Error("NEWTON_KRYLOV requires LINEAR_SOLVER= FGMRES, RESTARTED_FGMRES, FGMRES_CGS or BCGSTAB.", CURRENT_FUNCTION);
+    }
+    if ((Kind_Upwind_Flow == TURKEL) || Low_Mach_Precon) {
+      SU2_MPI::Error("NEWTON_KRYLOV is not compatible with the low Mach number preconditioners.", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- Set up the time stepping / unsteady CFL options. ---*/
   if ((Unsteady_Simulation == TIME_STEPPING) && (Unst_CFL != 0.0)) {
     for (iCFL = 0; iCFL < nCFL; iCFL++)
@@ -4155,6 +4381,16 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     }
   }
   
+  if (Kind_FluidModel == LUT_GAS) {
+    if (Kind_Regime == INCOMPRESSIBLE)
+      SU2_MPI::Error("FLUID_MODEL= LUT_GAS is for compressible flows only.", CURRENT_FUNCTION);
+    if ((Kind_LUT_Donor != IDEAL_GAS) && (Kind_LUT_Donor != VW_GAS) && (Kind_LUT_Donor != PR_GAS))
+      SU2_MPI::Error("LUT_DONOR_MODEL must be IDEAL_GAS, VW_GAS or PR_GAS.", CURRENT_FUNCTION);
+    if ((LUT_Pressure_Range[0] <= 0.0) || (LUT_Pressure_Range[1] <= LUT_Pressure_Range[0]) ||
+        (LUT_Temperature_Range[0] <= 0.0) || (LUT_Temperature_Range[1] <= LUT_Temperature_Range[0]))
+      SU2_MPI::Error("LUT_PRESSURE_RANGE and LUT_TEMPERATURE_RANGE must be positive and increasing.", CURRENT_FUNCTION);
+  }
+  
   if ((Kind_Regime == INCOMPRESSIBLE) && (Kind_FluidModel == INC_IDEAL_GAS_POLY)) {
     su2double sum = 0.0;
     for (unsigned short iVar = 0; iVar < nPolyCoeffs; iVar++) {
@@ -5840,22 +6076,47 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS: cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI: cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG: cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
+              if (Linear_Solver_Mixed_Precision) cout << "The preconditioner is stored in single precision." << endl;
+              if (Jacobian_Reuse_Freq > 1) cout << "The Jacobian and the preconditioner are assembled at most every " << Jacobian_Reuse_Freq << " iterations." << endl;
+              if (Newton_Krylov) cout << "Jacobian-free Newton-Krylov, the assembled Jacobian is used as preconditioner." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of linear iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
             case FGMRES:
             case RESTARTED_FGMRES:
+            case FGMRES_CGS:
               cout << "FGMRES is used for solving the linear system." << endl;
+              if (Kind_Linear_Solver == FGMRES_CGS) cout << "The Krylov basis is orthogonalized with classical Gram-Schmidt." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS: cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI: cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG: cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
+              if (Linear_Solver_Mixed_Precision) cout << "The preconditioner is stored in single precision." << endl;
+              if (Jacobian_Reuse_Freq > 1) cout << "The Jacobian and the preconditioner are assembled at most every " << Jacobian_Reuse_Freq << " iterations." << endl;
+              if (Newton_Krylov) cout << "Jacobian-free Newton-Krylov, the assembled Jacobian is used as preconditioner." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of linear iterations: "<< Linear_Solver_Iter <<"."<< endl;
                break;
+            case PIPELINED_CG:
+              cout << "A pipelined Conjugate Gradient method is used for solving the linear system." << endl;
+              switch (Kind_Linear_Solver_Prec) {
+                case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
+                case LU_SGS: cout << "Using a LU-SGS preconditioning."<< endl; break;
+                case JACOBI: cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG: cout << "Using an algebraic multigrid preconditioning."<< endl; break;
+              }
+              if (Linear_Solver_Mixed_Precision) cout << "The preconditioner is stored in single precision." << endl;
+              if (Jacobian_Reuse_Freq > 1) cout << "The Jacobian and the preconditioner are assembled at most every " << Jacobian_Reuse_Freq << " iterations." << endl;
+              if (Newton_Krylov) cout << "Jacobian-free Newton-Krylov, the assembled Jacobian is used as preconditioner." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of linear iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
             case SMOOTHER_JACOBI:
               cout << "A Jacobi method is used for smoothing the linear system." << endl;
               break;
@@ -5895,12 +6156,12 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case FGMRES_CGS:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case CONJUGATE_GRADIENT:
+            case CONJUGATE_GRADIENT: case PIPELINED_CG:
               cout << "A Conjugate Gradient method is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -7257,6 +7518,8 @@ CConfig::~CConfig(void) {
   if (default_inc_crit      != NULL) delete [] default_inc_crit;
   if (default_htp_axis      != NULL) delete [] default_htp_axis;
   if (default_body_force    != NULL) delete [] default_body_force;
+  if (default_lut_pressure  != NULL) delete [] default_lut_pressure;
+  if (default_lut_temperature != NULL) delete [] default_lut_temperature;
   if (default_sineload_coeff!= NULL) delete [] default_sineload_coeff;
   if (default_nacelle_location    != NULL) delete [] default_nacelle_location;
   
@@ -8686,46 +8949,129 @@ su2double CConfig::GetSpline(vector<su2double>&xa, vector<su2double>&ya, vector<
   return y;
 }
 
-void CConfig::Tick(double *val_start_time) {
-
-#ifdef PROFILE
+/*!
+ * \brief Wall clock time used by the profiling timers.
+ */
+static inline double Profile_WallTime(void) {
 #ifndef HAVE_MPI
-  *val_start_time = double(clock())/double(CLOCKS_PER_SEC);
+  return double(clock())/double(CLOCKS_PER_SEC);
 #else
-  *val_start_time = MPI_Wtime();
+  return MPI_Wtime();
 #endif
+}
 
-#endif
+void CConfig::InitProfiling(void) {
+
+  if (Profile_Initialized) return;
+  Profile_Initialized = true;
+
+  Profile_Enabled    = Profiling;
+  Profile_Trace      = Profiling && Profiling_Trace;
+  Profile_Trace_Size = Profiling_Trace_Size;
+  Profile_Start_Time = Profile_WallTime();
+
+  /*--- Preregister the regions that are instrumented in the code, their
+   IDs are the values of ENUM_PROFILE_REGION and are the same on all ranks. ---*/
+
+  RegisterProfileRegion("Iteration",         0);
+  RegisterProfileRegion("Preprocess",        0);
+  RegisterProfileRegion("Run",               0);
+  RegisterProfileRegion("Update",            0);
+  RegisterProfileRegion("Monitor",           0);
+  RegisterProfileRegion("Output",            0);
+  RegisterProfileRegion("Linear_Solver",     1);
+  RegisterProfileRegion("Mesh_Deformation",  1);
+
+  if (Profile_Trace) {
+    Profile_Trace_Region.resize(Profile_Trace_Size);
+    Profile_Trace_Begin.resize(Profile_Trace_Size);
+    Profile_Trace_Duration.resize(Profile_Trace_Size);
+  }
 
 }
 
-void CConfig::Tock(double val_start_time, string val_function_name, int val_group_id) {
+unsigned short CConfig::RegisterProfileRegion(string val_region_name, int val_group_id) {
 
-#ifdef PROFILE
+  map<string, unsigned short>::iterator it = Profile_Region_Map.find(val_region_name);
+  if (it != Profile_Region_Map.end()) return it->second;
 
-  double val_stop_time = 0.0, val_elapsed_time = 0.0;
+  unsigned short region_id = Profile_Name.size();
+  Profile_Region_Map[val_region_name] = region_id;
 
-#ifndef HAVE_MPI
-  val_stop_time = double(clock())/double(CLOCKS_PER_SEC);
-#else
-  val_stop_time = MPI_Wtime();
-#endif
+  Profile_Name.push_back(val_region_name);
+  Profile_Group.push_back(val_group_id);
+  Profile_Parent.push_back(-1);
+  Profile_NCalls.push_back(0);
+  Profile_TotTime.push_back(0.0);
+  Profile_SelfTime.push_back(0.0);
+  Profile_MinTime.push_back(1e10);
+  Profile_MaxTime.push_back(0.0);
 
-  /*--- Compute the elapsed time for this subroutine ---*/
-  val_elapsed_time = val_stop_time - val_start_time;
+  return region_id;
 
-  /*--- Store the subroutine name and the elapsed time ---*/
-  Profile_Function_tp.push_back(val_function_name);
-  Profile_Time_tp.push_back(val_elapsed_time);
-  Profile_ID_tp.push_back(val_group_id);
+}
 
-#endif
+void CConfig::Tick(double *val_start_time, unsigned short val_region_id) {
+
+  /*--- Only the master thread times regions, nested scopes are tracked with
+   a stack holding the region and the time spent in its children. ---*/
+
+  if (!Profile_Enabled || (SU2_OMP_GetThreadID() != 0)) return;
+
+  *val_start_time = Profile_WallTime();
+
+  Profile_Stack_Region.push_back(val_region_id);
+  Profile_Stack_Child.push_back(0.0);
+
+}
+
+void CConfig::Tock(double val_start_time, unsigned short val_region_id) {
+
+  if (!Profile_Enabled || (SU2_OMP_GetThreadID() != 0)) return;
+
+  double val_stop_time = Profile_WallTime();
+
+  /*--- Compute the elapsed time for this region and the part of it that
+   was not spent in nested regions. ---*/
+
+  double val_elapsed_time = val_stop_time - val_start_time;
+  double val_child_time = 0.0;
+
+  if (!Profile_Stack_Child.empty()) {
+    val_child_time = Profile_Stack_Child.back();
+    Profile_Stack_Child.pop_back();
+    Profile_Stack_Region.pop_back();
+  }
+
+  if (!Profile_Stack_Child.empty()) {
+    Profile_Stack_Child.back() += val_elapsed_time;
+    if (Profile_Parent[val_region_id] == -1)
+      Profile_Parent[val_region_id] = Profile_Stack_Region.back();
+  }
+
+  /*--- Accumulate the statistics, the memory used does not grow with the number of calls. ---*/
+
+  Profile_NCalls[val_region_id]++;
+  Profile_TotTime[val_region_id]  += val_elapsed_time;
+  Profile_SelfTime[val_region_id] += val_elapsed_time - val_child_time;
+  Profile_MinTime[val_region_id]   = min(Profile_MinTime[val_region_id], val_elapsed_time);
+  Profile_MaxTime[val_region_id]   = max(Profile_MaxTime[val_region_id], val_elapsed_time);
+
+  /*--- Store the event in the ring buffer of the timeline. ---*/
+
+  if (Profile_Trace && (Profile_Trace_Size > 0)) {
+    unsigned long index = Profile_Trace_Count % Profile_Trace_Size;
+    Profile_Trace_Region[index]   = val_region_id;
+    Profile_Trace_Begin[index]    = val_start_time - Profile_Start_Time;
+    Profile_Trace_Duration[index] = val_elapsed_time;
+    Profile_Trace_Count++;
+  }
 
 }
 
 void CConfig::SetProfilingCSV(void) {
 
-#ifdef PROFILE
+  if (!Profile_Enabled) return;
 
   int rank = MASTER_NODE;
   int size = SINGLE_NODE;
@@ -8734,160 +9080,185 @@ void CConfig::SetProfilingCSV(void) {
   SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
 #endif
 
-  /*--- Each rank has the same stack trace, so the they have the same
-   function calls and ordering in the vectors. We're going to reduce
-   the timings from each rank and extract the avg, min, and max timings. ---*/
+  /*--- The preregistered regions have the same IDs everywhere, regions that
+   are registered on the fly must be registered in the same order on all
+   ranks. Only the regions that exist on all ranks are reduced. ---*/
 
-  /*--- First, create a local mapping, so that we can extract the
-   min and max values for each function. ---*/
-
-  for (unsigned int i = 0; i < Profile_Function_tp.size(); i++) {
+  int nRegion = Profile_Name.size(), nRegion_Min = nRegion, nRegion_Max = nRegion;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nRegion, &nRegion_Min, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nRegion, &nRegion_Max, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  if ((rank == MASTER_NODE) && (nRegion_Min != nRegion_Max))
+    cout << "WARNING: The profiled regions differ between ranks, only the first " << nRegion_Min << " are reported." << endl;
+  nRegion = nRegion_Min;
 
-    /*--- Add the function and initialize if not already stored (the ID
-     only needs to be stored the first time).---*/
-    if (Profile_Map_tp.find(Profile_Function_tp[i]) == Profile_Map_tp.end()) {
+  /*--- Per rank values: calls, total and self time, and min/max time of one call. ---*/
 
-      vector<int> profile; profile.push_back(i);
-      Profile_Map_tp.insert(pair<string,vector<int> >(Profile_Function_tp[i],profile));
+  double *l_tot  = new double[nRegion], *l_self = new double[nRegion];
+  double *l_min  = new double[nRegion], *l_max  = new double[nRegion];
+  double *l_calls = new double[nRegion];
+  double *r_tot_sum = new double[nRegion], *r_tot_min = new double[nRegion], *r_tot_max = new double[nRegion];
+  double *r_self = new double[nRegion], *r_calls = new double[nRegion];
+  double *r_min  = new double[nRegion], *r_max = new double[nRegion];
 
-    } else {
+  for (int i = 0; i < nRegion; i++) {
+    l_calls[i] = double(Profile_NCalls[i]);
+    l_tot[i]   = Profile_TotTime[i];
+    l_self[i]  = Profile_SelfTime[i];
+    l_min[i]   = (Profile_NCalls[i] > 0)? Profile_MinTime[i] : 1e10;
+    l_max[i]   = Profile_MaxTime[i];
+  }
 
-      /*--- This function has already been added, so simply increment the
-       number of calls and total time for this function. ---*/
+#ifdef HAVE_MPI
+  MPI_Reduce(l_calls, r_calls,   nRegion, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(l_tot,   r_tot_sum, nRegion, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(l_tot,   r_tot_min, nRegion, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(l_tot,   r_tot_max, nRegion, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(l_self,  r_self,    nRegion, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(l_min,   r_min,     nRegion, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(l_max,   r_max,     nRegion, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  memcpy(r_calls,   l_calls, nRegion*sizeof(double));
+  memcpy(r_tot_sum, l_tot,   nRegion*sizeof(double));
+  memcpy(r_tot_min, l_tot,   nRegion*sizeof(double));
+  memcpy(r_tot_max, l_tot,   nRegion*sizeof(double));
+  memcpy(r_self,    l_self,  nRegion*sizeof(double));
+  memcpy(r_min,     l_min,   nRegion*sizeof(double));
+  memcpy(r_max,     l_max,   nRegion*sizeof(double));
+#endif
 
-      Profile_Map_tp[Profile_Function_tp[i]].push_back(i);
+  /*--- The master rank writes the file and prints the load imbalance
+   (max over ranks of the time in a region divided by the average). ---*/
 
-    }
-  }
+  if (rank == MASTER_NODE) {
 
-  /*--- We now have everything gathered by function name, so we can loop over
-   each function and store the min/max times. ---*/
+    ofstream Profile_File;
+    Profile_File.precision(15);
+    Profile_File.open("profiling.csv", ios::out);
 
-  int map_size = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-    map_size++;
-  }
+    Profile_File << "\"Region_Name\", \"Region_ID\", \"Group_ID\", \"Parent_Region\", \"N_Calls\", \"Avg_Total_Time\", \"Min_Total_Time\", \"Max_Total_Time\", \"Imbalance\", \"Avg_Self_Time\", \"Min_Time\", \"Max_Time\"" << endl;
 
-  /*--- Allocate and initialize memory ---*/
+    PrintingToolbox::CTablePrinter ProfileTable(&std::cout);
+    ProfileTable.AddColumn("Region", 20);
+    ProfileTable.AddColumn("Calls", 10);
+    ProfileTable.AddColumn("Avg Time", 12);
+    ProfileTable.AddColumn("Max Time", 12);
+    ProfileTable.AddColumn("Imbalance", 10);
+    ProfileTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
 
-  double *l_min_red = NULL, *l_max_red = NULL, *l_tot_red = NULL, *l_avg_red = NULL;
-  int *n_calls_red = NULL;
-  double* l_min = new double[map_size];
-  double* l_max = new double[map_size];
-  double* l_tot = new double[map_size];
-  double* l_avg = new double[map_size];
-  int* n_calls  = new int[map_size];
-  for (int i = 0; i < map_size; i++)
-  {
-    l_min[i]   = 1e10;
-    l_max[i]   = 0.0;
-    l_tot[i]   = 0.0;
-    l_avg[i]   = 0.0;
-    n_calls[i] = 0;
-  }
+    cout << endl <<"------------------------------ Profiling --------------------------------" << endl;
+    ProfileTable.PrintHeader();
 
-  /*--- Collect the info for each function from the current rank ---*/
+    for (int i = 0; i < nRegion; i++) {
+      if (r_calls[i] == 0.0) continue;
 
-  int func_counter = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
+      double avg_tot   = r_tot_sum[i]/double(size);
+      double imbalance = (avg_tot > 0.0)? r_tot_max[i]/avg_tot : 1.0;
+      string parent    = (Profile_Parent[i] >= 0)? Profile_Name[Profile_Parent[i]] : string("-");
 
-    for (unsigned int i = 0; i < (it->second).size(); i++) {
-      n_calls[func_counter]++;
-      l_tot[func_counter] += Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] < l_min[func_counter])
-        l_min[func_counter] = Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] > l_max[func_counter])
-        l_max[func_counter] = Profile_Time_tp[(it->second)[i]];
+      Profile_File << scientific << Profile_Name[i] << ", " << i << ", " << Profile_Group[i] << ", " << parent << ", "
+                   << (unsigned long)(r_calls[i]/double(size)) << ", " << avg_tot << ", " << r_tot_min[i] << ", "
+                   << r_tot_max[i] << ", " << imbalance << ", " << r_self[i]/double(size) << ", "
+                   << r_min[i] << ", " << r_max[i] << endl;
 
+      ProfileTable << Profile_Name[i] << (unsigned long)(r_calls[i]/double(size)) << avg_tot << r_tot_max[i] << imbalance;
     }
-    l_avg[func_counter] = l_tot[func_counter]/((double)n_calls[func_counter]);
-    func_counter++;
-  }
 
-  /*--- Now reduce the data ---*/
+    ProfileTable.PrintFooter();
+    Profile_File.close();
 
-  if (rank == MASTER_NODE) {
-    l_min_red = new double[map_size];
-    l_max_red = new double[map_size];
-    l_tot_red = new double[map_size];
-    l_avg_red = new double[map_size];
-    n_calls_red  = new int[map_size];
   }
 
-#ifdef HAVE_MPI
-  MPI_Reduce(n_calls, n_calls_red, map_size, MPI_INT, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_tot, l_tot_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_avg, l_avg_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_min, l_min_red, map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_max, l_max_red, map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-#else
-  memcpy(n_calls_red, n_calls, map_size*sizeof(int));
-  memcpy(l_tot_red,   l_tot,   map_size*sizeof(double));
-  memcpy(l_avg_red,   l_avg,   map_size*sizeof(double));
-  memcpy(l_min_red,   l_min,   map_size*sizeof(double));
-  memcpy(l_max_red,   l_max,   map_size*sizeof(double));
-#endif
+  delete [] l_tot; delete [] l_self; delete [] l_min; delete [] l_max; delete [] l_calls;
+  delete [] r_tot_sum; delete [] r_tot_min; delete [] r_tot_max;
+  delete [] r_self; delete [] r_calls; delete [] r_min; delete [] r_max;
 
-  /*--- The master rank will write the file ---*/
+  if (Profile_Trace) SetProfilingTrace();
 
-  if (rank == MASTER_NODE) {
+}
 
-    /*--- Take averages over all ranks on the master ---*/
+void CConfig::SetProfilingTrace(void) {
 
-    for (int i = 0; i < map_size; i++) {
-      l_tot_red[i]   = l_tot_red[i]/(double)size;
-      l_avg_red[i]   = l_avg_red[i]/(double)size;
-      n_calls_red[i] = n_calls_red[i]/size;
-    }
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  SU2_MPI::Comm_rank(MPI_COMM_WORLD, &rank);
+  SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+#endif
 
-    /*--- Now write a CSV file with the processed results ---*/
+  /*--- Pack the events kept in the ring buffer, oldest first, as
+   (region, begin, duration) triplets. ---*/
 
-    char cstr[200];
-    ofstream Profile_File;
-    strcpy (cstr, "profiling.csv");
+  unsigned long nEvent = min(Profile_Trace_Count, Profile_Trace_Size);
+  unsigned long first = (Profile_Trace_Count > Profile_Trace_Size)? Profile_Trace_Count % Profile_Trace_Size : 0;
 
-    /*--- Prepare and open the file ---*/
+  vector<double> events(3*nEvent);
+  for (unsigned long i = 0; i < nEvent; i++) {
+    unsigned long index = (first + i) % Profile_Trace_Size;
+    events[3*i+0] = Profile_Trace_Region[index];
+    events[3*i+1] = Profile_Trace_Begin[index];
+    events[3*i+2] = Profile_Trace_Duration[index];
+  }
 
-    Profile_File.precision(15);
-    Profile_File.open(cstr, ios::out);
+  /*--- The master receives the events one rank at a time and writes a single
+   timeline in the Chrome trace format (chrome://tracing), one process per rank. ---*/
 
-    /*--- Create the CSV header ---*/
+  if (rank == MASTER_NODE) {
 
-    Profile_File << "\"Function_Name\", \"N_Calls\", \"Avg_Total_Time\", \"Avg_Time\", \"Min_Time\", \"Max_Time\", \"Function_ID\"" << endl;
+    ofstream Trace_File;
+    Trace_File.precision(15);
+    Trace_File.open("profiling_trace.json", ios::out);
+    Trace_File << "{\"traceEvents\":[" << endl;
 
-    /*--- Loop through the map and write the results to the file ---*/
+    bool first_event = true;
+    for (int iRank = 0; iRank < size; iRank++) {
 
-    func_counter = 0;
-    for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
+      vector<double> rank_events;
+      if (iRank == MASTER_NODE) {
+        rank_events = events;
+      }
+#ifdef HAVE_MPI
+      else {
+        SU2_MPI::Status status;
+        unsigned long nRecv = 0;
+        SU2_MPI::Recv(&nRecv, 1, MPI_UNSIGNED_LONG, iRank, iRank, MPI_COMM_WORLD, &status);
+        rank_events.resize(3*nRecv);
+        if (nRecv > 0)
+          SU2_MPI::Recv(&rank_events[0], 3*nRecv, MPI_DOUBLE, iRank, iRank, MPI_COMM_WORLD, &status);
+      }
+#endif
 
-      Profile_File << scientific << it->first << ", " << n_calls_red[func_counter] << ", " << l_tot_red[func_counter] << ", " << l_avg_red[func_counter] << ", " << l_min_red[func_counter] << ", " << l_max_red[func_counter] << ", " << (int)Profile_ID_tp[(it->second)[0]] << endl;
-      func_counter++;
+      for (unsigned long i = 0; i < rank_events.size()/3; i++) {
+        unsigned short region = (unsigned short)rank_events[3*i+0];
+        if (region >= Profile_Name.size()) continue;
+        if (!first_event) Trace_File << "," << endl;
+        Trace_File << fixed << "{\"name\":\"" << Profile_Name[region] << "\",\"cat\":\"group" << Profile_Group[region]
+                   << "\",\"ph\":\"X\",\"pid\":" << iRank << ",\"tid\":0,\"ts\":" << 1e6*rank_events[3*i+1]
+                   << ",\"dur\":" << 1e6*rank_events[3*i+2] << "}";
+        first_event = false;
+      }
     }
 
-    Profile_File.close();
+    Trace_File << endl << "]}" << endl;
+    Trace_File.close();
 
   }
-
-  delete [] l_min;
-  delete [] l_max;
-  delete [] l_avg;
-  delete [] l_tot;
-  delete [] n_calls;
-  if (rank == MASTER_NODE) {
-    delete [] l_min_red;
-    delete [] l_max_red;
-    delete [] l_avg_red;
-    delete [] l_tot_red;
-    delete [] n_calls_red;
+#ifdef HAVE_MPI
+  else {
+    SU2_MPI::Send(&nEvent, 1, MPI_UNSIGNED_LONG, MASTER_NODE, rank, MPI_COMM_WORLD);
+    if (nEvent > 0)
+      SU2_MPI::Send(&events[0], 3*nEvent, MPI_DOUBLE, MASTER_NODE, rank, MPI_COMM_WORLD);
   }
-
 #endif
 
 }
 
 void CConfig::GEMM_Tick(double *val_start_time) {
 
-#ifdef PROFILE
+  /*--- Same rules as Tick, only the calls of the master thread are timed. ---*/
+
+  if (!Profile_Enabled || (SU2_OMP_GetThreadID() != 0)) return;
 
 #ifdef HAVE_MKL
   *val_start_time = dsecnd();
@@ -8897,13 +9268,11 @@ void CConfig::GEMM_Tick(double *val_start_time) {
   *val_start_time = double(clock())/double(CLOCKS_PER_SEC);
 #endif
 
-#endif
-
 }
 
 void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) {
 
-#ifdef PROFILE
+  if (!Profile_Enabled || (SU2_OMP_GetThreadID() != 0)) return;
 
   /* Determine the timing value. The actual function called depends on
      the type of executable. */
@@ -8946,13 +9315,11 @@ void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) {
     GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
   }
 
-#endif
-
 }
 
 void CConfig::GEMMProfilingCSV(void) {
 
-#ifdef PROFILE
+  if (!Profile_Enabled) return;
 
   /* Initialize the rank to the master node. */
   int rank = MASTER_NODE;
@@ -9056,8 +9423,8 @@ void CConfig::GEMMProfilingCSV(void) {
 
 #endif
 
-  /*--- The master rank will write the file ---*/
-  if (rank == MASTER_NODE) {
+  /*--- The master rank will write the file, if any GEMM was timed. ---*/
+  if ((rank == MASTER_NODE) && !GEMM_Profile_MNK.empty()) {
 
     /* Store the elements of the map GEMM_Profile_MNK in
        vectors for post processing reasons. */
@@ -9113,8 +9480,6 @@ void CConfig::GEMMProfilingCSV(void) {
     Profile_File.close();
   }
 
-#endif
-
 }
 
 void CConfig::SetFreeStreamTurboNormal(su2double* turboNormal){
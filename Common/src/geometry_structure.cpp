@@ -111,6 +111,36 @@ CGeometry::CGeometry(void) {
   CustomBoundaryHeatFlux = NULL;      //Customized heat flux wall
   CustomBoundaryTemperature = NULL;   //Customized temperature wall
 
+  /*--- Point-to-point (halo exchange) communication structures ---*/
+
+  P2PComms_Preprocessed  = false;
+  countPerPoint          = 0;
+  nP2PSend               = 0;
+  nP2PRecv               = 0;
+  nPoint_P2PSend         = NULL;
+  nPoint_P2PRecv         = NULL;
+  Neighbors_P2PSend      = NULL;
+  Neighbors_P2PRecv      = NULL;
+  Local_Point_P2PSend    = NULL;
+  Local_Point_P2PRecv    = NULL;
+  Local_Rotation_P2PRecv = NULL;
+  bufD_P2PSend           = NULL;
+  bufD_P2PRecv           = NULL;
+  req_P2PSend            = NULL;
+  req_P2PRecv            = NULL;
+
+  /*--- Edge coloring for the threaded edge loops ---*/
+
+  nEdgeColor     = 0;
+  EdgeColorStart = NULL;
+  EdgeColorList  = NULL;
+
+  /*--- Least-squares gradient weights ---*/
+
+  LSWeights_Updated = false;
+  LSWeightsStart    = NULL;
+  LSWeights         = NULL;
+
 }
 
 CGeometry::~CGeometry(void) {
@@ -198,6 +228,438 @@ CGeometry::~CGeometry(void) {
     delete [] CustomBoundaryTemperature;
   }
 
+  FreeP2PComms();
+
+  if (nPoint_P2PSend         != NULL) delete [] nPoint_P2PSend;
+  if (nPoint_P2PRecv         != NULL) delete [] nPoint_P2PRecv;
+  if (Neighbors_P2PSend      != NULL) delete [] Neighbors_P2PSend;
+  if (Neighbors_P2PRecv      != NULL) delete [] Neighbors_P2PRecv;
+  if (Local_Point_P2PSend    != NULL) delete [] Local_Point_P2PSend;
+  if (Local_Point_P2PRecv    != NULL) delete [] Local_Point_P2PRecv;
+  if (Local_Rotation_P2PRecv != NULL) delete [] Local_Rotation_P2PRecv;
+
+  if (EdgeColorStart != NULL) delete [] EdgeColorStart;
+  if (EdgeColorList  != NULL) delete [] EdgeColorList;
+
+  if (LSWeightsStart != NULL) delete [] LSWeightsStart;
+  if (LSWeights      != NULL) delete [] LSWeights;
+
+}
+
+void CGeometry::PreprocessP2PComms(CConfig *config) {
+
+  unsigned short iMarker, MarkerS, MarkerR;
+  unsigned long iVertex, nVertexS, nVertexR;
+  int iSend = 0, iRecv = 0;
+
+  /*--- Release any previous pattern (e.g. when called again after
+   re-partitioning) before building the new one. ---*/
+
+  FreeP2PComms();
+
+  if (nPoint_P2PSend         != NULL) delete [] nPoint_P2PSend;
+  if (nPoint_P2PRecv         != NULL) delete [] nPoint_P2PRecv;
+  if (Neighbors_P2PSend      != NULL) delete [] Neighbors_P2PSend;
+  if (Neighbors_P2PRecv      != NULL) delete [] Neighbors_P2PRecv;
+  if (Local_Point_P2PSend    != NULL) delete [] Local_Point_P2PSend;
+  if (Local_Point_P2PRecv    != NULL) delete [] Local_Point_P2PRecv;
+  if (Local_Rotation_P2PRecv != NULL) delete [] Local_Rotation_P2PRecv;
+
+  /*--- Count the send/receive marker pairs. As in the rest of the code, a
+   send marker (positive SendRecv) is always followed by its receive marker. ---*/
+
+  nP2PSend = 0; nP2PRecv = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      nP2PSend++; nP2PRecv++;
+    }
+  }
+
+  nPoint_P2PSend    = new int[nP2PSend+1];
+  nPoint_P2PRecv    = new int[nP2PRecv+1];
+  Neighbors_P2PSend = new int[nP2PSend];
+  Neighbors_P2PRecv = new int[nP2PRecv];
+
+  /*--- Store the neighbors and the number of vertices of each message
+   in cumulative storage format. ---*/
+
+  nPoint_P2PSend[0] = 0; nPoint_P2PRecv[0] = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+
+#ifdef HAVE_MPI
+      Neighbors_P2PSend[iSend] = config->GetMarker_All_SendRecv(MarkerS)-1;
+      Neighbors_P2PRecv[iRecv] = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+#else
+      Neighbors_P2PSend[iSend] = rank;
+      Neighbors_P2PRecv[iRecv] = rank;
+#endif
+
+      nPoint_P2PSend[iSend+1] = nPoint_P2PSend[iSend] + nVertex[MarkerS];
+      nPoint_P2PRecv[iRecv+1] = nPoint_P2PRecv[iRecv] + nVertex[MarkerR];
+
+      iSend++; iRecv++;
+    }
+  }
+
+  /*--- Store the local points (and periodic transformation of the received
+   points) so that packing/unpacking does not need the vertex structure. ---*/
+
+  Local_Point_P2PSend    = new unsigned long[nPoint_P2PSend[nP2PSend]];
+  Local_Point_P2PRecv    = new unsigned long[nPoint_P2PRecv[nP2PRecv]];
+  Local_Rotation_P2PRecv = new unsigned short[nPoint_P2PRecv[nP2PRecv]];
+
+  iSend = 0; iRecv = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+      nVertexS = nVertex[MarkerS];  nVertexR = nVertex[MarkerR];
+
+      for (iVertex = 0; iVertex < nVertexS; iVertex++)
+        Local_Point_P2PSend[nPoint_P2PSend[iSend]+iVertex] = vertex[MarkerS][iVertex]->GetNode();
+
+      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+        Local_Point_P2PRecv[nPoint_P2PRecv[iRecv]+iVertex]    = vertex[MarkerR][iVertex]->GetNode();
+        Local_Rotation_P2PRecv[nPoint_P2PRecv[iRecv]+iVertex] = vertex[MarkerR][iVertex]->GetRotation_Type();
+      }
+
+      iSend++; iRecv++;
+    }
+  }
+
+  P2PComms_Preprocessed = true;
+
+}
+
+void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
+
+  /*--- The buffers only grow, so after the first few exchanges this is a no-op. ---*/
+
+  if (val_countPerPoint <= countPerPoint) return;
+
+  /*--- The persistent requests are bound to the old buffers, release them. ---*/
+
+  FreeP2PComms();
+
+  countPerPoint = val_countPerPoint;
+
+  bufD_P2PSend = new su2double[countPerPoint*nPoint_P2PSend[nP2PSend]];
+  bufD_P2PRecv = new su2double[countPerPoint*nPoint_P2PRecv[nP2PRecv]];
+
+}
+
+void CGeometry::StartP2PComms(unsigned short val_countPerPoint) {
+
+#ifdef HAVE_MPI
+
+  int iSend, iRecv, offset, count;
+  const int nRequest = nP2PRecv + nP2PSend;
+
+  /*--- One set of requests per message size (recvs first, then sends),
+   created the first time that size is exchanged. ---*/
+
+  SU2_MPI::Request *req = NULL;
+  map<unsigned short, SU2_MPI::Request*>::iterator it = req_P2PPersistent.find(val_countPerPoint);
+
+  if (it != req_P2PPersistent.end()) {
+    req = it->second;
+  }
+  else {
+    req = new SU2_MPI::Request[nRequest];
+    req_P2PPersistent[val_countPerPoint] = req;
+
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+    for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+      offset = val_countPerPoint*nPoint_P2PRecv[iRecv];
+      count  = val_countPerPoint*(nPoint_P2PRecv[iRecv+1]-nPoint_P2PRecv[iRecv]);
+      SU2_MPI::Recv_init(&bufD_P2PRecv[offset], count, MPI_DOUBLE, Neighbors_P2PRecv[iRecv],
+                         0, MPI_COMM_WORLD, &req[iRecv]);
+    }
+    for (iSend = 0; iSend < nP2PSend; iSend++) {
+      offset = val_countPerPoint*nPoint_P2PSend[iSend];
+      count  = val_countPerPoint*(nPoint_P2PSend[iSend+1]-nPoint_P2PSend[iSend]);
+      SU2_MPI::Send_init(&bufD_P2PSend[offset], count, MPI_DOUBLE, Neighbors_P2PSend[iSend],
+                         0, MPI_COMM_WORLD, &req[nP2PRecv+iSend]);
+    }
+#endif
+  }
+
+  req_P2PRecv = req;
+  req_P2PSend = &req[nP2PRecv];
+
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+
+  /*--- The AD tools do not record persistent communication, post
+   regular non-blocking calls instead (still all at once). ---*/
+
+  for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    offset = val_countPerPoint*nPoint_P2PRecv[iRecv];
+    count  = val_countPerPoint*(nPoint_P2PRecv[iRecv+1]-nPoint_P2PRecv[iRecv]);
+    SU2_MPI::Irecv(&bufD_P2PRecv[offset], count, MPI_DOUBLE, Neighbors_P2PRecv[iRecv],
+                   0, MPI_COMM_WORLD, &req_P2PRecv[iRecv]);
+  }
+  for (iSend = 0; iSend < nP2PSend; iSend++) {
+    offset = val_countPerPoint*nPoint_P2PSend[iSend];
+    count  = val_countPerPoint*(nPoint_P2PSend[iSend+1]-nPoint_P2PSend[iSend]);
+    SU2_MPI::Isend(&bufD_P2PSend[offset], count, MPI_DOUBLE, Neighbors_P2PSend[iSend],
+                   0, MPI_COMM_WORLD, &req_P2PSend[iSend]);
+  }
+
+#else
+
+  SU2_MPI::Startall(nRequest, req);
+
+#endif
+
+#else
+
+  /*--- Without MPI the only pairs are periodic ones with ourselves. ---*/
+
+  unsigned long iBuf;
+  for (iBuf = 0; iBuf < (unsigned long)val_countPerPoint*nPoint_P2PRecv[nP2PRecv]; iBuf++)
+    bufD_P2PRecv[iBuf] = bufD_P2PSend[iBuf];
+
+#endif
+
+}
+
+void CGeometry::CompleteP2PComms(void) {
+
+#ifdef HAVE_MPI
+
+  /*--- Recvs and sends are contiguous in the request array. ---*/
+
+  SU2_MPI::Waitall(nP2PRecv+nP2PSend, req_P2PRecv, MPI_STATUSES_IGNORE);
+
+#endif
+
+}
+
+void CGeometry::FreeP2PComms(void) {
+
+  map<unsigned short, SU2_MPI::Request*>::iterator it;
+
+  for (it = req_P2PPersistent.begin(); it != req_P2PPersistent.end(); ++it) {
+#if defined HAVE_MPI && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+    for (int iReq = 0; iReq < nP2PRecv+nP2PSend; iReq++)
+      SU2_MPI::Request_free(&(it->second[iReq]));
+#endif
+    delete [] it->second;
+  }
+  req_P2PPersistent.clear();
+
+  req_P2PSend = NULL;
+  req_P2PRecv = NULL;
+
+  if (bufD_P2PSend != NULL) delete [] bufD_P2PSend;
+  if (bufD_P2PRecv != NULL) delete [] bufD_P2PRecv;
+  bufD_P2PSend  = NULL;
+  bufD_P2PRecv  = NULL;
+  countPerPoint = 0;
+
+}
+
+void CGeometry::SetEdgeColoring(void) {
+
+  unsigned long iEdge, iPoint, jPoint, iColor, nColor = 0;
+  unsigned short iNode, iMark;
+
+  if (EdgeColorStart != NULL) delete [] EdgeColorStart;
+  if (EdgeColorList  != NULL) delete [] EdgeColorList;
+  EdgeColorStart = NULL; EdgeColorList = NULL; nEdgeColor = 0;
+
+  if (nEdge == 0) return;
+
+  /*--- Greedy (first fit) coloring in the natural edge order: each edge gets
+   the lowest color not yet used by an edge sharing one of its points. The
+   colors in use at each point are kept in a short list, since the number of
+   neighbors of a point is small. ---*/
+
+  vector<vector<unsigned long> > PointColors(nPoint);
+  vector<unsigned long> EdgeColor(nEdge);
+  vector<unsigned long> ColorSize;
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+
+    iPoint = edge[iEdge]->GetNode(0);
+    jPoint = edge[iEdge]->GetNode(1);
+
+    for (iColor = 0; ; iColor++) {
+      bool used = false;
+      for (iNode = 0; iNode < 2 && !used; iNode++) {
+        const vector<unsigned long> &Colors = PointColors[(iNode == 0) ? iPoint : jPoint];
+        for (iMark = 0; iMark < Colors.size(); iMark++)
+          if (Colors[iMark] == iColor) { used = true; break; }
+      }
+      if (!used) break;
+    }
+
+    EdgeColor[iEdge] = iColor;
+    PointColors[iPoint].push_back(iColor);
+    PointColors[jPoint].push_back(iColor);
+
+    if (iColor >= nColor) { nColor = iColor+1; ColorSize.resize(nColor, 0); }
+    ColorSize[iColor]++;
+
+  }
+
+  /*--- Store the edges grouped by color (cumulative storage format). Within
+   a color the natural edge order is kept, to preserve the memory locality
+   of the grid numbering. ---*/
+
+  nEdgeColor = static_cast<unsigned short>(nColor);
+  EdgeColorStart = new unsigned long [nColor+1];
+  EdgeColorList  = new unsigned long [nEdge];
+
+  EdgeColorStart[0] = 0;
+  for (iColor = 0; iColor < nColor; iColor++)
+    EdgeColorStart[iColor+1] = EdgeColorStart[iColor] + ColorSize[iColor];
+
+  vector<unsigned long> Position(EdgeColorStart, EdgeColorStart+nColor);
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    EdgeColorList[Position[EdgeColor[iEdge]]++] = iEdge;
+
+}
+
+void CGeometry::SetLSWeights(CConfig *config) {
+
+  /*--- The discrete adjoint must record the dependence of the weights on
+   the coordinates, hence they are always recomputed in that case. ---*/
+
+  if (LSWeights_Updated && !config->GetDiscrete_Adjoint()) return;
+
+  unsigned long iPoint, jPoint;
+  unsigned short iDim, jDim, iNeigh;
+  su2double *Coord_i, *Coord_j, *Weight, weight, r11, r12, r13, r22, r23, r23_a,
+  r23_b, r33, z11, z12, z13, z22, z23, z33, detR2, Smatrix[3][3], Delta[3];
+  bool singular;
+
+  if (LSWeightsStart == NULL) {
+    LSWeightsStart = new unsigned long [nPointDomain+1];
+    LSWeightsStart[0] = 0;
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      LSWeightsStart[iPoint+1] = LSWeightsStart[iPoint] + node[iPoint]->GetnPoint();
+    LSWeights = new su2double [nDim*LSWeightsStart[nPointDomain]];
+  }
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    Coord_i = node[iPoint]->GetCoord();
+
+    r11 = 0.0; r12 = 0.0;   r13 = 0.0;    r22 = 0.0;
+    r23 = 0.0; r23_a = 0.0; r23_b = 0.0;  r33 = 0.0;
+
+    AD::StartPreacc();
+    AD::SetPreaccIn(Coord_i, nDim);
+
+    /*--- Sumations for entries of upper triangular matrix R ---*/
+
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = node[iPoint]->GetPoint(iNeigh);
+      Coord_j = node[jPoint]->GetCoord();
+
+      AD::SetPreaccIn(Coord_j, nDim);
+
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+
+      if (weight != 0.0) {
+        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+        if (nDim == 3) {
+          r13   += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r33   += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+        }
+      }
+    }
+
+    /*--- Entries of upper triangular matrix R ---*/
+
+    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
+    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
+    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
+
+    if (nDim == 3) {
+      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
+      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
+      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
+    }
+
+    /*--- Compute determinant and detect singular matrices ---*/
+
+    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
+    else detR2 = (r11*r22*r33)*(r11*r22*r33);
+
+    singular = false;
+    if (abs(detR2) <= EPS) { detR2 = 1.0; singular = true; }
+
+    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+
+    if (singular) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        for (jDim = 0; jDim < nDim; jDim++)
+          Smatrix[iDim][jDim] = 0.0;
+    }
+    else {
+      if (nDim == 2) {
+        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+        Smatrix[0][1] = -r11*r12/detR2;
+        Smatrix[1][0] = Smatrix[0][1];
+        Smatrix[1][1] = r11*r11/detR2;
+      }
+      else {
+        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
+        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
+        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+        Smatrix[0][2] = (z13*z33)/detR2;
+        Smatrix[1][0] = Smatrix[0][1];
+        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+        Smatrix[1][2] = (z23*z33)/detR2;
+        Smatrix[2][0] = Smatrix[0][2];
+        Smatrix[2][1] = Smatrix[1][2];
+        Smatrix[2][2] = (z33*z33)/detR2;
+      }
+    }
+
+    /*--- Weights of the neighbors: S*(x_j-x_i)/|x_j-x_i|^2 ---*/
+
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = node[iPoint]->GetPoint(iNeigh);
+      Coord_j = node[jPoint]->GetCoord();
+      Weight = GetLSWeights(iPoint, iNeigh);
+
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Delta[iDim] = Coord_j[iDim]-Coord_i[iDim];
+        weight += Delta[iDim]*Delta[iDim];
+      }
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Weight[iDim] = 0.0;
+        if (weight != 0.0)
+          for (jDim = 0; jDim < nDim; jDim++)
+            Weight[iDim] += Smatrix[iDim][jDim]*Delta[jDim]/weight;
+      }
+
+      AD::SetPreaccOut(Weight, nDim);
+    }
+
+    AD::EndPreacc();
+  }
+
+  LSWeights_Updated = true;
+
 }
 
 su2double CGeometry::Point2Plane_Distance(su2double *Coord, su2double *iCoord, su2double *jCoord, su2double *kCoord) {
@@ -2337,6 +2799,9 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
       case CGNS:
         Read_CGNS_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
         break;
+      case SU2_BINARY:
+        Read_SU2_Binary_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
+        break;
       default:
         SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
         break;
@@ -10912,41 +11377,744 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   
 }
 
-void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
-  
-  /*--- Original CGNS reader implementation by Thomas D. Economon,
-   Francisco Palacios. Improvements for mixed-element meshes generated
-   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
-   Parallel version by Thomas D. Economon, February 2015. ---*/
-  
-#ifdef HAVE_CGNS
-    
-  string text_line, Marker_Tag;
-  ifstream mesh_file;
-  unsigned short VTK_Type = 0, iMarker = 0;
+#ifdef HAVE_MPI
+/*!
+ * \brief Read a contiguous block of a binary SU2 mesh file at an explicit offset (MPI-IO).
+ * \param[in] fhw - Handle of the file, opened by all ranks.
+ * \param[in] disp - Offset of the block in bytes.
+ * \param[out] buf - Buffer receiving the data.
+ * \param[in] nBytes - Size of the block in bytes.
+ */
+static void Read_SU2_Binary_Block(MPI_File fhw, unsigned long disp, void *buf, unsigned long nBytes) {
+
+  /*--- MPI counts are ints, large blocks are read in pieces of 1 GB. ---*/
+
+  const unsigned long max_chunk = 1073741824;
+  char *cbuf = static_cast<char*>(buf);
+  MPI_Status status;
+  int nRead;
+
+  while (nBytes > 0) {
+    int chunk = (int)min(nBytes, max_chunk);
+    MPI_File_read_at(fhw, (MPI_Offset)disp, cbuf, chunk, MPI_BYTE, &status);
+    MPI_Get_count(&status, MPI_BYTE, &nRead);
+    if (nRead != chunk) {
+      SU2_MPI::Error("Error reading binary SU2 mesh file, the file is truncated.", CURRENT_FUNCTION);
+    }
+    cbuf += chunk; disp += chunk; nBytes -= chunk;
+  }
+
+}
+#else
+/*!
+ * \brief Read a contiguous block of a binary SU2 mesh file at an explicit offset.
+ * \param[in] fhw - Handle of the file.
+ * \param[in] disp - Offset of the block in bytes.
+ * \param[out] buf - Buffer receiving the data.
+ * \param[in] nBytes - Size of the block in bytes.
+ */
+static void Read_SU2_Binary_Block(FILE *fhw, unsigned long disp, void *buf, unsigned long nBytes) {
+
+  if (nBytes == 0) return;
+
+  if ((fseek(fhw, disp, SEEK_SET) != 0) || (fread(buf, 1, nBytes, fhw) != nBytes)) {
+    SU2_MPI::Error("Error reading binary SU2 mesh file, the file is truncated.", CURRENT_FUNCTION);
+  }
+
+}
+#endif
+
+void CPhysicalGeometry::Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+
   unsigned short nMarker_Max = config->GetnMarker_Max();
-  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
-  unsigned long globalOffset = 0;
+  unsigned short iNode, jNode, nNodes, iPeriodic, nPeriodic, iDim;
+  unsigned long iPoint, iElem, iMarker, iElem_Bound, ielem, index, i;
+  unsigned long VTK_Type, GlobalIndex, vnodes[N_POINTS_HEXAHEDRON];
+  unsigned long header[SU2_BINARY_MESH_HEADER];
+  unsigned long total_pt_accounted, rem_points, rem_elems;
+  unsigned long nElem_Linear, First_Elem, nElem_Conn;
+  long local_index;
+  int iProc, nSends, nRecvs;
+  passivedouble Offset_Angles[2];
+  su2double AoA_Offset, AoS_Offset, AoA_Current, AoS_Current;
+  string Marker_Tag;
+  char fname[MAX_STRING_SIZE], tag_buf[SU2_BINARY_MESH_TAG_SIZE+1];
+  vector<unsigned long>::iterator it;
+  bool harmonic_balance = config->GetUnsteady_Simulation() == HARMONIC_BALANCE;
+  bool multizone_file = config->GetMultizone_Mesh();
+  bool actuator_disk  = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                          (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                         ((config->GetKind_SU2() == SU2_CFD) ||
+                          ((config->GetKind_SU2() == SU2_DEF) && (config->GetActDisk_SU2_DEF()))));
+  if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
+
   nZone = val_nZone;
-  
-  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
-  
-  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
-  su2double Coord_cgns[3] = {0.0,0.0,0.0};
-  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
-  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
-  int interiorElems = 0, totalVerts = 0;
-  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
-  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
-  char coordname[CGNS_STRING_SIZE];
-  cgsize_t* cgsize; cgsize = new cgsize_t[3];
-  ZoneType_t zonetype;
-  DataType_t datatype;
-  passivedouble** coordArray = NULL;
-  passivedouble*** gridCoords = NULL;
-  ElementType_t elemType;
-  cgsize_t range_min, range_max, startE, endE;
-  range_min = 1;
+
+  /*--- The binary format holds a single zone and the surface splitting of the
+   actuator disk is only implemented in the ASCII reader. ---*/
+
+  if (val_nZone > 1 && multizone_file) {
+    SU2_MPI::Error("The binary SU2 mesh format holds a single zone, use the ASCII SU2 format for multizone meshes.", CURRENT_FUNCTION);
+  }
+  if (actuator_disk) {
+    SU2_MPI::Error("Actuator disk surfaces can only be split when reading ASCII SU2 meshes.", CURRENT_FUNCTION);
+  }
+  if (harmonic_balance) {
+    if (rank == MASTER_NODE) cout << "Reading time instance " << config->GetiInst()+1 << "." << endl;
+  }
+
+  Global_nPoint  = 0; Global_nPointDomain   = 0; Global_nElem = 0; Global_nElemDomain = 0;
+  nelem_edge     = 0; Global_nelem_edge     = 0;
+  nelem_triangle = 0; Global_nelem_triangle = 0;
+  nelem_quad     = 0; Global_nelem_quad     = 0;
+  nelem_tetra    = 0; Global_nelem_tetra    = 0;
+  nelem_hexa     = 0; Global_nelem_hexa     = 0;
+  nelem_prism    = 0; Global_nelem_prism    = 0;
+  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
+
+  /*--- Allocate memory for the linear partition of the mesh. These
+   arrays are the size of the number of ranks. ---*/
+
+  starting_node = new unsigned long[size];
+  ending_node   = new unsigned long[size];
+  npoint_procs  = new unsigned long[size];
+  nPoint_Linear = new unsigned long[size+1];
+
+  /*--- All ranks open the file. ---*/
+
+  strcpy(fname, val_mesh_filename.c_str());
+
+#ifdef HAVE_MPI
+  MPI_File fhw;
+  int ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + string(fname), CURRENT_FUNCTION);
+  }
+#else
+  FILE *fhw = fopen(fname, "rb");
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + string(fname), CURRENT_FUNCTION);
+  }
+#endif
+
+  /*--- The header is only a few bytes, every rank reads it directly
+   instead of waiting for a broadcast from the master. ---*/
+
+  Read_SU2_Binary_Block(fhw, 0, header, SU2_BINARY_MESH_HEADER*sizeof(unsigned long));
+  Read_SU2_Binary_Block(fhw, SU2_BINARY_MESH_HEADER*sizeof(unsigned long), Offset_Angles, 2*sizeof(passivedouble));
+
+  if (header[0] != SU2_BINARY_MESH_ID) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 mesh file. Please check MESH_FORMAT."), CURRENT_FUNCTION);
+  }
+  if (header[1] != SU2_BINARY_MESH_VERSION) {
+    SU2_MPI::Error(string("Unsupported version of the binary SU2 mesh file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  /*--- Read the dimension of the problem ---*/
+
+  nDim = header[2];
+  if (rank == MASTER_NODE) {
+    if (nDim == 2) cout << "Two dimensional problem." << endl;
+    if (nDim == 3) cout << "Three dimensional problem." << endl;
+  }
+
+  /*--- Offset of the angle of attack and sideslip angle (in deg). ---*/
+
+  AoA_Offset = Offset_Angles[0];
+  AoA_Current = config->GetAoA() + AoA_Offset;
+
+  if (config->GetDiscard_InFiles() == false) {
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+      cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
+    }
+    config->SetAoA_Offset(AoA_Offset);
+    config->SetAoA(AoA_Current);
+  }
+  else {
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
+      cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+  }
+
+  AoS_Offset = Offset_Angles[1];
+  AoS_Current = config->GetAoS() + AoS_Offset;
+
+  if (config->GetDiscard_InFiles() == false) {
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+      cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
+    }
+    config->SetAoS_Offset(AoS_Offset);
+    config->SetAoS(AoS_Current);
+  }
+  else {
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
+      cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+  }
+
+  /*--- Read number of points and possible ghost points. ---*/
+
+  nPoint       = header[3];
+  nPointDomain = header[4];
+  Global_nPoint = nPoint;
+  Global_nPointDomain = nPointDomain;
+
+  if (nPointDomain != nPoint) {
+    if (rank == MASTER_NODE && size > SINGLE_NODE) {
+      cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+      cout << " ghost points before parallel partitioning." << endl;
+    } else if (rank == MASTER_NODE) {
+      cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+      cout << " ghost points." << endl;
+    }
+  } else {
+    if (rank == MASTER_NODE && size > SINGLE_NODE) {
+      cout << nPoint << " points before parallel partitioning." << endl;
+    } else if (rank == MASTER_NODE) {
+      cout << nPoint << " points." << endl;
+    }
+  }
+
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Performing linear partitioning of the grid nodes." << endl;
+
+  /*--- Compute the number of points that will be on each processor.
+   This is a linear partitioning with the addition of a simple load
+   balancing for any remainder points (same as the ASCII reader). ---*/
+
+  total_pt_accounted = 0;
+  for (i = 0; i < (unsigned long)size; i++) {
+    npoint_procs[i] = nPoint/size;
+    total_pt_accounted = total_pt_accounted + npoint_procs[i];
+  }
+
+  rem_points = nPoint-total_pt_accounted;
+  for (i = 0; i<rem_points; i++) {
+    npoint_procs[i]++;
+  }
+
+  nPoint = npoint_procs[rank];
+  starting_node[0] = 0;
+  ending_node[0]   = starting_node[0] + npoint_procs[0];
+  nPoint_Linear[0] = 0;
+  for (i = 1; i < (unsigned long)size; i++) {
+    starting_node[i] = ending_node[i-1];
+    ending_node[i]   = starting_node[i] + npoint_procs[i];
+    nPoint_Linear[i] = nPoint_Linear[i-1] + npoint_procs[i-1];
+  }
+  nPoint_Linear[size] = Global_nPoint;
+
+  /*--- Each rank reads the coordinates of its own slice of points only. ---*/
+
+  passivedouble *Coord_Buffer = new passivedouble[nPoint*nDim];
+  Read_SU2_Binary_Block(fhw, header[8] + starting_node[rank]*nDim*sizeof(passivedouble),
+                        Coord_Buffer, nPoint*nDim*sizeof(passivedouble));
+
+  nPointNode = nPoint;
+  node = new CPoint*[nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    GlobalIndex = starting_node[rank] + iPoint;
+    if (nDim == 2)
+      node[iPoint] = new CPoint(Coord_Buffer[iPoint*nDim+0], Coord_Buffer[iPoint*nDim+1], GlobalIndex, config);
+    else
+      node[iPoint] = new CPoint(Coord_Buffer[iPoint*nDim+0], Coord_Buffer[iPoint*nDim+1],
+                                Coord_Buffer[iPoint*nDim+2], GlobalIndex, config);
+  }
+
+  delete [] Coord_Buffer;
+
+  /*--- Store total number of elements in the original mesh ---*/
+
+  Global_nElem = header[5];
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << Global_nElem << " interior elements before parallel partitioning." << endl;
+
+  /*--- The elements are also read with a linear partitioning: each rank reads
+   a contiguous chunk of the element offsets and of the connectivity. ---*/
+
+  nElem_Linear = Global_nElem/size;
+  rem_elems    = Global_nElem%size;
+  First_Elem   = rank*nElem_Linear + min((unsigned long)rank, rem_elems);
+  if ((unsigned long)rank < rem_elems) nElem_Linear++;
+
+  unsigned long *Elem_Offset = new unsigned long[nElem_Linear+1];
+  Read_SU2_Binary_Block(fhw, header[9] + First_Elem*sizeof(unsigned long),
+                        Elem_Offset, (nElem_Linear+1)*sizeof(unsigned long));
+
+  nElem_Conn = Elem_Offset[nElem_Linear]-Elem_Offset[0];
+  unsigned long *Elem_Conn = new unsigned long[nElem_Conn];
+  Read_SU2_Binary_Block(fhw, header[10] + Elem_Offset[0]*sizeof(unsigned long),
+                        Elem_Conn, nElem_Conn*sizeof(unsigned long));
+
+  /*--- Every element must end on all the ranks that own one of its nodes
+   in the linear partitioning of the points (i.e., there will be element
+   redundancy, as with the ASCII reader). Count the data to send to each
+   rank, the message for one element is its global index, VTK type and nodes. ---*/
+
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Distributing elements across all ranks." << endl;
+
+  int *nElem_Send = new int[size+1]; nElem_Send[0] = 0;
+  int *nElem_Recv = new int[size+1]; nElem_Recv[0] = 0;
+  long *nElem_Flag = new long[size];
+
+  for (iProc = 0; iProc < size; iProc++) {
+    nElem_Send[iProc+1] = 0; nElem_Recv[iProc+1] = 0; nElem_Flag[iProc] = -1;
+  }
+
+  for (iElem = 0; iElem < nElem_Linear; iElem++) {
+    index  = Elem_Offset[iElem]-Elem_Offset[0];
+    nNodes = Elem_Offset[iElem+1]-Elem_Offset[iElem]-1;
+    for (iNode = 0; iNode < nNodes; iNode++) {
+      iProc = upper_bound(nPoint_Linear, nPoint_Linear+size+1, Elem_Conn[index+1+iNode]) - nPoint_Linear - 1;
+      if (nElem_Flag[iProc] != (long)iElem) {
+        nElem_Flag[iProc] = iElem;
+        nElem_Send[iProc+1] += nNodes+2;
+      }
+    }
+  }
+
+  SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
+                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+
+  nSends = 0; nRecvs = 0;
+  for (iProc = 0; iProc < size; iProc++) {
+    if ((iProc != rank) && (nElem_Send[iProc+1] > 0)) nSends++;
+    if ((iProc != rank) && (nElem_Recv[iProc+1] > 0)) nRecvs++;
+
+    nElem_Send[iProc+1] += nElem_Send[iProc];
+    nElem_Recv[iProc+1] += nElem_Recv[iProc];
+  }
+
+  /*--- Load the send buffer. ---*/
+
+  unsigned long *connSend = new unsigned long[nElem_Send[size]];
+  unsigned long *connRecv = new unsigned long[nElem_Recv[size]];
+  unsigned long *Send_Index = new unsigned long[size];
+
+  for (iProc = 0; iProc < size; iProc++) {
+    Send_Index[iProc] = nElem_Send[iProc]; nElem_Flag[iProc] = -1;
+  }
+
+  for (iElem = 0; iElem < nElem_Linear; iElem++) {
+    index  = Elem_Offset[iElem]-Elem_Offset[0];
+    nNodes = Elem_Offset[iElem+1]-Elem_Offset[iElem]-1;
+    for (iNode = 0; iNode < nNodes; iNode++) {
+      iProc = upper_bound(nPoint_Linear, nPoint_Linear+size+1, Elem_Conn[index+1+iNode]) - nPoint_Linear - 1;
+      if (nElem_Flag[iProc] != (long)iElem) {
+        nElem_Flag[iProc] = iElem;
+        connSend[Send_Index[iProc]] = First_Elem + iElem; Send_Index[iProc]++;
+        for (jNode = 0; jNode <= nNodes; jNode++) {
+          connSend[Send_Index[iProc]] = Elem_Conn[index+jNode]; Send_Index[iProc]++;
+        }
+      }
+    }
+  }
+
+  delete [] Send_Index;
+  delete [] nElem_Flag;
+  delete [] Elem_Offset;
+  delete [] Elem_Conn;
+
+  /*--- Exchange the elements. Since every rank sends its elements in
+   increasing global order and the ranks hold increasing ranges, the
+   received elements are also sorted by their global index. ---*/
+
+  SU2_MPI::Request *connSendReq = NULL, *connRecvReq = NULL;
+  if (nSends > 0) connSendReq = new SU2_MPI::Request[nSends];
+  if (nRecvs > 0) connRecvReq = new SU2_MPI::Request[nRecvs];
+
+  InitiateComms(connSend, nElem_Send, connSendReq,
+                connRecv, nElem_Recv, connRecvReq,
+                1, COMM_TYPE_UNSIGNED_LONG);
+
+  for (i = 0; i < (unsigned long)(nElem_Send[rank+1]-nElem_Send[rank]); i++)
+    connRecv[nElem_Recv[rank]+i] = connSend[nElem_Send[rank]+i];
+
+  CompleteComms(nSends, connSendReq, nRecvs, connRecvReq);
+
+  delete [] connSend;
+  if (connSendReq != NULL) delete [] connSendReq;
+  if (connRecvReq != NULL) delete [] connRecvReq;
+
+  /*--- Count the local elements and allocate them. ---*/
+
+  nElem = 0;
+  for (index = 0; index < (unsigned long)nElem_Recv[size]; index += nNodes+2) {
+    switch (connRecv[index+1]) {
+      case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nNodes = N_POINTS_PRISM;         break;
+      case PYRAMID:       nNodes = N_POINTS_PYRAMID;       break;
+      default:
+        SU2_MPI::Error("Unknown element type in the binary SU2 mesh file.", CURRENT_FUNCTION);
+        break;
+    }
+    nElem++;
+  }
+
+  elem = new CPrimalGrid*[nElem];
+  Global_to_Local_Elem.clear();
+
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  /*--- Initialize a vector for the adjacency information (ParMETIS). ---*/
+  vector< vector<unsigned long> > adj_nodes(nPoint, vector<unsigned long>(0));
+#endif
+#endif
+
+  /*--- Store the elements and, for ParMETIS, build the adjacency of the
+   owned nodes assuming the VTK connectivity. ---*/
+
+  index = 0;
+  for (iElem = 0; iElem < nElem; iElem++) {
+
+    GlobalIndex = connRecv[index];
+    VTK_Type    = connRecv[index+1];
+
+    switch (VTK_Type) {
+      case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nNodes = N_POINTS_PRISM;         break;
+      case PYRAMID:       nNodes = N_POINTS_PYRAMID;       break;
+    }
+    for (iNode = 0; iNode < nNodes; iNode++) vnodes[iNode] = connRecv[index+2+iNode];
+    index += nNodes+2;
+
+    Global_to_Local_Elem[GlobalIndex] = iElem;
+
+    switch (VTK_Type) {
+      case TRIANGLE:
+        elem[iElem] = new CTriangle(vnodes[0], vnodes[1], vnodes[2], 2);
+        nelem_triangle++; break;
+      case QUADRILATERAL:
+        elem[iElem] = new CQuadrilateral(vnodes[0], vnodes[1], vnodes[2], vnodes[3], 2);
+        nelem_quad++; break;
+      case TETRAHEDRON:
+        elem[iElem] = new CTetrahedron(vnodes[0], vnodes[1], vnodes[2], vnodes[3]);
+        nelem_tetra++; break;
+      case HEXAHEDRON:
+        elem[iElem] = new CHexahedron(vnodes[0], vnodes[1], vnodes[2], vnodes[3],
+                                      vnodes[4], vnodes[5], vnodes[6], vnodes[7]);
+        nelem_hexa++; break;
+      case PRISM:
+        elem[iElem] = new CPrism(vnodes[0], vnodes[1], vnodes[2], vnodes[3], vnodes[4], vnodes[5]);
+        nelem_prism++; break;
+      case PYRAMID:
+        elem[iElem] = new CPyramid(vnodes[0], vnodes[1], vnodes[2], vnodes[3], vnodes[4]);
+        nelem_pyramid++; break;
+    }
+
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+    for (iNode = 0; iNode < nNodes; iNode++) {
+
+      local_index = vnodes[iNode]-starting_node[rank];
+      if ((local_index < 0) || (local_index >= (long)nPoint)) continue;
+
+      switch (VTK_Type) {
+        case TRIANGLE: case TETRAHEDRON:
+          for (unsigned short j = 0; j < nNodes; j++)
+            if (j != iNode) adj_nodes[local_index].push_back(vnodes[j]);
+          break;
+        case QUADRILATERAL:
+          adj_nodes[local_index].push_back(vnodes[(iNode+1)%4]);
+          adj_nodes[local_index].push_back(vnodes[(iNode+3)%4]);
+          break;
+        case HEXAHEDRON:
+          if (iNode < 4) {
+            adj_nodes[local_index].push_back(vnodes[(iNode+1)%4]);
+            adj_nodes[local_index].push_back(vnodes[(iNode+3)%4]);
+          } else {
+            adj_nodes[local_index].push_back(vnodes[(iNode-3)%4+4]);
+            adj_nodes[local_index].push_back(vnodes[(iNode-1)%4+4]);
+          }
+          adj_nodes[local_index].push_back(vnodes[(iNode+4)%8]);
+          break;
+        case PRISM:
+          if (iNode < 3) {
+            adj_nodes[local_index].push_back(vnodes[(iNode+1)%3]);
+            adj_nodes[local_index].push_back(vnodes[(iNode+2)%3]);
+          } else {
+            adj_nodes[local_index].push_back(vnodes[(iNode-2)%3+3]);
+            adj_nodes[local_index].push_back(vnodes[(iNode-1)%3+3]);
+          }
+          adj_nodes[local_index].push_back(vnodes[(iNode+3)%6]);
+          break;
+        case PYRAMID:
+          if (iNode < 4) {
+            adj_nodes[local_index].push_back(vnodes[(iNode+1)%4]);
+            adj_nodes[local_index].push_back(vnodes[(iNode+3)%4]);
+            adj_nodes[local_index].push_back(vnodes[4]);
+          } else {
+            adj_nodes[local_index].push_back(vnodes[0]);
+            adj_nodes[local_index].push_back(vnodes[1]);
+            adj_nodes[local_index].push_back(vnodes[2]);
+            adj_nodes[local_index].push_back(vnodes[3]);
+          }
+          break;
+      }
+    }
+#endif
+#endif
+
+  }
+
+  delete [] connRecv;
+  delete [] nElem_Send;
+  delete [] nElem_Recv;
+
+  /*--- Store the number of elements on the whole domain, excluding halos. ---*/
+
+  Global_nElemDomain = Global_nElem;
+
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Building the graph adjacency structure." << endl;
+
+  /*--- Sort the adjacency of each node, remove the repeats and copy it
+   into the single array that is fed to ParMETIS. ---*/
+
+  unsigned long loc_adjc_size = 0;
+  vector<unsigned long> adjac_vec;
+
+  xadj = new idx_t [npoint_procs[rank]+1];
+  xadj[0] = 0;
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    sort(adj_nodes[iPoint].begin(), adj_nodes[iPoint].end());
+    it = unique(adj_nodes[iPoint].begin(), adj_nodes[iPoint].end());
+    loc_adjc_size = it - adj_nodes[iPoint].begin();
+    xadj[iPoint+1] = xadj[iPoint]+loc_adjc_size;
+    adjac_vec.insert(adjac_vec.end(), adj_nodes[iPoint].begin(), it);
+    adj_nodes[iPoint].clear();
+  }
+
+  adjacency = new idx_t [xadj[npoint_procs[rank]]];
+  copy(adjac_vec.begin(), adjac_vec.end(), adjacency);
+
+  xadj_size = npoint_procs[rank]+1;
+  adjacency_size = xadj[npoint_procs[rank]];
+
+  adjac_vec.clear();
+  adj_nodes.clear();
+
+#endif
+#endif
+
+  /*--- The boundary markers are read by all ranks, as with the ASCII reader. ---*/
+
+  nMarker = header[6];
+  unsigned long nMarker_Data = header[12]/sizeof(unsigned long);
+  unsigned long *Marker_Data = new unsigned long[nMarker_Data];
+  Read_SU2_Binary_Block(fhw, header[11], Marker_Data, header[12]);
+
+  if (rank == MASTER_NODE) cout << nMarker << " surface markers." << endl;
+  config->SetnMarker_All(nMarker);
+  bound = new CPrimalGrid**[nMarker];
+  nElem_Bound = new unsigned long [nMarker];
+  Tag_to_Marker = new string [nMarker_Max];
+
+  PrintingToolbox::CTablePrinter BoundaryTable(&std::cout);
+  BoundaryTable.AddColumn("Index", 6);
+  BoundaryTable.AddColumn("Marker", 14);
+  BoundaryTable.AddColumn("Elements", 14);
+  if (rank == MASTER_NODE){
+    BoundaryTable.PrintHeader();
+  }
+
+  index = 0;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+
+    memcpy(tag_buf, &Marker_Data[index], SU2_BINARY_MESH_TAG_SIZE);
+    tag_buf[SU2_BINARY_MESH_TAG_SIZE] = '\0';
+    Marker_Tag = tag_buf;
+    index += SU2_BINARY_MESH_TAG_SIZE/sizeof(unsigned long);
+
+    nElem_Bound[iMarker] = Marker_Data[index];
+    short SendTo = (short)(long)Marker_Data[index+1];
+    index += 2;
+
+    bound[iMarker] = new CPrimalGrid* [nElem_Bound[iMarker]];
+
+    /*--- Physical boundaries definition ---*/
+
+    if (Marker_Tag != "SEND_RECEIVE") {
+
+      if (rank == MASTER_NODE) {
+        BoundaryTable << iMarker << Marker_Tag << nElem_Bound[iMarker];
+      }
+
+      nelem_edge_bound = 0; nelem_triangle_bound = 0; nelem_quad_bound = 0; ielem = 0;
+      for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+        VTK_Type = Marker_Data[index];
+        switch(VTK_Type) {
+          case LINE:
+            if (nDim == 3) {
+              SU2_MPI::Error("Please remove line boundary conditions from the mesh file!", CURRENT_FUNCTION);
+            }
+            bound[iMarker][ielem] = new CLine(Marker_Data[index+1], Marker_Data[index+2],2);
+            index += N_POINTS_LINE+1; ielem++; nelem_edge_bound++; break;
+          case TRIANGLE:
+            bound[iMarker][ielem] = new CTriangle(Marker_Data[index+1], Marker_Data[index+2],
+                                                  Marker_Data[index+3],3);
+            index += N_POINTS_TRIANGLE+1; ielem++; nelem_triangle_bound++; break;
+          case QUADRILATERAL:
+            bound[iMarker][ielem] = new CQuadrilateral(Marker_Data[index+1], Marker_Data[index+2],
+                                                       Marker_Data[index+3], Marker_Data[index+4],3);
+            index += N_POINTS_QUADRILATERAL+1; ielem++; nelem_quad_bound++; break;
+          default:
+            SU2_MPI::Error("Unknown boundary element type in the binary SU2 mesh file.", CURRENT_FUNCTION);
+            break;
+        }
+      }
+
+      /*--- Update config information storing the boundary information in the right place ---*/
+
+      Tag_to_Marker[config->GetMarker_CfgFile_TagBound(Marker_Tag)] = Marker_Tag;
+      config->SetMarker_All_TagBound(iMarker, Marker_Tag);
+      config->SetMarker_All_KindBC(iMarker, config->GetMarker_CfgFile_KindBC(Marker_Tag));
+      config->SetMarker_All_Monitoring(iMarker, config->GetMarker_CfgFile_Monitoring(Marker_Tag));
+      config->SetMarker_All_GeoEval(iMarker, config->GetMarker_CfgFile_GeoEval(Marker_Tag));
+      config->SetMarker_All_Designing(iMarker, config->GetMarker_CfgFile_Designing(Marker_Tag));
+      config->SetMarker_All_Plotting(iMarker, config->GetMarker_CfgFile_Plotting(Marker_Tag));
+      config->SetMarker_All_Analyze(iMarker, config->GetMarker_CfgFile_Analyze(Marker_Tag));
+      config->SetMarker_All_ZoneInterface(iMarker, config->GetMarker_CfgFile_ZoneInterface(Marker_Tag));
+      config->SetMarker_All_DV(iMarker, config->GetMarker_CfgFile_DV(Marker_Tag));
+      config->SetMarker_All_Moving(iMarker, config->GetMarker_CfgFile_Moving(Marker_Tag));
+      config->SetMarker_All_PyCustom(iMarker, config->GetMarker_CfgFile_PyCustom(Marker_Tag));
+      config->SetMarker_All_PerBound(iMarker, config->GetMarker_CfgFile_PerBound(Marker_Tag));
+      config->SetMarker_All_SendRecv(iMarker, NONE);
+      config->SetMarker_All_Turbomachinery(iMarker, config->GetMarker_CfgFile_Turbomachinery(Marker_Tag));
+      config->SetMarker_All_TurbomachineryFlag(iMarker, config->GetMarker_CfgFile_TurbomachineryFlag(Marker_Tag));
+      config->SetMarker_All_MixingPlaneInterface(iMarker, config->GetMarker_CfgFile_MixingPlaneInterface(Marker_Tag));
+
+    }
+
+    /*--- Send-Receive boundaries definition ---*/
+
+    else {
+
+      config->SetMarker_All_KindBC(iMarker, SEND_RECEIVE);
+      config->SetMarker_All_SendRecv(iMarker, SendTo);
+
+      for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+        bound[iMarker][iElem_Bound] = new CVertexMPI(Marker_Data[index+1], nDim);
+        bound[iMarker][iElem_Bound]->SetRotation_Type(Marker_Data[index+2]);
+        index += 3;
+      }
+
+    }
+
+  }
+
+  if (rank == MASTER_NODE){
+    BoundaryTable.PrintFooter();
+  }
+
+  delete [] Marker_Data;
+
+  /*--- Read periodic transformation info (center, rotation, translation),
+   or store default zeros if there is none. ---*/
+
+  nPeriodic = header[7];
+
+  if (nPeriodic > 0) {
+
+    if (rank == MASTER_NODE) {
+      if (nPeriodic - 1 != 0)
+        cout << nPeriodic - 1 << " periodic transformations." << endl;
+    }
+    config->SetnPeriodicIndex(nPeriodic);
+
+    passivedouble *Periodic_Data = new passivedouble[nPeriodic*9];
+    Read_SU2_Binary_Block(fhw, header[13], Periodic_Data, nPeriodic*9*sizeof(passivedouble));
+
+    su2double* center    = new su2double[3];
+    su2double* rotation  = new su2double[3];
+    su2double* translate = new su2double[3];
+    for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+      for (iDim = 0; iDim < 3; iDim++) {
+        center[iDim]    = Periodic_Data[iPeriodic*9+iDim];
+        rotation[iDim]  = Periodic_Data[iPeriodic*9+3+iDim];
+        translate[iDim] = Periodic_Data[iPeriodic*9+6+iDim];
+      }
+      config->SetPeriodicCenter(iPeriodic, center);
+      config->SetPeriodicRotation(iPeriodic, rotation);
+      config->SetPeriodicTranslate(iPeriodic, translate);
+    }
+    delete [] center; delete [] rotation; delete [] translate;
+    delete [] Periodic_Data;
+
+  }
+  else {
+    nPeriodic = 1; iPeriodic = 0;
+    config->SetnPeriodicIndex(nPeriodic);
+    su2double* center    = new su2double[3];
+    su2double* rotation  = new su2double[3];
+    su2double* translate = new su2double[3];
+    for (iDim = 0; iDim < 3; iDim++) {
+      center[iDim] = 0.0; rotation[iDim] = 0.0; translate[iDim] = 0.0;
+    }
+    config->SetPeriodicCenter(iPeriodic,    center);
+    config->SetPeriodicRotation(iPeriodic,  rotation);
+    config->SetPeriodicTranslate(iPeriodic, translate);
+    delete [] center; delete [] rotation; delete [] translate;
+  }
+
+  /*--- Close the input file ---*/
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fhw);
+#else
+  fclose(fhw);
+#endif
+
+}
+
+void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+  
+  /*--- Original CGNS reader implementation by Thomas D. Economon,
+   Francisco Palacios. Improvements for mixed-element meshes generated
+   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
+   Parallel version by Thomas D. Economon, February 2015. ---*/
+  
+#ifdef HAVE_CGNS
+    
+  string text_line, Marker_Tag;
+  ifstream mesh_file;
+  unsigned short VTK_Type = 0, iMarker = 0;
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
+  unsigned long globalOffset = 0;
+  nZone = val_nZone;
+  
+  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
+  
+  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
+  su2double Coord_cgns[3] = {0.0,0.0,0.0};
+  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
+  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
+  int interiorElems = 0, totalVerts = 0;
+  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
+  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
+  char coordname[CGNS_STRING_SIZE];
+  cgsize_t* cgsize; cgsize = new cgsize_t[3];
+  ZoneType_t zonetype;
+  DataType_t datatype;
+  passivedouble** coordArray = NULL;
+  passivedouble*** gridCoords = NULL;
+  ElementType_t elemType;
+  cgsize_t range_min, range_max, startE, endE;
+  range_min = 1;
   string currentElem;
   int** elemTypeVTK = NULL;
   int** elemIndex = NULL;
@@ -12973,83 +14141,466 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
         VTK_TypeElem.push_back(VTK_Type);
         elemIDs.push_back(iElem);
 
-        for (unsigned short iNode = 0; iNode < nDOFsPerElem; iNode++) 
-          surfaceConn.push_back(bound[iMarker][iElem]->GetNode(iNode));
+        for (unsigned short iNode = 0; iNode < nDOFsPerElem; iNode++) 
+          surfaceConn.push_back(bound[iMarker][iElem]->GetNode(iNode));
+      }
+    }
+  }
+
+
+  /*--- Create the coordinates of the local points on the viscous surfaces and
+        create the final version of the mapping from all volume points to the
+        points on the viscous surfaces. ---*/
+  vector<su2double> surfaceCoor;
+  unsigned long nVertex_SolidWall = 0;
+
+  for(unsigned long i=0; i<nPoint; ++i) {
+    if( meshToSurface[i] ) {
+      meshToSurface[i] = nVertex_SolidWall++;
+
+      for(unsigned short k=0; k<nDim; ++k)
+        surfaceCoor.push_back(node[i]->GetCoord(k));
+    }
+  }
+
+  /*--- Change the surface connectivity, such that it corresponds to
+        the entries in surfaceCoor rather than in meshPoints. ---*/
+  for(unsigned long i=0; i<surfaceConn.size(); ++i)
+    surfaceConn[i] = meshToSurface[surfaceConn[i]];
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Determine the points for which the wall distance must be   ---*/
+  /*---         computed. After a mesh deformation most points can keep    ---*/
+  /*---         their previous value.                                      ---*/
+  /*--------------------------------------------------------------------------*/
+
+  vector<unsigned long> pointList;
+  SetWall_Distance_Points(config, surfaceCoor, surfaceConn, VTK_TypeElem, pointList);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Build the ADT, which is an ADT of bounding boxes of the    ---*/
+  /*---         surface elements. A nearest point search does not give     ---*/
+  /*---         accurate results, especially not for the integration       ---*/
+  /*---         points of the elements close to a wall boundary.           ---*/
+  /*---         The tree is global (all wall elements on all ranks) for    ---*/
+  /*---         the discrete adjoint, which must record the dependence of  ---*/
+  /*---         the distance on the wall coordinates, otherwise each rank  ---*/
+  /*---         only stores its own wall elements.                         ---*/
+  /*--------------------------------------------------------------------------*/
+
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  const bool globalTree = (size == SINGLE_NODE) || config->GetDiscrete_Adjoint();
+
+  /* Bounding box of the local wall elements, inverted if there are none. */
+  vector<su2double> wallBBox(2*nDim);
+  for(unsigned short k=0; k<nDim; ++k) {
+    wallBBox[k]      =  1.0e30;
+    wallBBox[nDim+k] = -1.0e30;
+  }
+  for(unsigned long i=0; i<surfaceCoor.size()/nDim; ++i) {
+    for(unsigned short k=0; k<nDim; ++k) {
+      wallBBox[k]      = min(wallBBox[k],      surfaceCoor[i*nDim+k]);
+      wallBBox[nDim+k] = max(wallBBox[nDim+k], surfaceCoor[i*nDim+k]);
+    }
+  }
+
+  /* Build the ADT. */
+  CADTElemClass WallADT(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
+                           markerIDs, elemIDs, globalTree);
+
+  /* Release the memory of the vectors used to build the ADT. To make sure
+     that all the memory is deleted, the swap function is used. */
+  vector<unsigned short>().swap(markerIDs);
+  vector<unsigned short>().swap(VTK_TypeElem);
+  vector<unsigned long>().swap(elemIDs);
+  vector<unsigned long>().swap(surfaceConn);
+  vector<su2double>().swap(surfaceCoor);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 4: Loop over the selected mesh nodes and compute minimum      ---*/
+  /*---         distance to a solid wall element                           ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if ( !globalTree ) {
+
+    ComputeWall_Distance_Distributed(WallADT, wallBBox, pointList);
+  }
+  else if ( WallADT.IsEmpty() ) {
+  
+    /*--- No solid wall boundary nodes in the entire mesh.
+     Set the wall distance to zero for all nodes. ---*/
+    
+    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
+      node[iPoint]->SetWall_Distance(0.0);
+  }
+  else {
+
+    /*--- Solid wall boundary nodes are present. Compute the wall
+     distance for the selected nodes, the nearest element of the previous
+     node is the initial guess of the search. ---*/
+
+    unsigned long adtElemID = ULONG_MAX;
+
+    for (unsigned long i=0; i<pointList.size(); ++i) {
+      const unsigned long iPoint = pointList[i];
+      unsigned short markerID;
+      unsigned long  elemID;
+      int            rankID;
+      su2double      dist;
+
+      /* If no element is found, dist holds the squared guaranteed distance
+         of the search, an upper bound of the wall distance. */
+      if (!WallADT.DetermineNearestElement(node[iPoint]->GetCoord(), 1.0e30, adtElemID,
+                                           dist, markerID, elemID, rankID))
+        dist = sqrt(dist);
+      node[iPoint]->SetWall_Distance(dist);
+    }
+  }
+  
+}
+
+void CPhysicalGeometry::SetWall_Distance_Points(CConfig *config,
+                                                const vector<su2double> &surfaceCoor,
+                                                const vector<unsigned long> &surfaceConn,
+                                                const vector<unsigned short> &VTK_TypeElem,
+                                                vector<unsigned long> &pointList) {
+
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  /*--- The previous distances can only be reused if the wall and the points
+   are the same on all ranks, and never for the discrete adjoint, which must
+   record the computation of every point. ---*/
+
+  int canReuse = (!config->GetDiscrete_Adjoint()) &&
+                 (WallDist_Coor.size() == nPoint*nDim) &&
+                 (WallDist_SurfCoor.size() == surfaceCoor.size());
+#ifdef HAVE_MPI
+  int canReuseLocal = canReuse;
+  SU2_MPI::Allreduce(&canReuseLocal, &canReuse, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+
+  pointList.clear();
+
+  if (canReuse) {
+
+    /*--- Bounding box of the old and new positions of the local wall elements
+     that moved. A wall element that moved, or a point that is now closer to
+     any of those positions than its previous wall distance, needs a new
+     search; the distance of the other points is unchanged. ---*/
+
+    vector<su2double> movedBBox(2*nDim);
+    for (unsigned short k = 0; k < nDim; ++k) {
+      movedBBox[k]      =  1.0e30;
+      movedBBox[nDim+k] = -1.0e30;
+    }
+
+    unsigned long iConn = 0;
+    for (unsigned long iElem = 0; iElem < VTK_TypeElem.size(); ++iElem) {
+      unsigned short nNodes = 0;
+      switch (VTK_TypeElem[iElem]) {
+        case LINE:          nNodes = 2; break;
+        case TRIANGLE:      nNodes = 3; break;
+        case QUADRILATERAL: nNodes = 4; break;
+      }
+
+      bool moved = false;
+      for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+        const unsigned long iSurf = surfaceConn[iConn+iNode];
+        for (unsigned short k = 0; k < nDim; ++k)
+          if (SU2_TYPE::GetValue(surfaceCoor[iSurf*nDim+k]) != WallDist_SurfCoor[iSurf*nDim+k]) moved = true;
+      }
+
+      if (moved) {
+        for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+          const unsigned long iSurf = surfaceConn[iConn+iNode];
+          for (unsigned short k = 0; k < nDim; ++k) {
+            const su2double oldCoor = WallDist_SurfCoor[iSurf*nDim+k];
+            const su2double newCoor = surfaceCoor[iSurf*nDim+k];
+            movedBBox[k]      = min(movedBBox[k],      min(oldCoor, newCoor));
+            movedBBox[nDim+k] = max(movedBBox[nDim+k], max(oldCoor, newCoor));
+          }
+        }
+      }
+      iConn += nNodes;
+    }
+
+    vector<su2double> rankBBox(2*nDim*size);
+#ifdef HAVE_MPI
+    SU2_MPI::Allgather(movedBBox.data(), 2*nDim, MPI_DOUBLE, rankBBox.data(), 2*nDim,
+                       MPI_DOUBLE, MPI_COMM_WORLD);
+#else
+    rankBBox = movedBBox;
+#endif
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+      const su2double *coor = node[iPoint]->GetCoord();
+
+      bool recompute = false;
+      for (unsigned short k = 0; k < nDim; ++k)
+        if (SU2_TYPE::GetValue(coor[k]) != WallDist_Coor[iPoint*nDim+k]) recompute = true;
+
+      const su2double dist  = node[iPoint]->GetWall_Distance();
+      const su2double dist2 = dist*dist;
+
+      for (int iRank = 0; (iRank < size) && !recompute; ++iRank) {
+        const su2double *bbMin = &rankBBox[iRank*2*nDim];
+        const su2double *bbMax = bbMin + nDim;
+        if (bbMin[0] > bbMax[0]) continue;
+
+        su2double posDist2 = 0.0;
+        for (unsigned short k = 0; k < nDim; ++k) {
+          su2double ds = 0.0;
+          if(     coor[k] < bbMin[k]) ds = coor[k] - bbMin[k];
+          else if(coor[k] > bbMax[k]) ds = coor[k] - bbMax[k];
+          posDist2 += ds*ds;
+        }
+        if (posDist2 <= dist2) recompute = true;
+      }
+
+      if (recompute) pointList.push_back(iPoint);
+    }
+  }
+  else {
+    pointList.resize(nPoint);
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) pointList[iPoint] = iPoint;
+  }
+
+  /*--- Store the current coordinates for the next call. ---*/
+
+  WallDist_Coor.resize(nPoint*nDim);
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+    for (unsigned short k = 0; k < nDim; ++k)
+      WallDist_Coor[iPoint*nDim+k] = SU2_TYPE::GetValue(node[iPoint]->GetCoord(k));
+
+  WallDist_SurfCoor.resize(surfaceCoor.size());
+  for (unsigned long i = 0; i < surfaceCoor.size(); ++i)
+    WallDist_SurfCoor[i] = SU2_TYPE::GetValue(surfaceCoor[i]);
+
+  unsigned long nPointList = pointList.size(), nPointTotal = nPoint;
+  unsigned long nPointList_Global = nPointList, nPoint_Global = nPointTotal;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nPointList, &nPointList_Global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nPointTotal, &nPoint_Global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  if ((rank == MASTER_NODE) && canReuse)
+    cout << "Updating the wall distance of " << nPointList_Global << " of "
+         << nPoint_Global << " points." << endl;
+
+}
+
+void CPhysicalGeometry::ComputeWall_Distance_Distributed(CADTElemClass &WallADT,
+                                                         vector<su2double> &wallBBox,
+                                                         const vector<unsigned long> &pointList) {
+
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  /*--- Make the bounding boxes of the wall elements of all ranks available
+   on all ranks, only a few doubles per rank are communicated instead of
+   the wall elements themselves. ---*/
+
+  vector<su2double> rankBBox(2*nDim*size);
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(wallBBox.data(), 2*nDim, MPI_DOUBLE, rankBBox.data(), 2*nDim,
+                     MPI_DOUBLE, MPI_COMM_WORLD);
+#else
+  rankBBox = wallBBox;
+#endif
+
+  vector<int> wallRanks;
+  for (int iRank = 0; iRank < size; ++iRank)
+    if (rankBBox[iRank*2*nDim] <= rankBBox[iRank*2*nDim+nDim]) wallRanks.push_back(iRank);
+
+  if (wallRanks.empty()) {
+
+    /*--- No solid wall boundary nodes in the entire mesh.
+     Set the wall distance to zero for all nodes. ---*/
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+      node[iPoint]->SetWall_Distance(0.0);
+    return;
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Local search. The farthest corner of the bounding box of   ---*/
+  /*---         any rank bounds the distance, the local search is carried  ---*/
+  /*---         out within that bound and the nearest element of the       ---*/
+  /*---         previous point is the initial guess. The point is then     ---*/
+  /*---         sent to the ranks whose bounding box is closer than the    ---*/
+  /*---         resulting distance.                                        ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const unsigned long nList = pointList.size();
+  const su2double tolBound = 1.0 + 1.0e-8;
+
+  vector<su2double> distList(nList), boundList(nList);
+  vector<vector<unsigned long> > sendList(size);
+  unsigned long adtElemID = ULONG_MAX;
+
+  for (unsigned long i = 0; i < nList; ++i) {
+
+    const su2double *coor = node[pointList[i]]->GetCoord();
+
+    /* Possible and guaranteed distance squared to the boxes of the ranks. */
+    vector<su2double> posDist2(wallRanks.size());
+    su2double bound2 = 1.0e60;
+
+    for (unsigned long j = 0; j < wallRanks.size(); ++j) {
+      const su2double *bbMin = &rankBBox[wallRanks[j]*2*nDim];
+      const su2double *bbMax = bbMin + nDim;
+
+      su2double guarDist2 = 0.0;
+      posDist2[j] = 0.0;
+      for (unsigned short k = 0; k < nDim; ++k) {
+        su2double ds = 0.0;
+        if(     coor[k] < bbMin[k]) ds = coor[k] - bbMin[k];
+        else if(coor[k] > bbMax[k]) ds = coor[k] - bbMax[k];
+        posDist2[j] += ds*ds;
+
+        const su2double dsMax = max(fabs(coor[k] - bbMin[k]), fabs(coor[k] - bbMax[k]));
+        guarDist2 += dsMax*dsMax;
+      }
+      bound2 = min(bound2, guarDist2);
+    }
+
+    su2double bound = sqrt(bound2)*tolBound;
+    distList[i] = 1.0e30;
+
+    if (!WallADT.IsEmpty()) {
+      unsigned short markerID;
+      unsigned long  elemID;
+      int            rankID;
+      su2double      dist;
+
+      if (WallADT.DetermineNearestElement(coor, bound, adtElemID, dist,
+                                          markerID, elemID, rankID)) {
+        distList[i] = dist;
+        bound = dist;
       }
     }
+    boundList[i] = bound;
+
+    for (unsigned long j = 0; j < wallRanks.size(); ++j)
+      if ((wallRanks[j] != rank) && (posDist2[j] < bound*bound))
+        sendList[wallRanks[j]].push_back(i);
   }
 
+#ifdef HAVE_MPI
 
-  /*--- Create the coordinates of the local points on the viscous surfaces and
-        create the final version of the mapping from all volume points to the
-        points on the viscous surfaces. ---*/
-  vector<su2double> surfaceCoor;
-  unsigned long nVertex_SolidWall = 0;
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Send the coordinates and the distance bound of the points  ---*/
+  /*---         to the ranks that may hold a nearer wall element, in one   ---*/
+  /*---         batch per rank, and search them in the local ADT.          ---*/
+  /*--------------------------------------------------------------------------*/
 
-  for(unsigned long i=0; i<nPoint; ++i) {
-    if( meshToSurface[i] ) {
-      meshToSurface[i] = nVertex_SolidWall++;
+  vector<int> nPoint_Send(size+1, 0), nPoint_Recv(size+1, 0);
+  for (int iRank = 0; iRank < size; ++iRank)
+    nPoint_Send[iRank+1] = sendList[iRank].size();
 
-      for(unsigned short k=0; k<nDim; ++k)
-        surfaceCoor.push_back(node[i]->GetCoord(k));
+  SU2_MPI::Alltoall(&(nPoint_Send[1]), 1, MPI_INT,
+                    &(nPoint_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+
+  int nSends = 0, nRecvs = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (nPoint_Send[iRank+1] > 0) nSends++;
+    if (nPoint_Recv[iRank+1] > 0) nRecvs++;
+    nPoint_Send[iRank+1] += nPoint_Send[iRank];
+    nPoint_Recv[iRank+1] += nPoint_Recv[iRank];
+  }
+
+  const unsigned short nCount = nDim+1;
+  vector<su2double> bufSend(nCount*nPoint_Send[size]), bufRecv(nCount*nPoint_Recv[size]);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (unsigned long j = 0; j < sendList[iRank].size(); ++j) {
+      const unsigned long i  = sendList[iRank][j];
+      const unsigned long nn = nCount*(nPoint_Send[iRank]+j);
+      for (unsigned short k = 0; k < nDim; ++k)
+        bufSend[nn+k] = node[pointList[i]]->GetCoord(k);
+      bufSend[nn+nDim] = boundList[i];
     }
   }
 
-  /*--- Change the surface connectivity, such that it corresponds to
-        the entries in surfaceCoor rather than in meshPoints. ---*/
-  for(unsigned long i=0; i<surfaceConn.size(); ++i)
-    surfaceConn[i] = meshToSurface[surfaceConn[i]];
+  vector<SU2_MPI::Request> req(nSends+nRecvs);
+  int iReq = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    const int count = nCount*(nPoint_Recv[iRank+1]-nPoint_Recv[iRank]);
+    if (count > 0)
+      SU2_MPI::Irecv(&bufRecv[nCount*nPoint_Recv[iRank]], count, MPI_DOUBLE, iRank,
+                     iRank, MPI_COMM_WORLD, &req[iReq++]);
+  }
+  for (int iRank = 0; iRank < size; ++iRank) {
+    const int count = nCount*(nPoint_Send[iRank+1]-nPoint_Send[iRank]);
+    if (count > 0)
+      SU2_MPI::Isend(&bufSend[nCount*nPoint_Send[iRank]], count, MPI_DOUBLE, iRank,
+                     rank, MPI_COMM_WORLD, &req[iReq++]);
+  }
+  SU2_MPI::Waitall(iReq, req.data(), MPI_STATUSES_IGNORE);
 
-  /*--------------------------------------------------------------------------*/
-  /*--- Step 2: Build the ADT, which is an ADT of bounding boxes of the    ---*/
-  /*---         surface elements. A nearest point search does not give     ---*/
-  /*---         accurate results, especially not for the integration       ---*/
-  /*---         points of the elements close to a wall boundary.           ---*/
-  /*--------------------------------------------------------------------------*/
+  /* Search the received points, a negative distance means that there is
+     no local wall element within the bound of the point. */
+  vector<su2double> distSend(nPoint_Recv[size]), distRecv(nPoint_Send[size]);
+  adtElemID = ULONG_MAX;
 
-  /* Build the ADT. */
-  CADTElemClass WallADT(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                           markerIDs, elemIDs, true);
+  for (int i = 0; i < nPoint_Recv[size]; ++i) {
+    unsigned short markerID;
+    unsigned long  elemID;
+    int            rankID;
+    su2double      dist;
 
-  /* Release the memory of the vectors used to build the ADT. To make sure
-     that all the memory is deleted, the swap function is used. */
-  vector<unsigned short>().swap(markerIDs);
-  vector<unsigned short>().swap(VTK_TypeElem);
-  vector<unsigned long>().swap(elemIDs);
-  vector<unsigned long>().swap(surfaceConn);
-  vector<su2double>().swap(surfaceCoor);
+    distSend[i] = -1.0;
+    if (WallADT.DetermineNearestElement(&bufRecv[nCount*i], bufRecv[nCount*i+nDim],
+                                        adtElemID, dist, markerID, elemID, rankID))
+      distSend[i] = dist;
+  }
 
   /*--------------------------------------------------------------------------*/
-  /*--- Step 3: Loop over all interior mesh nodes and compute minimum      ---*/
-  /*---         distance to a solid wall element                           ---*/
+  /*--- Step 3: Return the distances to the ranks that own the points.     ---*/
   /*--------------------------------------------------------------------------*/
 
-
-  if ( WallADT.IsEmpty() ) {
-  
-    /*--- No solid wall boundary nodes in the entire mesh.
-     Set the wall distance to zero for all nodes. ---*/
-    
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
-      node[iPoint]->SetWall_Distance(0.0);
+  iReq = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    const int count = nPoint_Send[iRank+1]-nPoint_Send[iRank];
+    if (count > 0)
+      SU2_MPI::Irecv(&distRecv[nPoint_Send[iRank]], count, MPI_DOUBLE, iRank,
+                     iRank, MPI_COMM_WORLD, &req[iReq++]);
   }
-  else {
+  for (int iRank = 0; iRank < size; ++iRank) {
+    const int count = nPoint_Recv[iRank+1]-nPoint_Recv[iRank];
+    if (count > 0)
+      SU2_MPI::Isend(&distSend[nPoint_Recv[iRank]], count, MPI_DOUBLE, iRank,
+                     rank, MPI_COMM_WORLD, &req[iReq++]);
+  }
+  SU2_MPI::Waitall(iReq, req.data(), MPI_STATUSES_IGNORE);
 
-    /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
-    
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
-      unsigned short markerID;
-      unsigned long  elemID;
-      int            rankID;
-      su2double      dist;
-      
-      WallADT.DetermineNearestElement(node[iPoint]->GetCoord(), dist, markerID,
-                                   elemID, rankID);
-      node[iPoint]->SetWall_Distance(dist);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (unsigned long j = 0; j < sendList[iRank].size(); ++j) {
+      const su2double dist = distRecv[nPoint_Send[iRank]+j];
+      const unsigned long i = sendList[iRank][j];
+      if (dist >= 0.0) distList[i] = min(distList[i], dist);
     }
   }
-  
+
+#endif
+
+  /*--- Set the wall distance, the bound is only used if no element was found
+   within it, which can only happen due to round-off. ---*/
+
+  for (unsigned long i = 0; i < nList; ++i) {
+    if (distList[i] > boundList[i]) distList[i] = boundList[i];
+    node[pointList[i]]->SetWall_Distance(distList[i]);
+  }
+
 }
 
 void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
@@ -13280,89 +14831,100 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
   
 }
 
-void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
-  vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
-  bool *inQueue;
+void CPhysicalGeometry::SortPoint_Connectivity(void) {
   
-  inQueue = new bool [nPoint];
+  /*--- Sort the neighbors of each point, the edges are then created in
+   the order of the points and the edge loops traverse memory contiguously. ---*/
   
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    inQueue[iPoint] = false;
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SortPoint();
   
-  /*--- Select the node with the lowest degree in the grid. ---*/
+}
+
+void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
+  unsigned long iPoint, AdjPoint, AddPoint, iNode, iQueue = 0;
+  vector<unsigned long> Queue, AuxQueue, Result;
+  unsigned short Degree, MinDegree;
+  vector<bool> inQueue(nPoint, false);
   
-  MinDegree = node[0]->GetnNeighbor(); AddPoint = 0;
-  for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
-    Degree = node[iPoint]->GetnPoint();
-    if (Degree < MinDegree) { MinDegree = Degree; AddPoint = iPoint; }
-  }
+  /*--- The legacy ordering only traverses the component of the first node,
+   the other components follow in their original order. ---*/
   
-  /*--- Add the node in the first free position. ---*/
+  const bool legacy = (config->GetKind_Renumbering() == LEGACY_RCM_RENUMBERING);
   
-  Result.push_back(AddPoint); inQueue[AddPoint] = true;
+  Queue.reserve(nPointDomain);
+  Result.reserve(nPoint);
   
-  /*--- Loop until reorganize all the nodes ---*/
+  /*--- Loop over the connected components of the domain graph, each one
+   is started from the unnumbered node with the lowest degree. ---*/
   
-  do {
+  while (Result.size() < nPointDomain) {
+    
+    if (legacy && (Result.size() > 0)) {
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+        if (!inQueue[iPoint]) Result.push_back(iPoint);
+      break;
+    }
     
-    /*--- Add to the queue all the nodes adjacent in the increasing
-     order of their degree, checking if the element is already
-     in the Queue. ---*/
+    /*--- Select the node with the lowest degree in the grid. ---*/
     
-    AuxQueue.clear();
-    for (iNode = 0; iNode < node[AddPoint]->GetnPoint(); iNode++) {
-      AdjPoint = node[AddPoint]->GetPoint(iNode);
-      if ((!inQueue[AdjPoint]) && (AdjPoint < nPointDomain)) {
-        AuxQueue.push_back(AdjPoint);
-      }
+    MinDegree = USHRT_MAX; AddPoint = 0;
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (inQueue[iPoint]) continue;
+      Degree = node[iPoint]->GetnPoint();
+      if (Degree < MinDegree) { MinDegree = Degree; AddPoint = iPoint; }
     }
     
-    if (AuxQueue.size() != 0) {
+    /*--- Add the node in the first free position. ---*/
+    
+    Result.push_back(AddPoint); inQueue[AddPoint] = true;
+    
+    /*--- Loop until reorganize all the nodes of the component ---*/
+    
+    while (true) {
       
-      /*--- Sort the auxiliar queue based on the number of neighbors ---*/
+      /*--- Add to the queue all the nodes adjacent in the increasing
+       order of their degree, checking if the element is already
+       in the Queue. ---*/
       
-      for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
-        for (jNode = 0; jNode < AuxQueue.size() - 1 - iNode; jNode++) {
-          if (node[AuxQueue[jNode]]->GetnPoint() > node[AuxQueue[jNode+1]]->GetnPoint()) {
-            AuxPoint = AuxQueue[jNode];
-            AuxQueue[jNode] = AuxQueue[jNode+1];
-            AuxQueue[jNode+1] = AuxPoint;
-          }
+      AuxQueue.clear();
+      for (iNode = 0; iNode < node[AddPoint]->GetnPoint(); iNode++) {
+        AdjPoint = node[AddPoint]->GetPoint(iNode);
+        if ((!inQueue[AdjPoint]) && (AdjPoint < nPointDomain)) {
+          AuxQueue.push_back(AdjPoint);
         }
       }
       
-      Queue.insert(Queue.end(), AuxQueue.begin(), AuxQueue.end());
-      for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
-        inQueue[AuxQueue[iNode]] = true;
+      if (AuxQueue.size() != 0) {
+        
+        /*--- Sort the auxiliar queue based on the number of neighbors ---*/
+        
+        stable_sort(AuxQueue.begin(), AuxQueue.end(),
+                    [this](unsigned long a, unsigned long b) {
+                      return node[a]->GetnPoint() < node[b]->GetnPoint(); });
+        
+        Queue.insert(Queue.end(), AuxQueue.begin(), AuxQueue.end());
+        for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
+          inQueue[AuxQueue[iNode]] = true;
+        }
+        
       }
       
+      /*--- Extract the first node from the queue and add it in the first free
+       position (the queue is only advanced, not erased, to keep this linear). ---*/
+      
+      if (iQueue == Queue.size()) break;
+      AddPoint = Queue[iQueue]; iQueue++;
+      Result.push_back(AddPoint);
+      
+      /*--- The legacy ordering does not expand the last node of the queue. ---*/
+      
+      if (legacy && (iQueue == Queue.size())) break;
+      
     }
     
-    /*--- Extract the first node from the queue and add it in the first free
-     position. ---*/
-    
-    if (Queue.size() != 0) {
-      AddPoint = Queue[0];
-      Result.push_back(Queue[0]);
-      Queue.erase (Queue.begin(), Queue.begin()+1);
-    }
-    
-    /*--- Add to the queue all the nodes adjacent in the increasing
-     order of their degree, checking if the element is already
-     in the Queue. ---*/
-    
-  } while (Queue.size() != 0);
-  
-  /*--- Check that all the points have been added ---*/
-  
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    if (inQueue[iPoint] == false) Result.push_back(iPoint);
   }
   
-  delete[] inQueue;
-  
   reverse(Result.begin(), Result.end());
   
   /*--- Add the MPI points ---*/
@@ -13371,6 +14933,93 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
   
+  SetPoint_Ordering(Result, config);
+  
+}
+
+void CPhysicalGeometry::SetHilbert_Ordering(CConfig *config) {
+  unsigned long iPoint, Q, P, t;
+  unsigned short iDim, iBit;
+  
+  /*--- Number of bits per direction, such that the interleaved key fits in 64 bits. ---*/
+  
+  const unsigned short nBits = (nDim == 2)? 31 : 21;
+  const unsigned long nCells = (1ul << nBits) - 1;
+  
+  /*--- Bounding box of the domain points, a single scale is used in all the
+   directions so that the curve is not distorted by the aspect ratio. ---*/
+  
+  su2double Coord_Min[3] = {0.0, 0.0, 0.0}, Length = 0.0;
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    su2double Coord_Max = -1E30; Coord_Min[iDim] = 1E30;
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      Coord_Min[iDim] = min(Coord_Min[iDim], node[iPoint]->GetCoord(iDim));
+      Coord_Max = max(Coord_Max, node[iPoint]->GetCoord(iDim));
+    }
+    Length = max(Length, Coord_Max-Coord_Min[iDim]);
+  }
+  if (Length <= 0.0) Length = 1.0;
+  
+  /*--- Hilbert key of each domain point (Skilling's transpose algorithm
+   on the integer coordinates, followed by the bit interleaving). ---*/
+  
+  vector<pair<unsigned long long, unsigned long> > Key(nPointDomain);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    unsigned long X[3] = {0, 0, 0};
+    for (iDim = 0; iDim < nDim; iDim++) {
+      su2double Scaled = (node[iPoint]->GetCoord(iDim)-Coord_Min[iDim])/Length;
+      X[iDim] = static_cast<unsigned long>(SU2_TYPE::GetValue(Scaled)*nCells);
+    }
+    
+    /*--- Inverse undo of the excess work (transpose form). ---*/
+    
+    for (Q = 1ul << (nBits-1); Q > 1; Q >>= 1) {
+      P = Q-1;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        if (X[iDim] & Q) X[0] ^= P;
+        else { t = (X[0]^X[iDim]) & P; X[0] ^= t; X[iDim] ^= t; }
+      }
+    }
+    
+    /*--- Gray encode. ---*/
+    
+    for (iDim = 1; iDim < nDim; iDim++) X[iDim] ^= X[iDim-1];
+    t = 0;
+    for (Q = 1ul << (nBits-1); Q > 1; Q >>= 1)
+      if (X[nDim-1] & Q) t ^= Q-1;
+    for (iDim = 0; iDim < nDim; iDim++) X[iDim] ^= t;
+    
+    /*--- Interleave the bits, most significant first. ---*/
+    
+    unsigned long long Hilbert = 0;
+    for (iBit = nBits; iBit > 0; iBit--)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Hilbert = (Hilbert << 1) | ((X[iDim] >> (iBit-1)) & 1ul);
+    
+    Key[iPoint] = make_pair(Hilbert, iPoint);
+  }
+  
+  sort(Key.begin(), Key.end());
+  
+  /*--- Domain points along the curve, followed by the MPI points. ---*/
+  
+  vector<unsigned long> Result(nPoint);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result[iPoint] = Key[iPoint].second;
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    Result[iPoint] = iPoint;
+  
+  SetPoint_Ordering(Result, config);
+  
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(const vector<unsigned long> & Result, CConfig *config) {
+  unsigned long iPoint, iElem, iNode;
+  unsigned short iDim, iMarker;
+  
   /*--- Reset old data structures ---*/
   
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -16073,6 +17722,9 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
   Volume, DomainVolume, my_DomainVolume, *NormalFace = NULL;
   bool change_face_orientation;
 
+  /*--- The coordinates may have changed, the least-squares weights are recomputed on demand. ---*/
+  LSWeights_Updated = false;
+
   /*--- Update values of faces of the edge ---*/
   if (action != ALLOCATE) {
     for (iEdge = 0; iEdge < (long)nEdge; iEdge++)
@@ -18567,259 +20219,311 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     passivedouble Restart_Meta_Passive[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
     su2double Restart_Meta[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
 
-#ifndef HAVE_MPI
+    /*--- Chunked restart files, only the sensitivity fields are read. The metadata
+     is the footer of the file, as for the plain binary files. ---*/
 
-    /*--- Serial binary input. ---*/
+    if (CChunkedRestart::IsChunked(fname)) {
 
-    FILE *fhw;
-    fhw = fopen(fname,"rb");
-    size_t ret;
+      unsigned long *Point_Global = new unsigned long[GetnPointDomain()];
+      unsigned long iPoint_Global_Domain;
+      counter = 0;
+      for (iPoint_Global_Domain = 0; iPoint_Global_Domain < GetGlobal_nPointDomain(); iPoint_Global_Domain++) {
+        if (GetGlobal_to_Local_Point(iPoint_Global_Domain) > -1) {
+          Point_Global[counter] = iPoint_Global_Domain;
+          counter++;
+        }
+      }
 
-    /*--- Error check for opening the file. ---*/
+      vector<string> Field_Names;
+      CChunkedRestart::Read(config, fname, counter, Point_Global, skipVar, nDim,
+                            Restart_Vars, Field_Names, Restart_Data);
+      nFields = Restart_Vars[1];
+      delete [] Point_Global;
 
-    if (!fhw) {
-      SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
-    }
+      config->fields.push_back("Point_ID");
+      for (iVar = 0; iVar < nFields; iVar++) {
+#ifdef HAVE_MPI
+        config->fields.push_back("\"" + Field_Names[iVar] + "\"");
+#else
+        config->fields.push_back(Field_Names[iVar]);
+#endif
+      }
+
+      if (rank == MASTER_NODE) {
+        FILE *fhw = fopen(fname, "rb");
+        fseek(fhw, -long(sizeof(int) + 8*sizeof(passivedouble)), SEEK_END);
+        if ((fread(&Restart_Iter, sizeof(int), 1, fhw) != 1) ||
+            (fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw) != 8)) {
+          SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+        }
+        fclose(fhw);
+      }
 
-    /*--- First, read the number of variables and points. ---*/
+      for (iVar = 0; iVar < 8; iVar++)
+        Restart_Meta[iVar] = Restart_Meta_Passive[iVar];
 
-    ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
-    if (ret != (unsigned long)nRestart_Vars) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+#ifdef HAVE_MPI
+      SU2_MPI::Bcast(&Restart_Iter, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Bcast(Restart_Meta, 8, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#endif
     }
+    else {
 
-    /*--- Check that this is an SU2 binary file. SU2 binary files
-     have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (Restart_Vars[0] != 535532) {
-      SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
-                     string("SU2 reads/writes binary restart files by default.\n") +
-                     string("Note that backward compatibility for ASCII restart files is\n") +
-                     string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
-    }
+#ifndef HAVE_MPI
 
-    /*--- Store the number of fields for simplicity. ---*/
+      /*--- Serial binary input. ---*/
 
-    nFields = Restart_Vars[1];
+      FILE *fhw;
+      fhw = fopen(fname,"rb");
+      size_t ret;
 
-    /*--- Read the variable names from the file. Note that we are adopting a
-     fixed length of 33 for the string length to match with CGNS. This is
-     needed for when we read the strings later. We pad the beginning of the
-     variable string vector with the Point_ID tag that wasn't written. ---*/
+      /*--- Error check for opening the file. ---*/
 
-    config->fields.push_back("Point_ID");
-    for (iVar = 0; iVar < nFields; iVar++) {
-      ret = fread(str_buf, sizeof(char), CGNS_STRING_SIZE, fhw);
-      if (ret != (unsigned long)CGNS_STRING_SIZE) {
+      if (!fhw) {
+        SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
+      }
+
+      /*--- First, read the number of variables and points. ---*/
+
+      ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
+      if (ret != (unsigned long)nRestart_Vars) {
         SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
       }
-      config->fields.push_back(str_buf);
-    }
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+      /*--- Check that this is an SU2 binary file. SU2 binary files
+       have the hex representation of "SU2" as the first int in the file. ---*/
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+      if (Restart_Vars[0] != 535532) {
+        SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
+                       string("SU2 reads/writes binary restart files by default.\n") +
+                       string("Note that backward compatibility for ASCII restart files is\n") +
+                       string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
+      }
 
-    /*--- Read in the data for the restart at all local points. ---*/
+      /*--- Store the number of fields for simplicity. ---*/
 
-    ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
-    if (ret != (unsigned long)nFields*GetnPointDomain()) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      nFields = Restart_Vars[1];
 
-    /*--- Compute (negative) displacements and grab the metadata. ---*/
+      /*--- Read the variable names from the file. Note that we are adopting a
+       fixed length of 33 for the string length to match with CGNS. This is
+       needed for when we read the strings later. We pad the beginning of the
+       variable string vector with the Point_ID tag that wasn't written. ---*/
 
-    ret = sizeof(int) + 8*sizeof(passivedouble);
-    fseek(fhw,-ret, SEEK_END);
+      config->fields.push_back("Point_ID");
+      for (iVar = 0; iVar < nFields; iVar++) {
+        ret = fread(str_buf, sizeof(char), CGNS_STRING_SIZE, fhw);
+        if (ret != (unsigned long)CGNS_STRING_SIZE) {
+          SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+        }
+        config->fields.push_back(str_buf);
+      }
 
-    /*--- Read the external iteration. ---*/
+      /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-    ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
-    if (ret != 1) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      Restart_Data = new passivedouble[nFields*GetnPointDomain()];
 
-    /*--- Read the metadata. ---*/
+      /*--- Read in the data for the restart at all local points. ---*/
 
-    ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
-    if (ret != 8) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
+      if (ret != (unsigned long)nFields*GetnPointDomain()) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
 
-    /*--- Close the file. ---*/
+      /*--- Compute (negative) displacements and grab the metadata. ---*/
 
-    fclose(fhw);
+      ret = sizeof(int) + 8*sizeof(passivedouble);
+      fseek(fhw,-ret, SEEK_END);
+
+      /*--- Read the external iteration. ---*/
+
+      ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
+      if (ret != 1) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+
+      /*--- Read the metadata. ---*/
+
+      ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
+      if (ret != 8) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+
+      /*--- Close the file. ---*/
+
+      fclose(fhw);
 
 #else
 
-    /*--- Parallel binary input using MPI I/O. ---*/
+      /*--- Parallel binary input using MPI I/O. ---*/
 
-    MPI_File fhw;
-    SU2_MPI::Status status;
-    MPI_Datatype etype, filetype;
-    MPI_Offset disp;
-    unsigned long iPoint_Global, iChar;
-    string field_buf;
+      MPI_File fhw;
+      SU2_MPI::Status status;
+      MPI_Datatype etype, filetype;
+      MPI_Offset disp;
+      unsigned long iPoint_Global, iChar;
+      string field_buf;
 
-    int ierr;
-    
-    /*--- All ranks open the file using MPI. ---*/
+      int ierr;
 
-    ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+      /*--- All ranks open the file using MPI. ---*/
 
-    /*--- Error check opening the file. ---*/
+      ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
 
-    if (ierr) {
-      SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
-    }
+      /*--- Error check opening the file. ---*/
 
-    /*--- First, read the number of variables and points (i.e., cols and rows),
-     which we will need in order to read the file later. Also, read the
-     variable string names here. Only the master rank reads the header. ---*/
-    
-    if (rank == MASTER_NODE)
-      MPI_File_read(fhw, Restart_Vars, nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
+      if (ierr) {
+        SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+      }
 
-    /*--- Broadcast the number of variables to all procs and store clearly. ---*/
+      /*--- First, read the number of variables and points (i.e., cols and rows),
+       which we will need in order to read the file later. Also, read the
+       variable string names here. Only the master rank reads the header. ---*/
 
-    SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+      if (rank == MASTER_NODE)
+        MPI_File_read(fhw, Restart_Vars, nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
 
-    /*--- Check that this is an SU2 binary file. SU2 binary files
-     have the hex representation of "SU2" as the first int in the file. ---*/
+      /*--- Broadcast the number of variables to all procs and store clearly. ---*/
 
-    if (Restart_Vars[0] != 535532) {
-      
-      SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
-                     string("SU2 reads/writes binary restart files by default.\n") + 
-                     string("Note that backward compatibility for ASCII restart files is\n") + 
-                     string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
-    }
+      SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
 
-    /*--- Store the number of fields for simplicity. ---*/
+      /*--- Check that this is an SU2 binary file. SU2 binary files
+       have the hex representation of "SU2" as the first int in the file. ---*/
 
-    nFields = Restart_Vars[1];
+      if (Restart_Vars[0] != 535532) {
 
-    /*--- Read the variable names from the file. Note that we are adopting a
-     fixed length of 33 for the string length to match with CGNS. This is
-     needed for when we read the strings later. ---*/
+        SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
+                       string("SU2 reads/writes binary restart files by default.\n") + 
+                       string("Note that backward compatibility for ASCII restart files is\n") + 
+                       string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
+      }
 
-    char *mpi_str_buf = new char[nFields*CGNS_STRING_SIZE];
-    if (rank == MASTER_NODE) {
-      disp = nRestart_Vars*sizeof(int);
-      MPI_File_read_at(fhw, disp, mpi_str_buf, nFields*CGNS_STRING_SIZE,
-                       MPI_CHAR, MPI_STATUS_IGNORE);
-    }
+      /*--- Store the number of fields for simplicity. ---*/
+
+      nFields = Restart_Vars[1];
 
-    /*--- Broadcast the string names of the variables. ---*/
+      /*--- Read the variable names from the file. Note that we are adopting a
+       fixed length of 33 for the string length to match with CGNS. This is
+       needed for when we read the strings later. ---*/
 
-    SU2_MPI::Bcast(mpi_str_buf, nFields*CGNS_STRING_SIZE, MPI_CHAR,
-                   MASTER_NODE, MPI_COMM_WORLD);
+      char *mpi_str_buf = new char[nFields*CGNS_STRING_SIZE];
+      if (rank == MASTER_NODE) {
+        disp = nRestart_Vars*sizeof(int);
+        MPI_File_read_at(fhw, disp, mpi_str_buf, nFields*CGNS_STRING_SIZE,
+                         MPI_CHAR, MPI_STATUS_IGNORE);
+      }
+
+      /*--- Broadcast the string names of the variables. ---*/
+
+      SU2_MPI::Bcast(mpi_str_buf, nFields*CGNS_STRING_SIZE, MPI_CHAR,
+                     MASTER_NODE, MPI_COMM_WORLD);
 
-    /*--- Now parse the string names and load into the config class in case
-     we need them for writing visualization files (SU2_SOL). ---*/
+      /*--- Now parse the string names and load into the config class in case
+       we need them for writing visualization files (SU2_SOL). ---*/
 
-    config->fields.push_back("Point_ID");
-    for (iVar = 0; iVar < nFields; iVar++) {
-      index = iVar*CGNS_STRING_SIZE;
-      field_buf.append("\"");
-      for (iChar = 0; iChar < (unsigned long)CGNS_STRING_SIZE; iChar++) {
-        str_buf[iChar] = mpi_str_buf[index + iChar];
+      config->fields.push_back("Point_ID");
+      for (iVar = 0; iVar < nFields; iVar++) {
+        index = iVar*CGNS_STRING_SIZE;
+        field_buf.append("\"");
+        for (iChar = 0; iChar < (unsigned long)CGNS_STRING_SIZE; iChar++) {
+          str_buf[iChar] = mpi_str_buf[index + iChar];
+        }
+        field_buf.append(str_buf);
+        field_buf.append("\"");
+        config->fields.push_back(field_buf.c_str());
+        field_buf.clear();
       }
-      field_buf.append(str_buf);
-      field_buf.append("\"");
-      config->fields.push_back(field_buf.c_str());
-      field_buf.clear();
-    }
 
-    /*--- Free string buffer memory. ---*/
+      /*--- Free string buffer memory. ---*/
 
-    delete [] mpi_str_buf;
+      delete [] mpi_str_buf;
 
-    /*--- We're writing only su2doubles in the data portion of the file. ---*/
+      /*--- We're writing only su2doubles in the data portion of the file. ---*/
 
-    etype = MPI_DOUBLE;
+      etype = MPI_DOUBLE;
 
-    /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
-     along with the string names of the variables. ---*/
+      /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
+       along with the string names of the variables. ---*/
 
-    disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+      disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-    /*--- Define a derived datatype for this rank's set of non-contiguous data
-     that will be placed in the restart. Here, we are collecting each one of the
-     points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+      /*--- Define a derived datatype for this rank's set of non-contiguous data
+       that will be placed in the restart. Here, we are collecting each one of the
+       points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
 
-    int *blocklen = new int[GetnPointDomain()];
-    int *displace = new int[GetnPointDomain()];
+      int *blocklen = new int[GetnPointDomain()];
+      int *displace = new int[GetnPointDomain()];
 
-    counter = 0;
-    for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields;
-        counter++;
+      counter = 0;
+      for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
+        if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+          blocklen[counter] = nFields;
+          displace[counter] = iPoint_Global*nFields;
+          counter++;
+        }
       }
-    }
-    MPI_Type_indexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-    MPI_Type_commit(&filetype);
+      MPI_Type_indexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
+      MPI_Type_commit(&filetype);
 
-    /*--- Set the view for the MPI file write, i.e., describe the location in
-     the file that this rank "sees" for writing its piece of the restart file. ---*/
+      /*--- Set the view for the MPI file write, i.e., describe the location in
+       the file that this rank "sees" for writing its piece of the restart file. ---*/
 
-    MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+      MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+      /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+      Restart_Data = new passivedouble[nFields*GetnPointDomain()];
 
-    /*--- Collective call for all ranks to read from their view simultaneously. ---*/
-    
-    MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
+      /*--- Collective call for all ranks to read from their view simultaneously. ---*/
 
-    /*--- Free the derived datatype. ---*/
+      MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
 
-    MPI_Type_free(&filetype);
+      /*--- Free the derived datatype. ---*/
 
-    /*--- Reset the file view before writing the metadata. ---*/
+      MPI_Type_free(&filetype);
 
-    MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+      /*--- Reset the file view before writing the metadata. ---*/
 
-    /*--- Access the metadata. ---*/
+      MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
 
-    if (rank == MASTER_NODE) {
+      /*--- Access the metadata. ---*/
+
+      if (rank == MASTER_NODE) {
 
-      /*--- External iteration. ---*/
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble));
-      MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
+        /*--- External iteration. ---*/
+        disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                nFields*Restart_Vars[2]*sizeof(passivedouble));
+        MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
 
-      /*--- Additional doubles for AoA, AoS, etc. ---*/
+        /*--- Additional doubles for AoA, AoS, etc. ---*/
 
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
-      MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+        disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
+        MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
 
-    }
+      }
 
-    /*--- Communicate metadata. ---*/
+      /*--- Communicate metadata. ---*/
 
-    SU2_MPI::Bcast(&Restart_Iter, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Bcast(&Restart_Iter, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
 
-    /*--- Copy to a su2double structure (because of the SU2_MPI::Bcast
-              doesn't work with passive data)---*/
+      /*--- Copy to a su2double structure (because of the SU2_MPI::Bcast
+                doesn't work with passive data)---*/
 
-    for (unsigned short iVar = 0; iVar < 8; iVar++)
-      Restart_Meta[iVar] = Restart_Meta_Passive[iVar];
+      for (unsigned short iVar = 0; iVar < 8; iVar++)
+        Restart_Meta[iVar] = Restart_Meta_Passive[iVar];
 
-    SU2_MPI::Bcast(Restart_Meta, 8, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Bcast(Restart_Meta, 8, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+
+      /*--- All ranks close the file after writing. ---*/
+
+      MPI_File_close(&fhw);
+
+      delete [] blocklen;
+      delete [] displace;
 
-    /*--- All ranks close the file after writing. ---*/
-    
-    MPI_File_close(&fhw);
-    
-    delete [] blocklen;
-    delete [] displace;
-    
 #endif
+    }
 
     /*--- Load the data from the binary restart. ---*/
 
@@ -18880,7 +20584,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -18918,7 +20622,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber)) {
       
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") + 
@@ -21204,14 +22908,29 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
   Local_nPointCoarse = nPoint;
   Local_nPointFine = fine_grid->GetnPoint();
   
+  /*--- Load imbalance of the levels, ratio of the largest number of owned CVs of
+   a rank to the mean. The agglomeration does not move CVs between ranks, hence
+   the imbalance of the coarse levels follows from the fine grid partitioning ---*/
+  
+  unsigned long Local_nDomain[2] = {fine_grid->GetnPointDomain(), nPointDomain}, Max_nDomain[2], Global_nDomain[2];
+  
 #ifdef HAVE_MPI
   SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
   SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Local_nDomain, Max_nDomain, 2, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Local_nDomain, Global_nDomain, 2, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 #else
   Global_nPointCoarse = Local_nPointCoarse;
   Global_nPointFine = Local_nPointFine;
+  for (iNode = 0; iNode < 2; iNode++) {
+    Max_nDomain[iNode] = Local_nDomain[iNode];
+    Global_nDomain[iNode] = Local_nDomain[iNode];
+  }
 #endif
   
+  su2double Imbalance_Fine   = su2double(Max_nDomain[0]*size)/su2double(max(Global_nDomain[0], 1ul));
+  su2double Imbalance_Coarse = su2double(Max_nDomain[1]*size)/su2double(max(Global_nDomain[1], 1ul));
+  
   su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
   
   if (iMesh != MESH_0) {
@@ -21234,16 +22953,17 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
       MGTable.AddColumn("CVs", 10);
       MGTable.AddColumn("Aggl. Rate", 10);
       MGTable.AddColumn("CFL", 10);
+      MGTable.AddColumn("Imbalance", 10);
       MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
       
       
       if (iMesh == 1){
         MGTable.PrintHeader();
-        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1);
+        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1) << Imbalance_Fine;
       }
       stringstream ss;
       ss << "1/" << std::setprecision(3) << ratio;
-      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL;
+      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL << Imbalance_Coarse;
       if (iMesh == config->GetnMGLevels()){
         MGTable.PrintFooter();
       }
@@ -21679,6 +23399,9 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
   su2double *Normal, Coarse_Volume, Area, *NormalFace = NULL;
   Normal = new su2double [nDim];
   
+  /*--- The coordinates may have changed, the least-squares weights are recomputed on demand. ---*/
+  LSWeights_Updated = false;
+  
   /*--- Compute the area of the coarse volume ---*/
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
     node[iCoarsePoint]->SetVolume(0.0);
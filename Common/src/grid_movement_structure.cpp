@@ -136,6 +136,9 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   unsigned long IterLinSol = 0, Smoothing_Iter, iNonlinear_Iter, MaxIter = 0, RestartIter = 50, Tot_Iter = 0, Nonlinear_Iter = 0;
   su2double MinVolume, MaxVolume, NumError, Residual = 0.0, Residual_Init = 0.0;
   bool Screen_Output;
+  double tick = 0.0;
+
+  config->Tick(&tick, PROFILE_MESH_DEFORMATION);
 
 
   /*--- Retrieve number or iterations, tol, output, etc. from config ---*/
@@ -220,6 +223,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		StiffMatrix.BuildAMGPreconditioner(config);
+    		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+    	}
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
@@ -238,6 +247,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		StiffMatrix.BuildAMGPreconditioner(config, true);
+    		mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+    	}
 
     }
 
@@ -306,6 +321,18 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
           break;
 
+        case PIPELINED_CG:
+
+          Tot_Iter = system->PipelinedCG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output);
+
+          break;
+
+        case FGMRES_CGS:
+
+          Tot_Iter = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output, true);
+
+          break;
+
       }
     }
     
@@ -337,7 +364,8 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     }
     
   }
-  
+
+  config->Tock(tick, PROFILE_MESH_DEFORMATION);
 
 }
 
@@ -9564,7 +9592,9 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
   if (config->GetKind_Deform_Linear_Solver() == BCGSTAB ||
       config->GetKind_Deform_Linear_Solver() == FGMRES ||
       config->GetKind_Deform_Linear_Solver() == RESTARTED_FGMRES ||
-      config->GetKind_Deform_Linear_Solver() == CONJUGATE_GRADIENT) {
+      config->GetKind_Deform_Linear_Solver() == CONJUGATE_GRADIENT ||
+      config->GetKind_Deform_Linear_Solver() == PIPELINED_CG ||
+      config->GetKind_Deform_Linear_Solver() == FGMRES_CGS) {
 
     /*--- Independently of whether we are using or not derivatives,
      *--- as the matrix is now symmetric, the matrix-vector product
@@ -9591,6 +9621,10 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CLineletPreconditioner(StiffMatrix, geometry, config);
       break;
+    case AMG:
+      StiffMatrix.BuildAMGPreconditioner(config);
+      precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+      break;
     default:
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
@@ -9607,6 +9641,12 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
     case CONJUGATE_GRADIENT:
       IterLinSol = system->CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
       break;
+    case PIPELINED_CG:
+      IterLinSol = system->PipelinedCG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
+      break;
+    case FGMRES_CGS:
+      IterLinSol = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output, true);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = 0;
       while (IterLinSol < config->GetLinear_Solver_Iter()) {
@@ -260,6 +260,25 @@ void CInterpolator::Collect_VertexInfo(bool faces, int markDonor, int markTarget
 #endif
 }
 
+void CInterpolator::Collect_DonorPoints(unsigned short nDim, vector<su2double> &val_coor, vector<unsigned long> &val_index) {
+
+  unsigned long iVertex, iBuffer;
+  unsigned short iDim;
+  int iProcessor;
+
+  val_coor.clear();
+  val_index.clear();
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    for (iVertex = 0; iVertex < Buffer_Receive_nVertex_Donor[iProcessor]; iVertex++) {
+      iBuffer = iProcessor*MaxLocalVertex_Donor+iVertex;
+      val_index.push_back(iBuffer);
+      for (iDim = 0; iDim < nDim; iDim++)
+        val_coor.push_back(Buffer_Receive_Coord[iBuffer*nDim+iDim]);
+    }
+  }
+}
+
 int CInterpolator::Find_InterfaceMarker(CConfig *config, unsigned short val_marker_interface) {
     
   unsigned short nMarker = config->GetnMarker_All();
@@ -594,15 +613,15 @@ CNearestNeighbor::~CNearestNeighbor() {}
 
 void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
 
-  int iProcessor, pProcessor, nProcessor = size;
+  int pProcessor, rankID, nProcessor = size;
   int markDonor, markTarget;
 
   unsigned short nDim, iMarkerInt, nMarkerInt, iDonor;    
 
-  unsigned long nVertexDonor, nVertexTarget, Point_Target, jVertex, iVertexTarget;
+  unsigned long nVertexDonor, nVertexTarget, Point_Target, iVertexTarget;
   unsigned long Global_Point_Donor, pGlobalPoint=0;
 
-  su2double *Coord_i, *Coord_j, dist, mindist, maxdist;
+  su2double *Coord_i, mindist, maxdist;
 
   /*--- Initialize variables --- */
   
@@ -653,6 +672,15 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
     /*-- Collect coordinates, global points, and normal vectors ---*/
     Collect_VertexInfo( false, markDonor, markTarget, nVertexDonor, nDim );
 
+    /*--- Build an ADT of the donor points of all processors (they are already
+     known everywhere), the ID of a point is its position in the buffers. ---*/
+
+    vector<su2double> Coord_Donor;
+    vector<unsigned long> Index_Donor;
+    Collect_DonorPoints(nDim, Coord_Donor, Index_Donor);
+
+    CADTPointsOnlyClass DonorADT(nDim, Index_Donor.size(), Coord_Donor.data(), Index_Donor.data(), false);
+
     /*--- Compute the closest point to a Near-Field boundary point ---*/
     maxdist = 0.0;
 
@@ -660,7 +688,7 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
 
       Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
 
-      if ( target_geometry->node[Point_Target]->GetDomain() ) {
+      if ( target_geometry->node[Point_Target]->GetDomain() && !DonorADT.IsEmpty() ) {
 
         target_geometry->vertex[markTarget][iVertexTarget]->SetnDonorPoints(1);
         target_geometry->vertex[markTarget][iVertexTarget]->Allocate_DonorInfo(); // Possible meme leak?
@@ -668,27 +696,12 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
         /*--- Coordinates of the boundary point ---*/
         Coord_i = target_geometry->node[Point_Target]->GetCoord();
 
-        mindist    = 1E6; 
-        pProcessor = 0;
-
-        /*--- Loop over all the boundaries to find the pair ---*/
-
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (jVertex = 0; jVertex < MaxLocalVertex_Donor; jVertex++) {
-            Global_Point_Donor = iProcessor*MaxLocalVertex_Donor+jVertex;
-
-            Coord_j = &Buffer_Receive_Coord[ Global_Point_Donor*nDim];
+        /*--- Search the pair in the ADT ---*/
 
-            dist = PointsDistance(Coord_i, Coord_j);
+        DonorADT.DetermineNearestNode(Coord_i, mindist, Global_Point_Donor, rankID);
 
-            if (dist < mindist) {
-              mindist = dist; pProcessor = iProcessor; pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];
-            }
-
-            if (dist == 0.0) break;
-          }
-
-        }
+        pProcessor   = Global_Point_Donor/MaxLocalVertex_Donor;
+        pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];
 
         /*--- Store the value of the pair ---*/
         maxdist = max(maxdist, mindist);
@@ -749,6 +762,11 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
   unsigned long jGlobalPoint = 0;
   int iProcessor;
 
+  vector<su2double> Coord_Donor;
+  vector<unsigned long> Index_Donor;
+  map<unsigned long, unsigned long> DonorPointMap;
+  map<unsigned long, unsigned long>::const_iterator MI;
+
   unsigned long nLocalFace_Donor = 0, nLocalFaceNodes_Donor=0;
 
   unsigned long faceindex;
@@ -818,6 +836,15 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
     /*-- Collect coordinates, global points, and normal vectors ---*/
     Collect_VertexInfo(true, markDonor,markTarget,nVertexDonor,nDim);
 
+    /*--- Map the global index of the donor vertices to their position in the buffers, such
+     that the nodes of the donor faces are matched without a search over all the vertices. ---*/
+
+    Collect_DonorPoints(nDim, Coord_Donor, Index_Donor);
+
+    DonorPointMap.clear();
+    for (iVertex = 0; iVertex < Index_Donor.size(); iVertex++)
+      DonorPointMap[Buffer_Receive_GlobalPoint[Index_Donor[iVertex]]] = Index_Donor[iVertex];
+
     Buffer_Send_FaceIndex    = new unsigned long[MaxFace_Donor];
     Buffer_Send_FaceNodes    = new unsigned long[MaxFaceNodes_Donor];
     Buffer_Send_FaceProc     = new unsigned long[MaxFaceNodes_Donor];
@@ -871,13 +898,10 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
               dPoint = donor_geometry->elem[temp_donor]->GetNode(inode);
               // Match node on the face to the correct global index
               jGlobalPoint=donor_geometry->node[dPoint]->GetGlobalIndex();
-              for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-                for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                  if (jGlobalPoint ==Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]) {
-                    Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                    Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                  }
-                }
+              MI = DonorPointMap.find(jGlobalPoint);
+              if (MI != DonorPointMap.end()) {
+                Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MI->second;
+                Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=MI->second/MaxLocalVertex_Donor;
               }
               nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
             }
@@ -901,13 +925,10 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
             dPoint = donor_geometry->edge[inode]->GetNode(iDonor);
             // Match node on the face to the correct global index
             jGlobalPoint=donor_geometry->node[dPoint]->GetGlobalIndex();
-            for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-              for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                if (jGlobalPoint ==Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]) {
-                  Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                  Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                }
-              }
+            MI = DonorPointMap.find(jGlobalPoint);
+            if (MI != DonorPointMap.end()) {
+              Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MI->second;
+              Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=MI->second/MaxLocalVertex_Donor;
             }
             nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
           }
@@ -1294,6 +1315,11 @@ void CMirror::Set_TransferCoeff(CConfig **config) {
   su2double *Buffer_Send_Coeff, *Buffer_Receive_Coeff;
   su2double coeff;
 
+  multimap<unsigned long, unsigned long> TargetPointMap;
+  multimap<unsigned long, unsigned long>::const_iterator MI;
+  pair<multimap<unsigned long, unsigned long>::const_iterator,
+       multimap<unsigned long, unsigned long>::const_iterator> range;
+
   /*--- Number of markers on the interface ---*/
   nMarkerInt = (config[targetZone]->GetMarker_n_ZoneInterface())/2;
 
@@ -1425,46 +1451,41 @@ void CMirror::Set_TransferCoeff(CConfig **config) {
       Buffer_Receive_Coeff[iVertex] = Buffer_Send_Coeff[iVertex];
     }
 #endif
+    /*--- Map the target points to the positions of the face-nodes that refer to them, inserted in
+     the order processor, face, node, so that the donor order is the one of the scan over all faces. ---*/
+
+    TargetPointMap.clear();
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
+        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
+        iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
+        for (iTarget=0; iTarget<iNodes; iTarget++)
+          TargetPointMap.insert(make_pair(Buffer_Receive_GlobalPoint[faceindex+iTarget], faceindex+iTarget));
+      }
+    }
+
     /*--- Loop over the vertices on the target Marker ---*/
     for (iVertex = 0; iVertex<nVertexTarget; iVertex++) {
 
       iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
       if (target_geometry->node[iPoint]->GetDomain()) {
         Global_Point = target_geometry->node[iPoint]->GetGlobalIndex();
-        nNodes = 0;
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
-            for (iTarget=0; iTarget<iNodes; iTarget++) {
-              if (Global_Point == Buffer_Receive_GlobalPoint[faceindex+iTarget])
-                nNodes++;
-              //coeff =Buffer_Receive_Coeff[faceindex+iDonor];
-            }
-          }
-        }
+
+        range = TargetPointMap.equal_range(Global_Point);
+        nNodes = (unsigned int)distance(range.first, range.second);
 
         target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
         target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
 
         iDonor = 0;
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
-
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
-            for (iTarget=0; iTarget<iNodes; iTarget++) {
-              if (Global_Point == Buffer_Receive_GlobalPoint[faceindex+iTarget]) {
-                coeff =Buffer_Receive_Coeff[faceindex+iTarget];
-                pGlobalPoint = Buffer_Receive_FaceNodes[faceindex+iTarget];
-                target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,pGlobalPoint);
-                target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,coeff);
-                target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, iProcessor);
-                //cout <<rank << " Global Point " << Global_Point<<" iDonor " << iDonor <<" coeff " << coeff <<" gp " << pGlobalPoint << endl;
-                iDonor++;
-              }
-            }
-          }
+        for (MI = range.first; MI != range.second; MI++) {
+          coeff = Buffer_Receive_Coeff[MI->second];
+          pGlobalPoint = Buffer_Receive_FaceNodes[MI->second];
+          iProcessor = (int)(MI->second/MaxFaceNodes_Donor);
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,pGlobalPoint);
+          target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,coeff);
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, iProcessor);
+          iDonor++;
         }
       }
     }
@@ -1489,6 +1510,10 @@ void CMirror::Set_TransferCoeff(CConfig **config) {
 
 CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, CConfig **config, unsigned int iZone, unsigned int jZone)  :  CInterpolator(geometry_container, config, iZone, jZone){
 
+  /*--- With rigid motion of the zones the connectivity of the interface is fixed,
+   hence it is stored and only the coordinates are updated in subsequent calls ---*/
+  Incremental = config[donorZone]->GetSlidingMesh_Incremental();
+
   /*--- Initialize transfer coefficients between the zones ---*/
   Set_TransferCoeff(config);
 
@@ -1498,6 +1523,141 @@ CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, CConfig **config, u
 
 CSlidingMesh::~CSlidingMesh(){}
 
+void CSlidingMesh::StoreBoundary(CInterfaceSide &side){
+
+  unsigned long iVertex, nLinkedNodes = 0;
+
+  /*--- Links to vertices outside of the marker were removed in place, the
+   size of the list is given by the last used entry ---*/
+
+  for (iVertex = 0; iVertex < nGlobalVertex; iVertex++)
+    nLinkedNodes = max(nLinkedNodes, Buffer_Receive_StartLinkedNodes[iVertex] + Buffer_Receive_nLinkedNodes[iVertex]);
+
+  side.nGlobalVertex = nGlobalVertex;
+
+  side.GlobalPoint.assign(     Buffer_Receive_GlobalPoint,      Buffer_Receive_GlobalPoint      + nGlobalVertex);
+  side.Proc.assign(            Buffer_Receive_Proc,             Buffer_Receive_Proc             + nGlobalVertex);
+  side.nLinkedNodes.assign(    Buffer_Receive_nLinkedNodes,     Buffer_Receive_nLinkedNodes     + nGlobalVertex);
+  side.StartLinkedNodes.assign(Buffer_Receive_StartLinkedNodes, Buffer_Receive_StartLinkedNodes + nGlobalVertex);
+  side.LinkedNodes.assign(     Buffer_Receive_LinkedNodes,      Buffer_Receive_LinkedNodes      + nLinkedNodes);
+}
+
+su2double* CSlidingMesh::GatherBoundaryCoord(unsigned long val_zone, int val_marker, unsigned long val_nGlobalVertex){
+
+  CGeometry *geom = Geometry[val_zone][INST_0][MESH_0];
+
+  unsigned short iDim, nDim = geom->GetnDim();
+  unsigned long iVertex, iPoint, nVertex, nLocalVertex = 0;
+
+  if( val_marker != -1 )
+    nVertex = geom->GetnVertex( val_marker );
+  else
+    nVertex = 0;
+
+  su2double *Send_Coord    = new su2double[ nVertex * nDim ];
+  su2double *Receive_Coord = new su2double[ val_nGlobalVertex * nDim ];
+
+  /*--- Same ordering as ReconstructBoundary: owned vertices in marker order, ranks in ascending order ---*/
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++) {
+    iPoint = geom->vertex[val_marker][iVertex]->GetNode();
+    if (geom->node[iPoint]->GetDomain()) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        Send_Coord[nLocalVertex*nDim+iDim] = geom->node[iPoint]->GetCoord(iDim);
+      nLocalVertex++;
+    }
+  }
+
+#ifdef HAVE_MPI
+  int iRank, nLocalCoord = nLocalVertex*nDim;
+  int *nCoord = new int[size], *Displ = new int[size];
+
+  SU2_MPI::Allgather(&nLocalCoord, 1, MPI_INT, nCoord, 1, MPI_INT, MPI_COMM_WORLD);
+
+  Displ[0] = 0;
+  for (iRank = 1; iRank < size; iRank++)
+    Displ[iRank] = Displ[iRank-1] + nCoord[iRank-1];
+
+  SU2_MPI::Allgatherv(Send_Coord, nLocalCoord, MPI_DOUBLE, Receive_Coord, nCoord, Displ, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  delete [] nCoord;
+  delete [] Displ;
+#else
+  for (iVertex = 0; iVertex < nLocalVertex*nDim; iVertex++)
+    Receive_Coord[iVertex] = Send_Coord[iVertex];
+#endif
+
+  delete [] Send_Coord;
+
+  return Receive_Coord;
+}
+
+unsigned long CSlidingMesh::FindClosestDonor(su2double *Coord, su2double *DonorCoord, unsigned long nDonor, unsigned long *nLinkedNodes,
+                                             unsigned long *StartLinkedNodes, unsigned long *LinkedNodes, unsigned long val_guess){
+
+  unsigned short nDim = donor_geometry->GetnDim();
+  unsigned long iPoint, jPoint, iLink, closest;
+  su2double dist, mindist, maxLength;
+  bool moved;
+
+  if (val_guess < nDonor) {
+
+    /*--- The zones moved little since the previous update, walk from the previous
+     closest point towards the query point until no neighbor is closer ---*/
+
+    closest = val_guess;
+    mindist = PointsDistance(Coord, &DonorCoord[closest*nDim]);
+    moved   = true;
+
+    while (moved && mindist > 0.0) {
+      moved  = false;
+      iPoint = closest;
+      for (iLink = 0; iLink < nLinkedNodes[iPoint]; iLink++) {
+        jPoint = LinkedNodes[ StartLinkedNodes[iPoint] + iLink ];
+        dist   = PointsDistance(Coord, &DonorCoord[jPoint*nDim]);
+        if (dist < mindist) {
+          mindist = dist;
+          closest = jPoint;
+          moved   = true;
+        }
+      }
+    }
+
+    /*--- Accept the point if the query point lies within its donor element, otherwise
+     the walk may have stopped at a local minimum and the full search is made ---*/
+
+    maxLength = 0.0;
+    for (iLink = 0; iLink < nLinkedNodes[closest]; iLink++) {
+      jPoint    = LinkedNodes[ StartLinkedNodes[closest] + iLink ];
+      maxLength = max(maxLength, PointsDistance(&DonorCoord[closest*nDim], &DonorCoord[jPoint*nDim]));
+    }
+
+    if (mindist <= maxLength) return closest;
+  }
+
+  /*--- Brute force to find the closest donor_node ---*/
+
+  mindist = 1E6;
+  closest = 0;
+
+  for (iPoint = 0; iPoint < nDonor; iPoint++) {
+
+    dist = PointsDistance(Coord, &DonorCoord[ iPoint * nDim ]);
+
+    if (dist < mindist) {
+      mindist = dist;
+      closest = iPoint;
+    }
+
+    if (dist == 0.0){
+      closest = iPoint;
+      break;
+    }
+  }
+
+  return closest;
+}
+
 void CSlidingMesh::Set_TransferCoeff(CConfig **config){
     
   /* --- This routine sets the transfer coefficient for sliding mesh approach --- */
@@ -1511,7 +1671,7 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
   /* --- General variables --- */
 
-  bool check;
+  bool check, stored;
   
   unsigned short iDim, nDim;
   
@@ -1528,14 +1688,14 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
 
   /* --- Markers Variables --- */
 
-  unsigned short iMarkerInt, nMarkerInt; 
+  unsigned short iMarkerInt, nMarkerInt, iInterface; 
 
   unsigned long iVertex, nVertexTarget;
 
@@ -1587,6 +1747,14 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
   /*--- Number of markers on the FSI interface ---*/
   nMarkerInt    = (int)( config[ donorZone ]->GetMarker_n_ZoneInterface() ) / 2;
 
+  if (InterfaceStored.size() != nMarkerInt) {
+    InterfaceStored.assign(nMarkerInt, false);
+    TargetSide.resize(nMarkerInt);
+    DonorSide.resize(nMarkerInt);
+    TargetGlobalVertex.resize(nMarkerInt);
+    DonorClosestPoint.resize(nMarkerInt);
+  }
+
   /*--- For the number of markers on the interface... ---*/
   for ( iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++ ){
 
@@ -1609,29 +1777,67 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
     3 -Reconstruct the boundaries from parallel partitioning
     */
 
-    /*--- Target boundary ---*/
-    ReconstructBoundary(targetZone, markTarget);
-    
-    nGlobalVertex_Target = nGlobalVertex;
+    iInterface = iMarkerInt - 1;
+    stored     = Incremental && InterfaceStored[iInterface];
 
-    TargetPoint_Coord       = Buffer_Receive_Coord;
-    Target_GlobalPoint      = Buffer_Receive_GlobalPoint;
-    Target_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
-    Target_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
-    Target_LinkedNodes      = Buffer_Receive_LinkedNodes;
-    Target_Proc             = Buffer_Receive_Proc;
-    
-    /*--- Donor boundary ---*/
-    ReconstructBoundary(donorZone, markDonor);
-    
-    nGlobalVertex_Donor = nGlobalVertex;
+    if (stored) {
+
+      /*--- The connectivity of the interface is known from the previous update, only the coordinates are gathered ---*/
+
+      nGlobalVertex_Target = TargetSide[iInterface].nGlobalVertex;
+
+      TargetPoint_Coord       = GatherBoundaryCoord(targetZone, markTarget, nGlobalVertex_Target);
+      Target_GlobalPoint      = TargetSide[iInterface].GlobalPoint.data();
+      Target_nLinkedNodes     = TargetSide[iInterface].nLinkedNodes.data();
+      Target_StartLinkedNodes = TargetSide[iInterface].StartLinkedNodes.data();
+      Target_LinkedNodes      = TargetSide[iInterface].LinkedNodes.data();
+      Target_Proc             = TargetSide[iInterface].Proc.data();
+
+      nGlobalVertex_Donor = DonorSide[iInterface].nGlobalVertex;
 
-    DonorPoint_Coord       = Buffer_Receive_Coord;
-    Donor_GlobalPoint      = Buffer_Receive_GlobalPoint;
-    Donor_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
-    Donor_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
-    Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
-    Donor_Proc             = Buffer_Receive_Proc;
+      DonorPoint_Coord       = GatherBoundaryCoord(donorZone, markDonor, nGlobalVertex_Donor);
+      Donor_GlobalPoint      = DonorSide[iInterface].GlobalPoint.data();
+      Donor_nLinkedNodes     = DonorSide[iInterface].nLinkedNodes.data();
+      Donor_StartLinkedNodes = DonorSide[iInterface].StartLinkedNodes.data();
+      Donor_LinkedNodes      = DonorSide[iInterface].LinkedNodes.data();
+      Donor_Proc             = DonorSide[iInterface].Proc.data();
+    }
+    else {
+
+      /*--- Target boundary ---*/
+      ReconstructBoundary(targetZone, markTarget);
+      if (Incremental) StoreBoundary(TargetSide[iInterface]);
+
+      nGlobalVertex_Target = nGlobalVertex;
+
+      TargetPoint_Coord       = Buffer_Receive_Coord;
+      Target_GlobalPoint      = Buffer_Receive_GlobalPoint;
+      Target_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
+      Target_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
+      Target_LinkedNodes      = Buffer_Receive_LinkedNodes;
+      Target_Proc             = Buffer_Receive_Proc;
+
+      /*--- Donor boundary ---*/
+      ReconstructBoundary(donorZone, markDonor);
+      if (Incremental) StoreBoundary(DonorSide[iInterface]);
+
+      nGlobalVertex_Donor = nGlobalVertex;
+
+      DonorPoint_Coord       = Buffer_Receive_Coord;
+      Donor_GlobalPoint      = Buffer_Receive_GlobalPoint;
+      Donor_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
+      Donor_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
+      Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
+      Donor_Proc             = Buffer_Receive_Proc;
+
+      /*--- Position of the target vertices in the gathered boundary and closest donor
+       points, kept to start the search of the next update ---*/
+
+      if (Incremental) {
+        TargetGlobalVertex[iInterface].assign(nVertexTarget, 0);
+        DonorClosestPoint[iInterface].assign(nVertexTarget, nGlobalVertex_Donor);
+      }
+    }
 
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
@@ -1664,37 +1870,26 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
           Coord_i = target_geometry->node[target_iPoint]->GetCoord();
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
- 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-        
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = PointsDistance(Coord_i, Coord_j);
+          /*--- Find the closest donor_node, starting from the one of the previous update if available ---*/
 
-            if (dist < mindist) {
-              mindist = dist;  
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }    
-          }
+          donor_StartIndex = FindClosestDonor(Coord_i, DonorPoint_Coord, nGlobalVertex_Donor, Donor_nLinkedNodes, Donor_StartLinkedNodes,
+                                              Donor_LinkedNodes, stored? DonorClosestPoint[iInterface][iVertex] : nGlobalVertex_Donor);
+          if (Incremental) DonorClosestPoint[iInterface][iVertex] = donor_StartIndex;
 
           donor_iPoint    = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
           
           /*--- Contruct information regarding the target cell ---*/
           
-          dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          if (stored)
+            jVertexTarget = TargetGlobalVertex[iInterface][iVertex];
+          else {
+            dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
+            for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
+              if( dPoint == Target_GlobalPoint[jVertexTarget] )
+                break;
+            if (Incremental) TargetGlobalVertex[iInterface][iVertex] = jVertexTarget;
+          }
             
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -1923,11 +2118,16 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
           for (iDim = 0; iDim < nDim; iDim++)
             Coord_i[iDim] = target_geometry->node[target_iPoint]->GetCoord(iDim);
           
-          dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
-          for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-            if( dPoint == Target_GlobalPoint[target_iPoint] )
-              break;
-          }        
+          if (stored)
+            target_iPoint = TargetGlobalVertex[iInterface][iVertex];
+          else {
+            dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
+            for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
+              if( dPoint == Target_GlobalPoint[target_iPoint] )
+                break;
+            }
+            if (Incremental) TargetGlobalVertex[iInterface][iVertex] = target_iPoint;
+          }
         
           /*--- Build local surface dual mesh for target element ---*/
         
@@ -1941,27 +2141,11 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
             
           nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes, TargetPoint_Coord, target_iPoint, target_element);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
- 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-        
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = PointsDistance(Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;  
-              donor_StartIndex = donor_iPoint;
-            }
+          /*--- Find the closest donor_node, starting from the one of the previous update if available ---*/
 
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }    
-          }
+          donor_StartIndex = FindClosestDonor(Coord_i, DonorPoint_Coord, nGlobalVertex_Donor, Donor_nLinkedNodes, Donor_StartLinkedNodes,
+                                              Donor_LinkedNodes, stored? DonorClosestPoint[iInterface][iVertex] : nGlobalVertex_Donor);
+          if (Incremental) DonorClosestPoint[iInterface][iVertex] = donor_StartIndex;
                 
           donor_iPoint = donor_StartIndex;
 
@@ -2166,19 +2350,25 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
 
     delete [] TargetPoint_Coord;
-    delete [] Target_GlobalPoint;
-    delete [] Target_Proc;
-    delete [] Target_nLinkedNodes;
-    delete [] Target_LinkedNodes;
-    delete [] Target_StartLinkedNodes;
-        
     delete [] DonorPoint_Coord;
-    delete [] Donor_GlobalPoint;
-    delete [] Donor_Proc;
-    delete [] Donor_nLinkedNodes;      
-    delete [] Donor_StartLinkedNodes;  
-    delete [] Donor_LinkedNodes;       
-    
+
+    /*--- The connectivity is owned by the stored interface sides after the first update ---*/
+
+    if (!stored) {
+      delete [] Target_GlobalPoint;
+      delete [] Target_Proc;
+      delete [] Target_nLinkedNodes;
+      delete [] Target_LinkedNodes;
+      delete [] Target_StartLinkedNodes;
+
+      delete [] Donor_GlobalPoint;
+      delete [] Donor_Proc;
+      delete [] Donor_nLinkedNodes;      
+      delete [] Donor_StartLinkedNodes;  
+      delete [] Donor_LinkedNodes;       
+    }
+
+    InterfaceStored[iInterface] = Incremental;
   }
 
   delete [] Normal;
@@ -2857,6 +3047,24 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
 
     Collect_VertexInfo( false, mark_donor, mark_target, nVertexDonor, nDim);
 
+    /*--- The sparse form does not assemble the dense matrix on the master node, every rank
+     computes the weights of its own target points from the donor points it already has. ---*/
+
+    if (config[donorZone]->GetRadialBasisFunctionSparse()) {
+
+      Set_SparseTransferCoeff(config[donorZone], mark_target, nVertexTarget, nDim);
+
+      delete[] Buffer_Send_Coord;
+      delete[] Buffer_Send_GlobalPoint;
+
+      delete[] Buffer_Receive_Coord;
+      delete[] Buffer_Receive_GlobalPoint;
+
+      delete[] Buffer_Send_nVertex_Donor;
+
+      continue;
+    }
+
     /*--- Send information about size of local_M array ---*/
     nLocalM = nVertexDonorInDomain*(nVertexDonorInDomain+1)/2 \
 		    + nVertexDonorInDomain*(nGlobalVertexDonor-iGlobalVertexDonor_end);
@@ -3112,6 +3320,8 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
             coeff_vec[iVertexDonor] += target_vec[jVertexDonor]*C_inv_trunc[jVertexDonor*nGlobalVertexDonor+iVertexDonor];
         }
 
+        Prune_Coefficients(config[donorZone]->GetRadialBasisFunctionPruneTol(), nGlobalVertexDonor, coeff_vec);
+
         iCount = 0;
         for (iVertexDonor=0; iVertexDonor<nGlobalVertexDonor; iVertexDonor++) {
           if ( coeff_vec[iVertexDonor] != 0 ) {
@@ -3328,6 +3538,243 @@ void CRadialBasisFunction::Check_PolynomialTerms(int m, unsigned long n, const i
   
 }
 
+void CRadialBasisFunction::Set_SparseTransferCoeff(CConfig *config, int mark_target, unsigned long nVertexTarget, unsigned short nDim)
+{
+  const unsigned short kind_rbf = config->GetKindRadialBasisFunction();
+  const su2double radius = config->GetRadialBasisFunctionParameter();
+  const bool use_polynomial = config->GetRadialBasisFunctionPolynomialOption();
+  const passivedouble solver_tol = 1e-10;
+  const unsigned short max_widen = 20;
+
+  int m, n, nPolynomial = 0, nPolyTerm = 0;
+  unsigned short iDim, iWiden;
+  unsigned long iDonor, jDonor, iPatch, nPatch, nDonor, iVertexTarget, point_target, iCount, max_iter, nDenseSolve = 0;
+
+  su2double interface_coord_tol=1e6*numeric_limits<double>::epsilon();
+  su2double *Coord_i, target_vec[4], patch_radius;
+  passivedouble val_i, poly_res[4], poly_coeff[4];
+
+  vector<su2double> Coord_Donor, patch_dist, dist, P, coeff_vec;
+  vector<unsigned long> Index_Donor, patch, neighbors, row_ptr, col_ind;
+  vector<unsigned long>::iterator it;
+  vector<passivedouble> val, rhs, sol, Q;
+  vector<int> skip_row, calc_polynomial_check;
+
+  CSparseSymmetricMatrix patch_M;
+  CSymmetricMatrix Mp;
+
+  /*--- Donor points of all ranks, without the padding of the buffers ---*/
+
+  Collect_DonorPoints(nDim, Coord_Donor, Index_Donor);
+  nDonor = Index_Donor.size();
+
+  if (nDonor == 0) return;
+
+  CRadialBasisSupport DonorSupport(nDim, nDonor, Coord_Donor.data(), radius);
+
+  /*--- The inverse of the interpolation matrix of a compact basis decays quickly away from the
+   diagonal, the weights of a target point are therefore computed from the donor points of a patch
+   around it (RADIAL_BASIS_FUNCTION_SPARSE_PATCH support radii). Neither the matrix of all the donor
+   points nor a system of that size is ever formed, and the cost per target point is independent of
+   the size of the interface. With the polynomial term the interpolation of linear fields stays exact. ---*/
+
+  for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
+
+    point_target = target_geometry->vertex[mark_target][iVertexTarget]->GetNode();
+
+    if (!target_geometry->node[point_target]->GetDomain()) continue;
+
+    Coord_i = target_geometry->node[point_target]->GetCoord();
+
+    /*--- Donor points of the patch, the patch is widened if it is empty ---*/
+
+    patch_radius = config->GetRadialBasisFunctionPatch()*radius;
+    DonorSupport.FindPoints(Coord_i, patch_radius, patch, patch_dist);
+    for (iWiden = 0; (iWiden < max_widen) && patch.empty(); iWiden++) {
+      patch_radius *= 2.0;
+      DonorSupport.FindPoints(Coord_i, patch_radius, patch, patch_dist);
+    }
+    nPatch = patch.size();
+
+    if (nPatch == 0) {
+      target_geometry->vertex[mark_target][iVertexTarget]->SetnDonorPoints(0);
+      target_geometry->vertex[mark_target][iVertexTarget]->Allocate_DonorInfo();
+      continue;
+    }
+
+    /*--- Interpolation matrix of the patch, only the pairs closer than the support radius are stored ---*/
+
+    row_ptr.assign(nPatch+1, 0);
+    col_ind.clear();
+    val.clear();
+
+    for (iPatch = 0; iPatch < nPatch; iPatch++) {
+      DonorSupport.FindPoints(&Coord_Donor[patch[iPatch]*nDim], neighbors, dist);
+      for (jDonor = 0; jDonor < neighbors.size(); jDonor++) {
+        it = lower_bound(patch.begin(), patch.end(), neighbors[jDonor]);
+        if ((it == patch.end()) || (*it != neighbors[jDonor])) continue;
+        col_ind.push_back(it-patch.begin());
+        val.push_back(SU2_TYPE::GetValue(Get_RadialBasisValue(kind_rbf, radius, dist[jDonor])));
+      }
+      row_ptr[iPatch+1] = col_ind.size();
+    }
+
+    patch_M.Initialize(nPatch, row_ptr, col_ind, val);
+
+    /*--- The patch matrices can be ill-conditioned. The weights of a non converged
+     solve are never used, the patch is then solved directly instead. ---*/
+
+    max_iter = 10*nPatch;
+
+    rhs.resize(nPatch);
+    sol.resize(nPatch);
+    coeff_vec.resize(nPatch);
+
+    /*--- The polynomial term needs more points than terms ---*/
+
+    nPolyTerm = 0;
+    if (use_polynomial && (nPatch > nDim+1u)) {
+
+      /*--- Fill P and remove its redundant rows, exactly as for the dense form ---*/
+
+      P.resize(nPatch*(nDim+1));
+      for (iPatch = 0; iPatch < nPatch; iPatch++) {
+        P[iPatch*(nDim+1)] = 1;
+        for (iDim = 0; iDim < nDim; iDim++)
+          P[iPatch*(nDim+1)+iDim+1] = Coord_Donor[patch[iPatch]*nDim+iDim];
+      }
+
+      skip_row.assign(nDim+1, 0);
+      skip_row[0] = 1;
+      calc_polynomial_check.assign(nDim, 1);
+
+      Check_PolynomialTerms(nDim+1, nPatch, skip_row.data(), interface_coord_tol, calc_polynomial_check.data(), nPolynomial, P.data());
+      nPolyTerm = nPolynomial+1;
+
+      /*--- Q = M^-1*P, one solve per polynomial term ---*/
+
+      Q.resize(nPatch*nPolyTerm);
+      for (m = 0; m < nPolyTerm; m++) {
+        for (iPatch = 0; iPatch < nPatch; iPatch++)
+          rhs[iPatch] = SU2_TYPE::GetValue(P[iPatch*nPolyTerm+m]);
+
+        if (!patch_M.Solve(rhs.data(), sol.data(), solver_tol, max_iter)) {
+          patch_M.SolveDense(rhs.data(), sol.data());
+          nDenseSolve++;
+        }
+
+        for (iPatch = 0; iPatch < nPatch; iPatch++)
+          Q[iPatch*nPolyTerm+m] = sol[iPatch];
+      }
+
+      /*--- Mp = P'*M^-1*P is small and dense ---*/
+
+      Mp.Initialize(nPolyTerm);
+      for (m = 0; m < nPolyTerm; m++) {
+        for (n = m; n < nPolyTerm; n++) {
+          val_i = 0.0;
+          for (iPatch = 0; iPatch < nPatch; iPatch++)
+            val_i += SU2_TYPE::GetValue(P[iPatch*nPolyTerm+m])*Q[iPatch*nPolyTerm+n];
+          Mp.Write(m, n, val_i);
+        }
+      }
+      Mp.Invert(false);
+    }
+
+    /*--- The weights of the target point are w = M^-1*(phi - P*Mp^-1*(P'*M^-1*phi - p)), where phi
+     are the basis function values between the target and the donor points and p = (1, x, y, z). ---*/
+
+    for (iPatch = 0; iPatch < nPatch; iPatch++)
+      rhs[iPatch] = SU2_TYPE::GetValue(Get_RadialBasisValue(kind_rbf, radius, patch_dist[iPatch]));
+
+    if (!patch_M.Solve(rhs.data(), sol.data(), solver_tol, max_iter)) {
+      patch_M.SolveDense(rhs.data(), sol.data());
+      nDenseSolve++;
+    }
+
+    if (nPolyTerm > 0) {
+
+      iCount = 0;
+      target_vec[iCount++] = 1.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        if (calc_polynomial_check[iDim] == 1)
+          target_vec[iCount++] = Coord_i[iDim];
+
+      for (m = 0; m < nPolyTerm; m++) {
+        poly_res[m] = SU2_TYPE::GetValue(target_vec[m]);
+        for (iPatch = 0; iPatch < nPatch; iPatch++)
+          poly_res[m] -= SU2_TYPE::GetValue(P[iPatch*nPolyTerm+m])*sol[iPatch];
+      }
+
+      for (m = 0; m < nPolyTerm; m++) {
+        poly_coeff[m] = 0.0;
+        for (n = 0; n < nPolyTerm; n++)
+          poly_coeff[m] += Mp.Read(m, n)*poly_res[n];
+      }
+
+      for (iPatch = 0; iPatch < nPatch; iPatch++)
+        for (m = 0; m < nPolyTerm; m++)
+          sol[iPatch] += Q[iPatch*nPolyTerm+m]*poly_coeff[m];
+    }
+
+    for (iPatch = 0; iPatch < nPatch; iPatch++) coeff_vec[iPatch] = sol[iPatch];
+
+    Prune_Coefficients(config->GetRadialBasisFunctionPruneTol(), nPatch, coeff_vec.data());
+
+    /*--- Store the non zero weights, donor processor and global index follow from the buffer position ---*/
+
+    iCount = 0;
+    for (iPatch = 0; iPatch < nPatch; iPatch++)
+      if (coeff_vec[iPatch] != 0.0) iCount++;
+
+    target_geometry->vertex[mark_target][iVertexTarget]->SetnDonorPoints(iCount);
+    target_geometry->vertex[mark_target][iVertexTarget]->Allocate_DonorInfo();
+
+    iCount = 0;
+    for (iPatch = 0; iPatch < nPatch; iPatch++) {
+      if (coeff_vec[iPatch] != 0.0) {
+        iDonor = patch[iPatch];
+        target_geometry->vertex[mark_target][iVertexTarget]->SetInterpDonorPoint(iCount, Buffer_Receive_GlobalPoint[Index_Donor[iDonor]]);
+        target_geometry->vertex[mark_target][iVertexTarget]->SetInterpDonorProcessor(iCount, int(Index_Donor[iDonor]/MaxLocalVertex_Donor));
+        target_geometry->vertex[mark_target][iVertexTarget]->SetDonorCoeff(iCount, coeff_vec[iPatch]);
+        iCount++;
+      }
+    }
+  }
+
+#ifdef HAVE_MPI
+  unsigned long nDenseSolve_Local = nDenseSolve;
+  SU2_MPI::Allreduce(&nDenseSolve_Local, &nDenseSolve, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  if ((rank == MASTER_NODE) && (nDenseSolve > 0))
+    cout << nDenseSolve << " sparse RBF interpolation systems were solved directly, "
+         << "consider reducing RADIAL_BASIS_FUNCTION_PARAMETER." << endl;
+}
+
+void CRadialBasisFunction::Prune_Coefficients(su2double tol, unsigned long n, su2double *coeff)
+{
+  unsigned long i;
+  su2double max_coeff = 0.0, sum_all = 0.0, sum_kept = 0.0;
+
+  if (tol <= 0.0) return;
+
+  for (i = 0; i < n; i++) {
+    if (fabs(coeff[i]) > max_coeff) max_coeff = fabs(coeff[i]);
+    sum_all += coeff[i];
+  }
+
+  for (i = 0; i < n; i++) {
+    if (fabs(coeff[i]) < tol*max_coeff) coeff[i] = 0.0;
+    sum_kept += coeff[i];
+  }
+
+  /*--- Redistribute what was discarded, proportionally to the kept coefficients ---*/
+
+  if (sum_kept != 0.0)
+    for (i = 0; i < n; i++) coeff[i] *= sum_all/sum_kept;
+}
+
 su2double CRadialBasisFunction::Get_RadialBasisValue(const short unsigned int type, const su2double &radius, const su2double &dist)
 {
   su2double rbf = dist/radius;
@@ -3843,3 +4290,224 @@ double CSymmetricMatrix::ReadInv(int i, int j)
     throw invalid_argument("Matrix inverse not calculated yet.");
   }
 }
+
+/*--- Sparse symmetric matrix class definitions ---*/
+CSparseSymmetricMatrix::CSparseSymmetricMatrix()
+{
+  sz = 0;
+}
+
+void CSparseSymmetricMatrix::Initialize(unsigned long N, vector<unsigned long> &val_row_ptr,
+                                        vector<unsigned long> &val_col_ind, vector<passivedouble> &val)
+{
+  unsigned long i, k;
+
+  sz = N;
+  row_ptr.swap(val_row_ptr);
+  col_ind.swap(val_col_ind);
+  val_vec.swap(val);
+
+  /*--- Inverse of the diagonal for the Jacobi preconditioner ---*/
+  inv_diag.assign(sz, 1.0);
+  for (i = 0; i < sz; i++)
+    for (k = row_ptr[i]; k < row_ptr[i+1]; k++)
+      if ((col_ind[k] == i) && (val_vec[k] != 0.0)) inv_diag[i] = 1.0/val_vec[k];
+
+  r.resize(sz);  z.resize(sz);
+  p.resize(sz);  Ap.resize(sz);
+
+  dense_inv.clear();
+}
+
+void CSparseSymmetricMatrix::MatVecMult(const passivedouble *v, passivedouble *prod) const
+{
+  unsigned long i, k;
+  passivedouble sum;
+
+  for (i = 0; i < sz; i++) {
+    sum = 0.0;
+    for (k = row_ptr[i]; k < row_ptr[i+1]; k++)
+      sum += val_vec[k]*v[col_ind[k]];
+    prod[i] = sum;
+  }
+}
+
+bool CSparseSymmetricMatrix::Solve(const passivedouble *b, passivedouble *x, passivedouble tol, unsigned long max_iter)
+{
+  unsigned long i, iter;
+  passivedouble alpha, beta, rz, rz_new, pAp, norm_b = 0.0, norm_r;
+
+  for (i = 0; i < sz; i++) {
+    x[i] = 0.0;
+    r[i] = b[i];
+    z[i] = inv_diag[i]*r[i];
+    p[i] = z[i];
+    norm_b += b[i]*b[i];
+  }
+  norm_b = sqrt(norm_b);
+
+  if (norm_b == 0.0) return true;
+
+  rz = 0.0;
+  for (i = 0; i < sz; i++) rz += r[i]*z[i];
+
+  for (iter = 0; iter < max_iter; iter++) {
+
+    MatVecMult(p.data(), Ap.data());
+
+    pAp = 0.0;
+    for (i = 0; i < sz; i++) pAp += p[i]*Ap[i];
+    alpha = rz/pAp;
+
+    norm_r = 0.0;
+    for (i = 0; i < sz; i++) {
+      x[i] += alpha*p[i];
+      r[i] -= alpha*Ap[i];
+      norm_r += r[i]*r[i];
+    }
+
+    if (sqrt(norm_r) <= tol*norm_b) return true;
+
+    rz_new = 0.0;
+    for (i = 0; i < sz; i++) {
+      z[i] = inv_diag[i]*r[i];
+      rz_new += r[i]*z[i];
+    }
+    beta = rz_new/rz;
+    rz = rz_new;
+
+    for (i = 0; i < sz; i++) p[i] = z[i] + beta*p[i];
+  }
+
+  return false;
+}
+
+void CSparseSymmetricMatrix::SolveDense(const passivedouble *b, passivedouble *x)
+{
+  unsigned long i, j, k;
+
+  if (dense_inv.empty()) {
+
+    /*--- The patches are small, the inverse is formed with the dense symmetric matrix class ---*/
+    CSymmetricMatrix dense;
+    dense.Initialize(sz);
+    for (i = 0; i < sz; i++)
+      for (k = row_ptr[i]; k < row_ptr[i+1]; k++)
+        if (col_ind[k] >= i) dense.Write(i, col_ind[k], val_vec[k]);
+    dense.Invert(false);
+
+    dense_inv.resize(sz*sz);
+    for (i = 0; i < sz; i++) {
+      for (j = 0; j < sz; j++) {
+        dense_inv[i*sz+j] = dense.Read(i, j);
+        if (dense_inv[i*sz+j] != dense_inv[i*sz+j])
+          SU2_MPI::Error("Singular RBF interpolation matrix, consider changing RADIAL_BASIS_FUNCTION_PARAMETER.", CURRENT_FUNCTION);
+      }
+    }
+  }
+
+  for (i = 0; i < sz; i++) {
+    x[i] = 0.0;
+    for (j = 0; j < sz; j++) x[i] += dense_inv[i*sz+j]*b[j];
+  }
+}
+
+/*--- Support search class definitions ---*/
+CRadialBasisSupport::CRadialBasisSupport(unsigned short val_nDim, unsigned long nPoint, const su2double *val_coord, su2double val_radius)
+{
+  /*--- Bins are enlarged beyond the radius if needed, to keep the linear bin index in range ---*/
+  const unsigned long max_nBin = 1ul << 20;
+
+  unsigned short iDim;
+  unsigned long iPoint, bin, stride;
+  passivedouble max_coord[3], x;
+
+  nDim   = val_nDim;
+  radius = val_radius;
+  coord  = val_coord;
+
+  for (iDim = 0; iDim < 3; iDim++) {
+    min_coord[iDim] = 0.0;  max_coord[iDim] = 0.0;
+    bin_size[iDim]  = 1.0;  nBin[iDim]      = 1;
+  }
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    if (nPoint > 0) min_coord[iDim] = max_coord[iDim] = SU2_TYPE::GetValue(coord[iDim]);
+    for (iPoint = 1; iPoint < nPoint; iPoint++) {
+      x = SU2_TYPE::GetValue(coord[iPoint*nDim+iDim]);
+      min_coord[iDim] = min(min_coord[iDim], x);
+      max_coord[iDim] = max(max_coord[iDim], x);
+    }
+    bin_size[iDim] = max(SU2_TYPE::GetValue(radius), (max_coord[iDim]-min_coord[iDim])/max_nBin);
+    nBin[iDim] = (unsigned long)((max_coord[iDim]-min_coord[iDim])/bin_size[iDim])+1;
+  }
+
+  bin_point.resize(nPoint);
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    bin = 0;  stride = 1;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      x = (SU2_TYPE::GetValue(coord[iPoint*nDim+iDim])-min_coord[iDim])/bin_size[iDim];
+      bin += min((unsigned long)x, nBin[iDim]-1)*stride;
+      stride *= nBin[iDim];
+    }
+    bin_point[iPoint] = make_pair(bin, iPoint);
+  }
+  sort(bin_point.begin(), bin_point.end());
+}
+
+void CRadialBasisSupport::FindPoints(const su2double *coor, vector<unsigned long> &points, vector<su2double> &dist) const
+{
+  FindPoints(coor, radius, points, dist);
+}
+
+void CRadialBasisSupport::FindPoints(const su2double *coor, su2double search_radius,
+                                     vector<unsigned long> &points, vector<su2double> &dist) const
+{
+  unsigned short iDim;
+  long center[3], first[3], last[3], nLayer, i, j, k;
+  unsigned long iPoint, bin, ijk[3];
+  su2double d, dx;
+  vector<pair<unsigned long, unsigned long> >::const_iterator it;
+  vector<pair<unsigned long, su2double> > found;
+
+  /*--- Range of bins around the query point, 1 in each direction for the support radius as the bins are not smaller than it ---*/
+  for (iDim = 0; iDim < 3; iDim++) {
+    center[iDim] = 0;  first[iDim] = 0;  last[iDim] = 0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    nLayer = (long)ceil(SU2_TYPE::GetValue(search_radius)/bin_size[iDim]);
+    center[iDim] = (long)floor((SU2_TYPE::GetValue(coor[iDim])-min_coord[iDim])/bin_size[iDim]);
+    first[iDim]  = max(center[iDim]-nLayer, 0l);
+    last[iDim]   = min(center[iDim]+nLayer, long(nBin[iDim])-1);
+  }
+
+  for (i = first[0]; i <= last[0]; i++) {
+    for (j = first[1]; j <= last[1]; j++) {
+      for (k = first[2]; k <= last[2]; k++) {
+        ijk[0] = i;  ijk[1] = j;  ijk[2] = k;
+        bin = ijk[0] + nBin[0]*(ijk[1] + nBin[1]*ijk[2]);
+
+        for (it = lower_bound(bin_point.begin(), bin_point.end(), make_pair(bin, 0ul));
+             (it != bin_point.end()) && (it->first == bin); it++) {
+          iPoint = it->second;
+          d = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++) {
+            dx = coor[iDim]-coord[iPoint*nDim+iDim];
+            d += dx*dx;
+          }
+          d = sqrt(d);
+          if (d < search_radius) found.push_back(make_pair(iPoint, d));
+        }
+      }
+    }
+  }
+
+  sort(found.begin(), found.end());
+
+  points.resize(found.size());
+  dist.resize(found.size());
+  for (iPoint = 0; iPoint < found.size(); iPoint++) {
+    points[iPoint] = found[iPoint].first;
+    dist[iPoint]   = found[iPoint].second;
+  }
+}
@@ -0,0 +1,437 @@
+/*!
+ * \file io_aggregator_structure.cpp
+ * \brief Main subroutines for the parallel file I/O through a set of aggregator ranks.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/io_aggregator_structure.hpp"
+
+#ifdef HAVE_MPI
+
+/*--- Largest request passed to MPI at once, the counts are ints. ---*/
+const unsigned long IO_MaxChunkBytes = 1073741824;
+
+CIOAggregator::CIOAggregator(unsigned long val_nAggregator, unsigned long val_stripeSize) {
+
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+
+  stripeSize = val_stripeSize;
+  fileOpen   = false;
+
+  /*--- Contiguous groups of ranks, such that the data of a group is also contiguous
+   in the file for the linear partitions used by the output. The first rank of each
+   group is the aggregator, hence the master is always an aggregator. ---*/
+
+  int nAggregator = size;
+  if ((val_nAggregator > 0) && (val_nAggregator < (unsigned long)size))
+    nAggregator = int(val_nAggregator);
+
+  groupSize    = (size + nAggregator - 1)/nAggregator;
+  nGroup       = (size + groupSize - 1)/groupSize;
+  groupID      = rank/groupSize;
+  isAggregator = (rank%groupSize == 0);
+
+  MPI_Comm_split(MPI_COMM_WORLD, isAggregator? 0 : MPI_UNDEFINED, rank, &aggrComm);
+
+  /*--- Hints for the file system, one stripe per aggregator. Without aggregation
+   nothing is passed, to keep the defaults of the MPI library. ---*/
+
+  fileInfo = MPI_INFO_NULL;
+
+  if (val_nAggregator > 0) {
+    char str_buf[32];
+    MPI_Info_create(&fileInfo);
+
+    sprintf(str_buf, "%d", nGroup);
+    MPI_Info_set(fileInfo, (char*)"striping_factor", str_buf);
+    MPI_Info_set(fileInfo, (char*)"cb_nodes", str_buf);
+
+    if (stripeSize > 0) {
+      sprintf(str_buf, "%lu", stripeSize);
+      MPI_Info_set(fileInfo, (char*)"striping_unit", str_buf);
+      MPI_Info_set(fileInfo, (char*)"cb_buffer_size", str_buf);
+    }
+  }
+
+}
+
+CIOAggregator::~CIOAggregator(void) {
+
+  if (fileOpen) MPI_File_close(&fhw);
+  if (aggrComm != MPI_COMM_NULL) MPI_Comm_free(&aggrComm);
+  if (fileInfo != MPI_INFO_NULL) MPI_Info_free(&fileInfo);
+
+}
+
+bool CIOAggregator::Open(const char *val_filename, bool val_write) {
+
+  int ierr = MPI_SUCCESS;
+
+  if (isAggregator) {
+    if (val_write) {
+
+      /*--- Try to open the file with exclusive so that an error is generated if the
+       file exists. We always want to write a fresh file, so we delete any existing
+       file and create a new one. ---*/
+
+      ierr = MPI_File_open(aggrComm, (char*)val_filename,
+                           MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
+                           fileInfo, &fhw);
+      if (ierr != MPI_SUCCESS) {
+        if (rank == MASTER_NODE)
+          MPI_File_delete((char*)val_filename, MPI_INFO_NULL);
+        MPI_Barrier(aggrComm);
+        ierr = MPI_File_open(aggrComm, (char*)val_filename,
+                             MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
+                             fileInfo, &fhw);
+      }
+    }
+    else {
+      ierr = MPI_File_open(aggrComm, (char*)val_filename, MPI_MODE_RDONLY, fileInfo, &fhw);
+    }
+  }
+
+  fileOpen = (isAggregator && (ierr == MPI_SUCCESS));
+
+  /*--- All ranks must agree on the outcome. ---*/
+
+  int my_fail = (ierr != MPI_SUCCESS), fail = 0;
+  SU2_MPI::Allreduce(&my_fail, &fail, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+  return (fail == 0);
+
+}
+
+void CIOAggregator::Close(void) {
+
+  if (fileOpen) MPI_File_close(&fhw);
+  fileOpen = false;
+
+}
+
+void CIOAggregator::WriteAt_Master(MPI_Offset disp, const void *buf, unsigned long nBytes) {
+
+  if (rank != MASTER_NODE) return;
+
+  for (unsigned long offset = 0; offset < nBytes; offset += IO_MaxChunkBytes) {
+    unsigned long count = min(IO_MaxChunkBytes, nBytes-offset);
+    MPI_File_write_at(fhw, disp+offset, (void*)(static_cast<const char*>(buf)+offset), int(count),
+                      MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+
+}
+
+void CIOAggregator::ReadAt_Master(MPI_Offset disp, void *buf, unsigned long nBytes) {
+
+  if (rank != MASTER_NODE) return;
+
+  for (unsigned long offset = 0; offset < nBytes; offset += IO_MaxChunkBytes) {
+    unsigned long count = min(IO_MaxChunkBytes, nBytes-offset);
+    MPI_File_read_at(fhw, disp+offset, static_cast<char*>(buf)+offset, int(count), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+
+}
+
+void CIOAggregator::WriteAt_All(MPI_Offset disp, const void *buf, unsigned long nBytes) {
+
+  const int groupRoot = groupID*groupSize;
+  const int groupEnd  = min(groupRoot+groupSize, size);
+
+  /*--- The other ranks of the group only hand their data to the aggregator. ---*/
+
+  if (!isAggregator) {
+    SU2_MPI::Send(&nBytes, 1, MPI_UNSIGNED_LONG, groupRoot, rank, MPI_COMM_WORLD);
+    vector<MPI_Request> req;
+    IsendBytes(static_cast<const char*>(buf), nBytes, groupRoot, rank, MPI_COMM_WORLD, req);
+    MPI_Waitall(req.size(), req.data(), MPI_STATUSES_IGNORE);
+    return;
+  }
+
+  /*--- Gather the chunks of the group behind the one of the aggregator. ---*/
+
+  const int nMember = groupEnd-groupRoot-1;
+  vector<unsigned long> memberBytes(nMember+1, 0);
+
+  for (int iMember = 0; iMember < nMember; iMember++)
+    SU2_MPI::Recv(&memberBytes[iMember], 1, MPI_UNSIGNED_LONG, groupRoot+1+iMember,
+                  groupRoot+1+iMember, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+  unsigned long groupBytes = nBytes;
+  for (int iMember = 0; iMember < nMember; iMember++)
+    groupBytes += memberBytes[iMember];
+
+  vector<char> groupBuf(groupBytes);
+  if (nBytes > 0) memcpy(groupBuf.data(), buf, nBytes);
+
+  vector<MPI_Request> req;
+  unsigned long offset = nBytes;
+
+  for (int iMember = 0; iMember < nMember; iMember++) {
+    IrecvBytes(&groupBuf[offset], memberBytes[iMember], groupRoot+1+iMember,
+               groupRoot+1+iMember, MPI_COMM_WORLD, req);
+    offset += memberBytes[iMember];
+  }
+  MPI_Waitall(req.size(), req.data(), MPI_STATUSES_IGNORE);
+
+  /*--- Shift the boundaries between the aggregators to the stripes and write. ---*/
+
+  if ((stripeSize > 0) && (nGroup > 1)) AlignToStripes(disp, groupBuf);
+
+  WriteChunks(disp, groupBuf.data(), groupBuf.size());
+
+}
+
+void CIOAggregator::AlignToStripes(MPI_Offset &disp, vector<char> &buffer) {
+
+  /*--- Current and target range [begin, end) of every aggregator in the file. ---*/
+
+  long long my_range[2] = {(long long)disp, (long long)(disp + buffer.size())};
+  vector<long long> range(2*nGroup), target(nGroup+1);
+
+  MPI_Allgather(my_range, 2, MPI_LONG_LONG, range.data(), 2, MPI_LONG_LONG, aggrComm);
+
+  const long long stripe = (long long)stripeSize;
+  target[0] = range[0];
+  target[nGroup] = range[2*nGroup-1];
+  for (int iGroup = 1; iGroup < nGroup; iGroup++)
+    target[iGroup] = max(target[0], (range[2*iGroup]/stripe)*stripe);
+
+  vector<char> alignedBuf(target[groupID+1]-target[groupID]);
+  vector<MPI_Request> req;
+
+  for (int iGroup = 0; iGroup < nGroup; iGroup++) {
+
+    /*--- Part of my data that the other aggregator writes. ---*/
+
+    long long lo = max(my_range[0], target[iGroup]), hi = min(my_range[1], target[iGroup+1]);
+    if ((hi > lo) && (iGroup != groupID)) {
+      IsendBytes(&buffer[lo-my_range[0]], hi-lo, iGroup, 0, aggrComm, req);
+    }
+    else if (hi > lo) {
+      memcpy(&alignedBuf[lo-target[groupID]], &buffer[lo-my_range[0]], hi-lo);
+    }
+
+    /*--- Part of its data that I write. ---*/
+
+    lo = max(range[2*iGroup], target[groupID]); hi = min(range[2*iGroup+1], target[groupID+1]);
+    if ((hi > lo) && (iGroup != groupID)) {
+      IrecvBytes(&alignedBuf[lo-target[groupID]], hi-lo, iGroup, 0, aggrComm, req);
+    }
+  }
+  MPI_Waitall(req.size(), req.data(), MPI_STATUSES_IGNORE);
+
+  disp = target[groupID];
+  buffer.swap(alignedBuf);
+
+}
+
+void CIOAggregator::WriteChunks(MPI_Offset disp, const char *buf, unsigned long nBytes) {
+
+  /*--- The call is collective, every aggregator makes the same number of calls. ---*/
+
+  int my_nChunk = int((nBytes + IO_MaxChunkBytes - 1)/IO_MaxChunkBytes), nChunk = 0;
+  MPI_Allreduce(&my_nChunk, &nChunk, 1, MPI_INT, MPI_MAX, aggrComm);
+
+  for (int iChunk = 0; iChunk < nChunk; iChunk++) {
+    unsigned long offset = min(iChunk*IO_MaxChunkBytes, nBytes);
+    unsigned long count  = min(IO_MaxChunkBytes, nBytes-offset);
+    MPI_File_write_at_all(fhw, disp+offset, (void*)(buf+offset), int(count), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+
+}
+
+void CIOAggregator::ReadChunks(MPI_Offset disp, char *buf, unsigned long nBytes) {
+
+  int my_nChunk = int((nBytes + IO_MaxChunkBytes - 1)/IO_MaxChunkBytes), nChunk = 0;
+  MPI_Allreduce(&my_nChunk, &nChunk, 1, MPI_INT, MPI_MAX, aggrComm);
+
+  for (int iChunk = 0; iChunk < nChunk; iChunk++) {
+    unsigned long offset = min(iChunk*IO_MaxChunkBytes, nBytes);
+    unsigned long count  = min(IO_MaxChunkBytes, nBytes-offset);
+    MPI_File_read_at_all(fhw, disp+offset, buf+offset, int(count), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+
+}
+
+void CIOAggregator::IsendBytes(const char *buf, unsigned long nBytes, int dest, int tag,
+                               MPI_Comm comm, vector<MPI_Request> &req) {
+
+  /*--- Messages between two ranks with the same tag are matched in order,
+   so the receiver posts the same sequence of chunks. ---*/
+
+  for (unsigned long offset = 0; offset < nBytes; offset += IO_MaxChunkBytes) {
+    unsigned long count = min(IO_MaxChunkBytes, nBytes-offset);
+    req.push_back(MPI_REQUEST_NULL);
+    MPI_Isend((void*)(buf+offset), int(count), MPI_CHAR, dest, tag, comm, &req.back());
+  }
+
+}
+
+void CIOAggregator::IrecvBytes(char *buf, unsigned long nBytes, int source, int tag,
+                               MPI_Comm comm, vector<MPI_Request> &req) {
+
+  for (unsigned long offset = 0; offset < nBytes; offset += IO_MaxChunkBytes) {
+    unsigned long count = min(IO_MaxChunkBytes, nBytes-offset);
+    req.push_back(MPI_REQUEST_NULL);
+    MPI_Irecv(buf+offset, int(count), MPI_CHAR, source, tag, comm, &req.back());
+  }
+
+}
+
+void CIOAggregator::ReadAt_Aggregator(MPI_Offset disp, void *buf, unsigned long nBytes) {
+
+  if (!isAggregator) return;
+
+  for (unsigned long offset = 0; offset < nBytes; offset += IO_MaxChunkBytes) {
+    unsigned long count = min(IO_MaxChunkBytes, nBytes-offset);
+    MPI_File_read_at(fhw, disp+offset, static_cast<char*>(buf)+offset, int(count), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+
+}
+
+void CIOAggregator::ReadRecords_All(MPI_Offset disp, unsigned long recordBytes, unsigned long nRecord_Global,
+                                    unsigned long nRecord, const unsigned long *record, void *buf) {
+
+  /*--- Each aggregator reads a contiguous range of records, the ranges start at
+   the first record beginning in the stripe closest to an even split of the data. ---*/
+
+  vector<unsigned long> first(nGroup+1);
+  const unsigned long totalBytes = nRecord_Global*recordBytes;
+
+  for (int iGroup = 0; iGroup < nGroup; iGroup++) {
+    unsigned long bytes = (unsigned long)((double(iGroup)/nGroup)*totalBytes);
+    if ((stripeSize > 0) && (iGroup > 0)) {
+      unsigned long fileBytes = ((disp+bytes)/stripeSize)*stripeSize;
+      bytes = (fileBytes > (unsigned long)disp)? fileBytes-disp : 0;
+    }
+    first[iGroup] = min((bytes + recordBytes - 1)/recordBytes, nRecord_Global);
+  }
+  first[0] = 0;
+  first[nGroup] = nRecord_Global;
+
+  vector<char> rangeBuf;
+
+  if (isAggregator) {
+    rangeBuf.resize((first[groupID+1]-first[groupID])*recordBytes);
+    ReadChunks(disp + first[groupID]*recordBytes, rangeBuf.data(), rangeBuf.size());
+  }
+
+  ExchangeRecords(first.data(), recordBytes, nRecord, record, rangeBuf.data(), buf);
+
+}
+
+void CIOAggregator::ExchangeRecords(const unsigned long *first, unsigned long recordBytes, unsigned long nRecord,
+                                    const unsigned long *record, const char *rangeBuf, void *buf) {
+
+  unsigned long iRecord;
+  int iGroup, iRank;
+
+  /*--- Number of records requested from each aggregator, the records are sorted so
+   the requests to an aggregator are a contiguous part of the list. ---*/
+
+  vector<int> nRequest_Send(size, 0), nRequest_Recv(size, 0);
+  vector<unsigned long> request_Start(nGroup+1, 0);
+
+  iGroup = 0;
+  for (iRecord = 0; iRecord < nRecord; iRecord++) {
+    while (record[iRecord] >= first[iGroup+1]) {
+      iGroup++;
+      request_Start[iGroup] = iRecord;
+    }
+    nRequest_Send[iGroup*groupSize]++;
+  }
+  for (iGroup++; iGroup <= nGroup; iGroup++)
+    request_Start[iGroup] = nRecord;
+
+  SU2_MPI::Alltoall(nRequest_Send.data(), 1, MPI_INT,
+                    nRequest_Recv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  /*--- Send the requested indices to the aggregators. ---*/
+
+  unsigned long nRequest_Total = 0;
+  for (iRank = 0; iRank < size; iRank++) nRequest_Total += nRequest_Recv[iRank];
+
+  vector<unsigned long> request(nRequest_Total);
+  vector<SU2_MPI::Request> req(size+nGroup);
+  int nReq = 0;
+
+  for (iGroup = 0; iGroup < nGroup; iGroup++) {
+    iRank = iGroup*groupSize;
+    if (nRequest_Send[iRank] > 0) {
+      SU2_MPI::Isend((void*)&record[request_Start[iGroup]], nRequest_Send[iRank], MPI_UNSIGNED_LONG,
+                     iRank, 0, MPI_COMM_WORLD, &req[nReq]);
+      nReq++;
+    }
+  }
+
+  unsigned long offset = 0;
+  for (iRank = 0; iRank < size; iRank++) {
+    if (nRequest_Recv[iRank] > 0) {
+      SU2_MPI::Irecv(&request[offset], nRequest_Recv[iRank], MPI_UNSIGNED_LONG,
+                     iRank, 0, MPI_COMM_WORLD, &req[nReq]);
+      nReq++;
+    }
+    offset += nRequest_Recv[iRank];
+  }
+  SU2_MPI::Waitall(nReq, req.data(), MPI_STATUSES_IGNORE);
+
+  /*--- The aggregators reply in the order of the requests. ---*/
+
+  vector<char> replyBuf(nRequest_Total*recordBytes);
+
+  for (iRecord = 0; iRecord < nRequest_Total; iRecord++)
+    memcpy(&replyBuf[iRecord*recordBytes],
+           &rangeBuf[(request[iRecord]-first[groupID])*recordBytes], recordBytes);
+
+  /*--- The replies can exceed the int count of a message, they are sent in chunks. ---*/
+
+  vector<MPI_Request> replyReq;
+  offset = 0;
+  for (iRank = 0; iRank < size; iRank++) {
+    IsendBytes(&replyBuf[offset*recordBytes], nRequest_Recv[iRank]*recordBytes,
+               iRank, 1, MPI_COMM_WORLD, replyReq);
+    offset += nRequest_Recv[iRank];
+  }
+
+  for (iGroup = 0; iGroup < nGroup; iGroup++) {
+    iRank = iGroup*groupSize;
+    IrecvBytes(static_cast<char*>(buf) + request_Start[iGroup]*recordBytes,
+               nRequest_Send[iRank]*recordBytes, iRank, 1, MPI_COMM_WORLD, replyReq);
+  }
+  MPI_Waitall(replyReq.size(), replyReq.data(), MPI_STATUSES_IGNORE);
+
+}
+
+#endif
@@ -177,6 +177,92 @@ void CSysSolve::ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<
 
 }
 
+void CSysSolve::ClassicalGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w) {
+  
+  /*--- Parameter for reorthonormalization, the classical variant loses orthogonality
+   faster than the modified one, hence the vector is orthogonalized again as soon as its
+   norm is reduced by more than 1/sqrt(2) (Daniel, Gragg, Kaufman and Stewart) ---*/
+  
+  static const su2double reorth = 0.5;
+  
+  int k, iPass;
+  su2double nrm = 0.0, proj;
+  vector<su2double> loc_prod(i+2), prod(i+2);
+  SU2_MPI::Request request;
+  
+  for (k = 0; k < i+1; k++) Hsbg[k][i] = 0.0;
+  
+  for (iPass = 0; iPass < 2; iPass++) {
+    
+    /*--- Projections of w[i+1] onto the basis, and its norm, are summed
+     over the processors with a single reduction ---*/
+    
+    for (k = 0; k < i+1; k++) loc_prod[k] = dotProdLocal(w[i+1], w[k]);
+    loc_prod[i+1] = dotProdLocal(w[i+1], w[i+1]);
+    
+    StartReduction(&loc_prod[0], &prod[0], i+2, &request);
+    FinishReduction(&request);
+    
+    /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN, the reduced value is the
+     same on all processors so no further synchronization is needed ---*/
+    
+    if ((iPass == 0) && ((prod[i+1] <= 0.0) || (prod[i+1] != prod[i+1]))) {
+      SU2_MPI::Error("SU2 has diverged.", CURRENT_FUNCTION);
+    }
+    
+    /*--- Remove the projections ---*/
+    
+    proj = 0.0;
+    for (k = 0; k < i+1; k++) {
+      Hsbg[k][i] += prod[k];
+      w[i+1].Plus_AX(-prod[k], w[k]);
+      proj += prod[k]*prod[k];
+    }
+    
+    /*--- Norm of the resulting vector, if most of w[i+1] was removed this
+     estimate is not accurate and the vector is orthogonalized again ---*/
+    
+    nrm = prod[i+1] - proj;
+    if (proj <= reorth*prod[i+1]) break;
+  }
+  
+  /*--- If the second pass also removed most of the vector, w[i+1] is nearly in
+   the span of the basis, its (small) norm is computed explicitly ---*/
+  
+  if (iPass == 2) nrm = dotProd(w[i+1], w[i+1]);
+  
+  if (nrm < 0.0) nrm = 0.0;
+  nrm = sqrt(nrm);
+  Hsbg[i+1][i] = nrm;
+  
+  /*--- Scale the resulting vector ---*/
+  
+  w[i+1] /= nrm;
+  
+}
+
+void CSysSolve::StartReduction(su2double *loc_prod, su2double *prod, int count, SU2_MPI::Request *request) {
+  
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  
+  /*--- The AD wrapper has no non-blocking reductions, the sum is done here ---*/
+  
+  SU2_MPI::Allreduce(loc_prod, prod, count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  SU2_MPI::Iallreduce(loc_prod, prod, count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, request);
+#endif
+  
+}
+
+void CSysSolve::FinishReduction(SU2_MPI::Request *request) {
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  SU2_MPI::Status status;
+  SU2_MPI::Wait(request, &status);
+#endif
+  
+}
+
 void CSysSolve::WriteHeader(const string & solver, const su2double & restol, const su2double & resinit) {
   
   cout << "\n# " << solver << " residual history" << endl;
@@ -309,8 +395,143 @@ unsigned long CSysSolve::CG_LinSolver(const CSysVector & b, CSysVector & x, CMat
   
 }
 
+unsigned long CSysSolve::PipelinedCG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                               CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+  
+  int rank = SU2_MPI::GetRank();
+  
+  /*--- Check the subspace size ---*/
+  
+  if (m < 1) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for subspace size, m = %lu", m );
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+  
+  /*--- Besides the residual r, the recurrences carry u = M*r, w = A*u and their
+   search directions p, q = M*s, s = A*p, z = A*q. M_w and A_M_w hold the
+   preconditioned w and its product with the matrix. ---*/
+  
+  CSysVector r(b), u(b), w(b), p(b), q(b), s(b), z(b), M_w(b), A_M_w(b);
+  
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+  
+  mat_vec(x, w);
+  
+  r -= w; // recall, r holds b initially
+  su2double norm_r = r.norm();
+  su2double norm0 = b.norm();
+  if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
+    if (rank == MASTER_NODE) cout << "CSysSolve::PipelinedCG(): system solved by initial guess." << endl;
+    return 0;
+  }
+  
+  precond(r, u);
+  mat_vec(u, w);
+  
+  su2double alpha = 1.0, beta = 0.0, gamma, gamma_old = 1.0, delta;
+  su2double loc_prod[3], prod[3];
+  SU2_MPI::Request request;
+  
+  /*--- Set the norm to the initial initial residual value ---*/
+  
+  norm0 = norm_r;
+  
+  /*--- Output header information including initial residual ---*/
+  
+  int i = 0;
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    WriteHeader("Pipelined CG", tol, norm_r);
+    WriteHistory(i, norm_r, norm0);
+  }
+  
+  /*---  Loop over all search directions ---*/
+  
+  for (i = 0; i < (int)m; i++) {
+    
+    /*--- Start the reduction of gamma = (r,u), delta = (w,u) and (r,r) ---*/
+    
+    loc_prod[0] = dotProdLocal(r, u);
+    loc_prod[1] = dotProdLocal(w, u);
+    loc_prod[2] = dotProdLocal(r, r);
+    StartReduction(loc_prod, prod, 3, &request);
+    
+    /*--- Precondition and apply the matrix to w while the reduction progresses ---*/
+    
+    precond(w, M_w);
+    mat_vec(M_w, A_M_w);
+    
+    FinishReduction(&request);
+    gamma = prod[0];
+    delta = prod[1];
+    norm_r = sqrt(max(prod[2], su2double(0.0)));
+    
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+    
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (rank == MASTER_NODE)) && (i > 0) && (i % 10 == 0)) WriteHistory(i, norm_r, norm0);
+    
+    /*--- Step-length alpha and Gram-Schmidt coefficient beta ---*/
+    
+    if (i > 0) {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta*gamma/alpha);
+    }
+    else {
+      beta = 0.0;
+      alpha = gamma / delta;
+    }
+    gamma_old = gamma;
+    
+    /*--- Update the search directions ---*/
+    
+    z.Equals_AX_Plus_BY(1.0, A_M_w, beta, z);
+    q.Equals_AX_Plus_BY(1.0, M_w, beta, q);
+    s.Equals_AX_Plus_BY(1.0, w, beta, s);
+    p.Equals_AX_Plus_BY(1.0, u, beta, p);
+    
+    /*--- Update solution and residual, and their preconditioned counterparts ---*/
+    
+    x.Plus_AX(alpha, p);
+    r.Plus_AX(-alpha, s);
+    u.Plus_AX(-alpha, q);
+    w.Plus_AX(-alpha, z);
+    
+  }
+  
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    cout << "# Pipelined Conjugate Gradient final (true) residual:" << endl;
+    cout << "# Iteration = " << i << ": |res|/|res0| = "  << norm_r/norm0 << ".\n" << endl;
+  }
+  
+  /*--- Recalculate final residual (this should be optional) ---*/
+  
+  if (monitoring) {
+    
+    mat_vec(x, w);
+    r = b;
+    r -= w;
+    su2double true_res = r.norm();
+    
+    if (fabs(true_res - norm_r) > tol*10.0) {
+      if (rank == MASTER_NODE) {
+        cout << "# WARNING in CSysSolve::PipelinedCG_LinSolver(): " << endl;
+        cout << "# true residual norm and calculated residual norm do not agree." << endl;
+        cout << "# true_res = " << true_res <<", calc_res = " << norm_r <<", tol = " << tol*10 <<"."<< endl;
+        cout << "# true_res - calc_res = " << true_res - norm_r << endl;
+      }
+    }
+    
+  }
+  
+  (*residual) = norm_r;
+  return (unsigned long) i;
+  
+}
+
 unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                               CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+                               CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring,
+                               bool classical_gs) {
 	
   int rank = SU2_MPI::GetRank();
   
@@ -399,9 +620,11 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
     
     mat_vec(z[i], w[i+1]);
     
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Gram-Schmidt orthogonalization, the classical variant needs a single
+     reduction instead of one per basis vector ---*/
     
-    ModGramSchmidt(i, H, w);
+    if (classical_gs) ClassicalGramSchmidt(i, H, w);
+    else ModGramSchmidt(i, H, w);
     
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix
 		 then generate the new Givens rotation matrix and apply it to
@@ -589,12 +812,15 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
 
 unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
   
-  su2double SolverTol = config->GetLinear_Solver_Error(), Residual, Norm0;
+  su2double SolverTol = config->GetLinear_Solver_Error(), Residual;
   unsigned long MaxIter = config->GetLinear_Solver_Iter();
   unsigned long IterLinSol = 0;
   CMatrixVectorProduct *mat_vec;
 
   bool TapeActive = NO;
+  double tick = 0.0;
+
+  config->Tick(&tick, PROFILE_LINEAR_SOLVER);
 
   if (config->GetDiscrete_Adjoint()) {
 #ifdef CODI_REVERSE_TYPE
@@ -615,59 +841,17 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   if (config->GetKind_Linear_Solver() == BCGSTAB ||
       config->GetKind_Linear_Solver() == FGMRES ||
       config->GetKind_Linear_Solver() == RESTARTED_FGMRES ||
-      config->GetKind_Linear_Solver() == CONJUGATE_GRADIENT) {
+      config->GetKind_Linear_Solver() == CONJUGATE_GRADIENT ||
+      config->GetKind_Linear_Solver() == PIPELINED_CG ||
+      config->GetKind_Linear_Solver() == FGMRES_CGS) {
     
     mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
-    CPreconditioner* precond = NULL;
     
-    switch (config->GetKind_Linear_Solver_Prec()) {
-      case JACOBI:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CJacobiPreconditioner(Jacobian, geometry, config);
-        break;
-      case ILU:
-        Jacobian.BuildILUPreconditioner();
-        precond = new CILUPreconditioner(Jacobian, geometry, config);
-        break;
-      case LU_SGS:
-        precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
-        break;
-      case LINELET:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CLineletPreconditioner(Jacobian, geometry, config);
-        break;
-      default:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CJacobiPreconditioner(Jacobian, geometry, config);
-        break;
-    }
-    
-    switch (config->GetKind_Linear_Solver()) {
-      case BCGSTAB:
-        IterLinSol = BCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-        break;
-      case FGMRES:
-        IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-        break;
-      case CONJUGATE_GRADIENT:
-        IterLinSol = CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-        break;
-      case RESTARTED_FGMRES:
-        IterLinSol = 0;
-        Norm0 = LinSysRes.norm();
-        while (IterLinSol < config->GetLinear_Solver_Iter()) {
-          /*--- Enforce a hard limit on total number of iterations ---*/
-          MaxIter = min(config->GetLinear_Solver_Restart_Frequency(), config->GetLinear_Solver_Iter()-IterLinSol);
-          IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-          if ( Residual < SolverTol*Norm0 ) break;
-        }
-        break;
-    }
+    IterLinSol = Solve_Krylov(Jacobian, *mat_vec, LinSysRes, LinSysSol, geometry, config);
     
     /*--- Dealocate memory of the Krylov subspace method ---*/
     
     delete mat_vec;
-    delete precond;
     
   }
   
@@ -712,6 +896,95 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
 
   }
 
+  config->Tock(tick, PROFILE_LINEAR_SOLVER);
+
+  return IterLinSol;
+  
+}
+
+unsigned long CSysSolve::Solve_Krylov(CSysMatrix & Jacobian, CMatrixVectorProduct & mat_vec, CSysVector & LinSysRes,
+                                      CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
+  
+  su2double SolverTol = config->GetLinear_Solver_Error(), Residual, Norm0;
+  unsigned long MaxIter = config->GetLinear_Solver_Iter();
+  unsigned long IterLinSol = 0;
+  
+  /*--- The preconditioner is always built from the assembled Jacobian ---*/
+  
+  CPreconditioner* precond = NULL;
+  
+  switch (config->GetKind_Linear_Solver_Prec()) {
+    case JACOBI:
+      Jacobian.BuildJacobiPreconditioner();
+      precond = new CJacobiPreconditioner(Jacobian, geometry, config);
+      break;
+    case ILU:
+      Jacobian.BuildILUPreconditioner();
+      precond = new CILUPreconditioner(Jacobian, geometry, config);
+      break;
+    case LU_SGS:
+      precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
+      break;
+    case LINELET:
+      Jacobian.BuildJacobiPreconditioner();
+      precond = new CLineletPreconditioner(Jacobian, geometry, config);
+      break;
+    case AMG:
+      Jacobian.BuildAMGPreconditioner(config);
+      precond = new CAMGPreconditioner(Jacobian, geometry, config);
+      break;
+    default:
+      Jacobian.BuildJacobiPreconditioner();
+      precond = new CJacobiPreconditioner(Jacobian, geometry, config);
+      break;
+  }
+  
+  switch (config->GetKind_Linear_Solver()) {
+    case BCGSTAB:
+      IterLinSol = BCGSTAB_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+    case FGMRES:
+      IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+    case CONJUGATE_GRADIENT:
+      IterLinSol = CG_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+    case PIPELINED_CG:
+      IterLinSol = PipelinedCG_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+    case FGMRES_CGS:
+      IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false, true);
+      break;
+    case RESTARTED_FGMRES:
+      IterLinSol = 0;
+      Norm0 = LinSysRes.norm();
+      while (IterLinSol < config->GetLinear_Solver_Iter()) {
+        /*--- Enforce a hard limit on total number of iterations ---*/
+        MaxIter = min(config->GetLinear_Solver_Restart_Frequency(), config->GetLinear_Solver_Iter()-IterLinSol);
+        IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+        if ( Residual < SolverTol*Norm0 ) break;
+      }
+      break;
+  }
+  
+  delete precond;
+  
+  return IterLinSol;
+  
+}
+
+unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CMatrixVectorProduct & mat_vec, CSysVector & LinSysRes,
+                               CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long IterLinSol = 0;
+  double tick = 0.0;
+  
+  config->Tick(&tick, PROFILE_LINEAR_SOLVER);
+  
+  IterLinSol = Solve_Krylov(Jacobian, mat_vec, LinSysRes, LinSysSol, geometry, config);
+  
+  config->Tock(tick, PROFILE_LINEAR_SOLVER);
+  
   return IterLinSol;
   
 }
@@ -117,6 +117,12 @@ void CSysSolve_b::Solve_b(AD::Tape* tape, AD::CheckpointHandler* data) {
     case CONJUGATE_GRADIENT:
       solver->CG_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
       break;
+    case PIPELINED_CG:
+      solver->PipelinedCG_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+    case FGMRES_CGS:
+      solver->FGMRES_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false, true);
+      break;
   }
 
 
@@ -208,6 +214,12 @@ void CSysSolve_b::Solve_g(AD::Tape* tape, AD::CheckpointHandler* data){
     case CONJUGATE_GRADIENT:
       solver->CG_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter,  &Residual, false);
       break;
+    case PIPELINED_CG:
+      solver->PipelinedCG_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+      break;
+    case FGMRES_CGS:
+      solver->FGMRES_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false, true);
+      break;
   }
 
 
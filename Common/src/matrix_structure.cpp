@@ -37,17 +37,108 @@
 
 #include "../include/matrix_structure.hpp"
 
+/*--- Kernels on the dense blocks of the matrix. The block size is a template
+ parameter, so that the compiler can fully unroll and vectorize the small loops
+ of the common block sizes; N = 0 is the generic version, where the size is
+ only known at runtime (val_n). The order of the operations is the same for all
+ the versions, hence they give identical results. The block-vector products are
+ also instantiated for the single precision storage of the preconditioners, the
+ accumulation is always done in su2double. ---*/
+
+template<unsigned short N, class MatType>
+static void BlockVectorProduct(unsigned short val_n, const MatType *a, const su2double *b, su2double *c) {
+  const unsigned short n = (N > 0) ? N : val_n;
+  for (unsigned short iVar = 0; iVar < n; iVar++) {
+    su2double sum = 0.0;
+    for (unsigned short jVar = 0; jVar < n; jVar++)
+      sum += a[iVar*n+jVar]*b[jVar];
+    c[iVar] = sum;
+  }
+}
+
+template<unsigned short N, class MatType>
+static void BlockVectorProductAdd(unsigned short val_n, const MatType *a, const su2double *b, su2double *c) {
+  const unsigned short n = (N > 0) ? N : val_n;
+  for (unsigned short iVar = 0; iVar < n; iVar++) {
+    su2double sum = c[iVar];
+    for (unsigned short jVar = 0; jVar < n; jVar++)
+      sum += a[iVar*n+jVar]*b[jVar];
+    c[iVar] = sum;
+  }
+}
+
+template<unsigned short N>
+static void BlockTransposedVectorProductAdd(unsigned short val_n, const su2double *a, const su2double *b, su2double *c) {
+  const unsigned short n = (N > 0) ? N : val_n;
+  for (unsigned short iVar = 0; iVar < n; iVar++)
+    for (unsigned short jVar = 0; jVar < n; jVar++)
+      c[jVar] += a[iVar*n+jVar]*b[iVar];
+}
+
+template<unsigned short N>
+static void BlockBlockProduct(unsigned short val_n, const su2double *a, const su2double *b, su2double *c) {
+  const unsigned short n = (N > 0) ? N : val_n;
+  for (unsigned short iVar = 0; iVar < n; iVar++)
+    for (unsigned short jVar = 0; jVar < n; jVar++) {
+      su2double sum = 0.0;
+      for (unsigned short kVar = 0; kVar < n; kVar++)
+        sum += a[iVar*n+kVar]*b[kVar*n+jVar];
+      c[iVar*n+jVar] = sum;
+    }
+}
+
+template<unsigned short N>
+static void BlockGaussElimination(unsigned short val_n, su2double *block, su2double *rhs) {
+  
+  const int n = (N > 0) ? N : val_n;
+  int iVar, jVar, kVar;
+  su2double weight, aux;
+  
+  /*--- Transform system in Upper Matrix ---*/
+  
+  for (iVar = 1; iVar < n; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = block[iVar*n+jVar] / block[jVar*n+jVar];
+      for (kVar = jVar; kVar < n; kVar++)
+        block[iVar*n+kVar] -= weight*block[jVar*n+kVar];
+      rhs[iVar] -= weight*rhs[jVar];
+    }
+  }
+  
+  /*--- Backwards substitution ---*/
+  
+  rhs[n-1] = rhs[n-1] / block[n*n-1];
+  for (iVar = n-2; iVar >= 0; iVar--) {
+    aux = 0.0;
+    for (jVar = iVar+1; jVar < n; jVar++)
+      aux += block[iVar*n+jVar]*rhs[jVar];
+    rhs[iVar] = (rhs[iVar]-aux) / block[iVar*n+iVar];
+  }
+  
+}
+
 CSysMatrix::CSysMatrix(void) {
   
   size = SU2_MPI::GetSize();
   rank = SU2_MPI::GetRank();
   
   ilu_fill_in       = 0;
+  mixed_precision   = false;
+  frozen            = false;
+
+  BlockVectorKernel              = BlockVectorProduct<0, su2double>;
+  BlockVectorAddKernel           = BlockVectorProductAdd<0, su2double>;
+  BlockVectorMixedKernel         = BlockVectorProduct<0, su2mixedfloat>;
+  BlockVectorAddMixedKernel      = BlockVectorProductAdd<0, su2mixedfloat>;
+  BlockTransposedVectorAddKernel = BlockTransposedVectorProductAdd<0>;
+  BlockBlockKernel               = BlockBlockProduct<0>;
+  GaussEliminationKernel         = BlockGaussElimination<0>;
 
   /*--- Array initialization ---*/
 
   matrix            = NULL;
   ILU_matrix        = NULL;
+  ILU_matrix_mixed  = NULL;
   row_ptr           = NULL;
   col_ind           = NULL;
   row_ptr_ilu       = NULL;
@@ -58,6 +149,7 @@ CSysMatrix::CSysMatrix(void) {
   aux_vector        = NULL;
   sum_vector        = NULL;
   invM              = NULL;
+  invM_mixed        = NULL;
   block_weight      = NULL;
   block_inverse     = NULL;
 
@@ -76,6 +168,18 @@ CSysMatrix::CSysMatrix(void) {
   FzVector        = NULL;
   max_nElem       = 0;
 
+  /*--- Algebraic multigrid preconditioner ---*/
+
+  AMG_Coarse      = NULL;
+  AMG_Aggregate   = NULL;
+  AMG_Index       = NULL;
+  AMG_Rhs         = NULL;
+  AMG_Sol         = NULL;
+  AMG_Res         = NULL;
+  AMG_CoarseSweeps = 1;
+  AMG_Transposed  = NULL;
+  AMG_Use_Transposed = false;
+
 #if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
   MatrixMatrixProductJitter 		= NULL;
   MatrixVectorProductJitterBetaOne 	= NULL;
@@ -93,6 +197,7 @@ CSysMatrix::~CSysMatrix(void) {
   
   if (matrix != NULL)             delete [] matrix;
   if (ILU_matrix != NULL)         delete [] ILU_matrix;
+  if (ILU_matrix_mixed != NULL)   delete [] ILU_matrix_mixed;
   if (row_ptr != NULL)            delete [] row_ptr;
   if (col_ind != NULL)            delete [] col_ind;
 
@@ -110,6 +215,7 @@ CSysMatrix::~CSysMatrix(void) {
   if (aux_vector != NULL)         delete [] aux_vector;
   if (sum_vector != NULL)         delete [] sum_vector;
   if (invM != NULL)               delete [] invM;
+  if (invM_mixed != NULL)         delete [] invM_mixed;
   if (LineletBool != NULL)        delete [] LineletBool;
   if (LineletPoint != NULL)       delete [] LineletPoint;
   
@@ -132,6 +238,14 @@ CSysMatrix::~CSysMatrix(void) {
   if (LyVector != NULL)   delete [] LyVector;
   if (FzVector != NULL)   delete [] FzVector;
 
+  if (AMG_Coarse != NULL)     delete AMG_Coarse;
+  if (AMG_Aggregate != NULL)  delete [] AMG_Aggregate;
+  if (AMG_Index != NULL)      delete [] AMG_Index;
+  if (AMG_Rhs != NULL)        delete [] AMG_Rhs;
+  if (AMG_Sol != NULL)        delete [] AMG_Sol;
+  if (AMG_Res != NULL)        delete [] AMG_Res;
+  if (AMG_Transposed != NULL) delete AMG_Transposed;
+
 #if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
   if ( MatrixMatrixProductJitter != NULL ) 		mkl_jit_destroy( MatrixMatrixProductJitter );
   if ( MatrixVectorProductJitterBetaZero != NULL ) 	mkl_jit_destroy( MatrixVectorProductJitterBetaZero );
@@ -155,6 +269,10 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
   /*--- Set the ILU fill in level --*/
    
   ilu_fill_in = config->GetLinear_Solver_ILU_n();
+
+  /*--- Precision of the preconditioner factors ---*/
+
+  mixed_precision = config->GetLinear_Solver_Mixed_Precision();
   
   /*--- Compute the number of neighbors ---*/
   
@@ -293,8 +411,14 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
       
     }
     
-    ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
-    for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+    if (mixed_precision) {
+      ILU_matrix_mixed = new su2mixedfloat [nnz_ilu*nVar*nEqn];
+      for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix_mixed[iVar] = 0.0;
+    }
+    else {
+      ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
+      for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+    }
     
     delete [] nNeigh_ilu;
     
@@ -342,6 +466,8 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   col_ind      = val_col_ind;       // Assign colums values in the spare system structure (Jacobian structure)
   nnz          = val_nnz;           // Assign number of possible non zero blocks in the spare system structure (Jacobian structure)
   
+  SetBlockKernels();
+  
   if (ilu_fill_in == 0) {
     row_ptr_ilu  = val_row_ptr;       // Assign row values in the spare system structure (ILU structure)
     col_ind_ilu  = val_col_ind;       // Assign colums values in the spare system structure (ILU structure)
@@ -383,8 +509,14 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
       
       /*--- Reserve memory for the ILU matrix. ---*/
       
-      ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
-      for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+      if (mixed_precision) {
+        ILU_matrix_mixed = new su2mixedfloat [nnz_ilu*nVar*nEqn];
+        for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix_mixed[iVar] = 0.0;
+      }
+      else {
+        ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
+        for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+      }
       
     }
     
@@ -403,13 +535,68 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
     
     /*--- Reserve memory for the values of the inverse of the preconditioner. ---*/
     
-    invM = new su2double [nPoint*nVar*nEqn];
-    for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
+    if (mixed_precision) {
+      invM_mixed = new su2mixedfloat [nPoint*nVar*nEqn];
+      for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM_mixed[iVar] = 0.0;
+    }
+    else {
+      invM = new su2double [nPoint*nVar*nEqn];
+      for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
+    }
 
   }
 
 }
 
+void CSysMatrix::SetBlockKernels(void) {
+  
+  switch (nVar) {
+    case 1:
+      BlockVectorKernel = BlockVectorProduct<1, su2double>; BlockVectorAddKernel = BlockVectorProductAdd<1, su2double>;
+      BlockVectorMixedKernel = BlockVectorProduct<1, su2mixedfloat>; BlockVectorAddMixedKernel = BlockVectorProductAdd<1, su2mixedfloat>;
+      BlockTransposedVectorAddKernel = BlockTransposedVectorProductAdd<1>;
+      BlockBlockKernel = BlockBlockProduct<1>; GaussEliminationKernel = BlockGaussElimination<1>;
+      break;
+    case 2:
+      BlockVectorKernel = BlockVectorProduct<2, su2double>; BlockVectorAddKernel = BlockVectorProductAdd<2, su2double>;
+      BlockVectorMixedKernel = BlockVectorProduct<2, su2mixedfloat>; BlockVectorAddMixedKernel = BlockVectorProductAdd<2, su2mixedfloat>;
+      BlockTransposedVectorAddKernel = BlockTransposedVectorProductAdd<2>;
+      BlockBlockKernel = BlockBlockProduct<2>; GaussEliminationKernel = BlockGaussElimination<2>;
+      break;
+    case 4:
+      BlockVectorKernel = BlockVectorProduct<4, su2double>; BlockVectorAddKernel = BlockVectorProductAdd<4, su2double>;
+      BlockVectorMixedKernel = BlockVectorProduct<4, su2mixedfloat>; BlockVectorAddMixedKernel = BlockVectorProductAdd<4, su2mixedfloat>;
+      BlockTransposedVectorAddKernel = BlockTransposedVectorProductAdd<4>;
+      BlockBlockKernel = BlockBlockProduct<4>; GaussEliminationKernel = BlockGaussElimination<4>;
+      break;
+    case 5:
+      BlockVectorKernel = BlockVectorProduct<5, su2double>; BlockVectorAddKernel = BlockVectorProductAdd<5, su2double>;
+      BlockVectorMixedKernel = BlockVectorProduct<5, su2mixedfloat>; BlockVectorAddMixedKernel = BlockVectorProductAdd<5, su2mixedfloat>;
+      BlockTransposedVectorAddKernel = BlockTransposedVectorProductAdd<5>;
+      BlockBlockKernel = BlockBlockProduct<5>; GaussEliminationKernel = BlockGaussElimination<5>;
+      break;
+    case 6:
+      BlockVectorKernel = BlockVectorProduct<6, su2double>; BlockVectorAddKernel = BlockVectorProductAdd<6, su2double>;
+      BlockVectorMixedKernel = BlockVectorProduct<6, su2mixedfloat>; BlockVectorAddMixedKernel = BlockVectorProductAdd<6, su2mixedfloat>;
+      BlockTransposedVectorAddKernel = BlockTransposedVectorProductAdd<6>;
+      BlockBlockKernel = BlockBlockProduct<6>; GaussEliminationKernel = BlockGaussElimination<6>;
+      break;
+    case 7:
+      BlockVectorKernel = BlockVectorProduct<7, su2double>; BlockVectorAddKernel = BlockVectorProductAdd<7, su2double>;
+      BlockVectorMixedKernel = BlockVectorProduct<7, su2mixedfloat>; BlockVectorAddMixedKernel = BlockVectorProductAdd<7, su2mixedfloat>;
+      BlockTransposedVectorAddKernel = BlockTransposedVectorProductAdd<7>;
+      BlockBlockKernel = BlockBlockProduct<7>; GaussEliminationKernel = BlockGaussElimination<7>;
+      break;
+    default:
+      BlockVectorKernel = BlockVectorProduct<0, su2double>; BlockVectorAddKernel = BlockVectorProductAdd<0, su2double>;
+      BlockVectorMixedKernel = BlockVectorProduct<0, su2mixedfloat>; BlockVectorAddMixedKernel = BlockVectorProductAdd<0, su2mixedfloat>;
+      BlockTransposedVectorAddKernel = BlockTransposedVectorProductAdd<0>;
+      BlockBlockKernel = BlockBlockProduct<0>; GaussEliminationKernel = BlockGaussElimination<0>;
+      break;
+  }
+  
+}
+
 su2double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
   
   unsigned long step = 0, index;
@@ -472,6 +659,8 @@ void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, su2doubl
   
   unsigned long iVar, jVar, index, step = 0;
   
+  if (frozen) return;
+
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_j) {
@@ -489,6 +678,8 @@ void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, su2
   
   unsigned long iVar, jVar, index, step = 0;
   
+  if (frozen) return;
+
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_j) {
@@ -562,6 +753,17 @@ void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long bl
   
 }
 
+su2mixedfloat *CSysMatrix::GetBlock_ILUMatrix_Mixed(unsigned long block_i, unsigned long block_j) {
+  
+  unsigned long index;
+  
+  for (index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++) {
+    if (col_ind_ilu[index] == block_j) { return &(ILU_matrix_mixed[index*nVar*nEqn]); }
+  }
+  return NULL;
+  
+}
+
 void CSysMatrix::MatrixVectorProduct(su2double *matrix, su2double *vector, su2double *product) {
 
 #if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
@@ -573,14 +775,7 @@ void CSysMatrix::MatrixVectorProduct(su2double *matrix, su2double *vector, su2do
   }
 #endif
   
-  unsigned short iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    product[iVar] = 0.0;
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar] += matrix[iVar*nVar+jVar] * vector[jVar];
-    }
-  }
+  BlockVectorKernel(nVar, matrix, vector, product);
   
 }
 
@@ -594,16 +789,7 @@ void CSysMatrix::MatrixMatrixProduct(su2double *matrix_a, su2double *matrix_b, s
   }
 #endif
   
-  unsigned short iVar, jVar, kVar;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++) {
-        product[iVar*nVar+jVar] += matrix_a[iVar*nVar+kVar]*matrix_b[kVar*nVar+jVar];
-      }
-    }
-  }
+  BlockBlockKernel(nVar, matrix_a, matrix_b, product);
   
 }
 
@@ -611,6 +797,8 @@ void CSysMatrix::AddVal2Diag(unsigned long block_i, su2double val_matrix) {
   
   unsigned long step = 0, iVar, index;
   
+  if (frozen) return;
+
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_i) {	// Only elements on the diagonal
@@ -627,6 +815,8 @@ void CSysMatrix::SetVal2Diag(unsigned long block_i, su2double val_matrix) {
   
   unsigned long step = 0, iVar, jVar, index;
   
+  if (frozen) return;
+
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_i) {	// Only elements on the diagonal
@@ -651,6 +841,8 @@ void CSysMatrix::DeleteValsRowi(unsigned long i) {
   unsigned long row = i - block_i*nVar;
   unsigned long index, iVar;
   
+  if (frozen) return;
+
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     for (iVar = 0; iVar < nVar; iVar++)
       matrix[index*nVar*nVar+row*nVar+iVar] = 0.0; // Delete row values in the block
@@ -758,8 +950,7 @@ void CSysMatrix::MatrixTranspose(su2double **a, unsigned long n) {
 
 void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool transposed) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
+  unsigned short iVar, jVar;
   
   su2double *Block = GetBlock(block_i, block_i);
   
@@ -767,73 +958,35 @@ void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool t
    is modified by the algorithm---*/
   
   if (!transposed) {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
         block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
   } else {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
         block[iVar*nVar+jVar] = Block[jVar*nVar+iVar];
   }
+  
   /*--- Gauss elimination ---*/
   
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  GaussEliminationKernel(nVar, block, rhs);
   
 }
 
 void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
   su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
   
   /*--- Copy block matrix, note that the original matrix
    is modified by the algorithm---*/
 
-
   // If source and dest overlap higher level problems occur, so memcpy is safe. And it is faster.
   memcpy( block, Block, (nVar * nVar * sizeof(su2double)) );
-
-  //for (iVar = 0; iVar < (short)nVar; iVar++)
-  //  for (jVar = 0; jVar < (short)nVar; jVar++)
-  //    block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
   
   /*--- Gauss elimination ---*/
 
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-
 #if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-  if (useMKL) {
+  if (useMKL && (nVar > 1)) {
       // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
       lapack_int * ipiv = new lapack_int [ nVar ];
       LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, (double *)&block[0], nVar, ipiv );
@@ -843,84 +996,31 @@ void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* r
       return;
   }
 #endif
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  
+  GaussEliminationKernel(nVar, block, rhs);
   
 }
 
 void CSysMatrix::Gauss_Elimination(su2double* Block, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
+  unsigned short iVar, jVar;
   
   /*--- Copy block matrix, note that the original matrix
    is modified by the algorithm---*/
   
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++)
       block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
   
-  
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  GaussEliminationKernel(nVar, block, rhs);
   
 }
 
 void CSysMatrix::ProdBlockVector(unsigned long block_i, unsigned long block_j, const CSysVector & vec) {
   
-  unsigned long j = block_j*nVar;
-  unsigned short iVar, jVar;
-  
   su2double *block = GetBlock(block_i, block_j);
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    prod_block_vector[iVar] = 0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      prod_block_vector[iVar] += block[iVar*nVar+jVar]*vec[j+jVar];
-  }
+  BlockVectorKernel(nVar, block, &vec[block_j*nVar], prod_block_vector);
   
 }
 
@@ -1180,7 +1280,7 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod)
 
 void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar, row_i;
+  unsigned long prod_begin, vec_begin, mat_begin, index, row_i;
   
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
@@ -1207,11 +1307,7 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
         continue;
       }
 #endif
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++) {
-          prod[(unsigned long)(prod_begin+iVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+jVar)];
-        }
-      }
+      BlockVectorAddKernel(nVar, &matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
     }
   }
   
@@ -1222,7 +1318,7 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
 
 void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
 
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar , row_i;
+  unsigned long prod_begin, vec_begin, mat_begin, index, row_i;
 
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
@@ -1238,11 +1334,7 @@ void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVecto
     for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
       prod_begin = col_ind[index]*nVar; // offset to beginning of block row_i
       mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++) {
-            prod[(unsigned long)(prod_begin+jVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+iVar)];
-        }
-      }
+      BlockTransposedVectorAddKernel(nVar, &matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
     }
   }
 
@@ -1253,26 +1345,13 @@ void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVecto
 
 void CSysMatrix::GetMultBlockBlock(su2double *c, su2double *a, su2double *b) {
   
-  unsigned long iVar, jVar, kVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++) {
-      c[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++)
-        c[iVar*nVar+jVar] += a[iVar*nVar+kVar] * b[kVar*nVar+jVar];
-    }
+  BlockBlockKernel(nVar, a, b, c);
   
 }
 
 void CSysMatrix::GetMultBlockVector(su2double *c, su2double *a, su2double *b) {
   
-  unsigned long iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    c[iVar] =  0.0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      c[iVar] += a[iVar*nVar+jVar] * b[jVar];
-  }
+  BlockVectorKernel(nVar, a, b, c);
   
 }
 
@@ -1418,6 +1497,8 @@ void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
 
   unsigned long iPoint, iVar, jVar;
 
+  if (frozen) return;
+
   /*--- Compute Jacobi Preconditioner ---*/
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
@@ -1425,9 +1506,16 @@ void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
     InverseDiagonalBlock(iPoint, block_inverse, transpose);
 
     /*--- Set the inverse of the matrix to the invM structure (which is a vector) ---*/
-    for (iVar = 0; iVar < nVar; iVar++)
-      for (jVar = 0; jVar < nVar; jVar++)
-        invM[iPoint*nVar*nVar+iVar*nVar+jVar] = block_inverse[iVar*nVar+jVar];
+    if (mixed_precision) {
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          invM_mixed[iPoint*nVar*nVar+iVar*nVar+jVar] = block_inverse[iVar*nVar+jVar];
+    }
+    else {
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          invM[iPoint*nVar*nVar+iVar*nVar+jVar] = block_inverse[iVar*nVar+jVar];
+    }
   }
 
 }
@@ -1437,12 +1525,18 @@ void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector
   
   unsigned long iPoint, iVar, jVar;
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
-      for (jVar = 0; jVar < nVar; jVar++)
-        prod[(unsigned long)(iPoint*nVar+iVar)] +=
-        invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
+  if (mixed_precision) {
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      BlockVectorMixedKernel(nVar, &invM_mixed[iPoint*nVar*nVar], &vec[iPoint*nVar], &prod[iPoint*nVar]);
+  }
+  else {
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
+        for (jVar = 0; jVar < nVar; jVar++)
+          prod[(unsigned long)(iPoint*nVar+iVar)] +=
+          invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
+      }
     }
   }
   
@@ -1505,11 +1599,17 @@ unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x,
      diagonal matrix of A, which was built in the preprocessing phase. Note
      that we are directly updating the solution (x^k+1) during the loop. ---*/
     
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++)
-          x[(unsigned long)(iPoint*nVar+iVar)] +=
-          invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*r[(unsigned long)(iPoint*nVar+jVar)];
+    if (mixed_precision) {
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+        BlockVectorAddMixedKernel(nVar, &invM_mixed[iPoint*nVar*nVar], &r[iPoint*nVar], &x[iPoint*nVar]);
+    }
+    else {
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        for (iVar = 0; iVar < nVar; iVar++) {
+          for (jVar = 0; jVar < nVar; jVar++)
+            x[(unsigned long)(iPoint*nVar+iVar)] +=
+            invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*r[(unsigned long)(iPoint*nVar+jVar)];
+        }
       }
     }
     
@@ -1548,6 +1648,12 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
   su2double *Block_ij, *Block_jk;
   long iPoint, jPoint, kPoint;
   
+  if (frozen) return;
+
+  if (mixed_precision) {
+    BuildILUPreconditioner_Mixed(transposed);
+    return;
+  }
 
   /*--- Copy block matrix, note that the original matrix
    is modified by the algorithm, so that we have the factorization stored
@@ -1625,11 +1731,90 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
   
 }
 
-void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+void CSysMatrix::BuildILUPreconditioner_Mixed(bool transposed) {
   
-  unsigned long index;
+  unsigned long index, index_, iVar, jVar;
   su2double *Block_ij;
-  long iPoint, jPoint;
+  su2mixedfloat *Block_ILU, *Block_ik;
+  long iPoint, jPoint, kPoint;
+  
+  /*--- Copy the block matrix to the single precision ILU structure ---*/
+  
+  for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix_mixed[iVar] = 0.0;
+  
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      Block_ILU = GetBlock_ILUMatrix_Mixed(iPoint, jPoint);
+      if (transposed) {
+        Block_ij = GetBlock(jPoint, iPoint);
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (jVar = 0; jVar < nVar; jVar++)
+            Block_ILU[iVar*nVar+jVar] = Block_ij[jVar*nVar+iVar];
+      } else {
+        Block_ij = GetBlock(iPoint, jPoint);
+        for (iVar = 0; iVar < nVar*nVar; iVar++)
+          Block_ILU[iVar] = Block_ij[iVar];
+      }
+    }
+  }
+  
+  /*--- Transform system in Upper Matrix, the arithmetic is done in su2double
+   on the internal blocks and only the result is rounded. The rows are sorted,
+   so the lower triangular part of each row comes first. ---*/
+  
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+    
+    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+      
+      jPoint = col_ind_ilu[index];
+      if (jPoint >= iPoint) break;
+      
+      /*--- block_weight = Aij*inv(Ajj), the diagonal of the previous rows
+       already holds the inverse. ---*/
+      
+      Block_ILU = &ILU_matrix_mixed[index*nVar*nEqn];
+      for (iVar = 0; iVar < nVar*nVar; iVar++) block[iVar] = Block_ILU[iVar];
+      Block_ILU = GetBlock_ILUMatrix_Mixed(jPoint, jPoint);
+      for (iVar = 0; iVar < nVar*nVar; iVar++) block_inverse[iVar] = Block_ILU[iVar];
+      MatrixMatrixProduct(block, block_inverse, block_weight);
+      
+      /*--- Aik' = Aik - Aij*inv(Ajj)*Ajk on the upper part of row jPoint, the
+       blocks of the halo points are never used by the triangular solves. ---*/
+      
+      for (index_ = row_ptr_ilu[jPoint]; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+        kPoint = col_ind_ilu[index_];
+        if ((kPoint > jPoint) && (kPoint < (long)nPointDomain)) {
+          Block_ik = GetBlock_ILUMatrix_Mixed(iPoint, kPoint);
+          if (Block_ik == NULL) continue;
+          Block_ILU = &ILU_matrix_mixed[index_*nVar*nEqn];
+          for (iVar = 0; iVar < nVar*nVar; iVar++) block_inverse[iVar] = Block_ILU[iVar];
+          MatrixMatrixProduct(block_weight, block_inverse, block);
+          for (iVar = 0; iVar < nVar*nVar; iVar++) Block_ik[iVar] -= block[iVar];
+        }
+      }
+      
+      /*--- Store block_weight in the lower triangular part ---*/
+      
+      Block_ILU = &ILU_matrix_mixed[index*nVar*nEqn];
+      for (iVar = 0; iVar < nVar*nVar; iVar++) Block_ILU[iVar] = block_weight[iVar];
+      
+    }
+    
+    /*--- The row is complete, replace the diagonal block by its inverse ---*/
+    
+    Block_ILU = GetBlock_ILUMatrix_Mixed(iPoint, iPoint);
+    for (iVar = 0; iVar < nVar*nVar; iVar++) block_weight[iVar] = Block_ILU[iVar];
+    InverseBlock(block_weight, block_inverse);
+    for (iVar = 0; iVar < nVar*nVar; iVar++) Block_ILU[iVar] = block_inverse[iVar];
+    
+  }
+  
+}
+
+void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  long iPoint;
   unsigned short iVar;
   
   /*--- Copy block matrix, note that the original matrix
@@ -1641,6 +1826,24 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
     }
   }
   
+  /*--- Forward and backward substitution with the ILU factors ---*/
+  
+  if (mixed_precision) ILUSolve_Mixed(prod);
+  else ILUSolve(prod);
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+void CSysMatrix::ILUSolve(CSysVector & vec) {
+  
+  unsigned long index;
+  su2double *Block_ij;
+  long iPoint, jPoint;
+  unsigned short iVar;
+  
   /*--- Forward solve the system using the lower matrix entries that
    were computed and stored during the ILU preprocessing. Note
    that we are overwriting the residual vector as we go. ---*/
@@ -1650,9 +1853,9 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
       jPoint = col_ind_ilu[index];
       if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
         Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
+        MatrixVectorProduct(Block_ij, &vec[jPoint*nVar], aux_vector);
         for (iVar = 0; iVar < nVar; iVar++)
-          prod[iPoint*nVar+iVar] -= aux_vector[iVar];
+          vec[iPoint*nVar+iVar] -= aux_vector[iVar];
         
       }
     }
@@ -1661,10 +1864,10 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
   /*--- Backwards substitution (starts at the last row) ---*/
   
   InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-  MatrixVectorProduct(block_inverse, &prod[(nPointDomain-1)*nVar], aux_vector);
+  MatrixVectorProduct(block_inverse, &vec[(nPointDomain-1)*nVar], aux_vector);
   
   for (iVar = 0; iVar < nVar; iVar++)
-    prod[ (nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
+    vec[ (nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
   
   for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
     for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
@@ -1672,29 +1875,58 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
       jPoint = col_ind_ilu[index];
       if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
         Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
+        MatrixVectorProduct(Block_ij, &vec[jPoint*nVar], aux_vector);
         for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
       }
     }
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = (prod[iPoint*nVar+iVar]-sum_vector[iVar]);
+    for (iVar = 0; iVar < nVar; iVar++) vec[iPoint*nVar+iVar] = (vec[iPoint*nVar+iVar]-sum_vector[iVar]);
     InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-    MatrixVectorProduct(block_inverse, &prod[iPoint*nVar], aux_vector);
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = aux_vector[iVar];
+    MatrixVectorProduct(block_inverse, &vec[iPoint*nVar], aux_vector);
+    for (iVar = 0; iVar < nVar; iVar++) vec[iPoint*nVar+iVar] = aux_vector[iVar];
     if (iPoint == 0) break;
   }
   
-  /*--- MPI Parallelization ---*/
+}
+
+void CSysMatrix::ILUSolve_Mixed(CSysVector & vec) {
   
-  SendReceive_Solution(prod, geometry, config);
+  unsigned long index, index_diag = 0;
+  long iPoint, jPoint;
+  unsigned short iVar;
+  
+  /*--- Forward solve with the lower triangular part ---*/
+  
+  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
+    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+      jPoint = col_ind_ilu[index];
+      if (jPoint >= iPoint) break;
+      BlockVectorMixedKernel(nVar, &ILU_matrix_mixed[index*nVar*nEqn], &vec[jPoint*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++)
+        vec[iPoint*nVar+iVar] -= aux_vector[iVar];
+    }
+  }
+  
+  /*--- Backwards substitution (starts at the last row), the diagonal
+   blocks were inverted during the factorization. ---*/
+  
+  for (iPoint = nPointDomain-1; iPoint >= 0; iPoint--) {
+    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = vec[iPoint*nVar+iVar];
+    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+      jPoint = col_ind_ilu[index];
+      if (jPoint == iPoint) index_diag = index;
+      if ((jPoint > iPoint) && (jPoint < (long)nPointDomain)) {
+        BlockVectorMixedKernel(nVar, &ILU_matrix_mixed[index*nVar*nEqn], &vec[jPoint*nVar], aux_vector);
+        for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] -= aux_vector[iVar];
+      }
+    }
+    BlockVectorMixedKernel(nVar, &ILU_matrix_mixed[index_diag*nVar*nEqn], sum_vector, &vec[iPoint*nVar]);
+  }
   
 }
 
 unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
-  unsigned long index;
-  su2double *Block_ij, omega = 1.0;
-  long iPoint, jPoint;
-  unsigned short iVar;
+  su2double omega = 1.0;
   
   /*---  Check the number of iterations requested ---*/
   
@@ -1741,62 +1973,12 @@ unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMa
   
   for (i = 0; i < (int)m; i++) {
     
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+    /*--- Forward and backward substitution with the ILU factors, which
+     were computed in the preprocessing. Note that we are overwriting the
+     residual vector as we go. ---*/
     
-    for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
-      
-      /*--- For each row (unknown), loop over all entries in A on this row
-       row_ptr_ilu[iPoint+1] will have the index for the first entry on the next
-       row. ---*/
-      
-      for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-        
-        /*--- jPoint here is the column for each entry on this row ---*/
-        
-        jPoint = col_ind_ilu[index];
-        
-        /*--- Check that this column is in the lower triangular portion ---*/
-        
-        if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-          
-          /*--- Lastly, get Aij*inv(Ajj) from the lower triangular part, which
-           was calculated in the preprocessing, and apply to r. ---*/
-          
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++)
-            r[iPoint*nVar+iVar] -= aux_vector[iVar];
-          
-        }
-      }
-    }
-    
-    /*--- Backwards substitution (starts at the last row) ---*/
-    
-    InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-    MatrixVectorProduct(block_inverse, &r[(nPointDomain-1)*nVar], aux_vector);
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      r[(nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
-    
-    for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-      for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
-      for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-        jPoint = col_ind_ilu[index];
-        if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-        }
-      }
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = (r[iPoint*nVar+iVar]-sum_vector[iVar]);
-      InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-      MatrixVectorProduct(block_inverse, &r[iPoint*nVar], aux_vector);
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = aux_vector[iVar];
-      if (iPoint == 0) break;
-    }
+    if (mixed_precision) ILUSolve_Mixed(r);
+    else ILUSolve(r);
     
     /*--- Update solution (x^k+1 = x^k + w*M^-1*r^k) using the residual vector,
      which holds the update after applying the ILU smoother, i.e., M^-1*r^k.
@@ -2192,6 +2374,10 @@ void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector
     
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
       if (!LineletBool[iPoint]) {
+        if (mixed_precision) {
+          BlockVectorMixedKernel(nVar, &invM_mixed[iPoint*nVar*nVar], &vec[iPoint*nVar], &prod[iPoint*nVar]);
+          continue;
+        }
         for (iVar = 0; iVar < nVar; iVar++) {
           prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
           for (jVar = 0; jVar < nVar; jVar++)
@@ -2282,6 +2468,445 @@ void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector
   
 }
 
+void CSysMatrix::SetIndexes_AMG(unsigned long val_nPoint, unsigned short val_nVar, unsigned short val_nEq,
+                                unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz) {
+  
+  unsigned long iVar;
+  
+  nPoint       = val_nPoint;
+  nPointDomain = val_nPoint;
+  nVar         = val_nVar;
+  nEqn         = val_nEq;
+  
+  row_ptr      = val_row_ptr;
+  col_ind      = val_col_ind;
+  nnz          = val_nnz;
+  
+  SetBlockKernels();
+  
+  matrix            = new su2double [nnz*nVar*nEqn];
+  block             = new su2double [nVar*nEqn];
+  block_weight      = new su2double [nVar*nEqn];
+  block_inverse     = new su2double [nVar*nEqn];
+  
+  prod_block_vector = new su2double [nEqn];
+  prod_row_vector   = new su2double [nVar];
+  aux_vector        = new su2double [nVar];
+  sum_vector        = new su2double [nVar];
+  
+  for (iVar = 0; iVar < nnz*nVar*nEqn; iVar++) matrix[iVar] = 0.0;
+  for (iVar = 0; iVar < nVar*nEqn; iVar++)     block[iVar] = 0.0;
+  for (iVar = 0; iVar < nVar*nEqn; iVar++)     block_weight[iVar] = 0.0;
+  for (iVar = 0; iVar < nVar*nEqn; iVar++)     block_inverse[iVar] = 0.0;
+  
+  for (iVar = 0; iVar < nEqn; iVar++)          prod_block_vector[iVar] = 0.0;
+  for (iVar = 0; iVar < nVar; iVar++)          prod_row_vector[iVar] = 0.0;
+  for (iVar = 0; iVar < nVar; iVar++)          aux_vector[iVar] = 0.0;
+  for (iVar = 0; iVar < nVar; iVar++)          sum_vector[iVar] = 0.0;
+  
+  /*--- Only the inverse of the diagonal blocks is needed by the smoother ---*/
+  
+  if (mixed_precision) {
+    invM_mixed = new su2mixedfloat [nPoint*nVar*nEqn];
+    for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM_mixed[iVar] = 0.0;
+  }
+  else {
+    invM = new su2double [nPoint*nVar*nEqn];
+    for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
+  }
+  
+}
+
+unsigned long CSysMatrix::SetAMGAggregates(su2double strength) {
+  
+  const unsigned long NoAggregate = numeric_limits<unsigned long>::max();
+  unsigned long iPoint, jPoint, index, iVar, nAggregate = 0;
+  su2double *Block, norm;
+  bool free_neighbors, has_strong;
+  
+  /*--- Norm of the blocks, and strong couplings between domain points:
+   |Aij|^2 >= theta^2 |Aii| |Ajj| ---*/
+  
+  su2double *diag_norm = new su2double [nPointDomain];
+  bool *strong = new bool [nnz];
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Block = GetBlock(iPoint, iPoint);
+    norm = 0.0;
+    for (iVar = 0; iVar < nVar*nEqn; iVar++) norm += Block[iVar]*Block[iVar];
+    diag_norm[iPoint] = sqrt(norm);
+  }
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      strong[index] = false;
+      if ((jPoint == iPoint) || (jPoint >= nPointDomain)) continue;
+      Block = &matrix[index*nVar*nEqn];
+      norm = 0.0;
+      for (iVar = 0; iVar < nVar*nEqn; iVar++) norm += Block[iVar]*Block[iVar];
+      strong[index] = (norm >= pow(strength,2)*diag_norm[iPoint]*diag_norm[jPoint]);
+    }
+  }
+  
+  /*--- Points whose row has no strong coupling (e.g. Dirichlet rows) are left
+   out of the coarse levels, and so are the couplings with them. ---*/
+  
+  bool *isolated = new bool [nPointDomain];
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    isolated[iPoint] = true;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+      if (strong[index]) { isolated[iPoint] = false; break; }
+  }
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+      if (strong[index] && isolated[col_ind[index]]) strong[index] = false;
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) AMG_Aggregate[iPoint] = NoAggregate;
+  
+  /*--- First pass, a point whose strong neighbors are all free becomes
+   the root of a new aggregate with all of them. ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (AMG_Aggregate[iPoint] != NoAggregate) continue;
+    free_neighbors = true; has_strong = false;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      if (!strong[index]) continue;
+      has_strong = true;
+      if (AMG_Aggregate[col_ind[index]] != NoAggregate) { free_neighbors = false; break; }
+    }
+    if (!(free_neighbors && has_strong)) continue;
+    AMG_Aggregate[iPoint] = nAggregate;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+      if (strong[index]) AMG_Aggregate[col_ind[index]] = nAggregate;
+    nAggregate++;
+  }
+  
+  /*--- Second pass, the remaining points join the aggregate of one of their
+   strong neighbors. ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (AMG_Aggregate[iPoint] != NoAggregate) continue;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      if (strong[index] && (AMG_Aggregate[col_ind[index]] != NoAggregate)) {
+        AMG_Aggregate[iPoint] = AMG_Aggregate[col_ind[index]];
+        break;
+      }
+    }
+  }
+  
+  /*--- Last pass, new aggregates with the points that are still free. Points
+   without any strong coupling (e.g. Dirichlet rows) are not aggregated. ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (AMG_Aggregate[iPoint] != NoAggregate) continue;
+    has_strong = false;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      if (strong[index] && (AMG_Aggregate[col_ind[index]] == NoAggregate)) {
+        AMG_Aggregate[col_ind[index]] = nAggregate;
+        has_strong = true;
+      }
+    }
+    if (has_strong) { AMG_Aggregate[iPoint] = nAggregate; nAggregate++; }
+  }
+  
+  delete [] diag_norm;
+  delete [] strong;
+  delete [] isolated;
+  
+  return nAggregate;
+  
+}
+
+void CSysMatrix::SetAMGLevel(CConfig *config, unsigned short iLevel) {
+  
+  unsigned long iPoint, jPoint, iAgg, jAgg, index, iVar, nAggregate, nnz_coarse, *row_ptr_coarse, *col_ind_coarse;
+  su2double *Block, *Block_Coarse;
+  vector<unsigned long> *coarse_neighbors;
+  vector<unsigned long>::iterator it;
+  
+  /*--- Inverse of the diagonal blocks, used by the smoother ---*/
+  
+  if ((invM == NULL) && (invM_mixed == NULL)) {
+    if (mixed_precision) {
+      invM_mixed = new su2mixedfloat [nPoint*nVar*nEqn];
+      for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM_mixed[iVar] = 0.0;
+    }
+    else {
+      invM = new su2double [nPoint*nVar*nEqn];
+      for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
+    }
+  }
+  BuildJacobiPreconditioner();
+  
+  AMG_CoarseSweeps = config->GetAMG_CoarseSweeps();
+  
+  if ((iLevel+1 >= config->GetAMG_MaxLevels()) || (nPointDomain <= config->GetAMG_MinPoints())) return;
+  
+  /*--- The aggregates and the sparse pattern of the coarse level are computed
+   on the first build and reused afterwards, only the values of the coarse
+   operator are updated. ---*/
+  
+  if (AMG_Coarse == NULL) {
+    
+    if (AMG_Aggregate == NULL) AMG_Aggregate = new unsigned long [nPointDomain];
+    nAggregate = SetAMGAggregates(config->GetAMG_Strength());
+    
+    /*--- Stop the coarsening if it is not effective ---*/
+    
+    if ((nAggregate == 0) || (nAggregate > config->GetAMG_CoarseningRatio()*nPointDomain)) return;
+    
+    /*--- Sparse pattern of the coarse level, Ac(I,J) is non zero if any
+     point of I is coupled to any point of J. ---*/
+    
+    coarse_neighbors = new vector<unsigned long> [nAggregate];
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      iAgg = AMG_Aggregate[iPoint];
+      if (iAgg >= nAggregate) continue;
+      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        jPoint = col_ind[index];
+        if ((jPoint < nPointDomain) && (AMG_Aggregate[jPoint] < nAggregate))
+          coarse_neighbors[iAgg].push_back(AMG_Aggregate[jPoint]);
+      }
+    }
+    
+    row_ptr_coarse = new unsigned long [nAggregate+1];
+    row_ptr_coarse[0] = 0;
+    for (iAgg = 0; iAgg < nAggregate; iAgg++) {
+      sort(coarse_neighbors[iAgg].begin(), coarse_neighbors[iAgg].end());
+      it = unique(coarse_neighbors[iAgg].begin(), coarse_neighbors[iAgg].end());
+      coarse_neighbors[iAgg].resize(it - coarse_neighbors[iAgg].begin());
+      row_ptr_coarse[iAgg+1] = row_ptr_coarse[iAgg] + coarse_neighbors[iAgg].size();
+    }
+    nnz_coarse = row_ptr_coarse[nAggregate];
+    
+    col_ind_coarse = new unsigned long [nnz_coarse];
+    for (iAgg = 0; iAgg < nAggregate; iAgg++)
+      for (index = 0; index < coarse_neighbors[iAgg].size(); index++)
+        col_ind_coarse[row_ptr_coarse[iAgg]+index] = coarse_neighbors[iAgg][index];
+    
+    delete [] coarse_neighbors;
+    
+    /*--- Position of each block of this level in the coarse matrix, blocks that
+     do not contribute to the coarse operator point past its end. ---*/
+    
+    AMG_Index = new unsigned long [nnz];
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        AMG_Index[index] = nnz_coarse;
+        jPoint = col_ind[index];
+        if ((iPoint >= nPointDomain) || (jPoint >= nPointDomain)) continue;
+        iAgg = AMG_Aggregate[iPoint]; jAgg = AMG_Aggregate[jPoint];
+        if ((iAgg >= nAggregate) || (jAgg >= nAggregate)) continue;
+        AMG_Index[index] = lower_bound(&col_ind_coarse[row_ptr_coarse[iAgg]],
+                                       &col_ind_coarse[row_ptr_coarse[iAgg+1]], jAgg) - col_ind_coarse;
+      }
+    }
+    
+    /*--- The coarse level is a matrix without halo points ---*/
+    
+    AMG_Coarse = new CSysMatrix();
+    AMG_Coarse->mixed_precision = mixed_precision;
+    AMG_Coarse->SetIndexes_AMG(nAggregate, nVar, nEqn, row_ptr_coarse, col_ind_coarse, nnz_coarse);
+    
+    AMG_Res = new su2double [nPointDomain*nVar];
+    AMG_Coarse->AMG_Rhs = new su2double [nAggregate*nVar];
+    AMG_Coarse->AMG_Sol = new su2double [nAggregate*nVar];
+    
+  }
+  
+  /*--- Galerkin coarse operator with piecewise constant (per block) prolongation,
+   Ac(I,J) = sum of Aij over i in I and j in J. ---*/
+  
+  AMG_Coarse->SetValZero();
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      if (AMG_Index[index] >= AMG_Coarse->nnz) continue;
+      Block = &matrix[index*nVar*nEqn];
+      Block_Coarse = &(AMG_Coarse->matrix[AMG_Index[index]*nVar*nEqn]);
+      for (iVar = 0; iVar < nVar*nEqn; iVar++) Block_Coarse[iVar] += Block[iVar];
+    }
+  }
+  
+  AMG_Coarse->SetAMGLevel(config, iLevel+1);
+  
+}
+
+void CSysMatrix::AMG_Smoother(const su2double *b, su2double *x, bool forward) {
+  
+  unsigned long iPoint, jPoint, index, iVar, iSweep;
+  
+  for (iSweep = 0; iSweep < nPointDomain; iSweep++) {
+    
+    iPoint = forward? iSweep : nPointDomain-1-iSweep;
+    
+    /*--- x_i = inv(Aii)*(b_i - sum_j Aij*x_j) ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = b[iPoint*nVar+iVar];
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      if ((jPoint != iPoint) && (jPoint < nPointDomain)) {
+        BlockVectorKernel(nVar, &matrix[index*nVar*nEqn], &x[jPoint*nVar], aux_vector);
+        for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] -= aux_vector[iVar];
+      }
+    }
+    
+    if (mixed_precision)
+      BlockVectorMixedKernel(nVar, &invM_mixed[iPoint*nVar*nVar], sum_vector, &x[iPoint*nVar]);
+    else
+      BlockVectorKernel(nVar, &invM[iPoint*nVar*nVar], sum_vector, &x[iPoint*nVar]);
+    
+  }
+  
+}
+
+void CSysMatrix::AMG_Cycle(const su2double *b, su2double *x) {
+  
+  unsigned long iPoint, jPoint, index, iVar, iAgg, nAggregate;
+  unsigned short iSweep;
+  
+  /*--- Coarsest level, symmetric Gauss-Seidel iterations ---*/
+  
+  if (AMG_Coarse == NULL) {
+    for (iSweep = 0; iSweep < AMG_CoarseSweeps; iSweep++) {
+      AMG_Smoother(b, x, true);
+      AMG_Smoother(b, x, false);
+    }
+    return;
+  }
+  
+  /*--- Pre-smoothing ---*/
+  
+  AMG_Smoother(b, x, true);
+  
+  /*--- Residual of this level, r = b - A*x, restricted to the coarse level
+   by adding the residuals of the points of each aggregate. ---*/
+  
+  nAggregate = AMG_Coarse->nPointDomain;
+  for (iVar = 0; iVar < nAggregate*nVar; iVar++) {
+    AMG_Coarse->AMG_Rhs[iVar] = 0.0;
+    AMG_Coarse->AMG_Sol[iVar] = 0.0;
+  }
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      if (jPoint < nPointDomain)
+        BlockVectorAddKernel(nVar, &matrix[index*nVar*nEqn], &x[jPoint*nVar], sum_vector);
+    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      AMG_Res[iPoint*nVar+iVar] = b[iPoint*nVar+iVar] - sum_vector[iVar];
+    
+    iAgg = AMG_Aggregate[iPoint];
+    if (iAgg < nAggregate)
+      for (iVar = 0; iVar < nVar; iVar++)
+        AMG_Coarse->AMG_Rhs[iAgg*nVar+iVar] += AMG_Res[iPoint*nVar+iVar];
+  }
+  
+  /*--- Coarse level correction, and prolongation ---*/
+  
+  AMG_Coarse->AMG_Cycle(AMG_Coarse->AMG_Rhs, AMG_Coarse->AMG_Sol);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    iAgg = AMG_Aggregate[iPoint];
+    if (iAgg < nAggregate)
+      for (iVar = 0; iVar < nVar; iVar++)
+        x[iPoint*nVar+iVar] += AMG_Coarse->AMG_Sol[iAgg*nVar+iVar];
+  }
+  
+  /*--- Post-smoothing, in the opposite direction to keep the cycle symmetric ---*/
+  
+  AMG_Smoother(b, x, false);
+  
+}
+
+void CSysMatrix::BuildAMGPreconditioner(CConfig *config, bool transposed) {
+  
+  unsigned long iPoint, jPoint, index, iVar, jVar, nnz_trans, *row_ptr_trans, *col_ind_trans;
+  su2double *Block, *Block_Trans;
+  
+  if (frozen) return;
+  
+  AMG_Use_Transposed = transposed;
+  
+  if (!transposed) {
+    SetAMGLevel(config, 0);
+    return;
+  }
+  
+  /*--- Sparse pattern of the transpose of the domain part of the matrix,
+   built on the first call and reused afterwards. ---*/
+  
+  if (AMG_Transposed == NULL) {
+    
+    row_ptr_trans = new unsigned long [nPointDomain+1];
+    for (iPoint = 0; iPoint <= nPointDomain; iPoint++) row_ptr_trans[iPoint] = 0;
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+        if (col_ind[index] < nPointDomain) row_ptr_trans[col_ind[index]+1]++;
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) row_ptr_trans[iPoint+1] += row_ptr_trans[iPoint];
+    nnz_trans = row_ptr_trans[nPointDomain];
+    
+    /*--- Rows are visited in increasing order, hence the columns of the
+     transposed matrix are sorted. ---*/
+    
+    col_ind_trans = new unsigned long [nnz_trans];
+    unsigned long *next = new unsigned long [nPointDomain];
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) next[iPoint] = row_ptr_trans[iPoint];
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        jPoint = col_ind[index];
+        if (jPoint < nPointDomain) { col_ind_trans[next[jPoint]] = iPoint; next[jPoint]++; }
+      }
+    }
+    delete [] next;
+    
+    AMG_Transposed = new CSysMatrix();
+    AMG_Transposed->mixed_precision = mixed_precision;
+    AMG_Transposed->SetIndexes_AMG(nPointDomain, nVar, nEqn, row_ptr_trans, col_ind_trans, nnz_trans);
+    
+  }
+  
+  /*--- Values of the transposed matrix, At(i,j) = A(j,i)^T ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = AMG_Transposed->row_ptr[iPoint]; index < AMG_Transposed->row_ptr[iPoint+1]; index++) {
+      jPoint = AMG_Transposed->col_ind[index];
+      Block = GetBlock(jPoint, iPoint);
+      Block_Trans = &(AMG_Transposed->matrix[index*nVar*nEqn]);
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          Block_Trans[iVar*nVar+jVar] = Block[jVar*nVar+iVar];
+    }
+  }
+  
+  AMG_Transposed->SetAMGLevel(config, 0);
+  
+}
+
+void CSysMatrix::ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iVar;
+  
+  for (iVar = 0; iVar < nPointDomain*nVar; iVar++) prod[iVar] = 0.0;
+  
+  if (AMG_Use_Transposed)
+    AMG_Transposed->AMG_Cycle(&vec[0], &prod[0]);
+  else
+    AMG_Cycle(&vec[0], &prod[0]);
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
 void CSysMatrix::ComputeResidual(const CSysVector & sol, const CSysVector & f, CSysVector & res) {
   
   unsigned long iPoint, iVar;
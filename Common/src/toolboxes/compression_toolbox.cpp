@@ -0,0 +1,220 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Lossless compression of blocks of binary data (byte shuffle + LZ77).
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/compression_toolbox.hpp"
+
+/*--- Parameters of the LZ coder: minimum match length, largest match offset
+ (two bytes), and size of the hash table used to find the matches. ---*/
+
+const unsigned long LZ_MinMatch   = 4;
+const unsigned long LZ_MaxOffset  = 65535;
+const unsigned long LZ_HashLog    = 16;
+
+static inline unsigned int LZ_Read32(const unsigned char *p) {
+  unsigned int val;
+  memcpy(&val, p, sizeof(unsigned int));
+  return val;
+}
+
+static inline unsigned long LZ_Hash(unsigned int seq) {
+  return (seq*2654435761U) >> (32-LZ_HashLog);
+}
+
+/*--- Lengths that do not fit the 4 bits of the token continue in bytes of 255. ---*/
+
+static inline void LZ_WriteLength(unsigned long len, std::vector<char> &dst) {
+  while (len >= 255) { dst.push_back(char(255)); len -= 255; }
+  dst.push_back(char(len));
+}
+
+static inline bool LZ_ReadLength(const unsigned char *&ip, const unsigned char *iend, unsigned long &len) {
+  unsigned char byte;
+  do {
+    if (ip >= iend) return false;
+    byte = *ip++;
+    len += byte;
+  } while (byte == 255);
+  return true;
+}
+
+static void LZ_WriteSequence(const unsigned char *lit, unsigned long nLit, unsigned long offset,
+                             unsigned long matchLen, std::vector<char> &dst) {
+
+  /*--- Token: high nibble number of literals, low nibble match length - LZ_MinMatch. ---*/
+
+  const unsigned long mlCode = (matchLen > 0)? matchLen-LZ_MinMatch : 0;
+  unsigned char token = (unsigned char)(((nLit < 15)? nLit : 15) << 4);
+  token |= (unsigned char)((mlCode < 15)? mlCode : 15);
+  dst.push_back(char(token));
+
+  if (nLit >= 15) LZ_WriteLength(nLit-15, dst);
+  dst.insert(dst.end(), lit, lit+nLit);
+
+  /*--- The last sequence only has literals. ---*/
+
+  if (matchLen == 0) return;
+
+  dst.push_back(char(offset & 255));
+  dst.push_back(char(offset >> 8));
+  if (mlCode >= 15) LZ_WriteLength(mlCode-15, dst);
+}
+
+void CompressionToolbox::Shuffle(const char *src, unsigned long nElem, unsigned short elemSize, char *dst) {
+  for (unsigned long iElem = 0; iElem < nElem; iElem++)
+    for (unsigned short iByte = 0; iByte < elemSize; iByte++)
+      dst[iByte*nElem+iElem] = src[iElem*elemSize+iByte];
+}
+
+void CompressionToolbox::Unshuffle(const char *src, unsigned long nElem, unsigned short elemSize, char *dst) {
+  for (unsigned long iElem = 0; iElem < nElem; iElem++)
+    for (unsigned short iByte = 0; iByte < elemSize; iByte++)
+      dst[iElem*elemSize+iByte] = src[iByte*nElem+iElem];
+}
+
+void CompressionToolbox::CompressLZ(const char *src, unsigned long nBytes, std::vector<char> &dst) {
+
+  const unsigned char *in = reinterpret_cast<const unsigned char*>(src);
+
+  dst.clear();
+  dst.reserve(nBytes/2 + 16);
+
+  /*--- Last position seen for each hash (+1, zero means empty). ---*/
+
+  std::vector<unsigned long> table(1ul << LZ_HashLog, 0);
+
+  unsigned long ip = 0, anchor = 0;
+
+  while (ip + LZ_MinMatch <= nBytes) {
+
+    const unsigned int seq = LZ_Read32(in+ip);
+    const unsigned long hash = LZ_Hash(seq);
+    const unsigned long ref = table[hash];
+    table[hash] = ip+1;
+
+    if ((ref > 0) && (ip+1-ref <= LZ_MaxOffset) && (LZ_Read32(in+ref-1) == seq)) {
+
+      /*--- Extend the match as far as possible. ---*/
+
+      unsigned long matchLen = LZ_MinMatch;
+      while ((ip+matchLen < nBytes) && (in[ref-1+matchLen] == in[ip+matchLen])) matchLen++;
+
+      LZ_WriteSequence(in+anchor, ip-anchor, ip+1-ref, matchLen, dst);
+
+      ip += matchLen;
+      anchor = ip;
+    }
+    else {
+      ip++;
+    }
+  }
+
+  /*--- Remaining literals. ---*/
+
+  LZ_WriteSequence(in+anchor, nBytes-anchor, 0, 0, dst);
+
+}
+
+bool CompressionToolbox::DecompressLZ(const char *src, unsigned long srcBytes, char *dst, unsigned long dstBytes) {
+
+  const unsigned char *ip = reinterpret_cast<const unsigned char*>(src);
+  const unsigned char *iend = ip + srcBytes;
+  unsigned long op = 0;
+
+  while (ip < iend) {
+
+    const unsigned char token = *ip++;
+
+    /*--- Literals. ---*/
+
+    unsigned long nLit = token >> 4;
+    if ((nLit == 15) && !LZ_ReadLength(ip, iend, nLit)) return false;
+    if ((nLit > (unsigned long)(iend-ip)) || (op+nLit > dstBytes)) return false;
+    memcpy(dst+op, ip, nLit);
+    ip += nLit; op += nLit;
+
+    if (ip == iend) break;
+
+    /*--- Match, it may overlap with the output (repeated patterns), copy byte by byte. ---*/
+
+    if (iend-ip < 2) return false;
+    const unsigned long offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+
+    unsigned long matchLen = token & 15;
+    if ((matchLen == 15) && !LZ_ReadLength(ip, iend, matchLen)) return false;
+    matchLen += LZ_MinMatch;
+
+    if ((offset == 0) || (offset > op) || (op+matchLen > dstBytes)) return false;
+    for (unsigned long i = 0; i < matchLen; i++, op++) dst[op] = dst[op-offset];
+  }
+
+  return (op == dstBytes);
+
+}
+
+void CompressionToolbox::Encode(const char *src, unsigned long nElem, unsigned short elemSize,
+                                bool compress, std::vector<char> &dst) {
+
+  const unsigned long nBytes = nElem*elemSize;
+
+  if (compress && (nBytes > 0)) {
+    std::vector<char> shuffled(nBytes);
+    Shuffle(src, nElem, elemSize, shuffled.data());
+    CompressLZ(shuffled.data(), nBytes, dst);
+    if (dst.size() < nBytes) return;
+  }
+
+  dst.assign(src, src+nBytes);
+
+}
+
+bool CompressionToolbox::Decode(const char *src, unsigned long srcBytes, unsigned long nElem,
+                                unsigned short elemSize, char *dst) {
+
+  const unsigned long nBytes = nElem*elemSize;
+
+  if (srcBytes == nBytes) {
+    memcpy(dst, src, nBytes);
+    return true;
+  }
+
+  std::vector<char> shuffled(nBytes);
+  if (!DecompressLZ(src, srcBytes, shuffled.data(), nBytes)) return false;
+  Unshuffle(shuffled.data(), nElem, elemSize, dst);
+  return true;
+
+}
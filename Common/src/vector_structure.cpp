@@ -391,16 +391,9 @@ su2double *CSysVector::GetBlock(unsigned long val_ipoint) {
 
 su2double dotProd(const CSysVector & u, const CSysVector & v) {
   
-  /*--- check for consistent sizes ---*/
-  if (u.nElm != v.nElm) {
-    SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
-  }
-  
   /*--- find local inner product and, if a parallel run, sum over all
    processors (we use nElemDomain instead of nElem) ---*/
-  su2double loc_prod = 0.0;
-  for (unsigned long i = 0; i < u.nElmDomain; i++)
-    loc_prod += u.vec_val[i]*v.vec_val[i];
+  su2double loc_prod = dotProdLocal(u, v);
   su2double prod = 0.0;
   
 #ifdef HAVE_MPI
@@ -411,3 +404,17 @@ su2double dotProd(const CSysVector & u, const CSysVector & v) {
   
   return prod;
 }
+
+su2double dotProdLocal(const CSysVector & u, const CSysVector & v) {
+  
+  /*--- check for consistent sizes ---*/
+  if (u.nElm != v.nElm) {
+    SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
+  }
+  
+  su2double loc_prod = 0.0;
+  for (unsigned long i = 0; i < u.nElmDomain; i++)
+    loc_prod += u.vec_val[i]*v.vec_val[i];
+  
+  return loc_prod;
+}
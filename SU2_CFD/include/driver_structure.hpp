@@ -95,6 +95,8 @@ protected:
   CGeometry ****geometry_container;              /*!< \brief Geometrical definition of the problem. */
   CSolver *****solver_container;                 /*!< \brief Container vector with all the solutions. */
   CNumerics ******numerics_container;            /*!< \brief Description of the numerical method (the way in which the equations are solved). */
+  CNumerics ******numerics_thread;               /*!< \brief Thread-private edge numerics of the flow solver for the colored edge loops, numerics_thread[#ZONES][#THREADS][#INSTANCES][#MG_GRIDS][#EQ_TERMS] (thread 0 unused). */
+  unsigned short nThread_Numerics;               /*!< \brief Number of threads for which numerics_thread was allocated. */
   CConfig **config_container;                   /*!< \brief Definition of the particular problem. */
   CConfig *driver_config;                       /*!< \brief Definition of the driver configuration. */
   CSurfaceMovement **surface_movement;          /*!< \brief Surface movement classes of the problem. */
@@ -219,6 +221,45 @@ public:
    */
   void Numerics_Postprocessing(CNumerics *****numerics_container, CSolver ***solver_container, CGeometry **geometry, CConfig *config, unsigned short val_iInst);
 
+  /*!
+   * \brief Create the convective and viscous numerics of the flow solver (Euler and Navier-Stokes) on one grid level.
+   * \param[in,out] numerics - Numerics of the flow solver on the grid level, numerics[#EQ_TERMS].
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMGlevel - Grid level.
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] nVar_Flow - Number of variables of the flow solver.
+   * \param[in] visc_term - Whether to create the viscous term of the edge loops.
+   * \param[in] bound_terms - Whether to create the boundary condition methods (convective and viscous).
+   */
+  void Numerics_FlowPreprocessing(CNumerics **numerics, CConfig *config, unsigned short iMGlevel,
+                                  unsigned short nDim, unsigned short nVar_Flow, bool visc_term, bool bound_terms);
+
+  /*!
+   * \brief Create the thread-private copies of the numerics used in the threaded edge loops of the
+   *        flow solver (convective and viscous terms), the other terms are left NULL.
+   * \param[in] numerics - Thread-private numerics of one instance, numerics[#MG_GRIDS][#EQ_TERMS].
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iInst - Instance of the problem.
+   */
+  void Numerics_ThreadPreprocessing(CNumerics ***numerics, CSolver ****solver_container, CGeometry ***geometry,
+                                    CConfig *config, unsigned short val_iInst);
+  
+  /*!
+   * \brief Delete the thread-private numerics of one instance.
+   * \param[in] numerics - Thread-private numerics of one instance, numerics[#MG_GRIDS][#EQ_TERMS].
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Numerics_ThreadPostprocessing(CNumerics ***numerics, CConfig *config);
+  
+  /*!
+   * \brief Whether the flow solver of a zone runs its edge loops threaded, on colored edges.
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>TRUE</code> for the compressible FVM flow solvers when more than one thread is available.
+   */
+  bool Threaded_EdgeLoops(CConfig *config);
+
   /*!
    * \brief Initialize Python interface functionalities
    */
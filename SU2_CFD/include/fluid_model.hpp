@@ -44,6 +44,10 @@
 #include <iostream>
 #include <string>
 #include <cmath>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <functional>
 
 #define LEN_COMPONENTS 32
 
@@ -638,6 +642,225 @@ public:
 
 };
 
+/*!
+ * \class CLookUpTable2D
+ * \brief Table of thermodynamic quantities as a function of two input variables.
+ *        The rectangle of the (optionally logarithmic) inputs is covered by a uniform root
+ *        grid, whose cells are refined as a quadtree until bilinear interpolation reproduces
+ *        the generating function within a tolerance. The values are stored as passive data.
+ * \author: SU2 contributors
+ */
+class CLookUpTable2D {
+
+protected:
+  unsigned short nField;          /*!< \brief Number of fields stored per node. */
+  bool logX,                      /*!< \brief Whether the first coordinate is the logarithm of the first input. */
+       logY;                      /*!< \brief Whether the second coordinate is the logarithm of the second input. */
+  passivedouble xMin, xMax,       /*!< \brief Bounds of the first coordinate. */
+                yMin, yMax;       /*!< \brief Bounds of the second coordinate. */
+  unsigned long nRootX,           /*!< \brief Number of root cells in the first coordinate. */
+                nRootY;           /*!< \brief Number of root cells in the second coordinate. */
+  vector<long> Tree;              /*!< \brief Per cell, the index of its first of four children, or -1-(index of the leaf). */
+  vector<unsigned long> LeafNodes;/*!< \brief Nodes of the leaves (lower left, lower right, upper left, upper right). */
+  vector<passivedouble> NodeData; /*!< \brief Fields of the nodes [nNode][nField]. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   */
+  CLookUpTable2D(void);
+
+  /*!
+   * \brief Generate the table by evaluating a function at the nodes.
+   * \param[in] val_nField - Number of fields returned by the function.
+   * \param[in] nErrorField - The first nErrorField fields control the refinement.
+   * \param[in] val_logX - Interpolate in the logarithm of the first input.
+   * \param[in] val_logY - Interpolate in the logarithm of the second input.
+   * \param[in] x0, x1, y0, y1 - Bounds of the inputs.
+   * \param[in] val_nRoot - Number of root cells in each direction.
+   * \param[in] maxLevel - Maximum number of refinements of a root cell.
+   * \param[in] tolerance - Relative interpolation error that triggers a refinement.
+   * \param[in] func - Function, which computes the fields for a pair of inputs.
+   */
+  void Build(unsigned short val_nField, unsigned short nErrorField, bool val_logX, bool val_logY,
+             passivedouble x0, passivedouble x1, passivedouble y0, passivedouble y1,
+             unsigned long val_nRoot, unsigned short maxLevel, passivedouble tolerance,
+             const function<void(passivedouble, passivedouble, passivedouble*)> &func);
+
+  /*!
+   * \brief Interpolate the fields for a pair of inputs. Inputs outside the table are extrapolated linearly.
+   * \param[in] x - First input.
+   * \param[in] y - Second input.
+   * \param[out] val_fields - Interpolated fields.
+   */
+  void Interpolate(su2double x, su2double y, su2double *val_fields) const;
+
+  /*!
+   * \brief Get the number of leaves of the table.
+   * \return Number of leaves.
+   */
+  unsigned long GetnLeaf(void) const;
+
+  /*!
+   * \brief Write the table to a binary stream.
+   * \param[in] file - Output stream.
+   */
+  void Write(ofstream &file) const;
+
+  /*!
+   * \brief Read the table from a binary stream.
+   * \param[in] file - Input stream.
+   * \return Whether or not the table could be read.
+   */
+  bool Read(ifstream &file);
+
+  /*!
+   * \brief Send the table of the master node to all other ranks.
+   */
+  void Broadcast(void);
+
+};
+
+/*!
+ * \class CLookUpTableGas
+ * \brief Child class for defining a tabulated (look-up table) fluid model. The tables are generated
+ *        once from one of the analytic models (LUT_DONOR_MODEL) or read from LUT_FILENAME, after
+ *        which every thermodynamic state is obtained by interpolation instead of the iterative
+ *        solution of the donor equations. The master node reads or generates the tables and
+ *        broadcasts them. Every rank then holds one copy, which is shared by the multigrid
+ *        levels and the threads of a configuration (see CreateShared).
+ * \author: SU2 contributors
+ */
+class CLookUpTableGas : public CFluidModel {
+
+protected:
+  CFluidModel *Donor;          /*!< \brief Dimensionless donor model, used for the derivatives of the boundary conditions. */
+  CLookUpTable2D *Table_rhoe,  /*!< \brief State as a function of density and internal energy. */
+                 *Table_PT,    /*!< \brief Density and energy as a function of pressure and temperature. */
+                 *Table_Prho,  /*!< \brief Density and energy as a function of pressure and density. */
+                 *Table_rhoT,  /*!< \brief Density and energy as a function of density and temperature. */
+                 *Table_hs,    /*!< \brief Density and energy as a function of enthalpy and entropy. */
+                 *Table_Ps;    /*!< \brief Density and energy as a function of pressure and entropy. */
+  bool OwnTables;              /*!< \brief Whether the tables are owned or shared with another instance. */
+
+  static map<const CConfig*, const CLookUpTableGas*> TableOwner; /*!< \brief Instance that owns the tables of each configuration. */
+
+  /*!
+   * \brief Generate the tables from the donor model.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildTables(CConfig *config);
+
+  /*!
+   * \brief Write the tables and the parameters they were generated with to LUT_FILENAME.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void WriteTables(CConfig *config);
+
+  /*!
+   * \brief Read the tables from LUT_FILENAME, if they were generated with the same parameters.
+   * \param[in] config - Definition of the particular problem.
+   * \return Whether or not the tables could be read.
+   */
+  bool ReadTables(CConfig *config);
+
+public:
+
+  /*!
+   * \brief Constructor of the class, which reads or generates the dimensionless tables.
+   * \param[in] config - Definition of the particular problem (reference values must be set).
+   */
+  CLookUpTableGas(CConfig *config);
+
+  /*!
+   * \brief Constructor of the class, which shares the tables of another instance
+   *        (e.g. to give every thread its own thermodynamic state).
+   * \param[in] val_tables - Instance that owns the tables.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CLookUpTableGas(const CLookUpTableGas *val_tables, CConfig *config);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  virtual ~CLookUpTableGas(void);
+
+  /*!
+   * \brief Create the analytic model from which the tables are generated.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nondimensional - Whether to use the dimensionless parameters.
+   * \return Pointer to the new model.
+   */
+  static CFluidModel* CreateDonorModel(CConfig *config, bool nondimensional);
+
+  /*!
+   * \brief Create the model of a solver. The first instance of a configuration (the finest grid)
+   *        reads or generates the tables, the later ones (coarse grids) share its tables.
+   *        Collective, all ranks must create the models in the same order.
+   * \param[in] config - Definition of the particular problem (reference values must be set).
+   * \return Pointer to the new model.
+   */
+  static CLookUpTableGas* CreateShared(CConfig *config);
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe (su2double rho, su2double e );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT (su2double P, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless Energy using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs (su2double h, su2double s );
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT (su2double rho, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps (su2double P, su2double s );
+
+  /*!
+   * \brief Compute the derivatives of enthalpy and entropy needed for subsonic inflow BC (evaluated by the donor).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void ComputeDerivativeNRBC_Prho (su2double P, su2double rho );
+
+};
+
 /*!
  * \class CConstantDensity
  * \brief Child class for defining a constant density gas model (incompressible only).
@@ -121,6 +121,19 @@ public:
    */
   void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config, 
               unsigned short iRKStep, unsigned short RunTime_EqSystem, unsigned long Iteration);
+
+  /*!
+   * \brief Do one Jacobian-free Newton-Krylov iteration of the implicit system, the Jacobian-vector products
+   *        are finite differences of the residual and the assembled Jacobian is used as preconditioner.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  void NewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
+                              unsigned short iMesh, unsigned short RunTime_EqSystem);
   
   /*! 
    * \brief Do the time integration (explicit or implicit) of the numerical system on a FEM framework.
@@ -443,6 +456,58 @@ public:
 
 };
 
+/*!
+ * \class CNewtonKrylovProduct
+ * \brief Jacobian-free matrix-vector product of the implicit system, v = (Vol/dt)*u + dR/dU*u, where the
+ *        product with the Jacobian of the residual is the forward difference (R(U + eps*u) - R(U))/eps.
+ */
+class CNewtonKrylovProduct : public CMatrixVectorProduct {
+private:
+  CIntegration *integration;          /*!< \brief Integration that evaluates the residual. */
+  CGeometry *geometry;                /*!< \brief Geometrical definition of the problem. */
+  CSolver **solver_container;         /*!< \brief Container vector with all the solutions. */
+  CNumerics **numerics;               /*!< \brief Description of the numerical method. */
+  CConfig *config;                    /*!< \brief Definition of the particular problem. */
+  unsigned short iMesh,               /*!< \brief Index of the mesh in multigrid computations. */
+  RunTime_EqSystem,                   /*!< \brief System of equations which is being solved. */
+  MainSolver;                         /*!< \brief Position of the solver in the container. */
+  const CSysVector *Solution_Base,    /*!< \brief State at which the Jacobian is evaluated. */
+  *Residual_Base;                     /*!< \brief Residual (with the multigrid forcing term) at the base state. */
+  su2double Norm_Solution;            /*!< \brief Norm of the base state, to scale the finite difference step. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_integration - Integration that evaluates the residual.
+   * \param[in] val_geometry - Geometrical definition of the problem.
+   * \param[in] val_solver_container - Container vector with all the solutions.
+   * \param[in] val_numerics - Description of the numerical method.
+   * \param[in] val_config - Definition of the particular problem.
+   * \param[in] val_iMesh - Index of the mesh in multigrid computations.
+   * \param[in] val_RunTime_EqSystem - System of equations which is being solved.
+   * \param[in] val_Solution_Base - State at which the Jacobian is evaluated.
+   * \param[in] val_Residual_Base - Residual at the base state.
+   */
+  CNewtonKrylovProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+                       CNumerics **val_numerics, CConfig *val_config, unsigned short val_iMesh,
+                       unsigned short val_RunTime_EqSystem, const CSysVector & val_Solution_Base,
+                       const CSysVector & val_Residual_Base);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CNewtonKrylovProduct(void);
+
+  /*!
+   * \brief Jacobian-vector product by a forward difference of the residual, the solution
+   *        of the solver is restored to the base state on exit.
+   * \param[in] u - CSysVector that is being multiplied by the Jacobian.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 /*!
  * \class CMultiGridIntegration
  * \brief Class for doing the numerical integration using a multigrid method.
@@ -1118,6 +1118,20 @@ private:
   CFluidIteration* meanflow_iteration; /*!< \brief Pointer to the mean flow iteration class. */
   unsigned short CurrentRecording; /*!< \brief Stores the current status of the recording. */
   bool turbulent;       /*!< \brief Stores the turbulent flag. */
+  bool checkpointing;   /*!< \brief Recompute the direct solutions from checkpoints instead of reading every restart file. */
+  unsigned long nSnapshot;        /*!< \brief Maximum number of direct solutions kept in memory. */
+  unsigned long CheckpointFreq;   /*!< \brief Interval of the direct restart files (checkpoints on disk). */
+  long MinRequested;              /*!< \brief Earliest direct iteration requested so far by the reverse time integration. */
+  map<long, vector<passivedouble> > Snapshot; /*!< \brief Direct solutions at time n (and n-1) kept in memory, indexed by the direct iteration. */
+
+  /*!
+   * \brief Solution arrays of the direct solvers copied to and from the snapshots.
+   */
+  enum ENUM_PRIMAL_STATE {
+    PRIMAL_SOLUTION = 0, /*!< \brief Current solution. */
+    PRIMAL_TIME_N = 1,   /*!< \brief Solution at time n. */
+    PRIMAL_TIME_N1 = 2   /*!< \brief Solution at time n-1. */
+  };
 
 public:
   
@@ -1332,7 +1346,103 @@ public:
                       unsigned short val_iInst,
                       int val_DirectIter);
 
+  /*!
+   * \brief Load the direct solution of a time step, either from its restart file or recomputed
+   *        from the closest checkpoint (in memory or on disk) when checkpointing is enabled.
+   * \param[in] output - Pointer to the COutput class.
+   * \param[in] integration_container - Container vector with all the integration methods.
+   * \param[in] geometry_container - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] config_container - Definition of the particular problem.
+   * \param[in] surface_movement - Surface movement classes of the problem.
+   * \param[in] grid_movement - Volume grid movement classes of the problem.
+   * \param[in] FFDBox - FFD FFDBoxes of the problem.
+   * \param[in] val_iZone - Index of the zone.
+   * \param[in] val_iInst - Index of the instance.
+   * \param[in] val_DirectIter - Direct iteration to load.
+   */
+  void LoadUnsteady_Direct(COutput *output,
+                           CIntegration ****integration_container,
+                           CGeometry ****geometry_container,
+                           CSolver *****solver_container,
+                           CNumerics ******numerics_container,
+                           CConfig **config_container,
+                           CSurfaceMovement **surface_movement,
+                           CVolumetricMovement ***grid_movement,
+                           CFreeFormDefBox*** FFDBox,
+                           unsigned short val_iZone,
+                           unsigned short val_iInst,
+                           int val_DirectIter);
+
+private:
 
+  /*!
+   * \brief Advance the direct problem by one physical time step (dual time inner iterations and update).
+   * \param[in] val_DirectIter - Direct iteration (time step) that is computed.
+   */
+  void Run_DirectStep(COutput *output,
+                      CIntegration ****integration_container,
+                      CGeometry ****geometry_container,
+                      CSolver *****solver_container,
+                      CNumerics ******numerics_container,
+                      CConfig **config_container,
+                      CSurfaceMovement **surface_movement,
+                      CVolumetricMovement ***grid_movement,
+                      CFreeFormDefBox*** FFDBox,
+                      unsigned short val_iZone,
+                      unsigned short val_iInst,
+                      long val_DirectIter);
+
+  /*!
+   * \brief Compare a recomputed direct solution with the restart file of the direct run, if it exists,
+   *        and stop if they differ by more than UNST_ADJOINT_CHECKPOINT_VERIFY. Overwrites the solution.
+   * \param[in] val_DirectIter - Direct iteration (time step) that was recomputed.
+   * \param[in] state - Recomputed solution (as returned by GetPrimal_State).
+   */
+  void Verify_DirectStep(CGeometry ****geometry_container,
+                         CSolver *****solver_container,
+                         CConfig **config_container,
+                         unsigned short val_iZone,
+                         unsigned short val_iInst,
+                         long val_DirectIter,
+                         const vector<passivedouble> &state);
+
+  /*!
+   * \brief Append a solution array of the direct solvers (all mesh levels, including halos) to a state vector.
+   * \param[in] kind_state - Solution array that is copied.
+   * \param[in,out] state - Vector the values are appended to.
+   */
+  void GetPrimal_State(CGeometry ****geometry_container,
+                       CSolver *****solver_container,
+                       CConfig **config_container,
+                       unsigned short val_iZone,
+                       unsigned short val_iInst,
+                       unsigned short kind_state,
+                       vector<passivedouble> &state);
+
+  /*!
+   * \brief Set a solution array of the direct solvers from a state vector.
+   * \param[in] kind_state - Solution array that is set.
+   * \param[in] state - Vector with the values.
+   * \param[in] offset - Position of the first value in the state vector.
+   */
+  void SetPrimal_State(CGeometry ****geometry_container,
+                       CSolver *****solver_container,
+                       CConfig **config_container,
+                       unsigned short val_iZone,
+                       unsigned short val_iInst,
+                       unsigned short kind_state,
+                       const vector<passivedouble> &state,
+                       unsigned long offset);
+
+  /*!
+   * \brief Number of time steps to the next snapshot of the binomial (revolve) checkpointing schedule.
+   * \param[in] nSteps - Number of time steps left to the requested direct iteration.
+   * \param[in] nFree - Number of snapshots that can still be placed before it.
+   * \return Offset of the next snapshot.
+   */
+  unsigned long Snapshot_Offset(unsigned long nSteps, unsigned long nFree) const;
 
 };
 
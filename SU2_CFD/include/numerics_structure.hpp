@@ -1181,6 +1181,38 @@ public:
   virtual void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i,
                                CConfig *config);
   
+  /*!
+   * \brief Number of edges that the batched kernel of the scheme evaluates at once.
+   * \return Width of the batches, 0 if the scheme (or the current set of options) has no batched kernel.
+   */
+  virtual unsigned short GetBatchSize(void);
+  
+  /*!
+   * \brief Gather the state of one edge into a lane of the batch.
+   * \param[in] val_lane - Lane of the batch (less than GetBatchSize()).
+   * \param[in] val_v_i - Primitive variables at point i.
+   * \param[in] val_v_j - Primitive variables at point j.
+   * \param[in] val_normal - Normal vector of the edge.
+   */
+  virtual void SetPrimitive_Batch(unsigned short val_lane, su2double *val_v_i, su2double *val_v_j, su2double *val_normal);
+  
+  /*!
+   * \brief Compute the fluxes and the Jacobians of the first lanes of the batch.
+   * \param[in] val_nlane - Number of lanes that were set.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void ComputeResidual_Batch(unsigned short val_nlane, CConfig *config);
+  
+  /*!
+   * \brief Scatter the flux and the Jacobians of one lane of the batch.
+   * \param[in] val_lane - Lane of the batch.
+   * \param[out] val_residual - Pointer to the total residual.
+   * \param[out] val_Jacobian_i - Jacobian of the numerical method at node i (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobian of the numerical method at node j (implicit computation).
+   */
+  virtual void GetResidual_Batch(unsigned short val_lane, su2double *val_residual,
+                                 su2double **val_Jacobian_i, su2double **val_Jacobian_j);
+  
   /*!
    * \overload
    * \param[out] - Matrix for storing the constants to be used in the calculation of the equilibrium extent of reaction Keq.
@@ -1553,7 +1585,14 @@ public:
  */
 class CUpwRoe_Flow : public CNumerics {
 private:
+  static const unsigned short nBatch = 8;  /*!< \brief Number of edges of the batched kernel (SIMD lanes). */
   bool implicit, grid_movement, roe_low_dissipation;
+  su2double *Batch_V_i,      /*!< \brief Primitive variables at point i of the batch, stored lane-contiguous. */
+  *Batch_V_j,                /*!< \brief Primitive variables at point j of the batch, stored lane-contiguous. */
+  *Batch_Normal,             /*!< \brief Normal vectors of the batch, stored lane-contiguous. */
+  *Batch_Residual,           /*!< \brief Fluxes of the batch, stored lane-contiguous. */
+  *Batch_Jacobian_i,         /*!< \brief Jacobians w.r.t. point i of the batch, stored lane-contiguous. */
+  *Batch_Jacobian_j;         /*!< \brief Jacobians w.r.t. point j of the batch, stored lane-contiguous. */
   su2double *Diff_U;
   su2double *Velocity_i, *Velocity_j, *RoeVelocity;
   su2double *ProjFlux_i, *ProjFlux_j;
@@ -1589,6 +1628,48 @@ public:
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
   
+  /*!
+   * \brief Number of edges that the batched kernel evaluates at once.
+   * \return Width of the batches, 0 with grid movement, low dissipation or AD types.
+   */
+  unsigned short GetBatchSize(void);
+  
+  /*!
+   * \brief Gather the state of one edge into a lane of the batch.
+   * \param[in] val_lane - Lane of the batch.
+   * \param[in] val_v_i - Primitive variables at point i.
+   * \param[in] val_v_j - Primitive variables at point j.
+   * \param[in] val_normal - Normal vector of the edge.
+   */
+  void SetPrimitive_Batch(unsigned short val_lane, su2double *val_v_i, su2double *val_v_j, su2double *val_normal);
+  
+  /*!
+   * \brief Compute the Roe's fluxes and Jacobians of the first lanes of the batch.
+   * \param[in] val_nlane - Number of lanes that were set.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(unsigned short val_nlane, CConfig *config);
+  
+  /*!
+   * \brief Scatter the flux and the Jacobians of one lane of the batch.
+   * \param[in] val_lane - Lane of the batch.
+   * \param[out] val_residual - Pointer to the total residual.
+   * \param[out] val_Jacobian_i - Jacobian of the numerical method at node i (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobian of the numerical method at node j (implicit computation).
+   */
+  void GetResidual_Batch(unsigned short val_lane, su2double *val_residual,
+                         su2double **val_Jacobian_i, su2double **val_Jacobian_j);
+  
+private:
+  
+  /*!
+   * \brief Batched Roe's flux for a fixed number of dimensions, the loop over the lanes is the innermost one.
+   * \param[in] val_nlane - Number of lanes that were set.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<unsigned short nDim_>
+  void ComputeResidual_Batch_nDim(unsigned short val_nlane, CConfig *config);
+  
 };
 
 
@@ -169,6 +169,15 @@ inline void CNumerics::ComputeResidual(su2double **val_Jacobian_i, su2double **v
 inline void CNumerics::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, 
                                    CConfig *config) { }
 
+inline unsigned short CNumerics::GetBatchSize(void) { return 0; }
+
+inline void CNumerics::SetPrimitive_Batch(unsigned short val_lane, su2double *val_v_i, su2double *val_v_j, su2double *val_normal) { }
+
+inline void CNumerics::ComputeResidual_Batch(unsigned short val_nlane, CConfig *config) { }
+
+inline void CNumerics::GetResidual_Batch(unsigned short val_lane, su2double *val_residual,
+                                         su2double **val_Jacobian_i, su2double **val_Jacobian_j) { }
+
 inline void CNumerics::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j,
                                    su2double **val_JacobianMeanFlow_i, su2double **val_JacobianMeanFlow_j, CConfig *config) { }
 
@@ -50,6 +50,10 @@
 #include <cmath>
 #include <time.h>
 #include <fstream>
+#include <sstream>
+#ifdef HAVE_PTHREAD
+  #include <thread>
+#endif
 
 #include "solver_structure.hpp"
 #include "integration_structure.hpp"
@@ -57,11 +61,26 @@
 #include "../../Common/include/fem_geometry_structure.hpp"
 #include "../../Common/include/fem_standard_element.hpp"
 #include "../../Common/include/config_structure.hpp"
+#include "../../Common/include/io_aggregator_structure.hpp"
+#include "../../Common/include/chunked_restart_structure.hpp"
 
 #include "../../Common/include/toolboxes/printing_toolbox.hpp"
 
 using namespace std;
 
+/*!
+ * \struct CAsyncOutputJob
+ * \brief File staged for the background writer of COutput. It holds the (formatted) parts
+ *        of the file written by this rank and their positions, such that the writer does
+ *        not access the solver, the geometry or MPI.
+ */
+struct CAsyncOutputJob {
+  string filename;                /*!< \brief Name of the file. */
+  vector<string> sections;        /*!< \brief Parts of the file written by this rank (text or raw bytes). */
+  vector<unsigned long> offsets;  /*!< \brief Position of each part in the file (bytes). */
+  unsigned long file_size;        /*!< \brief Size of the complete file (bytes), set by the master rank. */
+};
+
 /*! 
  * \class COutput
  * \brief Class for writing the flow, adjoint and linearized solver 
@@ -139,6 +158,16 @@ class COutput {
   su2double **Parallel_Surf_Data;   // node i (x, y, z) = (Coords[0][i], Coords[1][i], Coords[2][i])
   vector<string> Variable_Names;
 
+  bool Async_Output;                       /*!< \brief Restart and volume solution files are written by a background thread. */
+  bool AsyncWriter_Running;                /*!< \brief A background write was started and has not been waited for. */
+  string AsyncWriter_Error;                /*!< \brief Error message of the background writer, empty on success. */
+  vector<CAsyncOutputJob> AsyncWriter_Jobs; /*!< \brief Files staged for (or being written by) the background writer. */
+  ostringstream AsyncWriter_Section;       /*!< \brief Section of the file being formatted by this rank. */
+  vector<string> AsyncWriter_Sections;     /*!< \brief Sections of the file already formatted by this rank. */
+#ifdef HAVE_PTHREAD
+  thread AsyncWriter;                      /*!< \brief The background writer. */
+#endif
+
   su2double **Data;
   unsigned short nVar_Consv, nVar_Total, nVar_Extra, nZones;
   bool wrote_surf_file, wrote_CGNS_base, wrote_Tecplot_base, wrote_Paraview_base;
@@ -503,6 +532,45 @@ public:
    */
   void WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_iInst);
 
+  /*!
+   * \brief Stream the parallel ASCII writers format into. The file itself in the synchronous mode,
+   *        the current section of the staged file in the asynchronous mode.
+   * \param[in] file - File stream of the writer.
+   * \return Stream to format the data into.
+   */
+  ostream &OutputStream(ofstream &file);
+
+  /*!
+   * \brief End of a part of a file written by the ranks in turn. In the synchronous mode the file is
+   *        flushed and the ranks are synchronized, in the asynchronous mode a new section is started.
+   * \param[in] file - File stream of the writer.
+   */
+  void NextOutputSection(ofstream &file);
+
+  /*!
+   * \brief Stage the sections formatted by this rank for the background writer. The position of
+   *        the sections in the file follows from the sizes of the sections of all the ranks (collective).
+   * \param[in] filename - Name of the file.
+   */
+  void StageOutputFile(string filename);
+
+  /*!
+   * \brief Start the background writer for the files staged during this output.
+   */
+  void StartAsyncWriter(void);
+
+  /*!
+   * \brief Body of the background writer, writes the staged files with plain (non MPI) I/O.
+   */
+  void WriteAsyncJobs(void);
+
+  /*!
+   * \brief Wait until this rank has written its parts of the files of the previous output. This provides
+   *        the back-pressure of the asynchronous output, at most one output is pending. When all the ranks
+   *        succeeded the master renames the temporary files to their final names (collective).
+   */
+  void WaitAsyncWriter(void);
+
   /*!
    * \brief Write the x, y, & z coordinates to a CGNS output file.
    * \param[in] config - Definition of the particular problem.
@@ -632,12 +700,13 @@ public:
   void SetSU2_MeshASCII(CConfig *config, CGeometry *geometry, unsigned short val_iZone, ofstream &output_file);
   
   /*!
-   * \brief Write the nodal coordinates and connectivity to a Tecplot binary mesh file.
+   * \brief Write the nodal coordinates and connectivity to a binary SU2 mesh file (see
+   *        CPhysicalGeometry::Read_SU2_Binary_Format_Parallel for the layout).
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] val_iZone - iZone index.
    */
-  void SetSU2_MeshBinary(CConfig *config, CGeometry *geometry);
+  void SetSU2_MeshBinary(CConfig *config, CGeometry *geometry, unsigned short val_iZone);
   
   /*!
    * \brief Write the nodal coordinates to a binary file.
@@ -68,9 +68,48 @@
 #include "../../Common/include/grid_movement_structure.hpp"
 #include "../../Common/include/blas_structure.hpp"
 #include "../../Common/include/graph_coloring_structure.hpp"
+#include "../../Common/include/omp_structure.hpp"
+#include "../../Common/include/io_aggregator_structure.hpp"
+#include "../../Common/include/chunked_restart_structure.hpp"
 
 using namespace std;
 
+/*!
+ * \class CEdgeWorkspace
+ * \brief Thread-private auxiliary arrays of the threaded edge loops (the reconstructed
+ *        states, the flux and the Jacobians of one edge).
+ */
+class CEdgeWorkspace {
+public:
+  su2double *Primitive_i,  /*!< \brief Auxiliary nPrimVar vector for the reconstruction at point i. */
+  *Primitive_j,            /*!< \brief Auxiliary nPrimVar vector for the reconstruction at point j. */
+  *Secondary_i,            /*!< \brief Auxiliary nSecondaryVar vector at point i. */
+  *Secondary_j,            /*!< \brief Auxiliary nSecondaryVar vector at point j. */
+  *Vector_i,               /*!< \brief Auxiliary nDim vector for the reconstruction at point i. */
+  *Vector_j,               /*!< \brief Auxiliary nDim vector for the reconstruction at point j. */
+  *Residual;               /*!< \brief Auxiliary nVar vector for the flux of the edge. */
+  su2double **Jacobian_i,  /*!< \brief Auxiliary nVar x nVar matrix for the Jacobian w.r.t. point i. */
+  **Jacobian_j;            /*!< \brief Auxiliary nVar x nVar matrix for the Jacobian w.r.t. point j. */
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of dimensions.
+   * \param[in] val_nVar - Number of variables of the solver.
+   * \param[in] val_nPrimVar - Number of primitive variables.
+   * \param[in] val_nSecondaryVar - Number of secondary variables.
+   */
+  CEdgeWorkspace(unsigned short val_nDim, unsigned short val_nVar,
+                 unsigned short val_nPrimVar, unsigned short val_nSecondaryVar);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CEdgeWorkspace(void);
+  
+private:
+  unsigned short nVar;  /*!< \brief Number of rows of the Jacobians. */
+};
+
 /*!
  * \class CSolver
  * \brief Main class for defining the PDE solution, it requires
@@ -82,6 +121,10 @@ protected:
   int rank, 	/*!< \brief MPI Rank. */
   size;       	/*!< \brief MPI Size. */
   unsigned short IterLinSolver;  /*!< \brief Linear solver iterations. */
+  unsigned long Jacobian_Age,   /*!< \brief Number of implicit iterations since the last assembly of the Jacobian. */
+  nIter_Jacobian,               /*!< \brief Number of implicit iterations of the solver. */
+  nReuse_Jacobian;              /*!< \brief Number of implicit iterations that reused a frozen Jacobian. */
+  su2double Res_Jacobian_Old;   /*!< \brief Residual of the previous implicit iteration, to detect a stalled convergence. */
   unsigned short nVar,          /*!< \brief Number of variables of the problem. */
   nPrimVar,                     /*!< \brief Number of primitive variables of the problem. */
   nPrimVarGrad,                 /*!< \brief Number of primitive variables of the problem in the gradient computation. */
@@ -140,6 +183,10 @@ protected:
   unsigned long *nCol_InletFile;       /*!< \brief Auxiliary structure for holding the number of columns for a particular marker in an inlet profile file. */
   passivedouble *Inlet_Data; /*!< \brief Auxiliary structure for holding the data values from an inlet profile file. */
 
+  unsigned short nThread;            /*!< \brief Number of threads of the colored edge loops (1 if they run serially). */
+  CNumerics ***ThreadNumerics;       /*!< \brief Numerics of each thread [nThread][MAX_TERMS], not owned (thread 0 uses the shared ones). */
+  CEdgeWorkspace **ThreadWorkspace;  /*!< \brief Auxiliary arrays of each thread (thread 0 uses the solver's own ones). */
+
 public:
   
   CSysVector LinSysSol;    /*!< \brief vector to store iterative solution of implicit linear system. */
@@ -153,6 +200,7 @@ public:
   string* OutputHeadingNames; /*< \brief vector of strings to store the headings for the exra variables */
   
   CVariable** node;  /*!< \brief Vector which the define the variables for each problem. */
+  CVariableStorage* NodeStorage;  /*!< \brief Contiguous storage of the main per-point fields of node (NULL if not used). */
   CVariable* node_infty; /*!< \brief CVariable storing the free stream conditions. */
   
   /*!
@@ -170,6 +218,62 @@ public:
    * \param[in] val_iterlinsolver - Number of linear iterations.
    */
   void SetIterLinSolver(unsigned short val_iterlinsolver);
+
+  /*!
+   * \brief Decide, at the end of an implicit iteration, if the Jacobian and its preconditioner
+   *        are assembled in the next iteration or if the current ones are reused (frozen).
+   *        A frozen Jacobian is assembled again when it reaches the maximum age, or when
+   *        the residual reduction of the iteration stalls.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetJacobian_Reuse(CConfig *config);
+  
+  /*!
+   * \brief Allocate the main per-point fields of the nodes in a contiguous, point-major storage so
+   *        that the edge and point loops stream through memory. It is activated right before the
+   *        nodes are created (in order of the points), and deactivated right after.
+   * \param[in] val_active - <code>TRUE</code> before creating the nodes, <code>FALSE</code> after.
+   */
+  void SetContiguousStorage(bool val_active);
+  
+  /*!
+   * \brief Register the private numerics of a thread for the colored edge loops, and allocate
+   *        its auxiliary arrays. Thread 0 always uses the numerics passed to the residual routines.
+   * \param[in] val_thread - Index of the thread (1 to nThread-1).
+   * \param[in] val_numerics - Numerics of the thread for each term (CONV_TERM, VISC_TERM, ...).
+   */
+  void SetThreadNumerics(unsigned short val_thread, CNumerics **val_numerics);
+  
+  /*!
+   * \brief Get the number of threads used by the colored edge loops.
+   * \return Number of threads (1 if the loops run serially).
+   */
+  unsigned short GetnThread(void);
+  
+  /*!
+   * \brief Number of su2double values sent per vertex for a given halo exchange.
+   * \param[in] commType - Type of quantity to be communicated (see MPI_QUANTITIES).
+   * \returns Number of values per vertex.
+   */
+  unsigned short GetCommCountPerPoint(unsigned short commType);
+  
+  /*!
+   * \brief Pack a solver quantity into the preallocated halo buffers of the geometry and post all
+   *        the sends/receives at once. Work not involving halo points can be done before CompleteComms().
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] commType - Type of quantity to be communicated (see MPI_QUANTITIES).
+   */
+  void InitiateComms(CGeometry *geometry, CConfig *config, unsigned short commType);
+  
+  /*!
+   * \brief Wait for the halo exchange launched with InitiateComms() and unpack (and rotate
+   *        across periodic boundaries) the received data into the halo points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] commType - Type of quantity to be communicated (see MPI_QUANTITIES).
+   */
+  void CompleteComms(CGeometry *geometry, CConfig *config, unsigned short commType);
   
   /*!
    * \brief Set number of linear solver iterations.
@@ -304,6 +408,12 @@ public:
    * \return Number of linear solver iterations.
    */
   unsigned short GetIterLinSolver(void);
+
+  /*!
+   * \brief Get the fraction of the implicit iterations that reused a frozen Jacobian.
+   * \return Reuse rate of the Jacobian, between 0 and 1.
+   */
+  su2double GetJacobian_Reuse_Rate(void);
   
   /*!
    * \brief Get the value of the maximum delta time.
@@ -2298,6 +2408,12 @@ public:
    */
   virtual bool IsElementBased(void);
 
+  /*!
+   * \brief A virtual member.
+   * \return Whether components 1..nDim of the state form a vector that is rotated across periodic boundaries.
+   */
+  virtual bool GetRotate_Periodic(void);
+
   /*!
    * \brief A virtual member.
    * \param[in] val_cequivarea - Value of the Equivalent Area coefficient.
@@ -3501,8 +3617,11 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] val_filename - String name of the restart file.
+   * \param[in] val_iField - First field needed by the caller (chunked files only).
+   * \param[in] val_nField - Number of fields needed by the caller, 0 for all (chunked files only, the others are zero).
    */
-  void Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename);
+  void Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename,
+                               unsigned short val_iField = 0, unsigned short val_nField = 0);
 
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
@@ -4803,6 +4922,12 @@ public:
    * \brief Destructor of the class.
    */
   virtual ~CEulerSolver(void);
+
+  /*!
+   * \brief The momentum (velocity) components are rotated across periodic boundaries.
+   * \return <code>TRUE</code>.
+   */
+  bool GetRotate_Periodic(void);
   
   /*!
    * \brief Impose the send-receive boundary condition.
@@ -5004,6 +5129,14 @@ public:
    */
   void SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the pressure sensor, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Compute Ducros Sensor for Roe Dissipation.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -5028,6 +5161,14 @@ public:
    */
   void SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Green-Gauss gradient of the primitive variables, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Compute the gradient of the primitive variables using a Least-Squares method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -5036,6 +5177,14 @@ public:
    */
   void SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Least-Squares gradient of the primitive variables, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Compute the gradient of the primitive variables using a Least-Squares method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -5051,6 +5200,14 @@ public:
    */
   void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the limiter of the primitive variables, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Compute the preconditioner for convergence acceleration by Roe-Turkel method.
    * \param[in] iPoint - Index of the grid point
@@ -5065,6 +5222,14 @@ public:
    */
   void SetUndivided_Laplacian(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the undivided laplacian, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetUndivided_Laplacian(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Parallelization of Undivided Laplacian.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -5079,6 +5244,14 @@ public:
    */
   void SetMax_Eigenvalue(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the max eigenvalue, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetMax_Eigenvalue(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Parallelization of the Max eigenvalue.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -7145,6 +7318,12 @@ public:
    * \brief Destructor of the class.
    */
   virtual ~CIncEulerSolver(void);
+
+  /*!
+   * \brief The momentum (velocity) components are rotated across periodic boundaries.
+   * \return <code>TRUE</code>.
+   */
+  bool GetRotate_Periodic(void);
   
   /*!
    * \brief Impose the send-receive boundary condition.
@@ -7339,6 +7518,14 @@ public:
    */
   void SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the pressure sensor, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Parallelization of SetPressure_Sensor.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -7355,6 +7542,14 @@ public:
    */
   void SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Green-Gauss gradient of the primitive variables, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Compute the gradient of the primitive variables using a Least-Squares method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -7363,6 +7558,14 @@ public:
    */
   void SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Least-Squares gradient of the primitive variables, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Compute the gradient of the primitive variables using a Least-Squares method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -7378,6 +7581,14 @@ public:
    */
   void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the limiter of the primitive variables, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Compute the undivided laplacian for the solution, except the energy equation.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -7385,6 +7596,14 @@ public:
    */
   void SetUndivided_Laplacian(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the undivided laplacian, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetUndivided_Laplacian(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Parallelization of Undivided Laplacian.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -7399,6 +7618,14 @@ public:
    */
   void SetMax_Eigenvalue(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the max eigenvalue, optionally leaving the halo exchange to the caller.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_communicate - If false, the halo values are not exchanged (the caller will do it).
+   */
+  void SetMax_Eigenvalue(CGeometry *geometry, CConfig *config, bool val_communicate);
+  
   /*!
    * \brief Parallelization of the Max eigenvalue.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -13424,6 +13651,10 @@ protected:
 
   unsigned int sizeWorkArray;     /*!< \brief The size of the work array needed. */
 
+  unsigned short nThreadDG;                /*!< \brief Number of threads of the task list executor (1 if the tasks run serially). */
+  vector<CFluidModel *> ThreadFluidModel;  /*!< \brief Fluid model of each thread of the task list executor. Entry 0 is
+                                                       FluidModel, the others are private copies owned by the solver. */
+
   vector<su2double> TolSolADER;   /*!< \brief Vector, which stores the tolerances for the conserved
                                               variables in the ADER predictor step. */
 
@@ -14473,6 +14704,47 @@ protected:
    * \param[in] timeLevel - The time level for which the communication must be
                             initiated.
    */
+  /*!
+   * \brief Create the private copies of the dimensionless fluid model for the
+            additional threads of the task list executor.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetThreadFluidModels(CConfig *config);
+
+  /*!
+   * \brief Get the fluid model of the calling thread of the task list executor.
+            The fluid model stores the last thermodynamic state it computed, so the
+            element kernels, whose chunks may be treated concurrently, must use
+            this function instead of FluidModel.
+   * \return Pointer to the fluid model, FluidModel outside the threaded tasks.
+   */
+  CFluidModel* GetThreadFluidModel(void);
+
+  /*!
+   * \brief Function, which carries out a task of the list that operates on a
+            range of owned or halo elements. When several threads are available
+            the range is split in chunks of ELEM_CHUNK_SIZE_DGFEM elements, which
+            are distributed over the threads with work stealing, while the master
+            thread also progresses the outstanding MPI communication.
+   * \param[in] config     - Definition of the particular problem.
+   * \param[in] task       - The element task to be carried out.
+   * \param[in] elemBeg    - Begin index of the element range.
+   * \param[in] elemEnd    - End index (not included) of the element range.
+   * \param[in] workArrays - Work arrays of all threads, each of size sizeWorkArray.
+   */
+  void ElementRangeTask_DG(CConfig                            *config,
+                           const CTaskDefinition::SOLVER_TASK task,
+                           const unsigned long                elemBeg,
+                           const unsigned long                elemEnd,
+                           su2double                          *workArrays);
+
+  /*!
+   * \brief Routine that tests the outstanding non-blocking communication of
+            all time levels without completing it, such that the MPI library
+            can progress the messages while the other threads compute.
+   */
+  void Progress_MPI_Communication(void);
+
   void Initiate_MPI_Communication(CConfig *config,
                                   const unsigned short timeLevel);
 
@@ -39,6 +39,8 @@
 
 inline void CSolver::SetIterLinSolver(unsigned short val_iterlinsolver) { IterLinSolver = val_iterlinsolver; }
 
+inline unsigned short CSolver::GetnThread(void) { return nThread; }
+
 inline void CSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) { }
 
 inline void CSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) { }
@@ -73,6 +75,10 @@ inline void CSolver::SetNondimensionalization(CConfig *config, unsigned short iM
 
 inline unsigned short CSolver::GetIterLinSolver(void) { return IterLinSolver; }
 
+inline su2double CSolver::GetJacobian_Reuse_Rate(void) {
+  return (nIter_Jacobian > 0)? su2double(nReuse_Jacobian)/su2double(nIter_Jacobian) : 0.0;
+}
+
 inline su2double CSolver::GetCSensitivity(unsigned short val_marker, unsigned long val_vertex) { return 0; }
 
 inline void CSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep, 
@@ -434,6 +440,8 @@ inline su2double CSolver::GetTotal_OFVolFrac() { return 0; }
 
 inline bool CSolver::IsElementBased(void){ return false; }
 
+inline bool CSolver::GetRotate_Periodic(void){ return false; }
+
 inline void CSolver::AddTotal_ComboObj(su2double val_obj) {}
 
 inline void CSolver::SetTotal_CEquivArea(su2double val_cequivarea) { }
@@ -1185,6 +1193,8 @@ inline void CSolver::SetConjugateHeatVariable(unsigned short val_marker, unsigne
 
 inline su2double CSolver::GetConjugateHeatVariable(unsigned short val_marker, unsigned long val_vertex, unsigned short pos_var) { return 0.0; }
 
+inline bool CEulerSolver::GetRotate_Periodic(void) { return true; }
+
 inline su2double CEulerSolver::GetDensity_Inf(void) { return Density_Inf; }
 
 inline su2double CEulerSolver::GetModVelocity_Inf(void) { 
@@ -1763,6 +1773,11 @@ inline void CNSSolver::SetConjugateHeatVariable(unsigned short val_marker, unsig
 
 inline CFluidModel* CFEM_DG_EulerSolver::GetFluidModel(void) { return FluidModel;}
 
+inline CFluidModel* CFEM_DG_EulerSolver::GetThreadFluidModel(void) {
+  const unsigned short iThread = SU2_OMP_GetThreadID();
+  return (iThread < ThreadFluidModel.size()) ? ThreadFluidModel[iThread] : FluidModel;
+}
+
 inline su2double* CFEM_DG_EulerSolver::GetVecSolDOFs(void) {return VecSolDOFs.data();}
 
 inline unsigned long CFEM_DG_EulerSolver::GetnDOFsGlobal(void) {return nDOFsGlobal;}
@@ -1976,6 +1991,8 @@ inline su2double CSolver::Get_val_I(void){ return 0.0; }
 
 inline su2double CSolver::Get_MassMatrix(unsigned long iPoint, unsigned long jPoint, unsigned short iVar, unsigned short jVar){ return 0.0; }
 
+inline bool CIncEulerSolver::GetRotate_Periodic(void) { return true; }
+
 inline su2double CIncEulerSolver::GetDensity_Inf(void) { return Density_Inf; }
 
 inline su2double CIncEulerSolver::GetModVelocity_Inf(void) {
@@ -51,6 +51,67 @@
 
 using namespace std;
 
+/*!
+ * \brief Per-point fields that can be allocated in the contiguous storage of a solver.
+ */
+enum ENUM_VARIABLE_FIELD {
+  FIELD_SOLUTION           = 0,  /*!< \brief Solution. */
+  FIELD_SOLUTION_OLD       = 1,  /*!< \brief Solution old. */
+  FIELD_GRADIENT           = 2,  /*!< \brief Gradient of the solution. */
+  FIELD_LIMITER            = 3,  /*!< \brief Limiter of the solution. */
+  FIELD_PRIMITIVE          = 4,  /*!< \brief Primitive variables. */
+  FIELD_GRADIENT_PRIMITIVE = 5,  /*!< \brief Gradient of the primitive variables. */
+  FIELD_LIMITER_PRIMITIVE  = 6,  /*!< \brief Limiter of the primitive variables. */
+  N_VARIABLE_FIELDS        = 7   /*!< \brief Number of fields. */
+};
+
+/*!
+ * \class CVariableStorage
+ * \brief Contiguous storage of the per-point fields of a solver (structure of arrays).
+ *        Each field is one array over all the points of the grid (point-major, the
+ *        values of a point are consecutive). The CVariable objects of the solver are
+ *        created while the storage is active and take their fields from it, in the
+ *        order of the points.
+ * \author SU2 contributors.
+ */
+class CVariableStorage {
+protected:
+  unsigned long nPoint;                        /*!< \brief Number of points of the field arrays. */
+  unsigned long FieldSize[N_VARIABLE_FIELDS];  /*!< \brief Number of values per point of each field. */
+  su2double *Field[N_VARIABLE_FIELDS];         /*!< \brief Field arrays, NULL if the field is not stored. */
+  unsigned long NextPoint[N_VARIABLE_FIELDS];  /*!< \brief Next point to hand out of each field. */
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_npoint - Number of points of the grid.
+   */
+  CVariableStorage(unsigned long val_npoint);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CVariableStorage(void);
+  
+  /*!
+   * \brief Get the location of the values of one point in a field, the field is allocated on first use.
+   * \param[in] val_field - Field (see ENUM_VARIABLE_FIELD).
+   * \param[in] val_point - Index of the point.
+   * \param[in] val_size - Number of values per point, must be the same for all the points.
+   * \return Pointer to the first value of the point.
+   */
+  su2double *GetPointer(unsigned short val_field, unsigned long val_point, unsigned long val_size);
+  
+  /*!
+   * \brief Get the location of the values of the next point (in creation order) in a field.
+   * \param[in] val_field - Field (see ENUM_VARIABLE_FIELD).
+   * \param[in] val_size - Number of values per point, must be the same for all the points.
+   * \return Pointer to the first value of the point.
+   */
+  su2double *GetNextPointer(unsigned short val_field, unsigned long val_size);
+};
+
 /*!
  * \class CVariable
  * \brief Main class for defining the variables.
@@ -91,6 +152,25 @@ protected:
                                                        note that this variable cannnot be static, it is possible to
                                                        have different number of nVar in the same problem. */
   su2double *Solution_Adj_Old;    /*!< \brief Solution of the problem in the previous AD-BGS iteration. */
+  bool External_Storage;    /*!< \brief The main fields live in a CVariableStorage of the solver (not owned). */
+  static CVariableStorage *Construction_Storage;  /*!< \brief Storage used by the variables being created (NULL if none). */
+  
+  /*!
+   * \brief Allocate a per-point field, in the active contiguous storage if there is one.
+   * \param[in] val_field - Field (see ENUM_VARIABLE_FIELD).
+   * \param[in] val_size - Number of values of the field.
+   * \return Pointer to the values of this point.
+   */
+  su2double *AllocateField(unsigned short val_field, unsigned long val_size);
+  
+  /*!
+   * \brief Allocate a per-point matrix field (e.g. a gradient), in the active contiguous storage if there is one.
+   * \param[in] val_field - Field (see ENUM_VARIABLE_FIELD).
+   * \param[in] val_nrow - Number of rows.
+   * \param[in] val_ncol - Number of columns.
+   * \return Row pointers of the matrix of this point.
+   */
+  su2double **AllocateFieldMatrix(unsigned short val_field, unsigned short val_nrow, unsigned short val_ncol);
   
 public:
   
@@ -119,6 +199,14 @@ public:
    */
   virtual ~CVariable(void);
   
+  /*!
+   * \brief Make the variables created from now on take their main fields (solution, old solution,
+   *        gradient, limiter and primitive variables) from a contiguous storage. The points must
+   *        be created in order, and the storage must be reset to NULL once they are.
+   * \param[in] storage - Contiguous storage of the solver, NULL to allocate the fields per point.
+   */
+  static void SetConstructionStorage(CVariableStorage *storage);
+  
   /*!
    * \brief Set the value of the solution.
    * \param[in] val_solution - Solution of the problem.
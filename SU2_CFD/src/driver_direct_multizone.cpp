@@ -161,32 +161,49 @@ void CMultizoneDriver::StartSolver() {
   if (driver_config->GetRestart())
     TimeIter = driver_config->GetRestart_Iter();
 
+  CConfig *config = config_container[ZONE_0];
+  double tick_iter = 0.0, tick = 0.0;
+
   /*--- Run the problem until the number of time iterations required is reached. ---*/
   while ( TimeIter < driver_config->GetnTime_Iter() ) {
 
+    config->Tick(&tick_iter, PROFILE_ITERATION);
+
     /*--- Perform some preprocessing before starting the time-step simulation. ---*/
 
+    config->Tick(&tick, PROFILE_PREPROCESS);
     Preprocess(TimeIter);
+    config->Tock(tick, PROFILE_PREPROCESS);
 
     /*--- Run a block iteration of the multizone problem. ---*/
 
+    config->Tick(&tick, PROFILE_RUN);
     switch (driver_config->GetKind_MZSolver()){
       case MZ_BLOCK_GAUSS_SEIDEL: Run_GaussSeidel(); break;  // Block Gauss-Seidel iteration
       case MZ_BLOCK_JACOBI: Run_Jacobi(); break;             // Block-Jacobi iteration
       default: Run_GaussSeidel(); break;
     }
+    config->Tock(tick, PROFILE_RUN);
 
     /*--- Update the solution for dual time stepping strategy ---*/
 
+    config->Tick(&tick, PROFILE_UPDATE);
     Update();
+    config->Tock(tick, PROFILE_UPDATE);
 
     /*--- Monitor the computations after each iteration. ---*/
 
+    config->Tick(&tick, PROFILE_MONITOR);
     Monitor(TimeIter);
+    config->Tock(tick, PROFILE_MONITOR);
 
     /*--- Output the solution in files. ---*/
 
+    config->Tick(&tick, PROFILE_OUTPUT);
     Output(TimeIter);
+    config->Tock(tick, PROFILE_OUTPUT);
+
+    config->Tock(tick_iter, PROFILE_ITERATION);
 
     /*--- If the convergence criteria has been met, terminate the simulation. ---*/
 
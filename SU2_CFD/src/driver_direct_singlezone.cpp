@@ -75,28 +75,45 @@ void CSinglezoneDriver::StartSolver() {
   if (config_container[ZONE_0]->GetRestart())
     TimeIter = config_container[ZONE_0]->GetRestart_Iter();
 
+  CConfig *config = config_container[ZONE_0];
+  double tick_iter = 0.0, tick = 0.0;
+
   /*--- Run the problem until the number of time iterations required is reached. ---*/
   while ( TimeIter < config_container[ZONE_0]->GetnTime_Iter() ) {
 
+    config->Tick(&tick_iter, PROFILE_ITERATION);
+
     /*--- Perform some preprocessing before starting the time-step simulation. ---*/
 
+    config->Tick(&tick, PROFILE_PREPROCESS);
     Preprocess(TimeIter);
+    config->Tock(tick, PROFILE_PREPROCESS);
 
     /*--- Run a time-step iteration of the single-zone problem. ---*/
 
+    config->Tick(&tick, PROFILE_RUN);
     Run();
+    config->Tock(tick, PROFILE_RUN);
 
     /*--- Update the solution for dual time stepping strategy ---*/
 
+    config->Tick(&tick, PROFILE_UPDATE);
     Update();
+    config->Tock(tick, PROFILE_UPDATE);
 
     /*--- Monitor the computations after each iteration. ---*/
 
+    config->Tick(&tick, PROFILE_MONITOR);
     Monitor(TimeIter);
+    config->Tock(tick, PROFILE_MONITOR);
 
     /*--- Output the solution in files. ---*/
 
+    config->Tick(&tick, PROFILE_OUTPUT);
     Output(TimeIter);
+    config->Tock(tick, PROFILE_OUTPUT);
+
+    config->Tock(tick_iter, PROFILE_ITERATION);
 
     /*--- If the convergence criteria has been met, terminate the simulation. ---*/
 
@@ -49,7 +49,7 @@ CDriver::CDriver(char* confFile,
                  SU2_Comm MPICommunicator):config_file_name(confFile), StartTime(0.0), StopTime(0.0), UsedTime(0.0), ExtIter(0), nZone(val_nZone), nDim(val_nDim), StopCalc(false), fsi(false), fem_solver(false) {
 
 
-  unsigned short jZone, iSol;
+  unsigned short jZone, iSol, iThread;
   unsigned short Kind_Grid_Movement;
   bool initStaticMovement;
 
@@ -78,6 +78,8 @@ CDriver::CDriver(char* confFile,
   geometry_container             = NULL;
   solver_container               = NULL;
   numerics_container             = NULL;
+  numerics_thread                = NULL;
+  nThread_Numerics               = 0;
   config_container               = NULL;
   surface_movement               = NULL;
   grid_movement                  = NULL;
@@ -94,6 +96,7 @@ CDriver::CDriver(char* confFile,
   solver_container               = new CSolver****[nZone];
   integration_container          = new CIntegration***[nZone];
   numerics_container             = new CNumerics*****[nZone];
+  numerics_thread                = new CNumerics*****[nZone];
   config_container               = new CConfig*[nZone];
   geometry_container             = new CGeometry***[nZone];
   surface_movement               = new CSurfaceMovement*[nZone];
@@ -110,6 +113,7 @@ CDriver::CDriver(char* confFile,
     solver_container[iZone]               = NULL;
     integration_container[iZone]          = NULL;
     numerics_container[iZone]             = NULL;
+    numerics_thread[iZone]                = NULL;
     config_container[iZone]               = NULL;
     geometry_container[iZone]             = NULL;
     surface_movement[iZone]               = NULL;
@@ -126,6 +130,10 @@ CDriver::CDriver(char* confFile,
 
   Input_Preprocessing(MPICommunicator, val_periodic);
 
+  /*--- Initialize the profiler, the regions are timed only with PROFILING= YES. ---*/
+
+  config_container[ZONE_0]->InitProfiling();
+
   /*--- Preprocessing of the geometry for all zones. In this routine, the edge-
    based data structure is constructed, i.e. node and cell neighbors are
    identified and linked, face areas and volumes of the dual mesh cells are
@@ -346,6 +354,26 @@ CDriver::CDriver(char* confFile,
 
     if (rank == MASTER_NODE) cout << "Numerics Preprocessing." << endl;
 
+    /*--- Private copies of the numerics for the additional threads of the
+     colored (threaded) edge loops of the flow solver. ---*/
+
+    if (Threaded_EdgeLoops(config_container[iZone])) {
+      nThread_Numerics = SU2_OMP_GetMaxThreads();
+      numerics_thread[iZone] = new CNumerics****[nThread_Numerics];
+      numerics_thread[iZone][0] = NULL;
+      for (iThread = 1; iThread < nThread_Numerics; iThread++) {
+        numerics_thread[iZone][iThread] = new CNumerics***[nInst[iZone]];
+        for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+          numerics_thread[iZone][iThread][iInst] = new CNumerics**[config_container[iZone]->GetnMGLevels()+1];
+          Numerics_ThreadPreprocessing(numerics_thread[iZone][iThread][iInst], solver_container[iZone],
+              geometry_container[iZone], config_container[iZone], iInst);
+          for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++)
+            solver_container[iZone][iInst][iMesh][FLOW_SOL]->SetThreadNumerics(iThread, numerics_thread[iZone][iThread][iInst][iMesh]);
+        }
+      }
+      if (rank == MASTER_NODE) cout << "Thread-private numerics for " << nThread_Numerics << " threads." << endl;
+    }
+
   }
 
   /*--- Definition of the interface and transfer conditions between different zones.
@@ -555,6 +583,7 @@ CDriver::CDriver(char* confFile,
 
 void CDriver::Postprocessing() {
 
+  unsigned short iThread;
   bool isBinary = config_container[ZONE_0]->GetWrt_Binary_Restart();
   bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
   
@@ -589,8 +618,19 @@ void CDriver::Postprocessing() {
           geometry_container[iZone][iInst], config_container[iZone], iInst);
     }
     delete [] numerics_container[iZone];
+    if (numerics_thread[iZone] != NULL) {
+      for (iThread = 1; iThread < nThread_Numerics; iThread++) {
+        for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+          Numerics_ThreadPostprocessing(numerics_thread[iZone][iThread][iInst], config_container[iZone]);
+          delete [] numerics_thread[iZone][iThread][iInst];
+        }
+        delete [] numerics_thread[iZone][iThread];
+      }
+      delete [] numerics_thread[iZone];
+    }
   }
   delete [] numerics_container;
+  delete [] numerics_thread;
   if (rank == MASTER_NODE) cout << "Deleted CNumerics container." << endl;
   
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -691,9 +731,7 @@ void CDriver::Postprocessing() {
   delete [] grid_movement;
   if (rank == MASTER_NODE) cout << "Deleted CVolumetricMovement class." << endl;
 
-  /*--- Output profiling information ---*/
-  // Note that for now this is called only by a single thread, but all
-  // necessary variables have been made thread private for safety (tick/tock)!!
+  /*--- Output profiling information, only the master thread times the regions. ---*/
 
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
@@ -930,15 +968,32 @@ void CDriver::Geometrical_Preprocessing() {
       if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
       geometry_container[iZone][iInst][MESH_0]->SetPoint_Connectivity();
 
-      /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+      /*--- Local renumbering of the points, before the edges and the Jacobian
+       structure are built, to improve the memory locality of the edge loops. ---*/
 
-      if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-      geometry_container[iZone][iInst][MESH_0]->SetRCM_Ordering(config_container[iZone]);
+      switch (config_container[iZone]->GetKind_Renumbering()) {
+        case LEGACY_RCM_RENUMBERING: case RCM_RENUMBERING:
+          if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+          geometry_container[iZone][iInst][MESH_0]->SetRCM_Ordering(config_container[iZone]);
+          break;
+        case HILBERT_RENUMBERING:
+          if (rank == MASTER_NODE) cout << "Renumbering points (Hilbert space-filling curve)." << endl;
+          geometry_container[iZone][iInst][MESH_0]->SetHilbert_Ordering(config_container[iZone]);
+          break;
+      }
 
       /*--- recompute elements surrounding points, points surrounding points ---*/
 
-      if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
-      geometry_container[iZone][iInst][MESH_0]->SetPoint_Connectivity();
+      if (config_container[iZone]->GetKind_Renumbering() != NO_RENUMBERING) {
+        if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
+        geometry_container[iZone][iInst][MESH_0]->SetPoint_Connectivity();
+      }
+
+      /*--- Number the edges in the order of the points (new orderings only). ---*/
+
+      if ((config_container[iZone]->GetKind_Renumbering() == RCM_RENUMBERING) ||
+          (config_container[iZone]->GetKind_Renumbering() == HILBERT_RENUMBERING))
+        geometry_container[iZone][iInst][MESH_0]->SortPoint_Connectivity();
 
       /*--- Compute elements surrounding elements ---*/
 
@@ -1064,6 +1119,32 @@ void CDriver::Geometrical_Preprocessing() {
 
   }
 
+  /*--- Build the point-to-point (halo exchange) communication pattern
+   once for each grid level, it is shared by all the solvers of a zone. ---*/
+
+  if (rank == MASTER_NODE) cout << "Preprocessing the point-to-point MPI communications." << endl;
+  for (iZone = 0; iZone < nZone; iZone++) {
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+      for (iMGlevel = 0; iMGlevel <= config_container[iZone]->GetnMGLevels(); iMGlevel++) {
+        geometry_container[iZone][iInst][iMGlevel]->PreprocessP2PComms(config_container[iZone]);
+      }
+    }
+  }
+
+  /*--- Color the edges of every grid for the threaded edge loops of the flow solver. ---*/
+
+  if (SU2_OMP_GetMaxThreads() > 1) {
+    if (rank == MASTER_NODE) cout << "Coloring the edges for " << SU2_OMP_GetMaxThreads() << " threads." << endl;
+    for (iZone = 0; iZone < nZone; iZone++) {
+      if (!Threaded_EdgeLoops(config_container[iZone])) continue;
+      for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+        for (iMGlevel = 0; iMGlevel <= config_container[iZone]->GetnMGLevels(); iMGlevel++) {
+          geometry_container[iZone][iInst][iMGlevel]->SetEdgeColoring();
+        }
+      }
+    }
+  }
+
   /*--- For unsteady simulations, initialize the grid volumes
    and coordinates for previous solutions. Loop over all zones/grids ---*/
 
@@ -1960,8 +2041,6 @@ void CDriver::Numerics_Preprocessing(CNumerics *****numerics_container,
   
   bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
-  bool ideal_gas = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS );
-  bool roe_low_dissipation = config->GetKind_RoeLowDiss() != NO_ROELOWDISS;
   
   /*--- Initialize some useful booleans ---*/
   euler            = false; ns     = false; turbulent     = false;
@@ -2078,213 +2157,10 @@ void CDriver::Numerics_Preprocessing(CNumerics *****numerics_container,
   /*--- Solver definition for the Potential, Euler, Navier-Stokes problems ---*/
   if ((euler) || (ns)) {
     
-    /*--- Definition of the convective scheme for each equation and mesh level ---*/
-    switch (config->GetKind_ConvNumScheme_Flow()) {
-      case NO_CONVECTIVE :
-        SU2_MPI::Error("No convective scheme.", CURRENT_FUNCTION);
-        break;
-        
-      case SPACE_CENTERED :
-        if (compressible) {
-          /*--- Compressible flow ---*/
-          switch (config->GetKind_Centered_Flow()) {
-            case NO_CENTERED : cout << "No centered scheme." << endl; break;
-            case LAX : numerics_container[val_iInst][MESH_0][FLOW_SOL][CONV_TERM] = new CCentLax_Flow(nDim, nVar_Flow, config); break;
-            case JST : numerics_container[val_iInst][MESH_0][FLOW_SOL][CONV_TERM] = new CCentJST_Flow(nDim, nVar_Flow, config); break;
-            case JST_KE : numerics_container[val_iInst][MESH_0][FLOW_SOL][CONV_TERM] = new CCentJST_KE_Flow(nDim, nVar_Flow, config); break;
-            default : SU2_MPI::Error("Centered scheme not implemented.", CURRENT_FUNCTION); break;
-          }
-          
-          for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-            numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CCentLax_Flow(nDim, nVar_Flow, config);
-          
-          /*--- Definition of the boundary condition method ---*/
-          for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-            numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwRoe_Flow(nDim, nVar_Flow, config, false);
-          
-        }
-        if (incompressible) {
-          /*--- Incompressible flow, use preconditioning method ---*/
-          switch (config->GetKind_Centered_Flow()) {
-            case NO_CENTERED : cout << "No centered scheme." << endl; break;
-            case LAX : numerics_container[val_iInst][MESH_0][FLOW_SOL][CONV_TERM] = new CCentLaxInc_Flow(nDim, nVar_Flow, config); break;
-            case JST : numerics_container[val_iInst][MESH_0][FLOW_SOL][CONV_TERM] = new CCentJSTInc_Flow(nDim, nVar_Flow, config); break;
-            default : SU2_MPI::Error("Centered scheme not implemented.\n Currently, only JST and LAX-FRIEDRICH are available for incompressible flows.", CURRENT_FUNCTION); break;
-          }
-          for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-            numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CCentLaxInc_Flow(nDim, nVar_Flow, config);
-          
-          /*--- Definition of the boundary condition method ---*/
-          for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-            numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwFDSInc_Flow(nDim, nVar_Flow, config);
-          
-        }
-        break;
-      case SPACE_UPWIND :
-        if (compressible) {
-          /*--- Compressible flow ---*/
-          switch (config->GetKind_Upwind_Flow()) {
-            case NO_UPWIND : cout << "No upwind scheme." << endl; break;
-            case ROE:
-              if (ideal_gas) {
-                
-                for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                  numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwRoe_Flow(nDim, nVar_Flow, config, roe_low_dissipation);
-                  numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwRoe_Flow(nDim, nVar_Flow, config, false);
-                }
-              } else {
-                
-                for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                  numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwGeneralRoe_Flow(nDim, nVar_Flow, config);
-                  numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwGeneralRoe_Flow(nDim, nVar_Flow, config);
-                }
-              }
-              break;
-              
-            case AUSM:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwAUSM_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwAUSM_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-
-	    case AUSMPLUSUP:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwAUSMPLUSUP_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwAUSMPLUSUP_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-
-	    case AUSMPLUSUP2:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwAUSMPLUSUP2_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwAUSMPLUSUP2_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-              
-            case TURKEL:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwTurkel_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwTurkel_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-                  
-            case L2ROE:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwL2Roe_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwL2Roe_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-            case LMROE:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwLMRoe_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwLMRoe_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-
-            case SLAU:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwSLAU_Flow(nDim, nVar_Flow, config, roe_low_dissipation);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwSLAU_Flow(nDim, nVar_Flow, config, false);
-              }
-              break;
-              
-            case SLAU2:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwSLAU2_Flow(nDim, nVar_Flow, config, roe_low_dissipation);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwSLAU2_Flow(nDim, nVar_Flow, config, false);
-              }
-              break;
-              
-            case HLLC:
-              if (ideal_gas) {
-                for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                  numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwHLLC_Flow(nDim, nVar_Flow, config);
-                  numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwHLLC_Flow(nDim, nVar_Flow, config);
-                }
-              }
-              else {
-                for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                  numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwGeneralHLLC_Flow(nDim, nVar_Flow, config);
-                  numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwGeneralHLLC_Flow(nDim, nVar_Flow, config);
-                }
-              }
-              break;
-              
-            case MSW:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwMSW_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwMSW_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-              
-            case CUSP:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwCUSP_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwCUSP_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-              
-            default : SU2_MPI::Error("Upwind scheme not implemented.", CURRENT_FUNCTION); break;
-          }
-          
-        }
-        if (incompressible) {
-          /*--- Incompressible flow, use artificial compressibility method ---*/
-          switch (config->GetKind_Upwind_Flow()) {
-            case NO_UPWIND : cout << "No upwind scheme." << endl; break;
-            case FDS:
-              for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_TERM] = new CUpwFDSInc_Flow(nDim, nVar_Flow, config);
-                numerics_container[val_iInst][iMGlevel][FLOW_SOL][CONV_BOUND_TERM] = new CUpwFDSInc_Flow(nDim, nVar_Flow, config);
-              }
-              break;
-            default : SU2_MPI::Error("Upwind scheme not implemented.\n Currently, only FDS is available for incompressible flows.", CURRENT_FUNCTION); break;
-          }
-        }
-        break;
-        
-      default :
-        SU2_MPI::Error("Convective scheme not implemented (Euler and Navier-Stokes).", CURRENT_FUNCTION);
-        break;
-    }
-    
-    /*--- Definition of the viscous scheme for each equation and mesh level ---*/
-    if (compressible) {
-      if (ideal_gas) {
-        
-        /*--- Compressible flow Ideal gas ---*/
-        numerics_container[val_iInst][MESH_0][FLOW_SOL][VISC_TERM] = new CAvgGrad_Flow(nDim, nVar_Flow, true, config);
-        for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-          numerics_container[val_iInst][iMGlevel][FLOW_SOL][VISC_TERM] = new CAvgGrad_Flow(nDim, nVar_Flow, false, config);
-        
-        /*--- Definition of the boundary condition method ---*/
-        for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-          numerics_container[val_iInst][iMGlevel][FLOW_SOL][VISC_BOUND_TERM] = new CAvgGrad_Flow(nDim, nVar_Flow, false, config);
-        
-      } else {
-        
-        /*--- Compressible flow Realgas ---*/
-        numerics_container[val_iInst][MESH_0][FLOW_SOL][VISC_TERM] = new CGeneralAvgGrad_Flow(nDim, nVar_Flow, true, config);
-        for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-          numerics_container[val_iInst][iMGlevel][FLOW_SOL][VISC_TERM] = new CGeneralAvgGrad_Flow(nDim, nVar_Flow, false, config);
-        
-        /*--- Definition of the boundary condition method ---*/
-        for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-          numerics_container[val_iInst][iMGlevel][FLOW_SOL][VISC_BOUND_TERM] = new CGeneralAvgGrad_Flow(nDim, nVar_Flow, false, config);
-        
-      }
-    }
-    if (incompressible) {
-      /*--- Incompressible flow, use preconditioning method ---*/
-      numerics_container[val_iInst][MESH_0][FLOW_SOL][VISC_TERM] = new CAvgGradInc_Flow(nDim, nVar_Flow, true, config);
-      for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-        numerics_container[val_iInst][iMGlevel][FLOW_SOL][VISC_TERM] = new CAvgGradInc_Flow(nDim, nVar_Flow, false, config);
-      
-      /*--- Definition of the boundary condition method ---*/
-      for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-        numerics_container[val_iInst][iMGlevel][FLOW_SOL][VISC_BOUND_TERM] = new CAvgGradInc_Flow(nDim, nVar_Flow, false, config);
-    }
+    /*--- Definition of the convective and viscous schemes (with their boundary
+     condition methods) for each mesh level ---*/
+    for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
+      Numerics_FlowPreprocessing(numerics_container[val_iInst][iMGlevel][FLOW_SOL], config, iMGlevel, nDim, nVar_Flow, true, true);
     
     /*--- Definition of the source term integration scheme for each equation and mesh level ---*/
     for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
@@ -2759,6 +2635,203 @@ void CDriver::Numerics_Preprocessing(CNumerics *****numerics_container,
 
 }
 
+void CDriver::Numerics_FlowPreprocessing(CNumerics **numerics, CConfig *config, unsigned short iMGlevel,
+                                         unsigned short nDim, unsigned short nVar_Flow, bool visc_term, bool bound_terms) {
+
+  bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
+  bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
+  bool ideal_gas = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS );
+  bool roe_low_dissipation = config->GetKind_RoeLowDiss() != NO_ROELOWDISS;
+  bool fine_grid = (iMGlevel == MESH_0);
+
+  /*--- Definition of the convective scheme ---*/
+  switch (config->GetKind_ConvNumScheme_Flow()) {
+    case NO_CONVECTIVE :
+      SU2_MPI::Error("No convective scheme.", CURRENT_FUNCTION);
+      break;
+
+    case SPACE_CENTERED :
+      if (compressible) {
+        /*--- Compressible flow, the coarse levels use the Lax scheme ---*/
+        if (fine_grid) {
+          switch (config->GetKind_Centered_Flow()) {
+            case NO_CENTERED : cout << "No centered scheme." << endl; break;
+            case LAX : numerics[CONV_TERM] = new CCentLax_Flow(nDim, nVar_Flow, config); break;
+            case JST : numerics[CONV_TERM] = new CCentJST_Flow(nDim, nVar_Flow, config); break;
+            case JST_KE : numerics[CONV_TERM] = new CCentJST_KE_Flow(nDim, nVar_Flow, config); break;
+            default : SU2_MPI::Error("Centered scheme not implemented.", CURRENT_FUNCTION); break;
+          }
+        }
+        else numerics[CONV_TERM] = new CCentLax_Flow(nDim, nVar_Flow, config);
+
+        /*--- Definition of the boundary condition method ---*/
+        if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwRoe_Flow(nDim, nVar_Flow, config, false);
+      }
+      if (incompressible) {
+        /*--- Incompressible flow, use preconditioning method ---*/
+        if (fine_grid) {
+          switch (config->GetKind_Centered_Flow()) {
+            case NO_CENTERED : cout << "No centered scheme." << endl; break;
+            case LAX : numerics[CONV_TERM] = new CCentLaxInc_Flow(nDim, nVar_Flow, config); break;
+            case JST : numerics[CONV_TERM] = new CCentJSTInc_Flow(nDim, nVar_Flow, config); break;
+            default : SU2_MPI::Error("Centered scheme not implemented.\n Currently, only JST and LAX-FRIEDRICH are available for incompressible flows.", CURRENT_FUNCTION); break;
+          }
+        }
+        else numerics[CONV_TERM] = new CCentLaxInc_Flow(nDim, nVar_Flow, config);
+
+        /*--- Definition of the boundary condition method ---*/
+        if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwFDSInc_Flow(nDim, nVar_Flow, config);
+      }
+      break;
+
+    case SPACE_UPWIND :
+      if (compressible) {
+        /*--- Compressible flow, the boundary condition method uses the same scheme ---*/
+        switch (config->GetKind_Upwind_Flow()) {
+          case NO_UPWIND : if (fine_grid) cout << "No upwind scheme." << endl; break;
+          case ROE:
+            if (ideal_gas) {
+              numerics[CONV_TERM] = new CUpwRoe_Flow(nDim, nVar_Flow, config, roe_low_dissipation);
+              if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwRoe_Flow(nDim, nVar_Flow, config, false);
+            } else {
+              numerics[CONV_TERM] = new CUpwGeneralRoe_Flow(nDim, nVar_Flow, config);
+              if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwGeneralRoe_Flow(nDim, nVar_Flow, config);
+            }
+            break;
+          case AUSM:
+            numerics[CONV_TERM] = new CUpwAUSM_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwAUSM_Flow(nDim, nVar_Flow, config);
+            break;
+          case AUSMPLUSUP:
+            numerics[CONV_TERM] = new CUpwAUSMPLUSUP_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwAUSMPLUSUP_Flow(nDim, nVar_Flow, config);
+            break;
+          case AUSMPLUSUP2:
+            numerics[CONV_TERM] = new CUpwAUSMPLUSUP2_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwAUSMPLUSUP2_Flow(nDim, nVar_Flow, config);
+            break;
+          case TURKEL:
+            numerics[CONV_TERM] = new CUpwTurkel_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwTurkel_Flow(nDim, nVar_Flow, config);
+            break;
+          case L2ROE:
+            numerics[CONV_TERM] = new CUpwL2Roe_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwL2Roe_Flow(nDim, nVar_Flow, config);
+            break;
+          case LMROE:
+            numerics[CONV_TERM] = new CUpwLMRoe_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwLMRoe_Flow(nDim, nVar_Flow, config);
+            break;
+          case SLAU:
+            numerics[CONV_TERM] = new CUpwSLAU_Flow(nDim, nVar_Flow, config, roe_low_dissipation);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwSLAU_Flow(nDim, nVar_Flow, config, false);
+            break;
+          case SLAU2:
+            numerics[CONV_TERM] = new CUpwSLAU2_Flow(nDim, nVar_Flow, config, roe_low_dissipation);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwSLAU2_Flow(nDim, nVar_Flow, config, false);
+            break;
+          case HLLC:
+            if (ideal_gas) {
+              numerics[CONV_TERM] = new CUpwHLLC_Flow(nDim, nVar_Flow, config);
+              if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwHLLC_Flow(nDim, nVar_Flow, config);
+            }
+            else {
+              numerics[CONV_TERM] = new CUpwGeneralHLLC_Flow(nDim, nVar_Flow, config);
+              if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwGeneralHLLC_Flow(nDim, nVar_Flow, config);
+            }
+            break;
+          case MSW:
+            numerics[CONV_TERM] = new CUpwMSW_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwMSW_Flow(nDim, nVar_Flow, config);
+            break;
+          case CUSP:
+            numerics[CONV_TERM] = new CUpwCUSP_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwCUSP_Flow(nDim, nVar_Flow, config);
+            break;
+          default : SU2_MPI::Error("Upwind scheme not implemented.", CURRENT_FUNCTION); break;
+        }
+      }
+      if (incompressible) {
+        /*--- Incompressible flow, use artificial compressibility method ---*/
+        switch (config->GetKind_Upwind_Flow()) {
+          case NO_UPWIND : if (fine_grid) cout << "No upwind scheme." << endl; break;
+          case FDS:
+            numerics[CONV_TERM] = new CUpwFDSInc_Flow(nDim, nVar_Flow, config);
+            if (bound_terms) numerics[CONV_BOUND_TERM] = new CUpwFDSInc_Flow(nDim, nVar_Flow, config);
+            break;
+          default : SU2_MPI::Error("Upwind scheme not implemented.\n Currently, only FDS is available for incompressible flows.", CURRENT_FUNCTION); break;
+        }
+      }
+      break;
+
+    default :
+      SU2_MPI::Error("Convective scheme not implemented (Euler and Navier-Stokes).", CURRENT_FUNCTION);
+      break;
+  }
+
+  /*--- Definition of the viscous scheme, only the finest grid uses the corrected gradients ---*/
+  if (compressible) {
+    if (ideal_gas) {
+      /*--- Compressible flow Ideal gas ---*/
+      if (visc_term) numerics[VISC_TERM] = new CAvgGrad_Flow(nDim, nVar_Flow, fine_grid, config);
+      if (bound_terms) numerics[VISC_BOUND_TERM] = new CAvgGrad_Flow(nDim, nVar_Flow, false, config);
+    } else {
+      /*--- Compressible flow Realgas ---*/
+      if (visc_term) numerics[VISC_TERM] = new CGeneralAvgGrad_Flow(nDim, nVar_Flow, fine_grid, config);
+      if (bound_terms) numerics[VISC_BOUND_TERM] = new CGeneralAvgGrad_Flow(nDim, nVar_Flow, false, config);
+    }
+  }
+  if (incompressible) {
+    /*--- Incompressible flow, use preconditioning method ---*/
+    if (visc_term) numerics[VISC_TERM] = new CAvgGradInc_Flow(nDim, nVar_Flow, fine_grid, config);
+    if (bound_terms) numerics[VISC_BOUND_TERM] = new CAvgGradInc_Flow(nDim, nVar_Flow, false, config);
+  }
+
+}
+
+void CDriver::Numerics_ThreadPreprocessing(CNumerics ***numerics, CSolver ****solver_container, CGeometry ***geometry,
+                                           CConfig *config, unsigned short val_iInst) {
+
+  unsigned short iMGlevel, iTerm;
+  unsigned short nMGlevels = config->GetnMGLevels();
+  unsigned short nDim      = geometry[val_iInst][MESH_0]->GetnDim();
+  unsigned short nVar_Flow = solver_container[val_iInst][MESH_0][FLOW_SOL]->GetnVar();
+  bool viscous = config->GetViscous();
+
+  /*--- Only the terms evaluated in the edge loops are duplicated, the boundary
+   and source terms are always evaluated by the master thread. ---*/
+
+  for (iMGlevel = 0; iMGlevel <= nMGlevels; iMGlevel++) {
+    numerics[iMGlevel] = new CNumerics* [MAX_TERMS];
+    for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+      numerics[iMGlevel][iTerm] = NULL;
+
+    Numerics_FlowPreprocessing(numerics[iMGlevel], config, iMGlevel, nDim, nVar_Flow, viscous, false);
+  }
+
+}
+
+void CDriver::Numerics_ThreadPostprocessing(CNumerics ***numerics, CConfig *config) {
+
+  unsigned short iMGlevel, iTerm;
+
+  for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+    for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+      if (numerics[iMGlevel][iTerm] != NULL) delete numerics[iMGlevel][iTerm];
+    delete [] numerics[iMGlevel];
+  }
+
+}
+
+bool CDriver::Threaded_EdgeLoops(CConfig *config) {
+
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  bool flow = ((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS));
+
+  return (flow && (config->GetKind_Regime() == COMPRESSIBLE) && (SU2_OMP_GetMaxThreads() > 1));
+
+}
+
 void CDriver::Numerics_Postprocessing(CNumerics *****numerics_container,
                                       CSolver ***solver_container, CGeometry **geometry,
                                       CConfig *config, unsigned short val_iInst) {
@@ -3768,10 +3841,16 @@ void CDriver::StartSolver(){
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
 
+  CConfig *config = config_container[ZONE_0];
+  double tick_iter = 0.0, tick = 0.0;
+
   while ( ExtIter < config_container[ZONE_0]->GetnExtIter() ) {
 
+    config->Tick(&tick_iter, PROFILE_ITERATION);
+
     /*--- Perform some external iteration preprocessing. ---*/
 
+    config->Tick(&tick, PROFILE_PREPROCESS);
     PreprocessExtIter(ExtIter);
 
     /*--- Perform a dynamic mesh update if required. ---*/
@@ -3779,25 +3858,39 @@ void CDriver::StartSolver(){
       if (!fem_solver) {
         DynamicMeshUpdate(ExtIter);
       }
+    config->Tock(tick, PROFILE_PREPROCESS);
 
     /*--- Run a single iteration of the problem (fluid, elasticity, heat, ...). ---*/
 
+    config->Tick(&tick, PROFILE_RUN);
     Run();
+    config->Tock(tick, PROFILE_RUN);
 
     /*--- Update the solution for dual time stepping strategy ---*/
 
+    config->Tick(&tick, PROFILE_UPDATE);
     Update();
+    config->Tock(tick, PROFILE_UPDATE);
 
     /*--- Terminate the simulation if only the Jacobian must be computed. ---*/
-    if (config_container[ZONE_0]->GetJacobian_Spatial_Discretization_Only()) break;
+    if (config_container[ZONE_0]->GetJacobian_Spatial_Discretization_Only()) {
+      config->Tock(tick_iter, PROFILE_ITERATION);
+      break;
+    }
 
     /*--- Monitor the computations after each iteration. ---*/
 
+    config->Tick(&tick, PROFILE_MONITOR);
     Monitor(ExtIter);
+    config->Tock(tick, PROFILE_MONITOR);
 
     /*--- Output the solution in files. ---*/
 
+    config->Tick(&tick, PROFILE_OUTPUT);
     Output(ExtIter);
+    config->Tock(tick, PROFILE_OUTPUT);
+
+    config->Tock(tick_iter, PROFILE_ITERATION);
 
     /*--- If the convergence criteria has been met, terminate the simulation. ---*/
 
@@ -4667,6 +4760,13 @@ void CDiscAdjFluidDriver::SetRecording(unsigned short kind_recording){
 
   AD::StopRecording();
 
+  /*--- Report the size of the tape of the first recording of the flow variables ---*/
+
+  if (rank == MASTER_NODE && (ExtIter == 0) && (kind_recording == FLOW_CONS_VARS) &&
+      config_container[ZONE_0]->GetWrt_AD_Statistics()) {
+    AD::PrintStatistics();
+  }
+
 }
 
 void CDiscAdjFluidDriver::SetAdj_ObjFunction(){
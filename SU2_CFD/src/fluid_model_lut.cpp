@@ -0,0 +1,604 @@
+/*!
+ * fluid_model_lut.cpp
+ * \brief Source of the look-up table (tabulated) fluid model.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "./../include/fluid_model.hpp"
+#include <unordered_map>
+#include <limits>
+#include <cstdio>
+
+CLookUpTable2D::CLookUpTable2D(void) {
+
+  nField = 0;
+  logX = false; logY = false;
+  xMin = 0.0; xMax = 1.0; yMin = 0.0; yMax = 1.0;
+  nRootX = 0; nRootY = 0;
+}
+
+void CLookUpTable2D::Build(unsigned short val_nField, unsigned short nErrorField, bool val_logX, bool val_logY,
+                           passivedouble x0, passivedouble x1, passivedouble y0, passivedouble y1,
+                           unsigned long val_nRoot, unsigned short maxLevel, passivedouble tolerance,
+                           const function<void(passivedouble, passivedouble, passivedouble*)> &func) {
+
+  nField = val_nField;
+  logX = val_logX; logY = val_logY;
+  xMin = logX? log(x0) : x0;  xMax = logX? log(x1) : x1;
+  yMin = logY? log(y0) : y0;  yMax = logY? log(y1) : y1;
+  nRootX = val_nRoot; nRootY = val_nRoot;
+
+  Tree.clear(); LeafNodes.clear(); NodeData.clear();
+
+  /*--- The nodes are identified by their integer coordinates on the finest
+   level, such that the corners shared by neighboring cells are evaluated once. ---*/
+
+  const unsigned long nFine  = 1ul << maxLevel;
+  const unsigned long nNodeY = nRootY*nFine + 1;
+  const passivedouble dxFine = (xMax-xMin)/(nRootX*nFine);
+  const passivedouble dyFine = (yMax-yMin)/(nRootY*nFine);
+
+  unordered_map<unsigned long, unsigned long> NodeID;
+
+  auto GetNode = [&](unsigned long ix, unsigned long iy) {
+    const unsigned long key = ix*nNodeY + iy;
+    unordered_map<unsigned long, unsigned long>::const_iterator it = NodeID.find(key);
+    if (it != NodeID.end()) return it->second;
+
+    const passivedouble u = xMin + ix*dxFine, v = yMin + iy*dyFine;
+    const unsigned long iNode = NodeData.size()/nField;
+    NodeData.resize(NodeData.size()+nField);
+    func(logX? exp(u) : u, logY? exp(v) : v, &NodeData[iNode*nField]);
+    NodeID[key] = iNode;
+    return iNode;
+  };
+
+  /*--- Magnitude of the refinement fields over the root grid, used as the
+   lower bound of the relative error for fields that cross zero. ---*/
+
+  vector<passivedouble> FieldScale(nErrorField, 0.0);
+  for (unsigned long j = 0; j <= nRootY; j++) {
+    for (unsigned long i = 0; i <= nRootX; i++) {
+      const unsigned long iNode = GetNode(i*nFine, j*nFine);
+      for (unsigned short k = 0; k < nErrorField; k++) {
+        const passivedouble val = fabs(NodeData[iNode*nField+k]);
+        if (val < numeric_limits<passivedouble>::max()) FieldScale[k] = max(FieldScale[k], val);
+      }
+    }
+  }
+
+  /*--- Refine the cells depth first. A cell is split in four when the bilinear
+   interpolation of its corners misses the function at the midpoints of its
+   edges or at its center. Cells with non-finite corners are not refined. ---*/
+
+  const unsigned short nTest = 5;
+  const unsigned long testX[] = {1, 0, 2, 1, 1}, testY[] = {0, 1, 1, 2, 1};
+
+  vector<unsigned long> Stack;
+  Tree.assign(nRootX*nRootY, 0);
+  for (unsigned long j = 0; j < nRootY; j++)
+    for (unsigned long i = 0; i < nRootX; i++) {
+      Stack.push_back(j*nRootX+i); Stack.push_back(0);
+      Stack.push_back(i*nFine);    Stack.push_back(j*nFine);
+    }
+
+  while (!Stack.empty()) {
+
+    const unsigned long iy    = Stack.back(); Stack.pop_back();
+    const unsigned long ix    = Stack.back(); Stack.pop_back();
+    const unsigned long level = Stack.back(); Stack.pop_back();
+    const unsigned long cell  = Stack.back(); Stack.pop_back();
+
+    const unsigned long size = nFine >> level;
+    const unsigned long Corner[] = {GetNode(ix, iy), GetNode(ix+size, iy),
+                                    GetNode(ix, iy+size), GetNode(ix+size, iy+size)};
+
+    bool refine = false;
+    if (level < maxLevel) {
+      const unsigned long half = size/2;
+      for (unsigned short iTest = 0; iTest < nTest; iTest++) {
+        const unsigned long iNode = GetNode(ix+testX[iTest]*half, iy+testY[iTest]*half);
+        const passivedouble a = 0.5*testX[iTest], b = 0.5*testY[iTest];
+        for (unsigned short k = 0; k < nErrorField; k++) {
+          const passivedouble exact  = NodeData[iNode*nField+k];
+          const passivedouble interp = (1.0-a)*(1.0-b)*NodeData[Corner[0]*nField+k] + a*(1.0-b)*NodeData[Corner[1]*nField+k]
+                                     + (1.0-a)*b*NodeData[Corner[2]*nField+k] + a*b*NodeData[Corner[3]*nField+k];
+          if (fabs(interp-exact) > tolerance*max(fabs(exact), 1.0e-3*FieldScale[k])) refine = true;
+        }
+      }
+    }
+
+    if (refine) {
+      const unsigned long half = size/2, first = Tree.size();
+      Tree[cell] = first;
+      Tree.resize(first+4, 0);
+      for (unsigned short q = 0; q < 4; q++) {
+        Stack.push_back(first+q);         Stack.push_back(level+1);
+        Stack.push_back(ix+(q%2)*half);   Stack.push_back(iy+(q/2)*half);
+      }
+    }
+    else {
+      Tree[cell] = -1-long(LeafNodes.size()/4);
+      for (unsigned short q = 0; q < 4; q++) LeafNodes.push_back(Corner[q]);
+    }
+  }
+
+  /*--- Remove the nodes that were only evaluated to test the leaves. ---*/
+
+  const unsigned long nNode = NodeData.size()/nField;
+  vector<long> NewID(nNode, -1);
+  vector<passivedouble> Compact;
+  Compact.reserve(NodeData.size());
+  for (unsigned long iLeafNode = 0; iLeafNode < LeafNodes.size(); iLeafNode++) {
+    const unsigned long iNode = LeafNodes[iLeafNode];
+    if (NewID[iNode] < 0) {
+      NewID[iNode] = Compact.size()/nField;
+      Compact.insert(Compact.end(), NodeData.begin()+iNode*nField, NodeData.begin()+(iNode+1)*nField);
+    }
+    LeafNodes[iLeafNode] = NewID[iNode];
+  }
+  NodeData.swap(Compact);
+}
+
+void CLookUpTable2D::Interpolate(su2double x, su2double y, su2double *val_fields) const {
+
+  const su2double u = logX? log(x) : x;
+  const su2double v = logY? log(y) : y;
+  const passivedouble up = SU2_TYPE::GetValue(u), vp = SU2_TYPE::GetValue(v);
+
+  /*--- Root cell, inputs outside of the table use the boundary cells. ---*/
+
+  passivedouble w = (xMax-xMin)/nRootX, h = (yMax-yMin)/nRootY;
+  const passivedouble si = (up-xMin)/w, sj = (vp-yMin)/h;
+  const unsigned long i = (si >= nRootX)? nRootX-1 : ((si > 0.0)? (unsigned long)(si) : 0);
+  const unsigned long j = (sj >= nRootY)? nRootY-1 : ((sj > 0.0)? (unsigned long)(sj) : 0);
+  passivedouble x0 = xMin + i*w, y0 = yMin + j*h;
+
+  /*--- Descend the quadtree to the leaf. ---*/
+
+  long cell = j*nRootX + i;
+  while (Tree[cell] >= 0) {
+    w *= 0.5; h *= 0.5;
+    const unsigned short qx = (up >= x0+w), qy = (vp >= y0+h);
+    x0 += qx*w; y0 += qy*h;
+    cell = Tree[cell] + qx + 2*qy;
+  }
+
+  const unsigned long leaf = -1-Tree[cell];
+  const passivedouble *f00 = &NodeData[LeafNodes[4*leaf  ]*nField];
+  const passivedouble *f10 = &NodeData[LeafNodes[4*leaf+1]*nField];
+  const passivedouble *f01 = &NodeData[LeafNodes[4*leaf+2]*nField];
+  const passivedouble *f11 = &NodeData[LeafNodes[4*leaf+3]*nField];
+
+  const su2double a = (u-x0)/w, b = (v-y0)/h;
+  const su2double w00 = (1.0-a)*(1.0-b), w10 = a*(1.0-b), w01 = (1.0-a)*b, w11 = a*b;
+
+  for (unsigned short k = 0; k < nField; k++)
+    val_fields[k] = w00*f00[k] + w10*f10[k] + w01*f01[k] + w11*f11[k];
+}
+
+void CLookUpTable2D::Write(ofstream &file) const {
+
+  const unsigned long Header[] = {nField, logX, logY, nRootX, nRootY,
+                                  Tree.size(), LeafNodes.size(), NodeData.size()};
+  const passivedouble Bounds[] = {xMin, xMax, yMin, yMax};
+
+  file.write((const char*)Header, sizeof(Header));
+  file.write((const char*)Bounds, sizeof(Bounds));
+  file.write((const char*)Tree.data(), Tree.size()*sizeof(long));
+  file.write((const char*)LeafNodes.data(), LeafNodes.size()*sizeof(unsigned long));
+  file.write((const char*)NodeData.data(), NodeData.size()*sizeof(passivedouble));
+}
+
+bool CLookUpTable2D::Read(ifstream &file) {
+
+  unsigned long Header[8];
+  passivedouble Bounds[4];
+
+  file.read((char*)Header, sizeof(Header));
+  file.read((char*)Bounds, sizeof(Bounds));
+  if (!file.good()) return false;
+
+  /*--- Sanity check of the sizes before allocating. ---*/
+
+  if ((Header[0] == 0) || (Header[3]*Header[4] == 0) || (Header[5] < Header[3]*Header[4]) ||
+      (Header[6]%4 != 0) || (Header[7]%Header[0] != 0)) return false;
+
+  nField = Header[0]; logX = Header[1]; logY = Header[2];
+  nRootX = Header[3]; nRootY = Header[4];
+  xMin = Bounds[0]; xMax = Bounds[1]; yMin = Bounds[2]; yMax = Bounds[3];
+
+  Tree.resize(Header[5]); LeafNodes.resize(Header[6]); NodeData.resize(Header[7]);
+  file.read((char*)Tree.data(), Tree.size()*sizeof(long));
+  file.read((char*)LeafNodes.data(), LeafNodes.size()*sizeof(unsigned long));
+  file.read((char*)NodeData.data(), NodeData.size()*sizeof(passivedouble));
+
+  return file.good();
+}
+
+void CLookUpTable2D::Broadcast(void) {
+
+#ifdef HAVE_MPI
+  unsigned long Header[] = {nField, logX, logY, nRootX, nRootY,
+                            Tree.size(), LeafNodes.size(), NodeData.size()};
+  passivedouble Bounds[] = {xMin, xMax, yMin, yMax};
+
+  SU2_MPI::Bcast(Header, 8, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(Bounds, 4, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+
+  nField = Header[0]; logX = Header[1]; logY = Header[2];
+  nRootX = Header[3]; nRootY = Header[4];
+  xMin = Bounds[0]; xMax = Bounds[1]; yMin = Bounds[2]; yMax = Bounds[3];
+
+  Tree.resize(Header[5]); LeafNodes.resize(Header[6]); NodeData.resize(Header[7]);
+  SU2_MPI::Bcast(Tree.data(), Tree.size(), MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(LeafNodes.data(), LeafNodes.size(), MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(NodeData.data(), NodeData.size(), MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+}
+
+/*--- Fields of the (density, energy) table. ---*/
+
+enum LUT_RHOE_FIELD {LUT_P = 0, LUT_T = 1, LUT_C2 = 2, LUT_S = 3, LUT_DPDRHO_E = 4, LUT_DPDE_RHO = 5,
+                     LUT_DTDRHO_E = 6, LUT_DTDE_RHO = 7, LUT_CP = 8, N_LUT_RHOE = 9};
+
+/*--- Number of root cells per direction and file format version of the tables. ---*/
+
+static const unsigned long LUT_ROOT_CELLS = 16;
+static const int LUT_FILE_VERSION = 1;
+
+map<const CConfig*, const CLookUpTableGas*> CLookUpTableGas::TableOwner;
+
+CLookUpTableGas::CLookUpTableGas(CConfig *config) : CFluidModel() {
+
+  const int rank = SU2_MPI::GetRank();
+
+  Donor = CreateDonorModel(config, true);
+  OwnTables = true;
+
+  Table_rhoe = new CLookUpTable2D(); Table_PT   = new CLookUpTable2D();
+  Table_Prho = new CLookUpTable2D(); Table_rhoT = new CLookUpTable2D();
+  Table_hs   = new CLookUpTable2D(); Table_Ps   = new CLookUpTable2D();
+
+  /*--- The master reads the tables of a previous run or generates and writes
+   them for later runs. The other ranks receive a copy, which avoids repeating
+   the donor evaluations on every rank. ---*/
+
+  if (rank == MASTER_NODE) {
+    if (ReadTables(config)) {
+      cout << "Fluid tables read from " << config->GetLUT_FileName() << " ("
+           << Table_rhoe->GetnLeaf() << " cells in the density-energy table)." << endl;
+    }
+    else {
+      BuildTables(config);
+      cout << "Fluid tables generated (" << Table_rhoe->GetnLeaf()
+           << " cells in the density-energy table)." << endl;
+      WriteTables(config);
+    }
+  }
+
+  Table_rhoe->Broadcast(); Table_PT->Broadcast(); Table_Prho->Broadcast();
+  Table_rhoT->Broadcast(); Table_hs->Broadcast(); Table_Ps->Broadcast();
+
+  TableOwner[config] = this;
+}
+
+CLookUpTableGas::CLookUpTableGas(const CLookUpTableGas *val_tables, CConfig *config) : CFluidModel() {
+
+  Donor = CreateDonorModel(config, true);
+  OwnTables = false;
+
+  Table_rhoe = val_tables->Table_rhoe; Table_PT   = val_tables->Table_PT;
+  Table_Prho = val_tables->Table_Prho; Table_rhoT = val_tables->Table_rhoT;
+  Table_hs   = val_tables->Table_hs;   Table_Ps   = val_tables->Table_Ps;
+}
+
+CLookUpTableGas::~CLookUpTableGas(void) {
+
+  delete Donor;
+
+  if (OwnTables) {
+    delete Table_rhoe; delete Table_PT; delete Table_Prho;
+    delete Table_rhoT; delete Table_hs; delete Table_Ps;
+
+    for (map<const CConfig*, const CLookUpTableGas*>::iterator it = TableOwner.begin(); it != TableOwner.end(); ++it) {
+      if (it->second == this) { TableOwner.erase(it); break; }
+    }
+  }
+}
+
+CLookUpTableGas* CLookUpTableGas::CreateShared(CConfig *config) {
+
+  map<const CConfig*, const CLookUpTableGas*>::const_iterator it = TableOwner.find(config);
+
+  if (it != TableOwner.end()) return new CLookUpTableGas(it->second, config);
+  return new CLookUpTableGas(config);
+}
+
+CFluidModel* CLookUpTableGas::CreateDonorModel(CConfig *config, bool nondimensional) {
+
+  su2double Gas_Constant = config->GetGas_Constant();
+  su2double Pstar = config->GetPressure_Critical(), Tstar = config->GetTemperature_Critical();
+
+  if (nondimensional) {
+    Gas_Constant = config->GetGas_ConstantND();
+    Pstar /= config->GetPressure_Ref();
+    Tstar /= config->GetTemperature_Ref();
+  }
+
+  switch (config->GetKind_LUT_Donor()) {
+    case VW_GAS:
+      return new CVanDerWaalsGas(config->GetGamma(), Gas_Constant, Pstar, Tstar);
+    case PR_GAS:
+      return new CPengRobinson(config->GetGamma(), Gas_Constant, Pstar, Tstar, config->GetAcentric_Factor());
+    default:
+      return new CIdealGas(config->GetGamma(), Gas_Constant);
+  }
+}
+
+void CLookUpTableGas::BuildTables(CConfig *config) {
+
+  const passivedouble Pressure_Ref    = SU2_TYPE::GetValue(config->GetPressure_Ref());
+  const passivedouble Temperature_Ref = SU2_TYPE::GetValue(config->GetTemperature_Ref());
+  const passivedouble Pmin = SU2_TYPE::GetValue(config->GetLUT_Pressure_Range()[0])/Pressure_Ref;
+  const passivedouble Pmax = SU2_TYPE::GetValue(config->GetLUT_Pressure_Range()[1])/Pressure_Ref;
+  const passivedouble Tmin = SU2_TYPE::GetValue(config->GetLUT_Temperature_Range()[0])/Temperature_Ref;
+  const passivedouble Tmax = SU2_TYPE::GetValue(config->GetLUT_Temperature_Range()[1])/Temperature_Ref;
+  const passivedouble tol  = SU2_TYPE::GetValue(config->GetLUT_Tolerance());
+  const unsigned short maxLevel = config->GetLUT_MaxRefinement();
+
+  /*--- The ranges of density, energy, enthalpy and entropy follow from a sweep
+   of the donor over the pressure-temperature rectangle. ---*/
+
+  const unsigned short nSweep = 64;
+  const passivedouble big = numeric_limits<passivedouble>::max();
+  passivedouble rhoMin = big, rhoMax = -big, eMin = big, eMax = -big;
+  passivedouble hMin = big, hMax = -big, sMin = big, sMax = -big;
+
+  for (unsigned short i = 0; i <= nSweep; i++) {
+    for (unsigned short j = 0; j <= nSweep; j++) {
+      const passivedouble P = Pmin*pow(Pmax/Pmin, passivedouble(i)/nSweep);
+      const passivedouble T = Tmin + (Tmax-Tmin)*passivedouble(j)/nSweep;
+      Donor->SetTDState_PT(P, T);
+      const passivedouble rho = SU2_TYPE::GetValue(Donor->GetDensity());
+      const passivedouble e   = SU2_TYPE::GetValue(Donor->GetStaticEnergy());
+      const passivedouble s   = SU2_TYPE::GetValue(Donor->GetEntropy());
+      const passivedouble h   = e + P/rho;
+      if (!(rho > 0.0) || !(fabs(e) < big) || !(fabs(h) < big) || !(fabs(s) < big)) continue;
+      rhoMin = min(rhoMin, rho); rhoMax = max(rhoMax, rho);
+      eMin = min(eMin, e); eMax = max(eMax, e);
+      hMin = min(hMin, h); hMax = max(hMax, h);
+      sMin = min(sMin, s); sMax = max(sMax, s);
+    }
+  }
+
+  if (!(rhoMin < rhoMax) || !(eMin < eMax) || !(hMin < hMax) || !(sMin < sMax))
+    SU2_MPI::Error("The donor fluid model has no valid states in LUT_PRESSURE_RANGE and LUT_TEMPERATURE_RANGE.", CURRENT_FUNCTION);
+
+  /*--- The state table stores the outputs of SetTDState_rhoe, including the
+   derivatives used in the Jacobians. Pressure, temperature and speed of sound
+   control the refinement. ---*/
+
+  Table_rhoe->Build(N_LUT_RHOE, 3, true, false, rhoMin, rhoMax, eMin, eMax, LUT_ROOT_CELLS, maxLevel, tol,
+                    [this](passivedouble rho, passivedouble e, passivedouble *val) {
+    Donor->SetTDState_rhoe(rho, e);
+    val[LUT_P]        = SU2_TYPE::GetValue(Donor->GetPressure());
+    val[LUT_T]        = SU2_TYPE::GetValue(Donor->GetTemperature());
+    val[LUT_C2]       = SU2_TYPE::GetValue(Donor->GetSoundSpeed2());
+    val[LUT_S]        = SU2_TYPE::GetValue(Donor->GetEntropy());
+    val[LUT_DPDRHO_E] = SU2_TYPE::GetValue(Donor->GetdPdrho_e());
+    val[LUT_DPDE_RHO] = SU2_TYPE::GetValue(Donor->GetdPde_rho());
+    val[LUT_DTDRHO_E] = SU2_TYPE::GetValue(Donor->GetdTdrho_e());
+    val[LUT_DTDE_RHO] = SU2_TYPE::GetValue(Donor->GetdTde_rho());
+    val[LUT_CP]       = SU2_TYPE::GetValue(Donor->GetCp());
+  });
+
+  /*--- The other input pairs are mapped to density and energy, the state then
+   follows from the first table. ---*/
+
+  auto DensityEnergy = [this](passivedouble *val) {
+    val[0] = SU2_TYPE::GetValue(Donor->GetDensity());
+    val[1] = SU2_TYPE::GetValue(Donor->GetStaticEnergy());
+  };
+
+  Table_PT->Build(2, 2, true, false, Pmin, Pmax, Tmin, Tmax, LUT_ROOT_CELLS, maxLevel, tol,
+                  [&](passivedouble P, passivedouble T, passivedouble *val) {
+    Donor->SetTDState_PT(P, T); DensityEnergy(val);
+  });
+
+  Table_Prho->Build(2, 2, true, true, Pmin, Pmax, rhoMin, rhoMax, LUT_ROOT_CELLS, maxLevel, tol,
+                    [&](passivedouble P, passivedouble rho, passivedouble *val) {
+    Donor->SetTDState_Prho(P, rho); DensityEnergy(val);
+  });
+
+  Table_rhoT->Build(2, 2, true, false, rhoMin, rhoMax, Tmin, Tmax, LUT_ROOT_CELLS, maxLevel, tol,
+                    [&](passivedouble rho, passivedouble T, passivedouble *val) {
+    Donor->SetTDState_rhoT(rho, T); DensityEnergy(val);
+  });
+
+  Table_hs->Build(2, 2, false, false, hMin, hMax, sMin, sMax, LUT_ROOT_CELLS, maxLevel, tol,
+                  [&](passivedouble h, passivedouble s, passivedouble *val) {
+    Donor->SetTDState_hs(h, s); DensityEnergy(val);
+  });
+
+  Table_Ps->Build(2, 2, true, false, Pmin, Pmax, sMin, sMax, LUT_ROOT_CELLS, maxLevel, tol,
+                  [&](passivedouble P, passivedouble s, passivedouble *val) {
+    Donor->SetTDState_Ps(P, s); DensityEnergy(val);
+  });
+}
+
+/*--- Parameters that determine the tables, stored in the header of the file. ---*/
+
+static void LUT_Signature(CConfig *config, passivedouble *signature) {
+
+  signature[0]  = LUT_FILE_VERSION;
+  signature[1]  = config->GetKind_LUT_Donor();
+  signature[2]  = SU2_TYPE::GetValue(config->GetGamma());
+  signature[3]  = SU2_TYPE::GetValue(config->GetGas_ConstantND());
+  signature[4]  = SU2_TYPE::GetValue(config->GetPressure_Critical()/config->GetPressure_Ref());
+  signature[5]  = SU2_TYPE::GetValue(config->GetTemperature_Critical()/config->GetTemperature_Ref());
+  signature[6]  = SU2_TYPE::GetValue(config->GetAcentric_Factor());
+  signature[7]  = SU2_TYPE::GetValue(config->GetLUT_Pressure_Range()[0]/config->GetPressure_Ref());
+  signature[8]  = SU2_TYPE::GetValue(config->GetLUT_Pressure_Range()[1]/config->GetPressure_Ref());
+  signature[9]  = SU2_TYPE::GetValue(config->GetLUT_Temperature_Range()[0]/config->GetTemperature_Ref());
+  signature[10] = SU2_TYPE::GetValue(config->GetLUT_Temperature_Range()[1]/config->GetTemperature_Ref());
+  signature[11] = SU2_TYPE::GetValue(config->GetLUT_Tolerance());
+  signature[12] = config->GetLUT_MaxRefinement();
+  signature[13] = LUT_ROOT_CELLS;
+}
+
+static const unsigned short LUT_SIGNATURE_SIZE = 14;
+
+void CLookUpTableGas::WriteTables(CConfig *config) {
+
+  /*--- Write to a temporary file that is renamed when complete, such that
+   other processes never read a partial file. ---*/
+
+  const string FileName = config->GetLUT_FileName(), TmpName = FileName + ".tmp";
+
+  ofstream file(TmpName.c_str(), ios::out | ios::binary);
+  if (!file.is_open()) {
+    cout << "Could not write the fluid tables to " << FileName << "." << endl;
+    return;
+  }
+
+  passivedouble signature[LUT_SIGNATURE_SIZE];
+  LUT_Signature(config, signature);
+  file.write((const char*)signature, sizeof(signature));
+
+  Table_rhoe->Write(file); Table_PT->Write(file); Table_Prho->Write(file);
+  Table_rhoT->Write(file); Table_hs->Write(file); Table_Ps->Write(file);
+
+  const bool good = file.good();
+  file.close();
+
+  if (good) rename(TmpName.c_str(), FileName.c_str());
+  else remove(TmpName.c_str());
+}
+
+bool CLookUpTableGas::ReadTables(CConfig *config) {
+
+  ifstream file(config->GetLUT_FileName().c_str(), ios::in | ios::binary);
+  if (!file.is_open()) return false;
+
+  /*--- The tables are only used when they were generated with the same
+   dimensionless parameters. ---*/
+
+  passivedouble signature[LUT_SIGNATURE_SIZE], stored[LUT_SIGNATURE_SIZE];
+  LUT_Signature(config, signature);
+  file.read((char*)stored, sizeof(stored));
+  if (!file.good()) return false;
+
+  for (unsigned short i = 0; i < LUT_SIGNATURE_SIZE; i++)
+    if (fabs(stored[i]-signature[i]) > 1.0e-12*max(fabs(signature[i]), 1.0)) return false;
+
+  return (Table_rhoe->Read(file) && Table_PT->Read(file) && Table_Prho->Read(file) &&
+          Table_rhoT->Read(file) && Table_hs->Read(file) && Table_Ps->Read(file));
+}
+
+void CLookUpTableGas::SetTDState_rhoe (su2double rho, su2double e ) {
+
+  su2double val[N_LUT_RHOE];
+  Table_rhoe->Interpolate(rho, e, val);
+
+  Density      = rho;
+  StaticEnergy = e;
+  Pressure     = val[LUT_P];
+  Temperature  = val[LUT_T];
+  SoundSpeed2  = val[LUT_C2];
+  Entropy      = val[LUT_S];
+  dPdrho_e     = val[LUT_DPDRHO_E];
+  dPde_rho     = val[LUT_DPDE_RHO];
+  dTdrho_e     = val[LUT_DTDRHO_E];
+  dTde_rho     = val[LUT_DTDE_RHO];
+  Cp           = val[LUT_CP];
+}
+
+void CLookUpTableGas::SetTDState_PT (su2double P, su2double T ) {
+
+  su2double val[2];
+  Table_PT->Interpolate(P, T, val);
+  SetTDState_rhoe(val[0], val[1]);
+  Pressure = P; Temperature = T;
+}
+
+void CLookUpTableGas::SetTDState_Prho (su2double P, su2double rho ) {
+
+  su2double val[2];
+  Table_Prho->Interpolate(P, rho, val);
+  SetTDState_rhoe(rho, val[1]);
+  Pressure = P;
+}
+
+void CLookUpTableGas::SetEnergy_Prho (su2double P, su2double rho ) {
+
+  su2double val[2];
+  Table_Prho->Interpolate(P, rho, val);
+  StaticEnergy = val[1];
+}
+
+void CLookUpTableGas::SetTDState_hs (su2double h, su2double s ) {
+
+  su2double val[2];
+  Table_hs->Interpolate(h, s, val);
+  SetTDState_rhoe(val[0], val[1]);
+  Entropy = s;
+}
+
+void CLookUpTableGas::SetTDState_rhoT (su2double rho, su2double T ) {
+
+  su2double val[2];
+  Table_rhoT->Interpolate(rho, T, val);
+  SetTDState_rhoe(rho, val[1]);
+  Temperature = T;
+}
+
+void CLookUpTableGas::SetTDState_Ps (su2double P, su2double s ) {
+
+  su2double val[2];
+  Table_Ps->Interpolate(P, s, val);
+  SetTDState_rhoe(val[0], val[1]);
+  Pressure = P; Entropy = s;
+}
+
+void CLookUpTableGas::ComputeDerivativeNRBC_Prho (su2double P, su2double rho ) {
+
+  /*--- Only needed by a few boundary conditions, hence evaluated by the donor. ---*/
+
+  Donor->ComputeDerivativeNRBC_Prho(P, rho);
+  dhdrho_P = Donor->Getdhdrho_P();
+  dhdP_rho = Donor->GetdhdP_rho();
+  dsdrho_P = Donor->Getdsdrho_P();
+  dsdP_rho = Donor->GetdsdP_rho();
+}
@@ -374,6 +374,189 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
 }
 
+void CIntegration::NewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                                          CConfig *config, unsigned short iMesh, unsigned short RunTime_EqSystem) {
+  
+  unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  CSolver *solver = solver_container[MainSolver];
+  
+  unsigned short iVar, nVar = solver->GetnVar();
+  unsigned long iPoint, total_index, IterLinSol = 0;
+  unsigned long nPoint = geometry->GetnPoint(), nPointDomain = geometry->GetnPointDomain();
+  su2double Delta, *local_Res_TruncError;
+  
+  CSysVector Solution_Base(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector Residual_Base(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector Rhs(nPoint, nPointDomain, nVar, 0.0);
+  
+  /*--- Set maximum residual to zero ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    solver->SetRes_RMS(iVar, 0.0);
+    solver->SetRes_Max(iVar, 0.0, 0);
+  }
+  
+  /*--- State at which the Jacobian is evaluated (ghost points included) ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution_Base[iPoint*nVar+iVar] = solver->node[iPoint]->GetSolution(iVar);
+  
+  /*--- Build the preconditioner (assembled Jacobian plus the pseudo time term) and
+   the right hand side, as in the implicit Euler iteration ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    local_Res_TruncError = solver->node[iPoint]->GetResTruncError();
+    
+    if (solver->node[iPoint]->GetDelta_Time() != 0.0) {
+      Delta = geometry->node[iPoint]->GetVolume() / solver->node[iPoint]->GetDelta_Time();
+      solver->Jacobian.AddVal2Diag(iPoint, Delta);
+    }
+    else {
+      solver->Jacobian.SetVal2Diag(iPoint, 1.0);
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar + iVar;
+        solver->LinSysRes[total_index] = 0.0;
+        local_Res_TruncError[iVar] = 0.0;
+      }
+    }
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      Residual_Base[total_index] = solver->LinSysRes[total_index] + local_Res_TruncError[iVar];
+      Rhs[total_index] = -Residual_Base[total_index];
+      solver->LinSysSol[total_index] = 0.0;
+      solver->AddRes_RMS(iVar, Rhs[total_index]*Rhs[total_index]);
+      solver->AddRes_Max(iVar, fabs(Rhs[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+    }
+  }
+  
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      solver->LinSysSol[iPoint*nVar+iVar] = 0.0;
+  
+  /*--- Solve the Newton system, the matrix-vector products evaluate the residual, which
+   overwrites the residual vector of the solver, hence the right hand side is a copy ---*/
+  
+  CNewtonKrylovProduct mat_vec(this, geometry, solver_container, numerics, config, iMesh,
+                               RunTime_EqSystem, Solution_Base, Residual_Base);
+  
+  CSysSolve system;
+  IterLinSol = system.Solve(solver->Jacobian, mat_vec, Rhs, solver->LinSysSol, geometry, config);
+  
+  solver->SetIterLinSolver(IterLinSol);
+  
+  /*--- Update solution (system written in terms of increments) ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      solver->node[iPoint]->AddSolution(iVar, config->GetRelaxation_Factor_Flow()*solver->LinSysSol[iPoint*nVar+iVar]);
+  
+  solver->Set_MPI_Solution(geometry, config);
+  
+  /*--- Compute the root mean square residual, and decide if the preconditioner is reused ---*/
+  
+  solver->SetResidual_RMS(geometry, config);
+  
+  solver->SetJacobian_Reuse(config);
+  
+}
+
+CNewtonKrylovProduct::CNewtonKrylovProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+                                           CNumerics **val_numerics, CConfig *val_config, unsigned short val_iMesh,
+                                           unsigned short val_RunTime_EqSystem, const CSysVector & val_Solution_Base,
+                                           const CSysVector & val_Residual_Base) {
+  
+  integration      = val_integration;
+  geometry         = val_geometry;
+  solver_container = val_solver_container;
+  numerics         = val_numerics;
+  config           = val_config;
+  iMesh            = val_iMesh;
+  RunTime_EqSystem = val_RunTime_EqSystem;
+  MainSolver       = config->GetContainerPosition(RunTime_EqSystem);
+  Solution_Base    = &val_Solution_Base;
+  Residual_Base    = &val_Residual_Base;
+  Norm_Solution    = val_Solution_Base.norm();
+  
+}
+
+CNewtonKrylovProduct::~CNewtonKrylovProduct(void) { }
+
+void CNewtonKrylovProduct::operator()(const CSysVector & u, CSysVector & v) const {
+  
+  CSolver *solver = solver_container[MainSolver];
+  
+  unsigned short iVar, nVar = solver->GetnVar();
+  unsigned long iPoint, total_index;
+  unsigned long nPoint = geometry->GetnPoint(), nPointDomain = geometry->GetnPointDomain();
+  su2double Delta, *local_Res_TruncError;
+  
+  /*--- Step of the forward difference, relative to the size of the state (Pernice and Walker) ---*/
+  
+  su2double Norm_u = u.norm();
+  
+  if (Norm_u == 0.0) {
+    v = 0.0;
+    return;
+  }
+  
+  su2double eps = config->GetNewton_Krylov_Step()*(1.0 + Norm_Solution)/Norm_u;
+  
+  /*--- Perturb the state and evaluate the residual, the assembled Jacobian is frozen
+   meanwhile so that it keeps the values used by the preconditioner ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      solver->node[iPoint]->SetSolution(iVar, (*Solution_Base)[total_index] + eps*u[total_index]);
+    }
+  
+  solver->Set_MPI_Solution(geometry, config);
+  
+  bool frozen = solver->Jacobian.GetFrozen();
+  solver->Jacobian.SetFrozen(true);
+  
+  solver->Preprocessing(geometry, solver_container, config, iMesh, 0, RunTime_EqSystem, false);
+  integration->Space_Integration(geometry, solver_container, numerics, config, iMesh, 0, RunTime_EqSystem);
+  
+  solver->Jacobian.SetFrozen(frozen);
+  
+  /*--- v = (Vol/dt)*u + (R(U + eps*u) - R(U))/eps, the rows without time step are the identity ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    local_Res_TruncError = solver->node[iPoint]->GetResTruncError();
+    
+    if (solver->node[iPoint]->GetDelta_Time() != 0.0) {
+      Delta = geometry->node[iPoint]->GetVolume() / solver->node[iPoint]->GetDelta_Time();
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar + iVar;
+        v[total_index] = Delta*u[total_index] +
+                         (solver->LinSysRes[total_index] + local_Res_TruncError[iVar] - (*Residual_Base)[total_index])/eps;
+      }
+    }
+    else {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar + iVar;
+        v[total_index] = u[total_index];
+      }
+    }
+  }
+  
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      v[iPoint*nVar+iVar] = 0.0;
+  
+  /*--- Restore the base state ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      solver->node[iPoint]->SetSolution(iVar, (*Solution_Base)[iPoint*nVar+iVar]);
+  
+}
+
 void CIntegration::Time_Integration_FEM(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
                                     unsigned short RunTime_EqSystem, unsigned long Iteration) {
 
@@ -149,6 +149,12 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
   bool startup_multigrid = (config[iZone]->GetRestart_Flow() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && (Iteration == 0));
   unsigned short SolContainer_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
   
+  /*--- The finest grid of the flow problem can be smoothed with Newton-Krylov iterations ---*/
+  
+  bool newton_krylov = (config[iZone]->GetNewton_Krylov() && (iMesh == MESH_0) &&
+                        (RunTime_EqSystem == RUNTIME_FLOW_SYS) &&
+                        (Iteration >= config[iZone]->GetNewton_Krylov_StartUp_Iter()));
+  
   /*--- Do a presmoothing on the grid iMesh to be restricted to the grid iMesh+1 ---*/
   
   for (iPreSmooth = 0; iPreSmooth < config[iZone]->GetMG_PreSmooth(iMesh); iPreSmooth++) {
@@ -191,7 +197,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
       
       /*--- Time integration, update solution using the old solution plus the solution increment ---*/
       
-      Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
+      if (newton_krylov)
+        NewtonKrylov_Iteration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone], iMesh, RunTime_EqSystem);
+      else
+        Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
       
       /*--- Send-Receive boundary conditions, and postprocessing ---*/
       
@@ -256,7 +265,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
         }
         
         Space_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
-        Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
+        if (newton_krylov)
+          NewtonKrylov_Iteration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone], iMesh, RunTime_EqSystem);
+        else
+          Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
         
         solver_container[iZone][iInst][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iMesh);
         
@@ -2080,10 +2080,24 @@ void CAdjFluidIteration::Postprocess(COutput *output,
 CDiscAdjFluidIteration::CDiscAdjFluidIteration(CConfig *config) : CIteration(config) {
   
   turbulent = ( config->GetKind_Solver() == DISC_ADJ_RANS);
+
+  /*--- With checkpointing the direct time steps between two restart files are recomputed ---*/
+
+  checkpointing  = config->GetUnst_AdjointCheckpointing();
+  nSnapshot      = config->GetUnst_AdjointSnapshots();
+  CheckpointFreq = config->GetUnst_AdjointCheckpointFreq();
+  MinRequested   = config->GetUnst_AdjointIter();
+
+  meanflow_iteration = NULL;
+  if (checkpointing) meanflow_iteration = new CFluidIteration(config);
   
 }
 
-CDiscAdjFluidIteration::~CDiscAdjFluidIteration(void) { }
+CDiscAdjFluidIteration::~CDiscAdjFluidIteration(void) {
+
+  if (meanflow_iteration != NULL) delete meanflow_iteration;
+
+}
 
 void CDiscAdjFluidIteration::Preprocess(COutput *output,
                                            CIntegration ****integration_container,
@@ -2125,7 +2139,8 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
 
         /*--- Load solution at timestep n-2 ---*/
 
-        LoadUnsteady_Solution(geometry_container, solver_container,config_container, val_iZone, val_iInst, Direct_Iter-2);
+        LoadUnsteady_Direct(output, integration_container, geometry_container, solver_container, numerics_container, config_container,
+                            surface_movement, grid_movement, FFDBox, val_iZone, val_iInst, Direct_Iter-2);
 
         /*--- Push solution back to correct array ---*/
 
@@ -2148,7 +2163,8 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
 
         /*--- Load solution at timestep n-1 ---*/
 
-        LoadUnsteady_Solution(geometry_container, solver_container,config_container, val_iZone, val_iInst, Direct_Iter-1);
+        LoadUnsteady_Direct(output, integration_container, geometry_container, solver_container, numerics_container, config_container,
+                            surface_movement, grid_movement, FFDBox, val_iZone, val_iInst, Direct_Iter-1);
 
         /*--- Push solution back to correct array ---*/
 
@@ -2167,7 +2183,8 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
 
       /*--- Load solution timestep n ---*/
 
-      LoadUnsteady_Solution(geometry_container, solver_container,config_container, val_iInst, val_iZone, Direct_Iter);
+      LoadUnsteady_Direct(output, integration_container, geometry_container, solver_container, numerics_container, config_container,
+                          surface_movement, grid_movement, FFDBox, val_iZone, val_iInst, Direct_Iter);
 
     }
 
@@ -2176,9 +2193,11 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
 
       /*--- Load solution timestep n-1 | n-2 for DualTimestepping 1st | 2nd order ---*/
       if (dual_time_1st){
-        LoadUnsteady_Solution(geometry_container, solver_container,config_container, val_iInst, val_iZone, Direct_Iter - 1);
+        LoadUnsteady_Direct(output, integration_container, geometry_container, solver_container, numerics_container, config_container,
+                            surface_movement, grid_movement, FFDBox, val_iZone, val_iInst, Direct_Iter - 1);
       } else {
-        LoadUnsteady_Solution(geometry_container, solver_container,config_container, val_iInst, val_iZone, Direct_Iter - 2);
+        LoadUnsteady_Direct(output, integration_container, geometry_container, solver_container, numerics_container, config_container,
+                            surface_movement, grid_movement, FFDBox, val_iZone, val_iInst, Direct_Iter - 2);
       }
   
 
@@ -2322,6 +2341,378 @@ void CDiscAdjFluidIteration::LoadUnsteady_Solution(CGeometry ****geometry_contai
 }
 
 
+void CDiscAdjFluidIteration::LoadUnsteady_Direct(COutput *output,
+                                                 CIntegration ****integration_container,
+                                                 CGeometry ****geometry_container,
+                                                 CSolver *****solver_container,
+                                                 CNumerics ******numerics_container,
+                                                 CConfig **config_container,
+                                                 CSurfaceMovement **surface_movement,
+                                                 CVolumetricMovement ***grid_movement,
+                                                 CFreeFormDefBox*** FFDBox,
+                                                 unsigned short val_iZone,
+                                                 unsigned short val_iInst,
+                                                 int val_DirectIter) {
+
+  CConfig *config = config_container[val_iZone];
+  bool dual_time_2nd = (config->GetUnsteady_Simulation() == DT_STEPPING_2ND);
+  bool from_disk = true;
+  unsigned short iMesh;
+  unsigned long nFree, nState, ExtIter = config->GetExtIter();
+  long iStep, iBase, iNext, iDirect = val_DirectIter;
+  vector<passivedouble> Backup, State;
+  map<long, vector<passivedouble> >::iterator it;
+
+  /*--- The reverse time integration only moves backwards, snapshots after the
+   earliest requested time step (and the one after it, which also holds time n-1) are released ---*/
+
+  if (iDirect < MinRequested) MinRequested = iDirect;
+  Snapshot.erase(Snapshot.upper_bound(MinRequested+1), Snapshot.end());
+
+  /*--- Without checkpointing, or if a restart file was written for this time step, read it ---*/
+
+  if (!checkpointing || (iDirect < 0) || (iDirect % long(CheckpointFreq) == 0) ||
+      (dual_time_2nd && (iDirect % long(CheckpointFreq) == 1 % long(CheckpointFreq)))) {
+    LoadUnsteady_Solution(geometry_container, solver_container, config_container, val_iZone, val_iInst, val_DirectIter);
+    return;
+  }
+
+  /*--- The recomputation overwrites the time levels of the adjoint iteration, keep them ---*/
+
+  GetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N, Backup);
+  nState = Backup.size();
+  if (dual_time_2nd)
+    GetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N1, Backup);
+
+  if (Snapshot.count(iDirect) != 0) {
+
+    /*--- The time step is kept in memory ---*/
+
+    if (rank == MASTER_NODE && val_iZone == ZONE_0)
+      cout << " Loading flow solution of direct iteration " << iDirect << " from memory." << endl;
+    State.assign(Snapshot[iDirect].begin(), Snapshot[iDirect].begin()+nState);
+
+  } else if (dual_time_2nd && (Snapshot.count(iDirect+1) != 0)) {
+
+    /*--- The next time step is kept in memory, it holds this one as time n-1 ---*/
+
+    if (rank == MASTER_NODE && val_iZone == ZONE_0)
+      cout << " Loading flow solution of direct iteration " << iDirect << " from memory." << endl;
+    State.assign(Snapshot[iDirect+1].begin()+nState, Snapshot[iDirect+1].end());
+
+  } else {
+
+    /*--- Closest checkpoint before the requested time step, either a pair of restart files
+     (time steps mK and mK+1 for 2nd order dual time) or a snapshot in memory ---*/
+
+    if (dual_time_2nd) iBase = ((iDirect-1)/long(CheckpointFreq))*long(CheckpointFreq) + 1;
+    else               iBase = (iDirect/long(CheckpointFreq))*long(CheckpointFreq);
+
+    it = Snapshot.lower_bound(iDirect);
+    if (it != Snapshot.begin()) {
+      --it;
+      if (it->first > iBase) {
+        iBase = it->first;
+        from_disk = false;
+      }
+    }
+
+    if (rank == MASTER_NODE && val_iZone == ZONE_0)
+      cout << " Recomputing direct iterations " << iBase+1 << " to " << iDirect << " from the checkpoint at direct iteration " << iBase << "." << endl;
+
+    if (from_disk) {
+      if (dual_time_2nd) {
+        LoadUnsteady_Solution(geometry_container, solver_container, config_container, val_iZone, val_iInst, iBase-1);
+        State.clear();
+        GetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_SOLUTION, State);
+        SetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N1, State, 0);
+      }
+      LoadUnsteady_Solution(geometry_container, solver_container, config_container, val_iZone, val_iInst, iBase);
+      State.clear();
+      GetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_SOLUTION, State);
+      SetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N, State, 0);
+    } else {
+      SetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_SOLUTION, it->second, 0);
+      SetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N, it->second, 0);
+      if (dual_time_2nd)
+        SetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N1, it->second, nState);
+    }
+
+    /*--- Advance the direct problem to the requested time step. Intermediate time steps are kept
+     following the binomial schedule, the requested one is kept as long as there is room ---*/
+
+    nFree = (Snapshot.size() < nSnapshot)? nSnapshot - Snapshot.size() : 0;
+    iNext = iBase + long(Snapshot_Offset(iDirect-iBase, (nFree > 0)? nFree-1 : 0));
+
+    for (iStep = iBase+1; iStep <= iDirect; iStep++) {
+
+      Run_DirectStep(output, integration_container, geometry_container, solver_container, numerics_container, config_container,
+                     surface_movement, grid_movement, FFDBox, val_iZone, val_iInst, iStep);
+
+      if ((nFree > 0) && ((iStep == iNext) || (iStep == iDirect))) {
+        vector<passivedouble> &NewSnapshot = Snapshot[iStep];
+        GetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N, NewSnapshot);
+        if (dual_time_2nd)
+          GetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N1, NewSnapshot);
+        nFree--;
+        iNext = iStep + long(Snapshot_Offset(iDirect-iStep, (nFree > 0)? nFree-1 : 0));
+      }
+    }
+
+    config->SetExtIter(ExtIter);
+    config->SetIntIter(0);
+
+    /*--- After the dual time update the requested solution is stored as time n ---*/
+
+    State.clear();
+    GetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N, State);
+
+    /*--- Regression check of the recomputation against the restart file of the direct run ---*/
+
+    if (config->GetUnst_AdjointCheckpointVerify() > 0.0)
+      Verify_DirectStep(geometry_container, solver_container, config_container, val_iZone, val_iInst, iDirect, State);
+
+  }
+
+  /*--- Restore the time levels of the adjoint iteration and set the requested solution ---*/
+
+  SetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N, Backup, 0);
+  if (dual_time_2nd)
+    SetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_TIME_N1, Backup, nState);
+  SetPrimal_State(geometry_container, solver_container, config_container, val_iZone, val_iInst, PRIMAL_SOLUTION, State, 0);
+
+  /*--- Update the primitive variables (and the eddy viscosity) as done when loading a restart ---*/
+
+  for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    solver_container[val_iZone][val_iInst][iMesh][FLOW_SOL]->Preprocessing(geometry_container[val_iZone][val_iInst][iMesh], solver_container[val_iZone][val_iInst][iMesh], config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    if (turbulent) {
+      solver_container[val_iZone][val_iInst][iMesh][TURB_SOL]->Postprocessing(geometry_container[val_iZone][val_iInst][iMesh], solver_container[val_iZone][val_iInst][iMesh], config, iMesh);
+    }
+  }
+
+}
+
+void CDiscAdjFluidIteration::Run_DirectStep(COutput *output,
+                                            CIntegration ****integration_container,
+                                            CGeometry ****geometry_container,
+                                            CSolver *****solver_container,
+                                            CNumerics ******numerics_container,
+                                            CConfig **config_container,
+                                            CSurfaceMovement **surface_movement,
+                                            CVolumetricMovement ***grid_movement,
+                                            CFreeFormDefBox*** FFDBox,
+                                            unsigned short val_iZone,
+                                            unsigned short val_iInst,
+                                            long val_DirectIter) {
+
+  unsigned long IntIter;
+  unsigned short Kind_Direct;
+  CConfig *config = config_container[val_iZone];
+  CIntegration *flow_integration = integration_container[val_iZone][val_iInst][FLOW_SOL];
+
+  switch (config->GetKind_Solver()) {
+    case DISC_ADJ_NAVIER_STOKES: Kind_Direct = NAVIER_STOKES; break;
+    case DISC_ADJ_RANS:          Kind_Direct = RANS; break;
+    default:                     Kind_Direct = EULER; break;
+  }
+
+  config->SetExtIter(val_DirectIter);
+  flow_integration->SetConvergence(false);
+
+  /*--- The direct problem is iterated with a non-adjoint view of the config. The discrete adjoint
+   mode does not reset the Jacobian in the preprocessing of the flow solvers (it would accumulate
+   over the implicit iterations) and may freeze the limiter, unlike the direct run. ---*/
+
+  config->SetDiscrete_Adjoint(false);
+
+  /*--- Dual time inner iterations, as in the direct run ---*/
+
+  for (IntIter = 0; IntIter < config->GetUnst_nIntIter(); IntIter++) {
+
+    config->SetIntIter(IntIter);
+
+    config->SetGlobalParam(Kind_Direct, RUNTIME_FLOW_SYS, val_DirectIter);
+    flow_integration->MultiGrid_Iteration(geometry_container, solver_container, numerics_container,
+                                          config_container, RUNTIME_FLOW_SYS, IntIter, val_iZone, val_iInst);
+
+    if (turbulent) {
+      config->SetGlobalParam(RANS, RUNTIME_TURB_SYS, val_DirectIter);
+      integration_container[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry_container, solver_container, numerics_container,
+                                                                                  config_container, RUNTIME_TURB_SYS, IntIter, val_iZone, val_iInst);
+    }
+
+    if (flow_integration->GetConvergence()) break;
+  }
+
+  /*--- Push the solution to time n (and n-1). The update flags convergence at the
+   end of the physical time interval, which must not stop later recomputations ---*/
+
+  meanflow_iteration->Update(output, integration_container, geometry_container, solver_container, numerics_container,
+                             config_container, surface_movement, grid_movement, FFDBox, val_iZone, val_iInst);
+  flow_integration->SetConvergence(false);
+
+  config->SetDiscrete_Adjoint(true);
+
+}
+
+void CDiscAdjFluidIteration::Verify_DirectStep(CGeometry ****geometry_container,
+                                               CSolver *****solver_container,
+                                               CConfig **config_container,
+                                               unsigned short val_iZone,
+                                               unsigned short val_iInst,
+                                               long val_DirectIter,
+                                               const vector<passivedouble> &state) {
+
+  unsigned short iSol, iVar, nVar, nSol = turbulent? 2 : 1;
+  unsigned short SolPosition[2] = {FLOW_SOL, TURB_SOL};
+  unsigned long iPoint, offset = 0;
+  passivedouble diff, ref, Max_Diff[2] = {0.0, 0.0}, Max_Ref[2] = {0.0, 0.0}, Rel_Diff = 0.0;
+  int exists = 0;
+  CConfig *config = config_container[val_iZone];
+  CSolver *solver;
+  string filename = config->GetUnsteady_FileName(config->GetSolution_FlowFileName(), val_DirectIter);
+  ifstream restart_file;
+
+  /*--- Only time steps for which the direct run also wrote a restart file can be compared ---*/
+
+  if (rank == MASTER_NODE) {
+    restart_file.open(filename.data(), ios::in);
+    exists = restart_file.is_open()? 1 : 0;
+    restart_file.close();
+  }
+  SU2_MPI::Bcast(&exists, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  if (exists == 0) return;
+
+  LoadUnsteady_Solution(geometry_container, solver_container, config_container, val_iZone, val_iInst, val_DirectIter);
+
+  /*--- The state holds the finest mesh first, flow then turbulence variables ---*/
+
+  for (iSol = 0; iSol < nSol; iSol++) {
+    solver = solver_container[val_iZone][val_iInst][MESH_0][SolPosition[iSol]];
+    nVar = solver->GetnVar();
+    for (iPoint = 0; iPoint < geometry_container[val_iZone][val_iInst][MESH_0]->GetnPoint(); iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        ref  = SU2_TYPE::GetValue(solver->node[iPoint]->GetSolution(iVar));
+        diff = fabs(state[offset++] - ref);
+        if (geometry_container[val_iZone][val_iInst][MESH_0]->node[iPoint]->GetDomain()) {
+          Max_Diff[iSol] = max(Max_Diff[iSol], diff);
+          Max_Ref[iSol]  = max(Max_Ref[iSol], fabs(ref));
+        }
+      }
+    }
+  }
+
+#ifdef HAVE_MPI
+  passivedouble Max_Diff_Local[2] = {Max_Diff[0], Max_Diff[1]}, Max_Ref_Local[2] = {Max_Ref[0], Max_Ref[1]};
+  SU2_MPI::Allreduce(Max_Diff_Local, Max_Diff, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Max_Ref_Local, Max_Ref, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  for (iSol = 0; iSol < nSol; iSol++)
+    if (Max_Ref[iSol] > 0.0) Rel_Diff = max(Rel_Diff, Max_Diff[iSol]/Max_Ref[iSol]);
+
+  if (rank == MASTER_NODE)
+    cout << " Recomputed direct iteration " << val_DirectIter << " differs from its restart file by "
+         << Rel_Diff << " (maximum relative difference)." << endl;
+
+  if (Rel_Diff > SU2_TYPE::GetValue(config->GetUnst_AdjointCheckpointVerify())) {
+    SU2_MPI::Error(string("The recomputed direct solution does not match the restart file ") + filename +
+                   string(".\nCheck UNST_INT_ITER and the convergence criteria against the direct run."), CURRENT_FUNCTION);
+  }
+
+}
+
+void CDiscAdjFluidIteration::GetPrimal_State(CGeometry ****geometry_container,
+                                             CSolver *****solver_container,
+                                             CConfig **config_container,
+                                             unsigned short val_iZone,
+                                             unsigned short val_iInst,
+                                             unsigned short kind_state,
+                                             vector<passivedouble> &state) {
+
+  unsigned short iMesh, iSol, iVar, nVar, nSol = turbulent? 2 : 1;
+  unsigned short SolPosition[2] = {FLOW_SOL, TURB_SOL};
+  unsigned long iPoint;
+  su2double *values = NULL;
+  CSolver *solver;
+
+  for (iMesh = 0; iMesh <= config_container[val_iZone]->GetnMGLevels(); iMesh++) {
+    for (iSol = 0; iSol < nSol; iSol++) {
+      solver = solver_container[val_iZone][val_iInst][iMesh][SolPosition[iSol]];
+      nVar = solver->GetnVar();
+      for (iPoint = 0; iPoint < geometry_container[val_iZone][val_iInst][iMesh]->GetnPoint(); iPoint++) {
+        switch (kind_state) {
+          case PRIMAL_SOLUTION: values = solver->node[iPoint]->GetSolution(); break;
+          case PRIMAL_TIME_N:   values = solver->node[iPoint]->GetSolution_time_n(); break;
+          case PRIMAL_TIME_N1:  values = solver->node[iPoint]->GetSolution_time_n1(); break;
+        }
+        for (iVar = 0; iVar < nVar; iVar++)
+          state.push_back(SU2_TYPE::GetValue(values[iVar]));
+      }
+    }
+  }
+
+}
+
+void CDiscAdjFluidIteration::SetPrimal_State(CGeometry ****geometry_container,
+                                             CSolver *****solver_container,
+                                             CConfig **config_container,
+                                             unsigned short val_iZone,
+                                             unsigned short val_iInst,
+                                             unsigned short kind_state,
+                                             const vector<passivedouble> &state,
+                                             unsigned long offset) {
+
+  unsigned short iMesh, iSol, iVar, nVar, nSol = turbulent? 2 : 1;
+  unsigned short SolPosition[2] = {FLOW_SOL, TURB_SOL};
+  unsigned long iPoint;
+  su2double *values = NULL;
+  CSolver *solver;
+
+  for (iMesh = 0; iMesh <= config_container[val_iZone]->GetnMGLevels(); iMesh++) {
+    for (iSol = 0; iSol < nSol; iSol++) {
+      solver = solver_container[val_iZone][val_iInst][iMesh][SolPosition[iSol]];
+      nVar = solver->GetnVar();
+      for (iPoint = 0; iPoint < geometry_container[val_iZone][val_iInst][iMesh]->GetnPoint(); iPoint++) {
+        switch (kind_state) {
+          case PRIMAL_SOLUTION: values = solver->node[iPoint]->GetSolution(); break;
+          case PRIMAL_TIME_N:   values = solver->node[iPoint]->GetSolution_time_n(); break;
+          case PRIMAL_TIME_N1:  values = solver->node[iPoint]->GetSolution_time_n1(); break;
+        }
+        for (iVar = 0; iVar < nVar; iVar++)
+          values[iVar] = state[offset++];
+      }
+    }
+  }
+
+}
+
+unsigned long CDiscAdjFluidIteration::Snapshot_Offset(unsigned long nSteps, unsigned long nFree) const {
+
+  unsigned long iSweep = 0, i;
+  passivedouble Reach, Reach_Less;
+
+  if ((nFree == 0) || (nSteps <= 1)) return nSteps;
+
+  /*--- Smallest number of sweeps r such that nFree snapshots reverse nSteps time steps,
+   i.e. C(nFree+r, nFree) >= nSteps. The first snapshot is placed such that the remaining
+   time steps can be reversed with one snapshot less in the same number of sweeps. ---*/
+
+  do {
+    iSweep++;
+    Reach = 1.0; Reach_Less = 1.0;
+    for (i = 1; i <= nFree; i++) {
+      Reach *= passivedouble(iSweep+i)/passivedouble(i);
+      if (i < nFree) Reach_Less = Reach;
+    }
+  } while (Reach < passivedouble(nSteps));
+
+  if (passivedouble(nSteps) > Reach_Less+1.0) return nSteps - (unsigned long)(Reach_Less);
+  return 1;
+
+}
+
 void CDiscAdjFluidIteration::Iterate(COutput *output,
                                         CIntegration ****integration_container,
                                         CGeometry ****geometry_container,
@@ -36,6 +36,7 @@
  */
 
 #include "../include/numerics_structure.hpp"
+#include "../../Common/include/omp_structure.hpp"
 #include <limits>
 
 CCentJST_Flow::CCentJST_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
@@ -3175,6 +3176,16 @@ CUpwRoe_Flow::CUpwRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CCo
     P_Tensor[iVar] = new su2double [nVar];
     invP_Tensor[iVar] = new su2double [nVar];
   }
+  
+  /*--- Lane-contiguous storage of the batched kernel ---*/
+  
+  Batch_V_i        = new su2double [(nDim+3)*nBatch];
+  Batch_V_j        = new su2double [(nDim+3)*nBatch];
+  Batch_Normal     = new su2double [nDim*nBatch];
+  Batch_Residual   = new su2double [nVar*nBatch];
+  Batch_Jacobian_i = new su2double [nVar*nVar*nBatch];
+  Batch_Jacobian_j = new su2double [nVar*nVar*nBatch];
+  
 }
 
 CUpwRoe_Flow::~CUpwRoe_Flow(void) {
@@ -3196,6 +3207,13 @@ CUpwRoe_Flow::~CUpwRoe_Flow(void) {
   delete [] P_Tensor;
   delete [] invP_Tensor;
   
+  delete [] Batch_V_i;
+  delete [] Batch_V_j;
+  delete [] Batch_Normal;
+  delete [] Batch_Residual;
+  delete [] Batch_Jacobian_i;
+  delete [] Batch_Jacobian_j;
+  
 }
 
 void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
@@ -3396,6 +3414,284 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   
 }
 
+unsigned short CUpwRoe_Flow::GetBatchSize(void) {
+
+  /*--- The AD types cannot be vectorized, and the per-edge preaccumulation
+   of the scalar kernel is cheaper to record than a batch. ---*/
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  return 0;
+#else
+  if (grid_movement || roe_low_dissipation) return 0;
+  return nBatch;
+#endif
+
+}
+
+void CUpwRoe_Flow::SetPrimitive_Batch(unsigned short val_lane, su2double *val_v_i, su2double *val_v_j, su2double *val_normal) {
+
+  /*--- Velocity, pressure, density and enthalpy (the temperature is not needed). ---*/
+
+  for (iVar = 0; iVar < nDim+3; iVar++) {
+    Batch_V_i[iVar*nBatch+val_lane] = val_v_i[iVar+1];
+    Batch_V_j[iVar*nBatch+val_lane] = val_v_j[iVar+1];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    Batch_Normal[iDim*nBatch+val_lane] = val_normal[iDim];
+
+}
+
+void CUpwRoe_Flow::ComputeResidual_Batch(unsigned short val_nlane, CConfig *config) {
+
+  if (nDim == 2) ComputeResidual_Batch_nDim<2>(val_nlane, config);
+  else           ComputeResidual_Batch_nDim<3>(val_nlane, config);
+
+}
+
+template<unsigned short nDim_>
+void CUpwRoe_Flow::ComputeResidual_Batch_nDim(unsigned short val_nlane, CConfig *config) {
+
+  const unsigned short nVar_ = nDim_+2;
+  const su2double Delta = config->GetEntropyFix_Coeff();
+  const su2double Gamma_ = Gamma, Gamma_Minus_One_ = Gamma_Minus_One, kappa_ = kappa;
+  unsigned short iLane, iDim_, jDim_, iVar_, jVar_;
+
+  const su2double *V_i_ = Batch_V_i, *V_j_ = Batch_V_j, *Normal_ = Batch_Normal;
+  su2double *Res_ = Batch_Residual, *Jac_i_ = Batch_Jacobian_i, *Jac_j_ = Batch_Jacobian_j;
+
+  /*--- Lane-contiguous quantities that the Jacobians reuse ---*/
+
+  su2double ProjVel_i[nBatch], ProjVel_j[nBatch], phi_i[nBatch], phi_j[nBatch], a1_i[nBatch], a1_j[nBatch];
+  su2double Lambda_u[nBatch], Lambda_p[nBatch], Lambda_m[nBatch], Dissip[nBatch], Kappa_Valid[nBatch];
+  su2double r_p[nVar_][nBatch], r_m[nVar_][nBatch], l_p[nVar_][nBatch], l_m[nVar_][nBatch];
+
+  /*--- Same scheme as ComputeResidual, but the dissipation matrix is assembled from its
+   closed form |A| = |l_u| I + (|l_+|-|l_u|) r_+ l_+^T + (|l_-|-|l_u|) r_- l_-^T, which
+   avoids the P and inverse P tensors and keeps the lane loops free of branches. ---*/
+
+  SU2_OMP_SIMD
+  for (iLane = 0; iLane < val_nlane; iLane++) {
+
+    su2double Normal[nDim_], UnitNormal[nDim_], Velocity_i[nDim_], Velocity_j[nDim_], RoeVelocity[nDim_];
+    su2double Diff_U[nVar_];
+
+    /*--- Face area and unit normal ---*/
+
+    su2double Area = 0.0;
+    for (iDim_ = 0; iDim_ < nDim_; iDim_++) {
+      Normal[iDim_] = Normal_[iDim_*nBatch+iLane];
+      Area += Normal[iDim_]*Normal[iDim_];
+    }
+    Area = sqrt(Area);
+    for (iDim_ = 0; iDim_ < nDim_; iDim_++)
+      UnitNormal[iDim_] = Normal[iDim_]/Area;
+
+    /*--- Primitive variables at point i and j ---*/
+
+    for (iDim_ = 0; iDim_ < nDim_; iDim_++) {
+      Velocity_i[iDim_] = V_i_[iDim_*nBatch+iLane];
+      Velocity_j[iDim_] = V_j_[iDim_*nBatch+iLane];
+    }
+    const su2double Pressure_i = V_i_[nDim_*nBatch+iLane],     Pressure_j = V_j_[nDim_*nBatch+iLane];
+    const su2double Density_i  = V_i_[(nDim_+1)*nBatch+iLane], Density_j  = V_j_[(nDim_+1)*nBatch+iLane];
+    const su2double Enthalpy_i = V_i_[(nDim_+2)*nBatch+iLane], Enthalpy_j = V_j_[(nDim_+2)*nBatch+iLane];
+    const su2double Energy_i = Enthalpy_i - Pressure_i/Density_i;
+    const su2double Energy_j = Enthalpy_j - Pressure_j/Density_j;
+
+    /*--- Difference of the conservative variables and projected velocities ---*/
+
+    su2double ProjVelocity_i = 0.0, ProjVelocity_j = 0.0, sq_vel_i = 0.0, sq_vel_j = 0.0;
+    Diff_U[0] = Density_j-Density_i;
+    for (iDim_ = 0; iDim_ < nDim_; iDim_++) {
+      Diff_U[iDim_+1] = Density_j*Velocity_j[iDim_]-Density_i*Velocity_i[iDim_];
+      ProjVelocity_i += Velocity_i[iDim_]*Normal[iDim_]; ProjVelocity_j += Velocity_j[iDim_]*Normal[iDim_];
+      sq_vel_i += Velocity_i[iDim_]*Velocity_i[iDim_]; sq_vel_j += Velocity_j[iDim_]*Velocity_j[iDim_];
+    }
+    Diff_U[nDim_+1] = Density_j*Energy_j-Density_i*Energy_i;
+
+    /*--- Roe-averaged variables at interface between i & j ---*/
+
+    const su2double R = sqrt(fabs(Density_j/Density_i));
+    su2double sq_vel = 0.0, ProjVelocity = 0.0;
+    for (iDim_ = 0; iDim_ < nDim_; iDim_++) {
+      RoeVelocity[iDim_] = (R*Velocity_j[iDim_]+Velocity_i[iDim_])/(R+1);
+      sq_vel += RoeVelocity[iDim_]*RoeVelocity[iDim_];
+      ProjVelocity += RoeVelocity[iDim_]*UnitNormal[iDim_];
+    }
+    const su2double RoeEnthalpy = (R*Enthalpy_j+Enthalpy_i)/(R+1);
+    const su2double RoeSoundSpeed2 = Gamma_Minus_One_*(RoeEnthalpy-0.5*sq_vel);
+
+    /*--- Negative RoeSoundSpeed2, the jump variables are too large, the lane
+     is evaluated with a dummy sound speed and its flux is discarded. ---*/
+
+    const su2double Valid = (RoeSoundSpeed2 > 0.0)? 1.0 : 0.0;
+    const su2double RoeSoundSpeed2_ = (RoeSoundSpeed2 > 0.0)? RoeSoundSpeed2 : 1.0;
+    const su2double RoeSoundSpeed = sqrt(RoeSoundSpeed2_);
+
+    /*--- Eigenvalues with Mavriplis' entropy correction ---*/
+
+    const su2double MaxLambda = fabs(ProjVelocity) + RoeSoundSpeed;
+    Lambda_u[iLane] = max(fabs(ProjVelocity), Delta*MaxLambda);
+    Lambda_p[iLane] = max(fabs(ProjVelocity+RoeSoundSpeed), Delta*MaxLambda) - Lambda_u[iLane];
+    Lambda_m[iLane] = max(fabs(ProjVelocity-RoeSoundSpeed), Delta*MaxLambda) - Lambda_u[iLane];
+
+    /*--- Acoustic right and left eigenvectors ---*/
+
+    const su2double phi = 0.5*Gamma_Minus_One_*sq_vel, inv_2c2 = 0.5/RoeSoundSpeed2_;
+    r_p[0][iLane] = 1.0; r_m[0][iLane] = 1.0;
+    l_p[0][iLane] = (phi - RoeSoundSpeed*ProjVelocity)*inv_2c2;
+    l_m[0][iLane] = (phi + RoeSoundSpeed*ProjVelocity)*inv_2c2;
+    for (iDim_ = 0; iDim_ < nDim_; iDim_++) {
+      r_p[iDim_+1][iLane] = RoeVelocity[iDim_] + RoeSoundSpeed*UnitNormal[iDim_];
+      r_m[iDim_+1][iLane] = RoeVelocity[iDim_] - RoeSoundSpeed*UnitNormal[iDim_];
+      l_p[iDim_+1][iLane] = (-Gamma_Minus_One_*RoeVelocity[iDim_] + RoeSoundSpeed*UnitNormal[iDim_])*inv_2c2;
+      l_m[iDim_+1][iLane] = (-Gamma_Minus_One_*RoeVelocity[iDim_] - RoeSoundSpeed*UnitNormal[iDim_])*inv_2c2;
+    }
+    r_p[nVar_-1][iLane] = RoeEnthalpy + RoeSoundSpeed*ProjVelocity;
+    r_m[nVar_-1][iLane] = RoeEnthalpy - RoeSoundSpeed*ProjVelocity;
+    l_p[nVar_-1][iLane] = Gamma_Minus_One_*inv_2c2;
+    l_m[nVar_-1][iLane] = Gamma_Minus_One_*inv_2c2;
+
+    /*--- Roe's flux approximation, kappa*(F_i+F_j) - (1-kappa)*|A|*(U_j-U_i)*Area ---*/
+
+    su2double Wave_p = 0.0, Wave_m = 0.0;
+    for (iVar_ = 0; iVar_ < nVar_; iVar_++) {
+      Wave_p += l_p[iVar_][iLane]*Diff_U[iVar_];
+      Wave_m += l_m[iVar_][iLane]*Diff_U[iVar_];
+    }
+    Dissip[iLane] = Valid*(1.0-kappa_)*Area;
+
+    const su2double MassFlux_i = Density_i*ProjVelocity_i, MassFlux_j = Density_j*ProjVelocity_j;
+    su2double Flux[nVar_];
+    Flux[0] = MassFlux_i + MassFlux_j;
+    for (iDim_ = 0; iDim_ < nDim_; iDim_++)
+      Flux[iDim_+1] = MassFlux_i*Velocity_i[iDim_] + MassFlux_j*Velocity_j[iDim_] + (Pressure_i+Pressure_j)*Normal[iDim_];
+    Flux[nVar_-1] = MassFlux_i*Enthalpy_i + MassFlux_j*Enthalpy_j;
+
+    for (iVar_ = 0; iVar_ < nVar_; iVar_++)
+      Res_[iVar_*nBatch+iLane] = Valid*kappa_*Flux[iVar_] - Dissip[iLane]*(Lambda_u[iLane]*Diff_U[iVar_] +
+                                                                         Lambda_p[iLane]*r_p[iVar_][iLane]*Wave_p +
+                                                                         Lambda_m[iLane]*r_m[iVar_][iLane]*Wave_m);
+
+    /*--- Quantities of the flux Jacobians (scaled by Valid, which discards the whole lane) ---*/
+
+    ProjVel_i[iLane] = ProjVelocity_i; ProjVel_j[iLane] = ProjVelocity_j;
+    phi_i[iLane] = 0.5*Gamma_Minus_One_*sq_vel_i; a1_i[iLane] = Gamma_*Energy_i-phi_i[iLane];
+    phi_j[iLane] = 0.5*Gamma_Minus_One_*sq_vel_j; a1_j[iLane] = Gamma_*Energy_j-phi_j[iLane];
+    Kappa_Valid[iLane] = Valid*kappa_;
+  }
+
+  if (!implicit) return;
+
+  /*--- Jacobians, one lane loop per entry. The inviscid flux Jacobian (scaled by
+   kappa, see GetInviscidProjJac) plus or minus the dissipation matrix. ---*/
+
+  for (iVar_ = 0; iVar_ < nVar_; iVar_++) {
+    for (jVar_ = 0; jVar_ < nVar_; jVar_++) {
+
+      su2double *Jac_i = &Jac_i_[(iVar_*nVar_+jVar_)*nBatch], *Jac_j = &Jac_j_[(iVar_*nVar_+jVar_)*nBatch];
+      const su2double Diag = (iVar_ == jVar_)? 1.0 : 0.0;
+
+      /*--- Dissipation matrix ---*/
+
+      SU2_OMP_SIMD
+      for (iLane = 0; iLane < val_nlane; iLane++) {
+        su2double ModJac = Diag*Lambda_u[iLane] + Lambda_p[iLane]*r_p[iVar_][iLane]*l_p[jVar_][iLane] +
+                           Lambda_m[iLane]*r_m[iVar_][iLane]*l_m[jVar_][iLane];
+        Jac_i[iLane] =  Dissip[iLane]*ModJac;
+        Jac_j[iLane] = -Dissip[iLane]*ModJac;
+      }
+
+      /*--- Inviscid flux Jacobian ---*/
+
+      if (iVar_ == 0) {
+        if ((jVar_ > 0) && (jVar_ < nVar_-1)) {
+          jDim_ = jVar_-1;
+          SU2_OMP_SIMD
+          for (iLane = 0; iLane < val_nlane; iLane++) {
+            const su2double Normal = Normal_[jDim_*nBatch+iLane];
+            Jac_i[iLane] += Kappa_Valid[iLane]*Normal;
+            Jac_j[iLane] += Kappa_Valid[iLane]*Normal;
+          }
+        }
+      }
+      else if (iVar_ < nVar_-1) {
+        iDim_ = iVar_-1;
+        if (jVar_ == 0) {
+          SU2_OMP_SIMD
+          for (iLane = 0; iLane < val_nlane; iLane++) {
+            const su2double Normal = Normal_[iDim_*nBatch+iLane];
+            Jac_i[iLane] += Kappa_Valid[iLane]*(Normal*phi_i[iLane] - V_i_[iDim_*nBatch+iLane]*ProjVel_i[iLane]);
+            Jac_j[iLane] += Kappa_Valid[iLane]*(Normal*phi_j[iLane] - V_j_[iDim_*nBatch+iLane]*ProjVel_j[iLane]);
+          }
+        }
+        else if (jVar_ < nVar_-1) {
+          jDim_ = jVar_-1;
+          SU2_OMP_SIMD
+          for (iLane = 0; iLane < val_nlane; iLane++) {
+            const su2double Normal_i = Normal_[iDim_*nBatch+iLane], Normal_j = Normal_[jDim_*nBatch+iLane];
+            Jac_i[iLane] += Kappa_Valid[iLane]*(Normal_j*V_i_[iDim_*nBatch+iLane] - Gamma_Minus_One_*Normal_i*V_i_[jDim_*nBatch+iLane] +
+                                           Diag*ProjVel_i[iLane]);
+            Jac_j[iLane] += Kappa_Valid[iLane]*(Normal_j*V_j_[iDim_*nBatch+iLane] - Gamma_Minus_One_*Normal_i*V_j_[jDim_*nBatch+iLane] +
+                                           Diag*ProjVel_j[iLane]);
+          }
+        }
+        else {
+          SU2_OMP_SIMD
+          for (iLane = 0; iLane < val_nlane; iLane++) {
+            const su2double Normal = Normal_[iDim_*nBatch+iLane];
+            Jac_i[iLane] += Kappa_Valid[iLane]*Gamma_Minus_One_*Normal;
+            Jac_j[iLane] += Kappa_Valid[iLane]*Gamma_Minus_One_*Normal;
+          }
+        }
+      }
+      else {
+        if (jVar_ == 0) {
+          SU2_OMP_SIMD
+          for (iLane = 0; iLane < val_nlane; iLane++) {
+            Jac_i[iLane] += Kappa_Valid[iLane]*ProjVel_i[iLane]*(phi_i[iLane]-a1_i[iLane]);
+            Jac_j[iLane] += Kappa_Valid[iLane]*ProjVel_j[iLane]*(phi_j[iLane]-a1_j[iLane]);
+          }
+        }
+        else if (jVar_ < nVar_-1) {
+          jDim_ = jVar_-1;
+          SU2_OMP_SIMD
+          for (iLane = 0; iLane < val_nlane; iLane++) {
+            const su2double Normal = Normal_[jDim_*nBatch+iLane];
+            Jac_i[iLane] += Kappa_Valid[iLane]*(Normal*a1_i[iLane] - Gamma_Minus_One_*V_i_[jDim_*nBatch+iLane]*ProjVel_i[iLane]);
+            Jac_j[iLane] += Kappa_Valid[iLane]*(Normal*a1_j[iLane] - Gamma_Minus_One_*V_j_[jDim_*nBatch+iLane]*ProjVel_j[iLane]);
+          }
+        }
+        else {
+          SU2_OMP_SIMD
+          for (iLane = 0; iLane < val_nlane; iLane++) {
+            Jac_i[iLane] += Kappa_Valid[iLane]*Gamma_*ProjVel_i[iLane];
+            Jac_j[iLane] += Kappa_Valid[iLane]*Gamma_*ProjVel_j[iLane];
+          }
+        }
+      }
+    }
+  }
+
+}
+
+void CUpwRoe_Flow::GetResidual_Batch(unsigned short val_lane, su2double *val_residual,
+                                     su2double **val_Jacobian_i, su2double **val_Jacobian_j) {
+
+  for (iVar = 0; iVar < nVar; iVar++)
+    val_residual[iVar] = Batch_Residual[iVar*nBatch+val_lane];
+
+  if (implicit) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nVar; jVar++) {
+        val_Jacobian_i[iVar][jVar] = Batch_Jacobian_i[(iVar*nVar+jVar)*nBatch+val_lane];
+        val_Jacobian_j[iVar][jVar] = Batch_Jacobian_j[(iVar*nVar+jVar)*nBatch+val_lane];
+      }
+    }
+  }
+
+}
+
 CUpwGeneralRoe_Flow::CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -2052,33 +2052,41 @@ void COutput::WriteParaViewASCII_Parallel(CConfig *config, CGeometry *geometry,
 
   /*--- Open Paraview ASCII file and write the header. ---*/
 
+  ostream &paraview_out = OutputStream(Paraview_File);
+  int firstProcessor = (Async_Output? rank : 0), lastProcessor = (Async_Output? rank+1 : size);
+
     if (rank == MASTER_NODE) {
-  Paraview_File.open(cstr, ios::out);
-  Paraview_File.precision(6);
-  Paraview_File << "# vtk DataFile Version 3.0\n";
-  Paraview_File << "vtk output\n";
-  Paraview_File << "ASCII\n";
-  Paraview_File << "DATASET UNSTRUCTURED_GRID\n";
+  if (!Async_Output) Paraview_File.open(cstr, ios::out);
+  paraview_out.precision(6);
+  paraview_out << "# vtk DataFile Version 3.0\n";
+  paraview_out << "vtk output\n";
+  paraview_out << "ASCII\n";
+  paraview_out << "DATASET UNSTRUCTURED_GRID\n";
 
   /*--- Write the header ---*/
-  if (surf_sol) Paraview_File << "POINTS "<< nGlobal_Surf_Poin <<" double\n";
-  else Paraview_File << "POINTS "<< nGlobal_Poin_Par <<" double\n";
+  if (surf_sol) paraview_out << "POINTS "<< nGlobal_Surf_Poin <<" double\n";
+  else paraview_out << "POINTS "<< nGlobal_Poin_Par <<" double\n";
 
     }
 
-  Paraview_File.close();
+  if (Async_Output) {
+    NextOutputSection(Paraview_File);
+  }
+  else {
+    Paraview_File.close();
 
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
 #endif
 
-  /*--- Each processor opens the file. ---*/
+    /*--- Each processor opens the file. ---*/
 
-  Paraview_File.open(cstr, ios::out | ios::app);
+    Paraview_File.open(cstr, ios::out | ios::app);
+  }
 
   /*--- Write surface and volumetric point coordinates. ---*/
 
-  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+  for (iProcessor = firstProcessor; iProcessor < lastProcessor; iProcessor++) {
     if (rank == iProcessor) {
 
       /*--- Write the node data from this proc ---*/
@@ -2086,22 +2094,19 @@ void COutput::WriteParaViewASCII_Parallel(CConfig *config, CGeometry *geometry,
       if (surf_sol) {
         for (iPoint = 0; iPoint < nSurf_Poin_Par; iPoint++) {
           for (iDim = 0; iDim < nDim; iDim++)
-            Paraview_File << scientific << Parallel_Surf_Data[iDim][iPoint] << "\t";
-          if (nDim == 2) Paraview_File << scientific << "0.0" << "\t";
+            paraview_out << scientific << Parallel_Surf_Data[iDim][iPoint] << "\t";
+          if (nDim == 2) paraview_out << scientific << "0.0" << "\t";
         }
       } else {
 
         for (iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
           for (iDim = 0; iDim < nDim; iDim++)
-            Paraview_File << scientific << Parallel_Data[iDim][iPoint] << "\t";
-          if (nDim == 2) Paraview_File << scientific << "0.0" << "\t";
+            paraview_out << scientific << Parallel_Data[iDim][iPoint] << "\t";
+          if (nDim == 2) paraview_out << scientific << "0.0" << "\t";
         }
       }
     }
-    Paraview_File.flush();
-#ifdef HAVE_MPI
-    SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+    NextOutputSection(Paraview_File);
   }
 
   /*--- Reduce the total number of each element. ---*/
@@ -2137,45 +2142,42 @@ void COutput::WriteParaViewASCII_Parallel(CConfig *config, CGeometry *geometry,
   nSurf_Elem_Storage = nTot_Line*3 +nTot_BoundTria*4 + nTot_BoundQuad*5;
   nGlobal_Elem_Storage = nTot_Tria*4 + nTot_Quad*5 + nTot_Tetr*5 + nTot_Hexa*9 + nTot_Pris*7 + nTot_Pyra*6;
 
-  if (surf_sol) Paraview_File << "\nCELLS " << nSurf_Elem_Par << "\t" << nSurf_Elem_Storage << "\n";
-  else Paraview_File << "\nCELLS " << nGlobal_Elem_Par << "\t" << nGlobal_Elem_Storage << "\n";
+  if (surf_sol) paraview_out << "\nCELLS " << nSurf_Elem_Par << "\t" << nSurf_Elem_Storage << "\n";
+  else paraview_out << "\nCELLS " << nGlobal_Elem_Par << "\t" << nGlobal_Elem_Storage << "\n";
 
   }
 
-  Paraview_File.flush();
-#ifdef HAVE_MPI
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+  NextOutputSection(Paraview_File);
 
   /*--- Write connectivity data. ---*/
 
-  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+  for (iProcessor = firstProcessor; iProcessor < lastProcessor; iProcessor++) {
     if (rank == iProcessor) {
 
   if (surf_sol) {
 
     for (iElem = 0; iElem < nParallel_Line; iElem++) {
       iNode = iElem*N_POINTS_LINE;
-      Paraview_File << N_POINTS_LINE << "\t";
-      Paraview_File << Conn_BoundLine_Par[iNode+0]-1 << "\t";
-      Paraview_File << Conn_BoundLine_Par[iNode+1]-1 << "\t";
+      paraview_out << N_POINTS_LINE << "\t";
+      paraview_out << Conn_BoundLine_Par[iNode+0]-1 << "\t";
+      paraview_out << Conn_BoundLine_Par[iNode+1]-1 << "\t";
     }
 
     for (iElem = 0; iElem < nParallel_BoundTria; iElem++) {
       iNode = iElem*N_POINTS_TRIANGLE;
-      Paraview_File << N_POINTS_TRIANGLE << "\t";
-      Paraview_File << Conn_BoundTria_Par[iNode+0]-1 << "\t";
-      Paraview_File << Conn_BoundTria_Par[iNode+1]-1 << "\t";
-      Paraview_File << Conn_BoundTria_Par[iNode+2]-1 << "\t";
+      paraview_out << N_POINTS_TRIANGLE << "\t";
+      paraview_out << Conn_BoundTria_Par[iNode+0]-1 << "\t";
+      paraview_out << Conn_BoundTria_Par[iNode+1]-1 << "\t";
+      paraview_out << Conn_BoundTria_Par[iNode+2]-1 << "\t";
     }
 
     for (iElem = 0; iElem < nParallel_BoundQuad; iElem++) {
       iNode = iElem*N_POINTS_QUADRILATERAL;
-      Paraview_File << N_POINTS_QUADRILATERAL << "\t";
-      Paraview_File << Conn_BoundQuad_Par[iNode+0]-1 << "\t";
-      Paraview_File << Conn_BoundQuad_Par[iNode+1]-1 << "\t";
-      Paraview_File << Conn_BoundQuad_Par[iNode+2]-1 << "\t";
-      Paraview_File << Conn_BoundQuad_Par[iNode+3]-1 << "\t";
+      paraview_out << N_POINTS_QUADRILATERAL << "\t";
+      paraview_out << Conn_BoundQuad_Par[iNode+0]-1 << "\t";
+      paraview_out << Conn_BoundQuad_Par[iNode+1]-1 << "\t";
+      paraview_out << Conn_BoundQuad_Par[iNode+2]-1 << "\t";
+      paraview_out << Conn_BoundQuad_Par[iNode+3]-1 << "\t";
     }
 
   }
@@ -2183,103 +2185,93 @@ void COutput::WriteParaViewASCII_Parallel(CConfig *config, CGeometry *geometry,
 
     for (iElem = 0; iElem < nParallel_Tria; iElem++) {
       iNode = iElem*N_POINTS_TRIANGLE;
-      Paraview_File << N_POINTS_TRIANGLE << "\t";
-      Paraview_File << Conn_Tria_Par[iNode+0]-1 << "\t";
-      Paraview_File << Conn_Tria_Par[iNode+1]-1 << "\t";
-      Paraview_File << Conn_Tria_Par[iNode+2]-1 << "\t";
+      paraview_out << N_POINTS_TRIANGLE << "\t";
+      paraview_out << Conn_Tria_Par[iNode+0]-1 << "\t";
+      paraview_out << Conn_Tria_Par[iNode+1]-1 << "\t";
+      paraview_out << Conn_Tria_Par[iNode+2]-1 << "\t";
     }
 
     for (iElem = 0; iElem < nParallel_Quad; iElem++) {
       iNode = iElem*N_POINTS_QUADRILATERAL;
-      Paraview_File << N_POINTS_QUADRILATERAL << "\t";
-      Paraview_File << Conn_Quad_Par[iNode+0]-1 << "\t";
-      Paraview_File << Conn_Quad_Par[iNode+1]-1 << "\t";
-      Paraview_File << Conn_Quad_Par[iNode+2]-1 << "\t";
-      Paraview_File << Conn_Quad_Par[iNode+3]-1 << "\t";
+      paraview_out << N_POINTS_QUADRILATERAL << "\t";
+      paraview_out << Conn_Quad_Par[iNode+0]-1 << "\t";
+      paraview_out << Conn_Quad_Par[iNode+1]-1 << "\t";
+      paraview_out << Conn_Quad_Par[iNode+2]-1 << "\t";
+      paraview_out << Conn_Quad_Par[iNode+3]-1 << "\t";
     }
 
     for (iElem = 0; iElem < nParallel_Tetr; iElem++) {
       iNode = iElem*N_POINTS_TETRAHEDRON;
-      Paraview_File << N_POINTS_TETRAHEDRON << "\t";
-      Paraview_File << Conn_Tetr_Par[iNode+0]-1 << "\t" << Conn_Tetr_Par[iNode+1]-1 << "\t";
-      Paraview_File << Conn_Tetr_Par[iNode+2]-1 << "\t" << Conn_Tetr_Par[iNode+3]-1 << "\t";
+      paraview_out << N_POINTS_TETRAHEDRON << "\t";
+      paraview_out << Conn_Tetr_Par[iNode+0]-1 << "\t" << Conn_Tetr_Par[iNode+1]-1 << "\t";
+      paraview_out << Conn_Tetr_Par[iNode+2]-1 << "\t" << Conn_Tetr_Par[iNode+3]-1 << "\t";
     }
 
     for (iElem = 0; iElem < nParallel_Hexa; iElem++) {
       iNode = iElem*N_POINTS_HEXAHEDRON;
-      Paraview_File << N_POINTS_HEXAHEDRON << "\t";
-      Paraview_File << Conn_Hexa_Par[iNode+0]-1 << "\t" << Conn_Hexa_Par[iNode+1]-1 << "\t";
-      Paraview_File << Conn_Hexa_Par[iNode+2]-1 << "\t" << Conn_Hexa_Par[iNode+3]-1 << "\t";
-      Paraview_File << Conn_Hexa_Par[iNode+4]-1 << "\t" << Conn_Hexa_Par[iNode+5]-1 << "\t";
-      Paraview_File << Conn_Hexa_Par[iNode+6]-1 << "\t" << Conn_Hexa_Par[iNode+7]-1 << "\t";
+      paraview_out << N_POINTS_HEXAHEDRON << "\t";
+      paraview_out << Conn_Hexa_Par[iNode+0]-1 << "\t" << Conn_Hexa_Par[iNode+1]-1 << "\t";
+      paraview_out << Conn_Hexa_Par[iNode+2]-1 << "\t" << Conn_Hexa_Par[iNode+3]-1 << "\t";
+      paraview_out << Conn_Hexa_Par[iNode+4]-1 << "\t" << Conn_Hexa_Par[iNode+5]-1 << "\t";
+      paraview_out << Conn_Hexa_Par[iNode+6]-1 << "\t" << Conn_Hexa_Par[iNode+7]-1 << "\t";
     }
 
     for (iElem = 0; iElem < nParallel_Pris; iElem++) {
       iNode = iElem*N_POINTS_PRISM;
-      Paraview_File << N_POINTS_PRISM << "\t";
-      Paraview_File << Conn_Pris_Par[iNode+0]-1 << "\t" << Conn_Pris_Par[iNode+1]-1 << "\t";
-      Paraview_File << Conn_Pris_Par[iNode+2]-1 << "\t" << Conn_Pris_Par[iNode+3]-1 << "\t";
-      Paraview_File << Conn_Pris_Par[iNode+4]-1 << "\t" << Conn_Pris_Par[iNode+5]-1 << "\t";
+      paraview_out << N_POINTS_PRISM << "\t";
+      paraview_out << Conn_Pris_Par[iNode+0]-1 << "\t" << Conn_Pris_Par[iNode+1]-1 << "\t";
+      paraview_out << Conn_Pris_Par[iNode+2]-1 << "\t" << Conn_Pris_Par[iNode+3]-1 << "\t";
+      paraview_out << Conn_Pris_Par[iNode+4]-1 << "\t" << Conn_Pris_Par[iNode+5]-1 << "\t";
     }
 
     for (iElem = 0; iElem < nParallel_Pyra; iElem++) {
       iNode = iElem*N_POINTS_PYRAMID;
-      Paraview_File << N_POINTS_PYRAMID << "\t";
-      Paraview_File << Conn_Pyra_Par[iNode+0]-1 << "\t" << Conn_Pyra_Par[iNode+1]-1 << "\t";
-      Paraview_File << Conn_Pyra_Par[iNode+2]-1 << "\t" << Conn_Pyra_Par[iNode+3]-1 << "\t";
-      Paraview_File << Conn_Pyra_Par[iNode+4]-1 << "\t";
+      paraview_out << N_POINTS_PYRAMID << "\t";
+      paraview_out << Conn_Pyra_Par[iNode+0]-1 << "\t" << Conn_Pyra_Par[iNode+1]-1 << "\t";
+      paraview_out << Conn_Pyra_Par[iNode+2]-1 << "\t" << Conn_Pyra_Par[iNode+3]-1 << "\t";
+      paraview_out << Conn_Pyra_Par[iNode+4]-1 << "\t";
     }
   }
-    }    Paraview_File.flush();
-#ifdef HAVE_MPI
-    SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+    }
+    NextOutputSection(Paraview_File);
   }
 
     if (rank == MASTER_NODE) {
 
   /*--- Write the header ---*/
-  if (surf_sol) Paraview_File << "\nCELL_TYPES " << nSurf_Elem_Par << "\n";
-  else Paraview_File << "\nCELL_TYPES " << nGlobal_Elem_Par << "\n";
+  if (surf_sol) paraview_out << "\nCELL_TYPES " << nSurf_Elem_Par << "\n";
+  else paraview_out << "\nCELL_TYPES " << nGlobal_Elem_Par << "\n";
     }
 
-  Paraview_File.flush();
-#ifdef HAVE_MPI
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+  NextOutputSection(Paraview_File);
 
-  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+  for (iProcessor = firstProcessor; iProcessor < lastProcessor; iProcessor++) {
     if (rank == iProcessor) {
       if (surf_sol) {
-        for (iElem = 0; iElem < nParallel_Line; iElem++) Paraview_File << "3\t";
-        for (iElem = 0; iElem < nParallel_BoundTria; iElem++) Paraview_File << "5\t";
-        for (iElem = 0; iElem < nParallel_BoundQuad; iElem++) Paraview_File << "9\t";
+        for (iElem = 0; iElem < nParallel_Line; iElem++) paraview_out << "3\t";
+        for (iElem = 0; iElem < nParallel_BoundTria; iElem++) paraview_out << "5\t";
+        for (iElem = 0; iElem < nParallel_BoundQuad; iElem++) paraview_out << "9\t";
       }
       else {
-        for (iElem = 0; iElem < nParallel_Tria; iElem++) Paraview_File << "5\t";
-        for (iElem = 0; iElem < nParallel_Quad; iElem++) Paraview_File << "9\t";
-        for (iElem = 0; iElem < nParallel_Tetr; iElem++) Paraview_File << "10\t";
-        for (iElem = 0; iElem < nParallel_Hexa; iElem++) Paraview_File << "12\t";
-        for (iElem = 0; iElem < nParallel_Pris; iElem++) Paraview_File << "13\t";
-        for (iElem = 0; iElem < nParallel_Pyra; iElem++) Paraview_File << "14\t";
-      }
-    }    Paraview_File.flush();
-#ifdef HAVE_MPI
-    SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+        for (iElem = 0; iElem < nParallel_Tria; iElem++) paraview_out << "5\t";
+        for (iElem = 0; iElem < nParallel_Quad; iElem++) paraview_out << "9\t";
+        for (iElem = 0; iElem < nParallel_Tetr; iElem++) paraview_out << "10\t";
+        for (iElem = 0; iElem < nParallel_Hexa; iElem++) paraview_out << "12\t";
+        for (iElem = 0; iElem < nParallel_Pris; iElem++) paraview_out << "13\t";
+        for (iElem = 0; iElem < nParallel_Pyra; iElem++) paraview_out << "14\t";
+      }
+    }
+    NextOutputSection(Paraview_File);
   }
   
     if (rank == MASTER_NODE) {
   /*--- Write the header ---*/
-  if (surf_sol) Paraview_File << "\nPOINT_DATA "<< nGlobal_Surf_Poin <<"\n";
-  else Paraview_File << "\nPOINT_DATA "<< nGlobal_Poin_Par <<"\n";
+  if (surf_sol) paraview_out << "\nPOINT_DATA "<< nGlobal_Surf_Poin <<"\n";
+  else paraview_out << "\nPOINT_DATA "<< nGlobal_Poin_Par <<"\n";
 
     }
 
-  Paraview_File.flush();
-#ifdef HAVE_MPI
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+  NextOutputSection(Paraview_File);
 
   unsigned short varStart = 2;
   if (nDim == 3) varStart++;
@@ -2303,20 +2295,14 @@ void COutput::WriteParaViewASCII_Parallel(CConfig *config, CGeometry *geometry,
     if (found!=string::npos) {
       output_variable = false;
       //skip
-      Paraview_File.flush();
-#ifdef HAVE_MPI
-      SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+      NextOutputSection(Paraview_File);
       VarCounter++;
     }
 found = Variable_Names[iField].find("_z");
     if (found!=string::npos) {
       output_variable = false;
       //skip
-      Paraview_File.flush();
-#ifdef HAVE_MPI
-      SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+      NextOutputSection(Paraview_File);
       VarCounter++;
     }
 
@@ -2325,17 +2311,14 @@ found = Variable_Names[iField].find("_z");
       fieldname.erase(fieldname.end()-2,fieldname.end());
 
       if (rank == MASTER_NODE) {
-        Paraview_File << "\nVECTORS " << fieldname << " double\n";
+        paraview_out << "\nVECTORS " << fieldname << " double\n";
       }
 
-      Paraview_File.flush();
-#ifdef HAVE_MPI
-      SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+      NextOutputSection(Paraview_File);
 
       /*--- Write surface and volumetric point coordinates. ---*/
 
-      for (iProcessor = 0; iProcessor < size; iProcessor++) {
+      for (iProcessor = firstProcessor; iProcessor < lastProcessor; iProcessor++) {
         if (rank == iProcessor) {
 
           /*--- Write the node data from this proc ---*/
@@ -2343,22 +2326,19 @@ found = Variable_Names[iField].find("_z");
           if (surf_sol) {
             for (iPoint = 0; iPoint < nSurf_Poin_Par; iPoint++) {
               /*--- Loop over the vars/residuals and write the values to file ---*/
-              Paraview_File << scientific << Parallel_Surf_Data[VarCounter+0][iPoint] << "\t" << Parallel_Surf_Data[VarCounter+1][iPoint] << "\t";
-              if (nDim == 3) Paraview_File << scientific << Parallel_Surf_Data[VarCounter+2][iPoint] << "\t";
-              if (nDim == 2) Paraview_File << scientific << "0.0" << "\t";
+              paraview_out << scientific << Parallel_Surf_Data[VarCounter+0][iPoint] << "\t" << Parallel_Surf_Data[VarCounter+1][iPoint] << "\t";
+              if (nDim == 3) paraview_out << scientific << Parallel_Surf_Data[VarCounter+2][iPoint] << "\t";
+              if (nDim == 2) paraview_out << scientific << "0.0" << "\t";
             }
           } else {
             for (iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
-              Paraview_File << scientific << Parallel_Data[VarCounter+0][iPoint] << "\t" << Parallel_Data[VarCounter+1][iPoint] << "\t";
-              if (nDim == 3) Paraview_File << scientific << Parallel_Data[VarCounter+2][iPoint] << "\t";
-              if (nDim == 2) Paraview_File << scientific << "0.0" << "\t";
+              paraview_out << scientific << Parallel_Data[VarCounter+0][iPoint] << "\t" << Parallel_Data[VarCounter+1][iPoint] << "\t";
+              if (nDim == 3) paraview_out << scientific << Parallel_Data[VarCounter+2][iPoint] << "\t";
+              if (nDim == 2) paraview_out << scientific << "0.0" << "\t";
             }
           }
         }
-        Paraview_File.flush();
-#ifdef HAVE_MPI
-        SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+        NextOutputSection(Paraview_File);
       }
 
       VarCounter++;
@@ -2367,36 +2347,30 @@ found = Variable_Names[iField].find("_z");
 
       if (rank == MASTER_NODE) {
 
-        Paraview_File << "\nSCALARS " << fieldname << " double 1\n";
-        Paraview_File << "LOOKUP_TABLE default\n";
+        paraview_out << "\nSCALARS " << fieldname << " double 1\n";
+        paraview_out << "LOOKUP_TABLE default\n";
       }
 
-      Paraview_File.flush();
-#ifdef HAVE_MPI
-      SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+      NextOutputSection(Paraview_File);
 
       /*--- Write surface and volumetric point coordinates. ---*/
 
-      for (iProcessor = 0; iProcessor < size; iProcessor++) {
+      for (iProcessor = firstProcessor; iProcessor < lastProcessor; iProcessor++) {
         if (rank == iProcessor) {
 
           /*--- Write the node data from this proc ---*/
 
           if (surf_sol) {
             for (iPoint = 0; iPoint < nSurf_Poin_Par; iPoint++) {
-              Paraview_File << scientific << Parallel_Surf_Data[VarCounter][iPoint] << "\t";
+              paraview_out << scientific << Parallel_Surf_Data[VarCounter][iPoint] << "\t";
             }
           } else {
             for (iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
-              Paraview_File << scientific << Parallel_Data[VarCounter][iPoint] << "\t";
+              paraview_out << scientific << Parallel_Data[VarCounter][iPoint] << "\t";
             }
           }
         }
-        Paraview_File.flush();
-#ifdef HAVE_MPI
-        SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+        NextOutputSection(Paraview_File);
       }
       
       VarCounter++;
@@ -2404,7 +2378,8 @@ found = Variable_Names[iField].find("_z");
 
   }
 
-  Paraview_File.close();
+  if (Async_Output) StageOutputFile(cstr);
+  else Paraview_File.close();
   
 }
 
@@ -2866,34 +2841,16 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
   
 #else
   
-  /*--- Parallel binary output using MPI I/O. ---*/
+  /*--- Parallel binary output using MPI I/O. The data of the ranks is gathered
+   on the I/O aggregators, which are the only ranks that access the file. ---*/
   
-  MPI_File fhw;
-  SU2_MPI::Status status;
-  MPI_Datatype etype, filetype;
   MPI_Offset disp, disp2;
-  int ierr;
-  
-  /*--- All ranks open the file using MPI. Here, we try to open the file with
-   exclusive so that an error is generated if the file exists. We always want
-   to write a fresh output file, so we delete any existing files and create
-   a new one. ---*/
   
-  ierr = MPI_File_open(MPI_COMM_WORLD, fname,
-                       MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
-                       MPI_INFO_NULL, &fhw);
-  if (ierr != MPI_SUCCESS)  {
-    MPI_File_close(&fhw);
-    if (rank == 0)
-      MPI_File_delete(fname, MPI_INFO_NULL);
-    ierr = MPI_File_open(MPI_COMM_WORLD, fname,
-                         MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
-                         MPI_INFO_NULL, &fhw);
-  }
+  CIOAggregator IO_Aggregator(config->GetnIO_Aggregators(), config->GetIO_Stripe_Size());
   
-  /*--- Error check opening the file. ---*/
+  /*--- We always want to write a fresh output file, any existing file is replaced. ---*/
   
-  if (ierr) {
+  if (!IO_Aggregator.Open(fname, true)) {
     SU2_MPI::Error(string("Unable to open VTK binary legacy file ") +
                    string(fname), CURRENT_FUNCTION);
   }
@@ -2913,26 +2870,22 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
   disp = 0;
   strcpy(str_buf, "# vtk DataFile Version 3.0\n");
   if (rank == MASTER_NODE)
-    MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
   disp += strlen(str_buf)*sizeof(char);
   
   strcpy(str_buf, "vtk output\n");
   if (rank == MASTER_NODE)
-    MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
   disp += strlen(str_buf)*sizeof(char);
   
   strcpy(str_buf, "BINARY\n");
   if (rank == MASTER_NODE)
-    MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
   disp += strlen(str_buf)*sizeof(char);
   
   strcpy(str_buf, "DATASET UNSTRUCTURED_GRID\n");
   if (rank == MASTER_NODE)
-    MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
   disp += strlen(str_buf)*sizeof(char);
   
   /*--- Communicate the number of total points that will be
@@ -2971,8 +2924,7 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
   
   SPRINTF(str_buf, "POINTS %i float\n", SU2_TYPE::Int(GlobalPoint));
   if (rank == MASTER_NODE)
-    MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
   disp += strlen(str_buf)*sizeof(char);
   
   /*--- Load/write the 1D buffer of point coordinates. Note that we
@@ -2991,39 +2943,21 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
   }
   if (!BigEndian) SwapBytes((char *)coord_buf, sizeof(float), myPoint*NCOORDS);
 
-  /*--- We will write the point coordinates as floats. ---*/
-  
-  etype = MPI_FLOAT;
-  
-  /*--- Define a derived datatype for this ranks contiguous
-   chunk of data that will be placed in the file. ---*/
-  
-  MPI_Type_contiguous(myPoint*NCOORDS, MPI_FLOAT, &filetype);
-  MPI_Type_commit(&filetype);
-  
   /*--- Compute the offset for this rank's linear partition of the
    data in bytes. ---*/
   
   disp2 = disp + NCOORDS*nPoint_Cum[rank]*sizeof(float);
   
-  /*--- Set the view for the MPI file write, i.e., describe the
-   location in the file that this rank "sees" for writing its
-   piece of the file. ---*/
-  
-  MPI_File_set_view(fhw, disp2, etype, filetype,
-                    (char*)"native", MPI_INFO_NULL);
-  
-  /*--- Collective call for all ranks to write simultaneously. ---*/
+  /*--- Collective call for all ranks to write their partition. ---*/
   
-  MPI_File_write_all(fhw, coord_buf, myPoint*NCOORDS, MPI_FLOAT, &status);
+  IO_Aggregator.WriteAt_All(disp2, coord_buf, myPoint*NCOORDS*sizeof(float));
   
   /*--- Update the displacement position for MPI IO. ---*/
   
   disp += NCOORDS*nPoint_Cum[size]*sizeof(float);
   
-  /*--- Free the derived datatype and coordinate array. ---*/
+  /*--- Free the coordinate array. ---*/
   
-  MPI_Type_free(&filetype);
   delete [] coord_buf;
   
   /*--- Compute our local number of elements, the required storage,
@@ -3112,13 +3046,10 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
   
   /*--- Reset the file view before writing the next ASCII line for cells. ---*/
   
-  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
-                    (char*)"native", MPI_INFO_NULL);
   SPRINTF(str_buf, "\nCELLS %i %i\n", SU2_TYPE::Int(GlobalElem),
           SU2_TYPE::Int(GlobalElemStorage));
   if (rank == MASTER_NODE)
-    MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
   disp += strlen(str_buf)*sizeof(char);
   
   /*--- Load/write 1D buffers for the connectivity of each element type. ---*/
@@ -3228,49 +3159,28 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
   }
   if (!BigEndian) SwapBytes((char *)conn_buf, sizeof(int), myElemStorage);
   
-  /*--- We write the connectivity with MPI_INTs. ---*/
-  
-  etype = MPI_INT;
-  
-  /*--- Define a derived datatype for this ranks contiguous
-   chunk of data that will be placed in the file. ---*/
-  
-  MPI_Type_contiguous(myElemStorage, MPI_INT, &filetype);
-  MPI_Type_commit(&filetype);
-  
   /*--- Compute the offset for this rank's linear partition of the
    data in bytes. ---*/
   
   disp2 = (disp + nElemStorage_Cum[rank]*sizeof(int));
   
-  /*--- Set the view for the MPI file write, i.e., describe the
-   location in the file that this rank "sees" for writing its
-   piece of the file. ---*/
-  
-  MPI_File_set_view(fhw, disp2, etype, filetype,
-                    (char*)"native", MPI_INFO_NULL);
+  /*--- Collective call for all ranks to write their partition. ---*/
   
-  /*--- Collective call for all ranks to write simultaneously. ---*/
-  
-  MPI_File_write_all(fhw, conn_buf, myElemStorage, MPI_INT, &status);
+  IO_Aggregator.WriteAt_All(disp2, conn_buf, myElemStorage*sizeof(int));
   
   /*--- Update the displacement position for MPI IO. ---*/
   
   disp += nElemStorage_Cum[size]*sizeof(int);
   
-  /*--- Free the derived datatype. ---*/
+  /*--- Free the buffer. ---*/
   
-  MPI_Type_free(&filetype);
   delete [] conn_buf;
   
   /*--- Load/write the cell type for all elements in the file. ---*/
   
-  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
-                    (char*)"native", MPI_INFO_NULL);
   SPRINTF (str_buf, "\nCELL_TYPES %i\n", SU2_TYPE::Int(GlobalElem));
   if (rank == MASTER_NODE)
-    MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
   disp += strlen(str_buf)*sizeof(char);
   
   int *type_buf = new int[myElem];
@@ -3308,49 +3218,28 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
   }
   if (!BigEndian) SwapBytes((char *)type_buf, sizeof(int), myElem);
 
-  /*--- We write the cell types with MPI_INTs. ---*/
-  
-  etype = MPI_INT;
-  
-  /*--- Define a derived datatype for this ranks contiguous
-   chunk of data that will be placed in the file. ---*/
-  
-  MPI_Type_contiguous(myElem, MPI_INT, &filetype);
-  MPI_Type_commit(&filetype);
-  
   /*--- Compute the offset for this rank's linear partition of the
    data in bytes. ---*/
   
   disp2 = (disp + nElem_Cum[rank]*sizeof(int));
   
-  /*--- Set the view for the MPI file write, i.e., describe the
-   location in the file that this rank "sees" for writing its
-   piece of the file. ---*/
-  
-  MPI_File_set_view(fhw, disp2, etype, filetype,
-                    (char*)"native", MPI_INFO_NULL);
+  /*--- Collective call for all ranks to write their partition. ---*/
   
-  /*--- Collective call for all ranks to write simultaneously. ---*/
-  
-  MPI_File_write_all(fhw, type_buf, myElem, MPI_INT, &status);
+  IO_Aggregator.WriteAt_All(disp2, type_buf, myElem*sizeof(int));
   
   /*--- Update the displacement position for MPI IO. ---*/
   
   disp += nElem_Cum[size]*sizeof(int);
   
-  /*--- Free the derived datatype. ---*/
+  /*--- Free the buffer. ---*/
   
-  MPI_Type_free(&filetype);
   if (type_buf != NULL) delete [] type_buf;
   
   /*--- Now write the scalar and vector point data. ---*/
   
-  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
-                    (char*)"native", MPI_INFO_NULL);
   SPRINTF (str_buf, "\nPOINT_DATA %i\n", SU2_TYPE::Int(GlobalPoint));
   if (rank == MASTER_NODE)
-    MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
   disp += strlen(str_buf)*sizeof(char);
   
   /*--- Adjust container start location to avoid point coords. ---*/
@@ -3395,12 +3284,9 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
       /*--- Adjust the string name to remove the leading "X-" ---*/
       
       fieldname.erase(fieldname.end()-2,fieldname.end());
-      MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
-                        (char*)"native", MPI_INFO_NULL);
       SPRINTF (str_buf, "\nVECTORS %s float\n", fieldname.c_str());
       if (rank == MASTER_NODE)
-        MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                          MPI_CHAR, MPI_STATUS_IGNORE);
+        IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
       disp += strlen(str_buf)*sizeof(char);
       
       /*--- Prepare the 1D data buffer on this rank. ---*/
@@ -3423,59 +3309,35 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
       if (!BigEndian)
         SwapBytes((char *)vec_buf, sizeof(float), myPoint*NCOORDS);
 
-      /*--- We will write the point data as floats. ---*/
-      
-      etype = MPI_FLOAT;
-      
-      /*--- Define a derived datatype for this ranks contiguous
-       chunk of data that will be placed in the file. ---*/
-      
-      MPI_Type_contiguous(myPoint*NCOORDS, MPI_FLOAT, &filetype);
-      MPI_Type_commit(&filetype);
-      
       /*--- Compute the offset for this rank's linear partition of the
        data in bytes. ---*/
       
       disp2 = disp + NCOORDS*nPoint_Cum[rank]*sizeof(float);
       
-      /*--- Set the view for the MPI file write, i.e., describe the
-       location in the file that this rank "sees" for writing its
-       piece of the file. ---*/
+      /*--- Collective call for all ranks to write their partition. ---*/
       
-      MPI_File_set_view(fhw, disp2, etype, filetype,
-                        (char*)"native", MPI_INFO_NULL);
-      
-      /*--- Collective call for all ranks to write simultaneously. ---*/
-      
-      MPI_File_write_all(fhw, vec_buf, myPoint*NCOORDS, MPI_FLOAT, &status);
+      IO_Aggregator.WriteAt_All(disp2, vec_buf, myPoint*NCOORDS*sizeof(float));
       
       /*--- Update the displacement position for MPI IO. ---*/
       
       disp += NCOORDS*nPoint_Cum[size]*sizeof(float);
       
-      /*--- Free the derived datatype and coordinate array. ---*/
+      /*--- Free the coordinate array. ---*/
       
-      MPI_Type_free(&filetype);
       delete [] vec_buf; vec_buf = NULL;
       
       VarCounter++;
       
     } else if (output_variable) {
       
-      MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
-                        (char*)"native", MPI_INFO_NULL);
       SPRINTF (str_buf, "\nSCALARS %s float 1\n", fieldname.c_str());
       if (rank == MASTER_NODE)
-        MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                          MPI_CHAR, MPI_STATUS_IGNORE);
+        IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
       disp += strlen(str_buf)*sizeof(char);
       
-      MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
-                        (char*)"native", MPI_INFO_NULL);
       SPRINTF (str_buf, "LOOKUP_TABLE default\n");
       if (rank == MASTER_NODE)
-        MPI_File_write_at(fhw, disp, str_buf, strlen(str_buf),
-                          MPI_CHAR, MPI_STATUS_IGNORE);
+        IO_Aggregator.WriteAt_Master(disp, str_buf, strlen(str_buf));
       disp += strlen(str_buf)*sizeof(char);
       
       /*--- Prepare the 1D data buffer on this rank. ---*/
@@ -3491,39 +3353,21 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
       }
       if (!BigEndian) SwapBytes((char *)scalar_buf, sizeof(float), myPoint);
       
-      /*--- We will write the point data as floats. ---*/
-      
-      etype = MPI_FLOAT;
-      
-      /*--- Define a derived datatype for this ranks contiguous
-       chunk of data that will be placed in the file. ---*/
-      
-      MPI_Type_contiguous(myPoint, MPI_FLOAT, &filetype);
-      MPI_Type_commit(&filetype);
-      
       /*--- Compute the offset for this rank's linear partition of the
        data in bytes. ---*/
       
       disp2 = disp + nPoint_Cum[rank]*sizeof(float);
       
-      /*--- Set the view for the MPI file write, i.e., describe the
-       location in the file that this rank "sees" for writing its
-       piece of the file. ---*/
-      
-      MPI_File_set_view(fhw, disp2, etype, filetype,
-                        (char*)"native", MPI_INFO_NULL);
-      
-      /*--- Collective call for all ranks to write simultaneously. ---*/
+      /*--- Collective call for all ranks to write their partition. ---*/
       
-      MPI_File_write_all(fhw, scalar_buf, myPoint, MPI_FLOAT, &status);
+      IO_Aggregator.WriteAt_All(disp2, scalar_buf, myPoint*sizeof(float));
       
       /*--- Update the displacement position for MPI IO. ---*/
       
       disp += nPoint_Cum[size]*sizeof(float);
       
-      /*--- Free the derived datatype and coordinate array. ---*/
+      /*--- Free the coordinate array. ---*/
       
-      MPI_Type_free(&filetype);
       delete [] scalar_buf; scalar_buf = NULL;
       
       VarCounter++;
@@ -3533,7 +3377,7 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
   
   /*--- All ranks close the file after writing. ---*/
   
-  MPI_File_close(&fhw);
+  IO_Aggregator.Close();
   
   /*--- Delete the offset counters that we needed for MPI IO. ---*/
   
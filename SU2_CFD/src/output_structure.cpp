@@ -37,11 +37,21 @@
 
 #include "../include/output_structure.hpp"
 
+#ifdef HAVE_PTHREAD
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
 COutput::COutput(CConfig *config) {
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
 
+  /*--- Asynchronous output of the restart and volume solution files. ---*/
+
+  Async_Output        = config->GetWrt_Async_Output();
+  AsyncWriter_Running = false;
+
   unsigned short iDim, iZone, iSpan, iMarker;
   
   /*--- Initialize point and connectivity counters to zero. ---*/
@@ -326,6 +336,10 @@ COutput::~COutput(void) {
   /* Coords and Conn_*(Connectivity) have their own dealloc functions */
   /* Data is taken care of in DeallocateSolution function */
 
+  /*--- Finish the restart files still being written in the background. ---*/
+
+  WaitAsyncWriter();
+
   if (RhoRes_Old != NULL) delete [] RhoRes_Old;
 
   /*--- Delete turboperformance pointers initiliazed at constrction  ---*/
@@ -4341,6 +4355,7 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config, un
   bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
   bool incload = config->GetIncrementalLoad();
+  bool jacobian_reuse = (config->GetJacobian_Reuse_Freq() > 1);
 
   bool thermal = false; /* Flag for whether to print heat flux values */
   bool weakly_coupled_heat = config->GetWeakly_Coupled_Heat();
@@ -4474,6 +4489,7 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config, un
   /*--- End of the header ---*/
   
   char end[]= ",\"Linear_Solver_Iterations\",\"CFL_Number\",\"Time(min)\"\n";
+  char end_reuse[]= ",\"Linear_Solver_Iterations\",\"Jacobian_Reuse\",\"CFL_Number\",\"Time(min)\"\n";
   char endfea[]= ",\"Linear_Solver_Iterations\",\"Time(min)\"\n";
   
   if ((config->GetOutput_FileFormat() == TECPLOT) ||
@@ -4517,7 +4533,8 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config, un
         if (output_surface) ConvHist_file[0] << d_surface_outputs;
       }
       if (output_comboObj) ConvHist_file[0] << combo_obj;
-      ConvHist_file[0] << end;
+      if (jacobian_reuse) ConvHist_file[0] << end_reuse;
+      else ConvHist_file[0] << end;
       
       break;
       
@@ -4704,6 +4721,8 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
     unsigned short iVar, iMarker_Monitoring;
     
     unsigned long LinSolvIter = 0, iPointMaxResid;
+    su2double Jacobian_Reuse = 0.0;
+    bool jacobian_reuse = (config[val_iZone]->GetJacobian_Reuse_Freq() > 1);
     su2double timeiter = timeused/su2double(iExtIter+1);
     
     unsigned short nDim = geometry[val_iZone][val_iInst][FinestMesh]->GetnDim();
@@ -5079,6 +5098,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
         /*--- Iterations of the linear solver ---*/
         
         LinSolvIter = (unsigned long) solver_container[val_iZone][val_iInst][FinestMesh][FLOW_SOL]->GetIterLinSolver();
+        Jacobian_Reuse = solver_container[val_iZone][val_iInst][FinestMesh][FLOW_SOL]->GetJacobian_Reuse_Rate();
         
         /*--- Adjoint solver ---*/
         
@@ -5235,7 +5255,10 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
         SPRINTF(begin, "%12d", SU2_TYPE::Int(iExtIter+ExtIter_OffSet));
         
         /*--- Write the end of the history file ---*/
-        SPRINTF (end, ", %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
+        if (jacobian_reuse)
+          SPRINTF (end, ", %12.10f, %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), Jacobian_Reuse, config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
+        else
+          SPRINTF (end, ", %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
         
         /*--- Write the solution and residual of the history file ---*/
         switch (config[val_iZone]->GetKind_Solver()) {
@@ -6950,6 +6973,25 @@ void COutput::SpecialOutput_ForcesBreakdown(CSolver *****solver, CGeometry ****g
           Breakdown_file << "Critical Pressure (non-dim):   " << config[val_iZone]->GetPressure_Critical() /config[val_iZone]->GetPressure_Ref() << "\n";
           Breakdown_file << "Critical Temperature (non-dim) :  " << config[val_iZone]->GetTemperature_Critical() /config[val_iZone]->GetTemperature_Ref() << "\n";
           break;
+          
+        case LUT_GAS:
+          Breakdown_file << "Fluid Model: Look-up table "<< "\n";
+          switch (config[val_iZone]->GetKind_LUT_Donor()) {
+            case IDEAL_GAS: Breakdown_file << "Tabulated Model: IDEAL_GAS "<< "\n"; break;
+            case VW_GAS:    Breakdown_file << "Tabulated Model: Van der Waals "<< "\n"; break;
+            case PR_GAS:    Breakdown_file << "Tabulated Model: Peng-Robinson "<< "\n"; break;
+          }
+          Breakdown_file << "Specific gas constant: " << config[val_iZone]->GetGas_Constant() << " N.m/kg.K." << "\n";
+          Breakdown_file << "Specific gas constant (non-dim): " << config[val_iZone]->GetGas_ConstantND()<< "\n";
+          Breakdown_file << "Specific Heat Ratio: "<< config[val_iZone]->GetGamma() << "\n";
+          Breakdown_file << "Critical Pressure:   " << config[val_iZone]->GetPressure_Critical()  << " Pa." << "\n";
+          Breakdown_file << "Critical Temperature:  " << config[val_iZone]->GetTemperature_Critical() << " K." << "\n";
+          Breakdown_file << "Critical Pressure (non-dim):   " << config[val_iZone]->GetPressure_Critical() /config[val_iZone]->GetPressure_Ref() << "\n";
+          Breakdown_file << "Critical Temperature (non-dim) :  " << config[val_iZone]->GetTemperature_Critical() /config[val_iZone]->GetTemperature_Ref() << "\n";
+          Breakdown_file << "Table Pressure Range:   " << config[val_iZone]->GetLUT_Pressure_Range()[0] << " - " << config[val_iZone]->GetLUT_Pressure_Range()[1] << " Pa." << "\n";
+          Breakdown_file << "Table Temperature Range:  " << config[val_iZone]->GetLUT_Temperature_Range()[0] << " - " << config[val_iZone]->GetLUT_Temperature_Range()[1] << " K." << "\n";
+          Breakdown_file << "Table Tolerance: " << config[val_iZone]->GetLUT_Tolerance() << ", max. refinement levels: " << config[val_iZone]->GetLUT_MaxRefinement() << "\n";
+          break;
       }
       
       if (viscous) {
@@ -8669,10 +8711,15 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
   unsigned short iZone;
   ofstream output_file;
   string str;
+  bool binary_mesh = config[ZONE_0]->GetWrt_Binary_Mesh();
+
+  if (su2_file && binary_mesh && (val_nZone > 1)) {
+    SU2_MPI::Error("The binary SU2 mesh format holds a single zone, set WRT_BINARY_MESH= NO for multizone meshes.", CURRENT_FUNCTION);
+  }
 
   /*--- Read the name of the output and input file ---*/
 
-  if (su2_file) {
+  if (su2_file && !binary_mesh) {
     if (rank == MASTER_NODE) {
       str = config[ZONE_0]->GetMesh_Out_FileName();
       strcpy (out_file, str.c_str());
@@ -8755,9 +8802,14 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
 
       if (su2_file) {
         
-        if (rank == MASTER_NODE) cout <<"Writing .su2 file." << endl;
-        
-        SetSU2_MeshASCII(config[iZone], geometry[iZone], iZone, output_file);
+        if (binary_mesh) {
+          if (rank == MASTER_NODE) cout <<"Writing binary .su2 file." << endl;
+          SetSU2_MeshBinary(config[iZone], geometry[iZone], iZone);
+        }
+        else {
+          if (rank == MASTER_NODE) cout <<"Writing .su2 file." << endl;
+          SetSU2_MeshASCII(config[iZone], geometry[iZone], iZone, output_file);
+        }
         
         /*--- Write an stl surface file ---*/
         
@@ -12287,6 +12339,11 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
   unsigned short nInst = 1;
   bool compressible = true;
 
+  /*--- With asynchronous output, the previous output of this rank must be complete before
+   the data is staged again (back-pressure, this also protects files that are overwritten). ---*/
+
+  WaitAsyncWriter();
+
   for (iZone = 0; iZone < val_nZone; iZone++) {
 
     /*--- Bool to distinguish between the FVM and FEM solvers. ---*/
@@ -12626,6 +12683,10 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
 
     }
   }
+
+  /*--- The staged files are written while the solver continues. ---*/
+
+  StartAsyncWriter();
 }
 
 void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone) {
@@ -17606,31 +17667,53 @@ void COutput::WriteRestart_Parallel_ASCII(CConfig *config, CGeometry *geometry,
     filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
   }
   
+  /*--- With asynchronous output the file is formatted into sections that are staged
+   for the background writer (see StageOutputFile), the file is not opened here. ---*/
+
+  ostream &restart_out = OutputStream(restart_file);
+
   /*--- Only the master node writes the header. ---*/
   
   if (rank == MASTER_NODE) {
-    restart_file.open(filename.c_str(), ios::out);
-    restart_file.precision(15);
-    restart_file << "\"PointID\"";
+    if (!Async_Output) restart_file.open(filename.c_str(), ios::out);
+    restart_out.precision(15);
+    restart_out << "\"PointID\"";
     for (iVar = 0; iVar < Variable_Names.size()-1; iVar++)
-      restart_file << "\t\"" << Variable_Names[iVar] << "\"";
-    restart_file << "\t\"" << Variable_Names[Variable_Names.size()-1] << "\"" << endl;
-    restart_file.close();
+      restart_out << "\t\"" << Variable_Names[iVar] << "\"";
+    restart_out << "\t\"" << Variable_Names[Variable_Names.size()-1] << "\"" << endl;
+    if (!Async_Output) restart_file.close();
   }
   
+  if (Async_Output) {
+    NextOutputSection(restart_file);
+  }
+  else {
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
 #endif
+    
+    /*--- All processors open the file. ---*/
+    
+    restart_file.open(filename.c_str(), ios::out | ios::app);
+  }
+  restart_out.precision(15);
   
-  /*--- All processors open the file. ---*/
+  /*--- Write the restart file in parallel, processor by processor. With asynchronous
+   output every rank formats its own points only, starting at its global offset. ---*/
   
-  restart_file.open(filename.c_str(), ios::out | ios::app);
-  restart_file.precision(15);
+  unsigned long myPoint = 0, offset = 0, Global_Index;
+  int firstProcessor = 0, lastProcessor = size;
   
-  /*--- Write the restart file in parallel, processor by processor. ---*/
+  if (Async_Output) {
+    unsigned long *Buffer_Recv_nPoin = new unsigned long [size];
+    SU2_MPI::Allgather(&nParallel_Poin, 1, MPI_UNSIGNED_LONG,
+                       Buffer_Recv_nPoin, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+    for (iProcessor = 0; iProcessor < rank; iProcessor++) offset += Buffer_Recv_nPoin[iProcessor];
+    delete [] Buffer_Recv_nPoin;
+    firstProcessor = rank; lastProcessor = rank+1;
+  }
   
-  unsigned long myPoint = 0, offset = 0, Global_Index;
-  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+  for (iProcessor = firstProcessor; iProcessor < lastProcessor; iProcessor++) {
     if (rank == iProcessor) {
       for (iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
         
@@ -17645,52 +17728,57 @@ void COutput::WriteRestart_Parallel_ASCII(CConfig *config, CGeometry *geometry,
           
           /*--- Write global index. (note outer loop over procs) ---*/
           
-          restart_file << Global_Index << "\t";
+          restart_out << Global_Index << "\t";
           myPoint++;
           
           /*--- Loop over the variables and write the values to file ---*/
           
           for (iVar = 0; iVar < nVar_Par; iVar++) {
-            restart_file << scientific << Parallel_Data[iVar][iPoint] << "\t";
+            restart_out << scientific << Parallel_Data[iVar][iPoint] << "\t";
           }
-          restart_file << "\n";
+          restart_out << "\n";
         }
       }
     }
     /*--- Flush the file and wait for all processors to arrive. ---*/
-    restart_file.flush();
+    if (!Async_Output) {
+      restart_file.flush();
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&myPoint, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Barrier(MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&myPoint, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Barrier(MPI_COMM_WORLD);
 #endif
+    }
     
   }
+  
+  if (Async_Output) NextOutputSection(restart_file);
 
   /*--- Write the metadata (master rank alone) ----*/
 
   if (rank == MASTER_NODE) {
     if (dual_time)
-      restart_file <<"EXT_ITER= " << config->GetExtIter() + 1 << endl;
+      restart_out <<"EXT_ITER= " << config->GetExtIter() + 1 << endl;
     else
-      restart_file <<"EXT_ITER= " << config->GetExtIter() + config->GetExtIter_OffSet() + 1 << endl;
-    restart_file <<"AOA= " << config->GetAoA() - config->GetAoA_Offset() << endl;
-    restart_file <<"SIDESLIP_ANGLE= " << config->GetAoS() - config->GetAoS_Offset() << endl;
-    restart_file <<"INITIAL_BCTHRUST= " << config->GetInitial_BCThrust() << endl;
-    restart_file <<"DCD_DCL_VALUE= " << config->GetdCD_dCL() << endl;
-    restart_file <<"DCMX_DCL_VALUE= " << config->GetdCMx_dCL() << endl;
-    restart_file <<"DCMY_DCL_VALUE= " << config->GetdCMy_dCL() << endl;
-    restart_file <<"DCMZ_DCL_VALUE= " << config->GetdCMz_dCL() << endl;
+      restart_out <<"EXT_ITER= " << config->GetExtIter() + config->GetExtIter_OffSet() + 1 << endl;
+    restart_out <<"AOA= " << config->GetAoA() - config->GetAoA_Offset() << endl;
+    restart_out <<"SIDESLIP_ANGLE= " << config->GetAoS() - config->GetAoS_Offset() << endl;
+    restart_out <<"INITIAL_BCTHRUST= " << config->GetInitial_BCThrust() << endl;
+    restart_out <<"DCD_DCL_VALUE= " << config->GetdCD_dCL() << endl;
+    restart_out <<"DCMX_DCL_VALUE= " << config->GetdCMx_dCL() << endl;
+    restart_out <<"DCMY_DCL_VALUE= " << config->GetdCMy_dCL() << endl;
+    restart_out <<"DCMZ_DCL_VALUE= " << config->GetdCMz_dCL() << endl;
 
     if (( config->GetKind_Solver() == DISC_ADJ_EULER ||
           config->GetKind_Solver() == DISC_ADJ_NAVIER_STOKES ||
           config->GetKind_Solver() == DISC_ADJ_RANS ) && adjoint) {
-      restart_file << "SENS_AOA=" << solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0 << endl;
+      restart_out << "SENS_AOA=" << solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0 << endl;
     }
   }
 
-  /*--- All processors close the file. ---*/
+  /*--- All processors close the file (or stage it for the background writer). ---*/
 
-  restart_file.close();
+  if (Async_Output) StageOutputFile(filename);
+  else restart_file.close();
   
 }
 
@@ -17786,6 +17874,36 @@ void COutput::WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry,
     Restart_Metadata[4] = SU2_TYPE::GetValue(solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0);
   }
 
+  /*--- Asynchronous output: the header (master rank), the data of each rank and the
+   metadata (master rank) are staged as consecutive sections of the file, they are
+   written by the background writer (see StartAsyncWriter). The chunked format is
+   always written synchronously. ---*/
+
+  if (Async_Output && !config->GetWrt_Chunked_Restart()) {
+
+    if (rank == MASTER_NODE) {
+      AsyncWriter_Section.write((char *)var_buf, var_buf_size*sizeof(int));
+      for (iVar = 0; iVar < nVar_Par; iVar++) {
+        strncpy(str_buf, Variable_Names[iVar].c_str(), CGNS_STRING_SIZE);
+        AsyncWriter_Section.write(str_buf, CGNS_STRING_SIZE*sizeof(char));
+      }
+    }
+    NextOutputSection(restart_file);
+
+    AsyncWriter_Section.write((char *)buf, nParallel_Poin*nVar_Par*sizeof(passivedouble));
+    NextOutputSection(restart_file);
+
+    if (rank == MASTER_NODE) {
+      AsyncWriter_Section.write((char *)&Restart_ExtIter, sizeof(int));
+      AsyncWriter_Section.write((char *)Restart_Metadata, 8*sizeof(passivedouble));
+    }
+
+    StageOutputFile(filename);
+
+    delete [] buf;
+    return;
+  }
+
   /*--- Set a timer for the binary file writing. ---*/
   
 #ifndef HAVE_MPI
@@ -17794,164 +17912,133 @@ void COutput::WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry,
   StartTime = MPI_Wtime();
 #endif
   
-#ifndef HAVE_MPI
-
-  FILE* fhw;
-  fhw = fopen(fname, "wb");
+  /*--- Chunked format, the fields are written in separate (compressed) blocks. ---*/
 
-  /*--- Error check for opening the file. ---*/
-
-  if (!fhw) {
-    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  if (config->GetWrt_Chunked_Restart()) {
+    file_size = (su2double)CChunkedRestart::Write(config, fname, nVar_Par, Variable_Names.data(), nGlobalPoint_Sort,
+                                                  nParallel_Poin, buf, Restart_ExtIter, Restart_Metadata);
   }
+  else {
 
-  /*--- First, write the number of variables and points. ---*/
-
-  fwrite(var_buf, var_buf_size, sizeof(int), fhw);
-  file_size += (su2double)var_buf_size*sizeof(int);
-  
-  /*--- Write the variable names to the file. Note that we are adopting a
-   fixed length of 33 for the string length to match with CGNS. This is 
-   needed for when we read the strings later. ---*/
-
-  for (iVar = 0; iVar < nVar_Par; iVar++) {
-    strncpy(str_buf, Variable_Names[iVar].c_str(), CGNS_STRING_SIZE);
-    fwrite(str_buf, CGNS_STRING_SIZE, sizeof(char), fhw);
-    file_size += (su2double)CGNS_STRING_SIZE*sizeof(char);
-  }
-
-  /*--- Call to write the entire restart file data in binary in one shot. ---*/
-
-  fwrite(buf, nVar_Par*nParallel_Poin, sizeof(passivedouble), fhw);
-  file_size += (su2double)nVar_Par*nParallel_Poin*sizeof(passivedouble);
+#ifndef HAVE_MPI
 
-  /*--- Write the external iteration. ---*/
+    FILE* fhw;
+    fhw = fopen(fname, "wb");
 
-  fwrite(&Restart_ExtIter, 1, sizeof(int), fhw);
-  file_size += (su2double)sizeof(int);
+    /*--- Error check for opening the file. ---*/
 
-  /*--- Write the metadata. ---*/
+    if (!fhw) {
+      SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+    }
 
-  fwrite(Restart_Metadata, 8, sizeof(passivedouble), fhw);
-  file_size += (su2double)8*sizeof(passivedouble);
+    /*--- First, write the number of variables and points. ---*/
 
-  /*--- Close the file. ---*/
+    fwrite(var_buf, var_buf_size, sizeof(int), fhw);
+    file_size += (su2double)var_buf_size*sizeof(int);
 
-  fclose(fhw);
+    /*--- Write the variable names to the file. Note that we are adopting a
+     fixed length of 33 for the string length to match with CGNS. This is 
+     needed for when we read the strings later. ---*/
 
-#else
+    for (iVar = 0; iVar < nVar_Par; iVar++) {
+      strncpy(str_buf, Variable_Names[iVar].c_str(), CGNS_STRING_SIZE);
+      fwrite(str_buf, CGNS_STRING_SIZE, sizeof(char), fhw);
+      file_size += (su2double)CGNS_STRING_SIZE*sizeof(char);
+    }
 
-  /*--- Parallel binary output using MPI I/O. ---*/
+    /*--- Call to write the entire restart file data in binary in one shot. ---*/
 
-  MPI_File fhw;
-  SU2_MPI::Status status;
-  MPI_Datatype etype, filetype;
-  MPI_Offset disp;
-  int ierr;
+    fwrite(buf, nVar_Par*nParallel_Poin, sizeof(passivedouble), fhw);
+    file_size += (su2double)nVar_Par*nParallel_Poin*sizeof(passivedouble);
 
-  /*--- We're writing only su2doubles in the data portion of the file. ---*/
+    /*--- Write the external iteration. ---*/
 
-  etype = MPI_DOUBLE;
+    fwrite(&Restart_ExtIter, 1, sizeof(int), fhw);
+    file_size += (su2double)sizeof(int);
 
-  /*--- Define a derived datatype for this ranks contiguous chunk of data
-   that will be placed in the restart (1D array size = num points * num vars). ---*/
+    /*--- Write the metadata. ---*/
 
-  MPI_Type_contiguous(nVar_Par*nParallel_Poin, MPI_DOUBLE, &filetype);
-  MPI_Type_commit(&filetype);
+    fwrite(Restart_Metadata, 8, sizeof(passivedouble), fhw);
+    file_size += (su2double)8*sizeof(passivedouble);
 
-  /*--- All ranks open the file using MPI. Here, we try to open the file with
-   exclusive so that an error is generated if the file exists. We always want
-   to write a fresh restart file, so we delete any existing files and create
-   a new one. ---*/
+    /*--- Close the file. ---*/
 
-  ierr = MPI_File_open(MPI_COMM_WORLD, fname,
-                       MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
-                       MPI_INFO_NULL, &fhw);
-  if (ierr != MPI_SUCCESS)  {
-    MPI_File_close(&fhw);
-    if (rank == 0)
-      MPI_File_delete(fname, MPI_INFO_NULL);
-    ierr = MPI_File_open(MPI_COMM_WORLD, fname,
-                         MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
-                         MPI_INFO_NULL, &fhw);
-  }
+    fclose(fhw);
 
-  /*--- Error check opening the file. ---*/
+#else
 
-  if (ierr) {
-    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
-  }
+    /*--- Parallel binary output using MPI I/O. The data of the ranks is gathered
+     on the I/O aggregators, which are the only ranks that access the file. ---*/
 
-  /*--- First, write the number of variables and points (i.e., cols and rows),
-   which we will need in order to read the file later. Also, write the 
-   variable string names here. Only the master rank writes the header. ---*/
+    MPI_Offset disp;
 
-  if (rank == MASTER_NODE) {
-    MPI_File_write(fhw, var_buf, var_buf_size, MPI_INT, MPI_STATUS_IGNORE);
-    file_size += (su2double)var_buf_size*sizeof(int);
+    CIOAggregator IO_Aggregator(config->GetnIO_Aggregators(), config->GetIO_Stripe_Size());
 
-    /*--- Write the variable names to the file. Note that we are adopting a
-     fixed length of 33 for the string length to match with CGNS. This is
-     needed for when we read the strings later. ---*/
+    /*--- We always want to write a fresh restart file, any existing file is replaced. ---*/
 
-    for (iVar = 0; iVar < nVar_Par; iVar++) {
-      disp = var_buf_size*sizeof(int) + iVar*CGNS_STRING_SIZE*sizeof(char);
-      strcpy(str_buf, Variable_Names[iVar].c_str());
-      MPI_File_write_at(fhw, disp, str_buf, CGNS_STRING_SIZE, MPI_CHAR, MPI_STATUS_IGNORE);
-      file_size += (su2double)CGNS_STRING_SIZE*sizeof(char);
+    if (!IO_Aggregator.Open(fname, true)) {
+      SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
     }
-  }
-
-  /*--- Compute the offset for this rank's linear partition of the data in bytes.
-   After the calculations above, we have the partition sizes store in nPoint_Linear
-   in cumulative storage format. ---*/
 
-  disp = (var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char) +
-          nVar_Par*nPoint_Cum[rank]*sizeof(passivedouble));
+    /*--- First, write the number of variables and points (i.e., cols and rows),
+     which we will need in order to read the file later. Also, write the
+     variable string names here. Only the master rank writes the header. ---*/
 
-  /*--- Set the view for the MPI file write, i.e., describe the location in
-   the file that this rank "sees" for writing its piece of the restart file. ---*/
-
-  MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+    if (rank == MASTER_NODE) {
+      IO_Aggregator.WriteAt_Master(0, var_buf, var_buf_size*sizeof(int));
+      file_size += (su2double)var_buf_size*sizeof(int);
 
-  /*--- Collective call for all ranks to write to their view simultaneously. ---*/
+      /*--- Write the variable names to the file. Note that we are adopting a
+       fixed length of 33 for the string length to match with CGNS. This is
+       needed for when we read the strings later. ---*/
 
-  MPI_File_write_all(fhw, buf, nVar_Par*nParallel_Poin, MPI_DOUBLE, &status);
-  file_size += (su2double)nVar_Par*nParallel_Poin*sizeof(passivedouble);
+      for (iVar = 0; iVar < nVar_Par; iVar++) {
+        disp = var_buf_size*sizeof(int) + iVar*CGNS_STRING_SIZE*sizeof(char);
+        strcpy(str_buf, Variable_Names[iVar].c_str());
+        IO_Aggregator.WriteAt_Master(disp, str_buf, CGNS_STRING_SIZE*sizeof(char));
+        file_size += (su2double)CGNS_STRING_SIZE*sizeof(char);
+      }
+    }
 
-  /*--- Free the derived datatype. ---*/
+    /*--- Compute the offset for this rank's linear partition of the data in bytes.
+     After the calculations above, we have the partition sizes store in nPoint_Linear
+     in cumulative storage format. ---*/
 
-  MPI_Type_free(&filetype);
+    disp = (var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char) +
+            nVar_Par*nPoint_Cum[rank]*sizeof(passivedouble));
 
-  /*--- Reset the file view before writing the metadata. ---*/
+    /*--- Collective call for all ranks to write their partition, the partitions
+     follow each other in the file in the order of the ranks. ---*/
 
-  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+    IO_Aggregator.WriteAt_All(disp, buf, nVar_Par*nParallel_Poin*sizeof(passivedouble));
+    file_size += (su2double)nVar_Par*nParallel_Poin*sizeof(passivedouble);
 
-  /*--- Finally, the master rank writes the metadata. ---*/
+    /*--- Finally, the master rank writes the metadata. ---*/
 
-  if (rank == MASTER_NODE) {
+    if (rank == MASTER_NODE) {
 
-    /*--- External iteration. ---*/
+      /*--- External iteration. ---*/
 
-    disp = (var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char) +
-            nVar_Par*nGlobalPoint_Sort*sizeof(passivedouble));
-    MPI_File_write_at(fhw, disp, &Restart_ExtIter, 1, MPI_INT, MPI_STATUS_IGNORE);
-    file_size += (su2double)sizeof(int);
+      disp = (var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char) +
+              nVar_Par*nGlobalPoint_Sort*sizeof(passivedouble));
+      IO_Aggregator.WriteAt_Master(disp, &Restart_ExtIter, sizeof(int));
+      file_size += (su2double)sizeof(int);
 
-    /*--- Additional doubles for AoA, AoS, etc. ---*/
+      /*--- Additional doubles for AoA, AoS, etc. ---*/
 
-    disp = (var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char) +
-            nVar_Par*nGlobalPoint_Sort*sizeof(passivedouble) + 1*sizeof(int));
-    MPI_File_write_at(fhw, disp, Restart_Metadata, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
-    file_size += (su2double)8*sizeof(passivedouble);
+      disp = (var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char) +
+              nVar_Par*nGlobalPoint_Sort*sizeof(passivedouble) + 1*sizeof(int));
+      IO_Aggregator.WriteAt_Master(disp, Restart_Metadata, 8*sizeof(passivedouble));
+      file_size += (su2double)8*sizeof(passivedouble);
 
-  }
+    }
 
-  /*--- All ranks close the file after writing. ---*/
+    /*--- All ranks close the file after writing. ---*/
 
-  MPI_File_close(&fhw);
+    IO_Aggregator.Close();
 
 #endif
+  }
 
   /*--- Compute and store the write time. ---*/
   
@@ -17986,6 +18073,176 @@ void COutput::WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry,
 
 }
 
+ostream &COutput::OutputStream(ofstream &file) {
+
+  if (Async_Output) return AsyncWriter_Section;
+  return file;
+
+}
+
+void COutput::NextOutputSection(ofstream &file) {
+
+  if (Async_Output) {
+    AsyncWriter_Sections.push_back(AsyncWriter_Section.str());
+    AsyncWriter_Section.str("");
+    return;
+  }
+
+  file.flush();
+#ifdef HAVE_MPI
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+#endif
+
+}
+
+void COutput::StageOutputFile(string filename) {
+
+  unsigned long iSection, nSection, offset = 0;
+  int iProcessor;
+
+  /*--- Close the last section, and reset the stream for the next file. ---*/
+
+  AsyncWriter_Sections.push_back(AsyncWriter_Section.str());
+
+  ostringstream default_format;
+  AsyncWriter_Section.str("");
+  AsyncWriter_Section.copyfmt(default_format);
+
+  /*--- Sizes of the sections of all the ranks. The sections are laid out in the file in
+   order, and within a section the ranks are in order, as with the synchronous writers. ---*/
+
+  nSection = AsyncWriter_Sections.size();
+
+  unsigned long *Buffer_Send_Size = new unsigned long [nSection];
+  unsigned long *Buffer_Recv_Size = new unsigned long [nSection*size];
+
+  for (iSection = 0; iSection < nSection; iSection++)
+    Buffer_Send_Size[iSection] = AsyncWriter_Sections[iSection].size();
+
+  SU2_MPI::Allgather(Buffer_Send_Size, nSection, MPI_UNSIGNED_LONG,
+                     Buffer_Recv_Size, nSection, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  AsyncWriter_Jobs.push_back(CAsyncOutputJob());
+  CAsyncOutputJob &job = AsyncWriter_Jobs.back();
+
+  job.filename = filename;
+  job.sections.swap(AsyncWriter_Sections);
+  job.offsets.resize(nSection);
+
+  for (iSection = 0; iSection < nSection; iSection++) {
+    for (iProcessor = 0; iProcessor < size; iProcessor++) {
+      if (iProcessor == rank) job.offsets[iSection] = offset;
+      offset += Buffer_Recv_Size[iProcessor*nSection+iSection];
+    }
+  }
+  job.file_size = offset;
+
+  delete [] Buffer_Send_Size;
+  delete [] Buffer_Recv_Size;
+
+}
+
+void COutput::StartAsyncWriter(void) {
+
+  if (AsyncWriter_Jobs.empty()) return;
+
+  /*--- No synchronization is needed here, any rank may create the files and the
+   master rank sets their final size. ---*/
+
+  AsyncWriter_Error.clear();
+  AsyncWriter_Running = true;
+
+#ifdef HAVE_PTHREAD
+  AsyncWriter = thread(&COutput::WriteAsyncJobs, this);
+#else
+  WriteAsyncJobs();
+#endif
+}
+
+void COutput::WriteAsyncJobs(void) {
+
+  /*--- No MPI and no access to the solver or the geometry in here, this runs concurrently
+   with the iterations. The ranks write disjoint parts of temporary files, which replace
+   the files of the previous output in WaitAsyncWriter. ---*/
+
+#ifdef HAVE_PTHREAD
+
+  for (unsigned long iJob = 0; iJob < AsyncWriter_Jobs.size(); iJob++) {
+
+    const CAsyncOutputJob &job = AsyncWriter_Jobs[iJob];
+    const string TmpName = job.filename + ".tmp";
+
+    int fd = open(TmpName.c_str(), O_WRONLY | O_CREAT, 0644);
+    if (fd < 0) {
+      AsyncWriter_Error = string("Unable to open file ") + TmpName;
+      return;
+    }
+
+    bool ok = true;
+
+    for (unsigned long iSection = 0; iSection < job.sections.size(); iSection++) {
+      const char *data = job.sections[iSection].data();
+      size_t remaining = job.sections[iSection].size();
+      off_t position = job.offsets[iSection];
+      while (ok && (remaining > 0)) {
+        ssize_t written = pwrite(fd, data, remaining, position);
+        if (written <= 0) { ok = false; break; }
+        data += written; remaining -= written; position += written;
+      }
+    }
+
+    /*--- A (longer) temporary file left by an interrupted output is cut to the new size. ---*/
+
+    if (rank == MASTER_NODE) ok = ok && (ftruncate(fd, job.file_size) == 0);
+    ok = (close(fd) == 0) && ok;
+
+    if (!ok) {
+      AsyncWriter_Error = string("Unable to write file ") + TmpName;
+      return;
+    }
+  }
+
+#endif
+}
+
+void COutput::WaitAsyncWriter(void) {
+
+  if (!AsyncWriter_Running) return;
+
+#ifdef HAVE_PTHREAD
+  AsyncWriter.join();
+#endif
+
+  AsyncWriter_Running = false;
+
+  /*--- The temporary files replace the files of the previous output only if all the ranks
+   have written their parts, such that a restart file is never left incomplete. ---*/
+
+  int ok = AsyncWriter_Error.empty(), all_ok = ok;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&ok, &all_ok, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+
+  if (rank == MASTER_NODE) {
+    for (unsigned long iJob = 0; iJob < AsyncWriter_Jobs.size(); iJob++) {
+      const string FileName = AsyncWriter_Jobs[iJob].filename, TmpName = FileName + ".tmp";
+      if (!all_ok) remove(TmpName.c_str());
+      else if (rename(TmpName.c_str(), FileName.c_str()) != 0 && AsyncWriter_Error.empty())
+        AsyncWriter_Error = string("Unable to rename file ") + TmpName + " to " + FileName;
+    }
+  }
+  AsyncWriter_Jobs.clear();
+
+  if (!all_ok && AsyncWriter_Error.empty())
+    AsyncWriter_Error = "The background output failed on another rank, the files of the previous output were kept.";
+
+  if (!AsyncWriter_Error.empty())
+    SU2_MPI::Error(AsyncWriter_Error, CURRENT_FUNCTION);
+
+  /*--- No barrier, a temporary file is only written again after it has been staged again, and
+   the staging (StageOutputFile) is collective, i.e. the master has renamed it before. ---*/
+}
+
 void COutput::WriteCSV_Slice(CConfig *config, CGeometry *geometry,
                              CSolver *FlowSolver, unsigned long iExtIter,
                              unsigned short val_iZone, unsigned short val_direction) {
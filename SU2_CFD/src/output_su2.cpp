@@ -245,7 +245,209 @@ void COutput::SetSU2_MeshASCII(CConfig *config, CGeometry *geometry, unsigned sh
 
 }
 
-void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) { }
+void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
+
+  unsigned long iElem, iPoint, iElem_Bound, nElem_Bound_, nElem, nElem_Conn, index, VTK_Type, vnodes[4];
+  unsigned short iMarker, iDim, iChar, iType, iNode, iPeriodic, nPeriodic, nMarker_ = 0, nDim = geometry->GetnDim();
+  unsigned long header[SU2_BINARY_MESH_HEADER];
+  passivedouble Offset_Angles[2];
+  short SendTo;
+  su2double *center, *angles, *transl;
+  char tag_buf[SU2_BINARY_MESH_TAG_SIZE], fname[MAX_STRING_SIZE];
+  ifstream input_file;
+  string text_line, Marker_Tag, str;
+  string::size_type position;
+  vector<unsigned long> Marker_Data;
+
+  /*--- Read the boundary information first, the size of the marker
+   block is needed before the header can be written. ---*/
+
+  str = "boundary.dat";
+
+  str = config->GetMultizone_FileName(str, val_iZone);
+
+  input_file.open(str.c_str(), ios::in);
+
+  while (getline (input_file, text_line)) {
+
+    position = text_line.find ("NMARK=",0);
+    if (position != string::npos) {
+
+      text_line.erase (0,6); nMarker_ = atoi(text_line.c_str());
+
+      for (iMarker = 0 ; iMarker < nMarker_; iMarker++) {
+
+        getline (input_file, text_line);
+        text_line.erase (0,11);
+        for (iChar = 0; iChar < 20; iChar++) {
+          position = text_line.find( " ", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\r", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\n", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+        }
+        Marker_Tag = text_line.c_str();
+
+        if (Marker_Tag.size() >= (unsigned long)SU2_BINARY_MESH_TAG_SIZE) {
+          SU2_MPI::Error(string("Marker tag ") + Marker_Tag + string(" is too long for the binary SU2 mesh format."), CURRENT_FUNCTION);
+        }
+
+        getline (input_file, text_line);
+        text_line.erase (0,13); nElem_Bound_ = atoi(text_line.c_str());
+        getline (input_file, text_line);
+        text_line.erase (0,8); SendTo = atoi(text_line.c_str());
+
+        /*--- Tag (padded with zeros), number of elements and SEND_TO. ---*/
+
+        memset(tag_buf, 0, SU2_BINARY_MESH_TAG_SIZE);
+        strncpy(tag_buf, Marker_Tag.c_str(), SU2_BINARY_MESH_TAG_SIZE-1);
+        index = Marker_Data.size();
+        Marker_Data.resize(index + SU2_BINARY_MESH_TAG_SIZE/sizeof(unsigned long));
+        memcpy(&Marker_Data[index], tag_buf, SU2_BINARY_MESH_TAG_SIZE);
+        Marker_Data.push_back(nElem_Bound_);
+        Marker_Data.push_back((unsigned long)(long)SendTo);
+
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+          bound_line >> VTK_Type;
+
+          switch(VTK_Type) {
+            case LINE: case VERTEX:
+              bound_line >> vnodes[0]; bound_line >> vnodes[1];
+              Marker_Data.push_back(VTK_Type);
+              Marker_Data.push_back(vnodes[0]); Marker_Data.push_back(vnodes[1]);
+              break;
+            case TRIANGLE:
+              bound_line >> vnodes[0]; bound_line >> vnodes[1]; bound_line >> vnodes[2];
+              Marker_Data.push_back(VTK_Type);
+              for (iNode = 0; iNode < N_POINTS_TRIANGLE; iNode++) Marker_Data.push_back(vnodes[iNode]);
+              break;
+            case QUADRILATERAL:
+              bound_line >> vnodes[0]; bound_line >> vnodes[1]; bound_line >> vnodes[2]; bound_line >> vnodes[3];
+              Marker_Data.push_back(VTK_Type);
+              for (iNode = 0; iNode < N_POINTS_QUADRILATERAL; iNode++) Marker_Data.push_back(vnodes[iNode]);
+              break;
+          }
+        }
+      }
+    }
+
+  }
+
+  input_file.close();
+
+  remove(str.c_str());
+
+  /*--- Volume elements, written by type in the same order as the ASCII file. ---*/
+
+  const unsigned short nType = 6;
+  unsigned long nElem_Type[nType] = {nGlobal_Tria, nGlobal_Quad, nGlobal_Tetr,
+                                     nGlobal_Hexa, nGlobal_Pris, nGlobal_Pyra};
+  unsigned short VTK_Elem[nType]  = {TRIANGLE, QUADRILATERAL, TETRAHEDRON,
+                                     HEXAHEDRON, PRISM, PYRAMID};
+  unsigned short nNodes_Type[nType] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                       N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+  int *Conn_Type[nType] = {Conn_Tria, Conn_Quad, Conn_Tetr, Conn_Hexa, Conn_Pris, Conn_Pyra};
+
+  nElem = 0; nElem_Conn = 0;
+  for (iType = 0; iType < nType; iType++) {
+    nElem      += nElem_Type[iType];
+    nElem_Conn += nElem_Type[iType]*(nNodes_Type[iType]+1);
+  }
+
+  /*--- Header with the sizes and the offsets of each block. ---*/
+
+  nPeriodic = config->GetnPeriodicIndex();
+
+  header[0]  = SU2_BINARY_MESH_ID;
+  header[1]  = SU2_BINARY_MESH_VERSION;
+  header[2]  = nDim;
+  header[3]  = nGlobal_Doma;
+  header[4]  = geometry->GetGlobal_nPointDomain();
+  header[5]  = nElem;
+  header[6]  = nMarker_;
+  header[7]  = nPeriodic;
+  header[8]  = SU2_BINARY_MESH_HEADER*sizeof(unsigned long) + 2*sizeof(passivedouble);
+  header[9]  = header[8] + nGlobal_Doma*nDim*sizeof(passivedouble);
+  header[10] = header[9] + (nElem+1)*sizeof(unsigned long);
+  header[11] = header[10] + nElem_Conn*sizeof(unsigned long);
+  header[12] = Marker_Data.size()*sizeof(unsigned long);
+  header[13] = header[11] + header[12];
+  header[14] = 0;
+  header[15] = 0;
+
+  Offset_Angles[0] = SU2_TYPE::GetValue(config->GetAoA_Offset());
+  Offset_Angles[1] = SU2_TYPE::GetValue(config->GetAoS_Offset());
+
+  /*--- Open the file on the master (the merged data only lives there). ---*/
+
+  strcpy(fname, config->GetMesh_Out_FileName().c_str());
+  FILE *fhw = fopen(fname, "wb");
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  fwrite(header, sizeof(unsigned long), SU2_BINARY_MESH_HEADER, fhw);
+  fwrite(Offset_Angles, sizeof(passivedouble), 2, fhw);
+
+  /*--- Write the node coordinates ---*/
+
+  passivedouble *Coord_Buffer = new passivedouble[nGlobal_Doma*nDim];
+  for (iPoint = 0; iPoint < nGlobal_Doma; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord_Buffer[iPoint*nDim+iDim] = SU2_TYPE::GetValue(Coords[iDim][iPoint]);
+  fwrite(Coord_Buffer, sizeof(passivedouble), nGlobal_Doma*nDim, fhw);
+  delete [] Coord_Buffer;
+
+  /*--- Write the element offsets and the connectivity (0-based). ---*/
+
+  unsigned long *Elem_Offset = new unsigned long[nElem+1];
+  unsigned long *Elem_Conn   = new unsigned long[nElem_Conn];
+
+  Elem_Offset[0] = 0; nElem = 0; index = 0;
+  for (iType = 0; iType < nType; iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]; iElem++) {
+      Elem_Conn[index] = VTK_Elem[iType]; index++;
+      for (iNode = 0; iNode < nNodes_Type[iType]; iNode++) {
+        Elem_Conn[index] = Conn_Type[iType][iElem*nNodes_Type[iType]+iNode]-1; index++;
+      }
+      Elem_Offset[nElem+1] = index; nElem++;
+    }
+  }
+
+  fwrite(Elem_Offset, sizeof(unsigned long), nElem+1, fhw);
+  fwrite(Elem_Conn, sizeof(unsigned long), nElem_Conn, fhw);
+
+  delete [] Elem_Offset;
+  delete [] Elem_Conn;
+
+  /*--- Write the markers ---*/
+
+  if (!Marker_Data.empty())
+    fwrite(&Marker_Data[0], sizeof(unsigned long), Marker_Data.size(), fhw);
+
+  /*--- Write the periodic transformations (center, rotation, translation). ---*/
+
+  passivedouble *Periodic_Data = new passivedouble[nPeriodic*9];
+  for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+    center = config->GetPeriodicCenter(iPeriodic);
+    angles = config->GetPeriodicRotation(iPeriodic);
+    transl = config->GetPeriodicTranslate(iPeriodic);
+    for (iDim = 0; iDim < 3; iDim++) {
+      Periodic_Data[iPeriodic*9+iDim]   = SU2_TYPE::GetValue(center[iDim]);
+      Periodic_Data[iPeriodic*9+3+iDim] = SU2_TYPE::GetValue(angles[iDim]);
+      Periodic_Data[iPeriodic*9+6+iDim] = SU2_TYPE::GetValue(transl[iDim]);
+    }
+  }
+  fwrite(Periodic_Data, sizeof(passivedouble), nPeriodic*9, fhw);
+  delete [] Periodic_Data;
+
+  fclose(fhw);
+
+}
 
 void COutput::WriteCoordinates_Binary(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
   
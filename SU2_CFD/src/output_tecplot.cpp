@@ -853,52 +853,60 @@ void COutput::WriteTecplotASCII_Parallel(CConfig *config, CGeometry *geometry, C
   
   /*--- Open Tecplot ASCII file and write the header. ---*/
   
+  ostream &tecplot_out = OutputStream(Tecplot_File);
+  int firstProcessor = (Async_Output? rank : 0), lastProcessor = (Async_Output? rank+1 : size);
+  
   if (rank == MASTER_NODE) {
-    Tecplot_File.open(cstr, ios::out);
-    Tecplot_File.precision(6);
-    if (surf_sol) Tecplot_File << "TITLE = \"Visualization of the surface solution\"" << endl;
-    else Tecplot_File << "TITLE = \"Visualization of the volumetric solution\"" << endl;
+    if (!Async_Output) Tecplot_File.open(cstr, ios::out);
+    tecplot_out.precision(6);
+    if (surf_sol) tecplot_out << "TITLE = \"Visualization of the surface solution\"" << endl;
+    else tecplot_out << "TITLE = \"Visualization of the volumetric solution\"" << endl;
     
-    Tecplot_File << "VARIABLES = ";
+    tecplot_out << "VARIABLES = ";
     for (iVar = 0; iVar < Variable_Names.size()-1; iVar++) {
-      Tecplot_File << "\"" << Variable_Names[iVar] << "\",";
+      tecplot_out << "\"" << Variable_Names[iVar] << "\",";
     }
-    Tecplot_File << "\"" << Variable_Names[Variable_Names.size()-1] << "\"" << endl;
+    tecplot_out << "\"" << Variable_Names[Variable_Names.size()-1] << "\"" << endl;
     
     /*--- Write the header ---*/
     
-    Tecplot_File << "ZONE ";
+    tecplot_out << "ZONE ";
     if (config->GetUnsteady_Simulation() && config->GetWrt_Unsteady()) {
-      Tecplot_File << "STRANDID="<<SU2_TYPE::Int(iExtIter+1)<<", SOLUTIONTIME="<<config->GetDelta_UnstTime()*iExtIter<<", ";
+      tecplot_out << "STRANDID="<<SU2_TYPE::Int(iExtIter+1)<<", SOLUTIONTIME="<<config->GetDelta_UnstTime()*iExtIter<<", ";
     } else if (config->GetUnsteady_Simulation() == HARMONIC_BALANCE) {
       /*--- Compute period of oscillation & compute time interval using nTimeInstances ---*/
       su2double period = config->GetHarmonicBalance_Period();
       su2double deltaT = period/(su2double)(config->GetnTimeInstances());
-      Tecplot_File << "STRANDID="<<SU2_TYPE::Int(val_iZone+1)<<", SOLUTIONTIME="<<deltaT*val_iZone<<", ";
+      tecplot_out << "STRANDID="<<SU2_TYPE::Int(val_iZone+1)<<", SOLUTIONTIME="<<deltaT*val_iZone<<", ";
     }
     if (nDim == 2) {
-      if (surf_sol) Tecplot_File << "NODES= "<< nGlobal_Surf_Poin <<", ELEMENTS= "<< nSurf_Elem_Par <<", DATAPACKING=POINT, ZONETYPE=FELINESEG"<< endl;
-      else Tecplot_File << "NODES= "<< nGlobal_Poin_Par <<", ELEMENTS= "<< nGlobal_Elem_Par <<", DATAPACKING=POINT, ZONETYPE=FEQUADRILATERAL"<< endl;
+      if (surf_sol) tecplot_out << "NODES= "<< nGlobal_Surf_Poin <<", ELEMENTS= "<< nSurf_Elem_Par <<", DATAPACKING=POINT, ZONETYPE=FELINESEG"<< endl;
+      else tecplot_out << "NODES= "<< nGlobal_Poin_Par <<", ELEMENTS= "<< nGlobal_Elem_Par <<", DATAPACKING=POINT, ZONETYPE=FEQUADRILATERAL"<< endl;
     } else {
-      if (surf_sol) Tecplot_File << "NODES= "<< nGlobal_Surf_Poin <<", ELEMENTS= "<< nSurf_Elem_Par <<", DATAPACKING=POINT, ZONETYPE=FEQUADRILATERAL"<< endl;
-      else Tecplot_File << "NODES= "<< nGlobal_Poin_Par <<", ELEMENTS= "<< nGlobal_Elem_Par <<", DATAPACKING=POINT, ZONETYPE=FEBRICK"<< endl;
+      if (surf_sol) tecplot_out << "NODES= "<< nGlobal_Surf_Poin <<", ELEMENTS= "<< nSurf_Elem_Par <<", DATAPACKING=POINT, ZONETYPE=FEQUADRILATERAL"<< endl;
+      else tecplot_out << "NODES= "<< nGlobal_Poin_Par <<", ELEMENTS= "<< nGlobal_Elem_Par <<", DATAPACKING=POINT, ZONETYPE=FEBRICK"<< endl;
     }
 
-    Tecplot_File.close();
+    if (!Async_Output) Tecplot_File.close();
     
   }
   
+  if (Async_Output) {
+    NextOutputSection(Tecplot_File);
+  }
+  else {
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
 #endif
-  
-  /*--- Each processor opens the file. ---*/
-  
-  Tecplot_File.open(cstr, ios::out | ios::app);
+    
+    /*--- Each processor opens the file. ---*/
+    
+    Tecplot_File.open(cstr, ios::out | ios::app);
+  }
   
   /*--- Write surface and volumetric solution data. ---*/
   
-  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+  for (iProcessor = firstProcessor; iProcessor < lastProcessor; iProcessor++) {
     if (rank == iProcessor) {
       
         /*--- Write the node data from this proc ---*/
@@ -906,113 +914,108 @@ void COutput::WriteTecplotASCII_Parallel(CConfig *config, CGeometry *geometry, C
         if (surf_sol) {
             for (iPoint = 0; iPoint < nSurf_Poin_Par; iPoint++) {
         for (iVar = 0; iVar < nVar_Par; iVar++)
-          Tecplot_File << scientific << Parallel_Surf_Data[iVar][iPoint] << "\t";
-        Tecplot_File << endl;
+          tecplot_out << scientific << Parallel_Surf_Data[iVar][iPoint] << "\t";
+        tecplot_out << endl;
             
           }
         } else {
           
            for (iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
           for (iVar = 0; iVar < nVar_Par; iVar++)
-            Tecplot_File << scientific << Parallel_Data[iVar][iPoint] << "\t";
-          Tecplot_File << endl;
+            tecplot_out << scientific << Parallel_Data[iVar][iPoint] << "\t";
+          tecplot_out << endl;
         }
       }
     }
-    Tecplot_File.flush();
-#ifdef HAVE_MPI
-    SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+    NextOutputSection(Tecplot_File);
   }
   
   /*--- Write connectivity data. ---*/
   
-  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+  for (iProcessor = firstProcessor; iProcessor < lastProcessor; iProcessor++) {
     if (rank == iProcessor) {
       
       if (surf_sol) {
         
         for (iElem = 0; iElem < nParallel_Line; iElem++) {
           iNode = iElem*N_POINTS_LINE;
-          Tecplot_File << Conn_BoundLine_Par[iNode+0] << "\t";
-          Tecplot_File << Conn_BoundLine_Par[iNode+1] << "\n";
+          tecplot_out << Conn_BoundLine_Par[iNode+0] << "\t";
+          tecplot_out << Conn_BoundLine_Par[iNode+1] << "\n";
         }
         
         for (iElem = 0; iElem < nParallel_BoundTria; iElem++) {
           iNode = iElem*N_POINTS_TRIANGLE;
-          Tecplot_File << Conn_BoundTria_Par[iNode+0] << "\t";
-          Tecplot_File << Conn_BoundTria_Par[iNode+1] << "\t";
-          Tecplot_File << Conn_BoundTria_Par[iNode+2] << "\t";
-          Tecplot_File << Conn_BoundTria_Par[iNode+2] << "\n";
+          tecplot_out << Conn_BoundTria_Par[iNode+0] << "\t";
+          tecplot_out << Conn_BoundTria_Par[iNode+1] << "\t";
+          tecplot_out << Conn_BoundTria_Par[iNode+2] << "\t";
+          tecplot_out << Conn_BoundTria_Par[iNode+2] << "\n";
         }
         
         for (iElem = 0; iElem < nParallel_BoundQuad; iElem++) {
           iNode = iElem*N_POINTS_QUADRILATERAL;
-          Tecplot_File << Conn_BoundQuad_Par[iNode+0] << "\t";
-          Tecplot_File << Conn_BoundQuad_Par[iNode+1] << "\t";
-          Tecplot_File << Conn_BoundQuad_Par[iNode+2] << "\t";
-          Tecplot_File << Conn_BoundQuad_Par[iNode+3] << "\n";
+          tecplot_out << Conn_BoundQuad_Par[iNode+0] << "\t";
+          tecplot_out << Conn_BoundQuad_Par[iNode+1] << "\t";
+          tecplot_out << Conn_BoundQuad_Par[iNode+2] << "\t";
+          tecplot_out << Conn_BoundQuad_Par[iNode+3] << "\n";
         }
         
       } else {
         
       for (iElem = 0; iElem < nParallel_Tria; iElem++) {
         iNode = iElem*N_POINTS_TRIANGLE;
-        Tecplot_File << Conn_Tria_Par[iNode+0] << "\t";
-        Tecplot_File << Conn_Tria_Par[iNode+1] << "\t";
-        Tecplot_File << Conn_Tria_Par[iNode+2] << "\t";
-        Tecplot_File << Conn_Tria_Par[iNode+2] << "\n";
+        tecplot_out << Conn_Tria_Par[iNode+0] << "\t";
+        tecplot_out << Conn_Tria_Par[iNode+1] << "\t";
+        tecplot_out << Conn_Tria_Par[iNode+2] << "\t";
+        tecplot_out << Conn_Tria_Par[iNode+2] << "\n";
       }
       
       for (iElem = 0; iElem < nParallel_Quad; iElem++) {
         iNode = iElem*N_POINTS_QUADRILATERAL;
-        Tecplot_File << Conn_Quad_Par[iNode+0] << "\t";
-        Tecplot_File << Conn_Quad_Par[iNode+1] << "\t";
-        Tecplot_File << Conn_Quad_Par[iNode+2] << "\t";
-        Tecplot_File << Conn_Quad_Par[iNode+3] << "\n";
+        tecplot_out << Conn_Quad_Par[iNode+0] << "\t";
+        tecplot_out << Conn_Quad_Par[iNode+1] << "\t";
+        tecplot_out << Conn_Quad_Par[iNode+2] << "\t";
+        tecplot_out << Conn_Quad_Par[iNode+3] << "\n";
       }
       
       for (iElem = 0; iElem < nParallel_Tetr; iElem++) {
         iNode = iElem*N_POINTS_TETRAHEDRON;
-        Tecplot_File << Conn_Tetr_Par[iNode+0] << "\t" << Conn_Tetr_Par[iNode+1] << "\t";
-        Tecplot_File << Conn_Tetr_Par[iNode+2] << "\t" << Conn_Tetr_Par[iNode+2] << "\t";
-        Tecplot_File << Conn_Tetr_Par[iNode+3] << "\t" << Conn_Tetr_Par[iNode+3] << "\t";
-        Tecplot_File << Conn_Tetr_Par[iNode+3] << "\t" << Conn_Tetr_Par[iNode+3] << "\n";
+        tecplot_out << Conn_Tetr_Par[iNode+0] << "\t" << Conn_Tetr_Par[iNode+1] << "\t";
+        tecplot_out << Conn_Tetr_Par[iNode+2] << "\t" << Conn_Tetr_Par[iNode+2] << "\t";
+        tecplot_out << Conn_Tetr_Par[iNode+3] << "\t" << Conn_Tetr_Par[iNode+3] << "\t";
+        tecplot_out << Conn_Tetr_Par[iNode+3] << "\t" << Conn_Tetr_Par[iNode+3] << "\n";
       }
       
       for (iElem = 0; iElem < nParallel_Hexa; iElem++) {
         iNode = iElem*N_POINTS_HEXAHEDRON;
-        Tecplot_File << Conn_Hexa_Par[iNode+0] << "\t" << Conn_Hexa_Par[iNode+1] << "\t";
-        Tecplot_File << Conn_Hexa_Par[iNode+2] << "\t" << Conn_Hexa_Par[iNode+3] << "\t";
-        Tecplot_File << Conn_Hexa_Par[iNode+4] << "\t" << Conn_Hexa_Par[iNode+5] << "\t";
-        Tecplot_File << Conn_Hexa_Par[iNode+6] << "\t" << Conn_Hexa_Par[iNode+7] << "\n";
+        tecplot_out << Conn_Hexa_Par[iNode+0] << "\t" << Conn_Hexa_Par[iNode+1] << "\t";
+        tecplot_out << Conn_Hexa_Par[iNode+2] << "\t" << Conn_Hexa_Par[iNode+3] << "\t";
+        tecplot_out << Conn_Hexa_Par[iNode+4] << "\t" << Conn_Hexa_Par[iNode+5] << "\t";
+        tecplot_out << Conn_Hexa_Par[iNode+6] << "\t" << Conn_Hexa_Par[iNode+7] << "\n";
       }
       
       for (iElem = 0; iElem < nParallel_Pris; iElem++) {
         iNode = iElem*N_POINTS_PRISM;
-        Tecplot_File << Conn_Pris_Par[iNode+0] << "\t" << Conn_Pris_Par[iNode+1] << "\t";
-        Tecplot_File << Conn_Pris_Par[iNode+1] << "\t" << Conn_Pris_Par[iNode+2] << "\t";
-        Tecplot_File << Conn_Pris_Par[iNode+3] << "\t" << Conn_Pris_Par[iNode+4] << "\t";
-        Tecplot_File << Conn_Pris_Par[iNode+4] << "\t" << Conn_Pris_Par[iNode+5] << "\n";
+        tecplot_out << Conn_Pris_Par[iNode+0] << "\t" << Conn_Pris_Par[iNode+1] << "\t";
+        tecplot_out << Conn_Pris_Par[iNode+1] << "\t" << Conn_Pris_Par[iNode+2] << "\t";
+        tecplot_out << Conn_Pris_Par[iNode+3] << "\t" << Conn_Pris_Par[iNode+4] << "\t";
+        tecplot_out << Conn_Pris_Par[iNode+4] << "\t" << Conn_Pris_Par[iNode+5] << "\n";
       }
       
       for (iElem = 0; iElem < nParallel_Pyra; iElem++) {
         iNode = iElem*N_POINTS_PYRAMID;
-        Tecplot_File << Conn_Pyra_Par[iNode+0] << "\t" << Conn_Pyra_Par[iNode+1] << "\t";
-        Tecplot_File << Conn_Pyra_Par[iNode+2] << "\t" << Conn_Pyra_Par[iNode+3] << "\t";
-        Tecplot_File << Conn_Pyra_Par[iNode+4] << "\t" << Conn_Pyra_Par[iNode+4] << "\t";
-        Tecplot_File << Conn_Pyra_Par[iNode+4] << "\t" << Conn_Pyra_Par[iNode+4] << "\n";
+        tecplot_out << Conn_Pyra_Par[iNode+0] << "\t" << Conn_Pyra_Par[iNode+1] << "\t";
+        tecplot_out << Conn_Pyra_Par[iNode+2] << "\t" << Conn_Pyra_Par[iNode+3] << "\t";
+        tecplot_out << Conn_Pyra_Par[iNode+4] << "\t" << Conn_Pyra_Par[iNode+4] << "\t";
+        tecplot_out << Conn_Pyra_Par[iNode+4] << "\t" << Conn_Pyra_Par[iNode+4] << "\n";
       }
       }
       
     }
-    Tecplot_File.flush();
-#ifdef HAVE_MPI
-    SU2_MPI::Barrier(MPI_COMM_WORLD);
-#endif
+    NextOutputSection(Tecplot_File);
   }
   
-  Tecplot_File.close();
+  if (Async_Output) StageOutputFile(cstr);
+  else Tecplot_File.close();
   
 }
 
@@ -39,6 +39,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
   /*--- Basic array initialization ---*/
 
   FluidModel = NULL;
+  nThreadDG  = 1;
 
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
   CMx_Inv = NULL; CMy_Inv = NULL; CMz_Inv = NULL;
@@ -74,6 +75,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
   /*--- Basic array initialization ---*/
 
   FluidModel = NULL;
+  nThreadDG  = 1;
 
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
   CMx_Inv = NULL; CMy_Inv = NULL; CMz_Inv = NULL;
@@ -117,6 +119,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   /*--- Array initialization ---*/
   FluidModel = NULL;
+  nThreadDG  = 1;
 
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL; CEff_Inv = NULL;
   CMx_Inv = NULL;   CMy_Inv = NULL;   CMz_Inv = NULL;
@@ -723,6 +726,9 @@ CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
   if(FluidModel    != NULL) delete FluidModel;
   if(blasFunctions != NULL) delete blasFunctions;
 
+  for(unsigned short iThread=1; iThread<ThreadFluidModel.size(); ++iThread)
+    delete ThreadFluidModel[iThread];
+
   /*--- Array deallocation ---*/
   if (CD_Inv != NULL)           delete [] CD_Inv;
   if (CL_Inv != NULL)           delete [] CL_Inv;
@@ -864,6 +870,23 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       }
       break;
 
+    case LUT_GAS:
+
+      /*--- The dimensional free-stream state is computed with the donor model,
+            the tables are only generated for the dimensionless problem. ---*/
+      FluidModel = CLookUpTableGas::CreateDonorModel(config, false);
+      if (free_stream_temp) {
+        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = FluidModel->GetDensity();
+        config->SetDensity_FreeStream(Density_FreeStream);
+      }
+      else {
+        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = FluidModel->GetTemperature();
+        config->SetTemperature_FreeStream(Temperature_FreeStream);
+      }
+      break;
+
   }
 
   Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
@@ -1057,6 +1080,12 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
       break;
 
+    case LUT_GAS:
+      /*--- The coarse grids share the tables of the finest grid. ---*/
+      FluidModel = CLookUpTableGas::CreateShared(config);
+      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+      break;
+
   }
 
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
@@ -1080,6 +1109,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   }
 
+  /*--- Private copies of the fluid model for the threads of the task list executor. ---*/
+
+  SetThreadFluidModels(config);
+
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
   Energy_Ref = Energy_FreeStream/Energy_FreeStreamND; config->SetEnergy_Ref(Energy_Ref);
@@ -1147,6 +1180,25 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
         cout << "Critical Temperature (non-dim) :  " << config->GetTemperature_Critical() /config->GetTemperature_Ref() << endl;
         break;
 
+      case LUT_GAS:
+        cout << "Fluid Model: Look-up table "<< endl;
+        switch (config->GetKind_LUT_Donor()) {
+          case IDEAL_GAS: cout << "Tabulated Model: IDEAL_GAS "<< endl; break;
+          case VW_GAS:    cout << "Tabulated Model: Van der Waals "<< endl; break;
+          case PR_GAS:    cout << "Tabulated Model: Peng-Robinson "<< endl; break;
+        }
+        cout << "Specific gas constant: " << config->GetGas_Constant() << " N.m/kg.K." << endl;
+        cout << "Specific gas constant (non-dim): " << config->GetGas_ConstantND()<< endl;
+        cout << "Specific Heat Ratio: "<< Gamma << endl;
+        cout << "Critical Pressure:   " << config->GetPressure_Critical()  << " Pa." << endl;
+        cout << "Critical Temperature:  " << config->GetTemperature_Critical() << " K." << endl;
+        cout << "Critical Pressure (non-dim):   " << config->GetPressure_Critical() /config->GetPressure_Ref() << endl;
+        cout << "Critical Temperature (non-dim) :  " << config->GetTemperature_Critical() /config->GetTemperature_Ref() << endl;
+        cout << "Table Pressure Range:   " << config->GetLUT_Pressure_Range()[0] << " - " << config->GetLUT_Pressure_Range()[1] << " Pa." << endl;
+        cout << "Table Temperature Range:  " << config->GetLUT_Temperature_Range()[0] << " - " << config->GetLUT_Temperature_Range()[1] << " K." << endl;
+        cout << "Table Tolerance: " << config->GetLUT_Tolerance() << ", max. refinement levels: " << config->GetLUT_MaxRefinement() << endl;
+        break;
+
     }
     if (viscous) {
       switch (config->GetKind_ViscosityModel()) {
@@ -1329,6 +1381,65 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   }
 }
 
+void CFEM_DG_EulerSolver::SetThreadFluidModels(CConfig *config) {
+
+  /*--- Remove the copies of a previous call. ---*/
+  for(unsigned short iThread=1; iThread<ThreadFluidModel.size(); ++iThread)
+    delete ThreadFluidModel[iThread];
+
+  /*--- Determine the number of threads of the task list executor. The gemm
+        profiling in CConfig only times the calls of the master thread, hence
+        the tasks can be carried out concurrently also when profiling. ---*/
+  nThreadDG = SU2_OMP_GetMaxThreads();
+
+  /*--- Thread 0 uses FluidModel. The other threads get a copy with the same
+        dimensionless parameters. The copies are only used as scratch for the
+        thermodynamic state in the element kernels, so no reference state
+        needs to be set. ---*/
+  ThreadFluidModel.assign(nThreadDG, FluidModel);
+
+  const su2double Gas_ConstantND = config->GetGas_ConstantND();
+
+  for(unsigned short iThread=1; iThread<nThreadDG; ++iThread) {
+
+    CFluidModel *fluidModel = NULL;
+    switch (config->GetKind_FluidModel()) {
+
+      case STANDARD_AIR:
+        fluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
+
+      case IDEAL_GAS:
+        fluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
+
+      case VW_GAS:
+        fluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                         config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
+
+      case PR_GAS:
+        fluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                       config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
+
+      case LUT_GAS:
+        fluidModel = new CLookUpTableGas(static_cast<CLookUpTableGas*>(FluidModel), config);
+        break;
+
+      default:
+        SU2_MPI::Error("Fluid model not supported by the threaded DG task executor.", CURRENT_FUNCTION);
+    }
+
+    if( config->GetViscous() ) {
+      fluidModel->SetLaminarViscosityModel(config);
+      fluidModel->SetThermalConductivityModel(config);
+    }
+
+    ThreadFluidModel[iThread] = fluidModel;
+  }
+}
+
 void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
                                              CConfig        *config) {
 
@@ -4015,6 +4126,120 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
   else syncTimeReached = false;
 }
 
+void CFEM_DG_EulerSolver::ElementRangeTask_DG(CConfig                            *config,
+                                              const CTaskDefinition::SOLVER_TASK task,
+                                              const unsigned long                elemBeg,
+                                              const unsigned long                elemEnd,
+                                              su2double                          *workArrays) {
+
+  /*--- Lambda, which carries out the task for the elements of a chunk. ---*/
+  auto ElementKernel = [&](const unsigned long chunkBeg, const unsigned long chunkEnd,
+                           su2double *workArray) {
+    switch( task ) {
+
+      case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+      case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS:
+        ADER_DG_PredictorStep(config, chunkBeg, chunkEnd, workArray);
+        break;
+
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS:
+        Shock_Capturing_DG(config, chunkBeg, chunkEnd, workArray);
+        break;
+
+      case CTaskDefinition::VOLUME_RESIDUAL:
+        Volume_Residual(config, chunkBeg, chunkEnd, workArray);
+        break;
+
+      case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX:
+        MultiplyResidualByInverseMassMatrix(config, config->GetKind_TimeIntScheme() == ADER_DG,
+                                            chunkBeg, chunkEnd, workArray);
+        break;
+
+      case CTaskDefinition::ADER_UPDATE_SOLUTION:
+        ADER_DG_Iteration(chunkBeg, chunkEnd);
+        break;
+
+      default:
+        SU2_MPI::Error("Task is not an element range task.", CURRENT_FUNCTION);
+    }
+  };
+
+  /*--- Determine the number of chunks and the number of threads that take
+        part, at most one per chunk. A single thread treats the entire range
+        in one go, which is identical to the serial execution. ---*/
+  if(elemEnd <= elemBeg) return;
+
+  const unsigned long chunkSize = config->GetElemChunkSize_DGFEM();
+  const unsigned long nChunks   = (elemEnd - elemBeg + chunkSize - 1)/chunkSize;
+  const unsigned short nThreadTask = (unsigned short) min((unsigned long) nThreadDG, nChunks);
+
+  if(nThreadTask == 1) {
+    ElementKernel(elemBeg, elemEnd, workArrays);
+    return;
+  }
+
+  /*--- Every thread starts with a contiguous share of the chunks, such that
+        neighboring elements are treated by the same thread. A thread that has
+        finished its share steals the remaining chunks of the other threads.
+        The next chunk of a share is claimed with an atomic increment, hence
+        the owner and the thieves never carry out the same chunk. ---*/
+  vector<unsigned long> nextChunk(nThreadTask), endChunk(nThreadTask);
+  for(unsigned short iThread=0; iThread<nThreadTask; ++iThread) {
+    nextChunk[iThread] =  iThread   *nChunks/nThreadTask;
+    endChunk[iThread]  = (iThread+1)*nChunks/nThreadTask;
+  }
+
+#ifdef HAVE_OMP
+#pragma omp parallel num_threads(nThreadTask)
+#endif
+  {
+    const unsigned short iThread = SU2_OMP_GetThreadID();
+    su2double *workArray = workArrays + ((unsigned long) iThread)*sizeWorkArray;
+
+    for(unsigned short k=0; k<nThreadTask; ++k) {
+      const unsigned short owner = (iThread + k)%nThreadTask;
+
+      for(;;) {
+        unsigned long iChunk;
+#ifdef HAVE_OMP
+#pragma omp atomic capture
+#endif
+        iChunk = nextChunk[owner]++;
+        if(iChunk >= endChunk[owner]) break;
+
+        const unsigned long chunkBeg = elemBeg + iChunk*chunkSize;
+        const unsigned long chunkEnd = min(chunkBeg + chunkSize, elemEnd);
+        ElementKernel(chunkBeg, chunkEnd, workArray);
+
+        /* The master thread, which initialized MPI, gives the library the
+           opportunity to progress the outstanding messages in between its
+           chunks, such that the communication overlaps with the computation. */
+        if(iThread == 0) Progress_MPI_Communication();
+      }
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::Progress_MPI_Communication(void) {
+
+#ifdef HAVE_MPI
+
+  /*--- Test the requests of all time levels. Completed requests are set to
+        MPI_REQUEST_NULL, for which the Testall or Waitall in the completion
+        routines return immediately, so the received data is still copied by
+        the tasks that complete the communication. ---*/
+  for(unsigned short level=0; level<commRequests.size(); ++level) {
+    if( commRequests[level].size() ) {
+      int flag;
+      SU2_MPI::Testall(commRequests[level].size(), commRequests[level].data(),
+                       &flag, MPI_STATUSES_IGNORE);
+    }
+  }
+
+#endif
+}
+
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
@@ -4025,11 +4250,19 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
      not the tasks from the list have been completed. */
   vector<bool> taskCompleted(tasksList.size(), false);
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+  /* Allocate the memory for the work arrays of all threads and initialize it
+     to zero to avoid warnings in debug mode  about uninitialized memory when
+     padding is applied. The tasks that are carried out by the master thread
+     only use the first work array. */
+  vector<su2double> workArrayVec(nThreadDG*sizeWorkArray, 0.0);
   su2double *workArray = workArrayVec.data();
 
+  /*--- The tasks are selected by the master thread in the order of the list.
+        The tasks that operate on a range of elements are split in chunks,
+        which are carried out by all threads, see ElementRangeTask_DG. All
+        other tasks, including the initiation and completion of the MPI
+        communication, are carried out by the master thread only. ---*/
+
   /* While loop to carry out all the tasks in tasksList. */
   unsigned long lowestIndexInList = 0;
   while(lowestIndexInList < tasksList.size()) {
@@ -4066,7 +4299,7 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
                                            + nVolElemInternalPerTimeLevel[level];
               const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+              ElementRangeTask_DG(config, tasksList[i].task, elemBeg, elemEnd, workArray);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4079,7 +4312,7 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
               const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
               const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
                                            + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+              ElementRangeTask_DG(config, tasksList[i].task, elemBeg, elemEnd, workArray);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4177,8 +4410,8 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
+              ElementRangeTask_DG(config, tasksList[i].task, nVolElemOwnedPerTimeLevel[level],
+                                  nVolElemOwnedPerTimeLevel[level+1], workArray);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4187,8 +4420,8 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
+              ElementRangeTask_DG(config, tasksList[i].task, nVolElemHaloPerTimeLevel[level],
+                                  nVolElemHaloPerTimeLevel[level+1], workArray);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4197,8 +4430,8 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Compute the volume portion of the residual. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
+              ElementRangeTask_DG(config, tasksList[i].task, nVolElemOwnedPerTimeLevel[level],
+                                  nVolElemOwnedPerTimeLevel[level+1], workArray);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4287,11 +4520,8 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
+              ElementRangeTask_DG(config, tasksList[i].task, nVolElemOwnedPerTimeLevel[level],
+                                  nVolElemOwnedPerTimeLevel[level+1], workArray);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4300,8 +4530,8 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Perform the update step for ADER-DG. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
+              ElementRangeTask_DG(config, tasksList[i].task, nVolElemOwnedPerTimeLevel[level],
+                                  nVolElemOwnedPerTimeLevel[level+1], workArray);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4926,6 +5156,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
@@ -4981,8 +5213,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5122,6 +5354,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
@@ -5181,8 +5415,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5353,6 +5587,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
                                                                  su2double            *res,
                                                                  su2double            *work) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
   su2double *solAndGradInt = work;
@@ -5421,8 +5657,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5513,6 +5749,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
                                                                  su2double            *res,
                                                                  su2double            *work) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
   su2double *solAndGradInt = work;
@@ -5587,8 +5825,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5797,6 +6035,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
                                           const unsigned long elemEnd,
                                           su2double           *workArray) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
   const su2double *body_force_vector = body_force ? config->GetBody_Force_Vector() : NULL;
@@ -5918,8 +6158,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = fluidModel->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6013,8 +6253,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = fluidModel->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -10755,6 +10995,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                            const unsigned short NPad,
                                                            su2double            *res,
                                                            su2double            *work) {
+
+  CFluidModel *fluidModel = GetThreadFluidModel();
   /* Constant factor present in the heat flux vector. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
@@ -10858,9 +11100,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = fluidModel->GetPressure();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -11030,6 +11272,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                            const unsigned short NPad,
                                                            su2double            *res,
                                                            su2double            *work) {
+
+  CFluidModel *fluidModel = GetThreadFluidModel();
   /* Constant factor present in the heat flux vector. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
@@ -11152,9 +11396,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = fluidModel->GetPressure();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -11369,6 +11613,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Constant factor present in the heat flux vector, the inverse of
      the specific heat at constant volume and ratio lambdaOverMu. */
   const su2double factHeatFlux_Lam  =  Gamma/Prandtl_Lam;
@@ -11475,13 +11721,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+      const su2double dViscLamdT   = fluidModel->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -11712,6 +11958,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Constant factor present in the heat flux vector, the inverse of
      the specific heat at constant volume and ratio lambdaOverMu. */
   const su2double factHeatFlux_Lam  =  Gamma/Prandtl_Lam;
@@ -11825,13 +12073,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+      const su2double dViscLamdT   = fluidModel->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -12236,6 +12484,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
                                                   const unsigned long elemEnd,
                                                   su2double           *workArray) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /*--- Dummy variable for storing shock sensor value temporarily ---*/
   su2double sensorVal, sensorLowerBound, machNorm, machMax;
   su2double DensityInv, Velocity2, StaticEnergy, SoundSpeed2, Velocity2Rel;
@@ -12317,8 +12567,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
 
       StaticEnergy = sol[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-      SoundSpeed2 = FluidModel->GetSoundSpeed2();
+      fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+      SoundSpeed2 = fluidModel->GetSoundSpeed2();
       machSolDOFs[iInd] = sqrt( Velocity2Rel/SoundSpeed2 );
       machMax = max(machSolDOFs[iInd],machMax);
     }
@@ -12398,6 +12648,8 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
                                        const unsigned long elemEnd,
                                        su2double           *workArray) {
 
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
   const su2double *body_force_vector = body_force ? config->GetBody_Force_Vector() : NULL;
@@ -12571,9 +12823,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = fluidModel->GetPressure();
+            const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -12764,9 +13016,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = fluidModel->GetPressure();
+            const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -12910,9 +13162,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
         }
         const su2double StaticEnergy = sol[nVar-1]*rhoInv - kinEner;
 
-        FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-        const su2double ViscosityLam        = FluidModel->GetLaminarViscosity();
-        const su2double ThermalConductivity = FluidModel->GetThermalConductivity();
+        fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+        const su2double ViscosityLam        = fluidModel->GetLaminarViscosity();
+        const su2double ThermalConductivity = fluidModel->GetThermalConductivity();
 
         /* Determine the integration weight multiplied by the Jacobian. */
         const su2double *metricTerms = volElem[lInd].metricTerms.data()
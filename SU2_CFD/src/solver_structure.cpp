@@ -37,6 +37,48 @@
 
 #include "../include/solver_structure.hpp"
 
+CEdgeWorkspace::CEdgeWorkspace(unsigned short val_nDim, unsigned short val_nVar,
+                               unsigned short val_nPrimVar, unsigned short val_nSecondaryVar) {
+  
+  unsigned short iVar;
+  
+  nVar = val_nVar;
+  
+  Primitive_i = new su2double [max(val_nPrimVar, val_nVar)];
+  Primitive_j = new su2double [max(val_nPrimVar, val_nVar)];
+  Secondary_i = new su2double [max(val_nSecondaryVar, (unsigned short)1)];
+  Secondary_j = new su2double [max(val_nSecondaryVar, (unsigned short)1)];
+  Vector_i    = new su2double [val_nDim];
+  Vector_j    = new su2double [val_nDim];
+  Residual    = new su2double [nVar];
+  
+  Jacobian_i = new su2double* [nVar];
+  Jacobian_j = new su2double* [nVar];
+  for (iVar = 0; iVar < nVar; iVar++) {
+    Jacobian_i[iVar] = new su2double [nVar];
+    Jacobian_j[iVar] = new su2double [nVar];
+  }
+  
+}
+
+CEdgeWorkspace::~CEdgeWorkspace(void) {
+  
+  unsigned short iVar;
+  
+  delete [] Primitive_i; delete [] Primitive_j;
+  delete [] Secondary_i; delete [] Secondary_j;
+  delete [] Vector_i;    delete [] Vector_j;
+  delete [] Residual;
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    delete [] Jacobian_i[iVar];
+    delete [] Jacobian_j[iVar];
+  }
+  delete [] Jacobian_i;
+  delete [] Jacobian_j;
+  
+}
+
 CSolver::CSolver(void) {
 
   rank = SU2_MPI::GetRank();
@@ -75,6 +117,10 @@ CSolver::CSolver(void) {
   Jacobian_ij        = NULL;
   Jacobian_ji        = NULL;
   Jacobian_jj        = NULL;
+  NodeStorage        = NULL;
+  nThread            = 1;
+  ThreadNumerics     = NULL;
+  ThreadWorkspace    = NULL;
   Smatrix            = NULL;
   Cvector            = NULL;
   Restart_Vars       = NULL;
@@ -91,6 +137,13 @@ CSolver::CSolver(void) {
 
   /*--- Variable initialization to avoid valgrid warnings when not used. ---*/
   IterLinSolver = 0;
+
+  /*--- Reuse of the Jacobian, the first implicit iteration always assembles it. ---*/
+
+  Jacobian_Age     = 0;
+  nIter_Jacobian   = 0;
+  nReuse_Jacobian  = 0;
+  Res_Jacobian_Old = 0.0;
 }
 
 CSolver::~CSolver(void) {
@@ -111,6 +164,19 @@ CSolver::~CSolver(void) {
     delete [] node;
   }
 
+  /*--- After the nodes, which only hold views of it. ---*/
+
+  if (NodeStorage != NULL) delete NodeStorage;
+
+  /*--- Thread-private data of the colored edge loops (the numerics belong to the driver). ---*/
+
+  if (ThreadWorkspace != NULL) {
+    for (unsigned short iThread = 0; iThread < nThread; iThread++)
+      if (ThreadWorkspace[iThread] != NULL) delete ThreadWorkspace[iThread];
+    delete [] ThreadWorkspace;
+  }
+  if (ThreadNumerics != NULL) delete [] ThreadNumerics;
+
   /*--- Private ---*/
 
   if (Residual_RMS != NULL) delete [] Residual_RMS;
@@ -210,6 +276,299 @@ CSolver::~CSolver(void) {
 
 }
 
+void CSolver::SetContiguousStorage(bool val_active) {
+  
+  /*--- The fields are allocated directly in the storage by the variable
+   constructors, there is no per-point copy to move and release. ---*/
+  
+  if (val_active) {
+    if (NodeStorage == NULL) NodeStorage = new CVariableStorage(nPoint);
+    CVariable::SetConstructionStorage(NodeStorage);
+  }
+  else {
+    CVariable::SetConstructionStorage(NULL);
+  }
+  
+}
+
+void CSolver::SetThreadNumerics(unsigned short val_thread, CNumerics **val_numerics) {
+  
+  unsigned short iThread;
+  
+  /*--- Allocate the per-thread containers on the first call. ---*/
+  
+  if (ThreadNumerics == NULL) {
+    nThread = SU2_OMP_GetMaxThreads();
+    ThreadNumerics  = new CNumerics** [nThread];
+    ThreadWorkspace = new CEdgeWorkspace* [nThread];
+    for (iThread = 0; iThread < nThread; iThread++) {
+      ThreadNumerics[iThread]  = NULL;
+      ThreadWorkspace[iThread] = NULL;
+    }
+  }
+  
+  if ((val_thread == 0) || (val_thread >= nThread))
+    SU2_MPI::Error("Invalid thread index for the thread-private numerics.", CURRENT_FUNCTION);
+  
+  ThreadNumerics[val_thread] = val_numerics;
+  if (ThreadWorkspace[val_thread] == NULL)
+    ThreadWorkspace[val_thread] = new CEdgeWorkspace(nDim, nVar, nPrimVar, nSecondaryVar);
+  
+}
+
+unsigned short CSolver::GetCommCountPerPoint(unsigned short commType) {
+  
+  unsigned short COUNT_PER_POINT = 0;
+  
+  switch (commType) {
+    case SOLUTION:
+    case SOLUTION_OLD:
+    case UNDIVIDED_LAPLACIAN:
+    case SOLUTION_LIMITER:
+      COUNT_PER_POINT = nVar;
+      break;
+    case SOLUTION_EDDY:
+      COUNT_PER_POINT = nVar+1;
+      break;
+    case PRIMITIVE_LIMITER:
+      COUNT_PER_POINT = nPrimVarGrad;
+      break;
+    case SOLUTION_GRADIENT:
+      COUNT_PER_POINT = nVar*nDim;
+      break;
+    case PRIMITIVE_GRADIENT:
+      COUNT_PER_POINT = nPrimVarGrad*nDim;
+      break;
+    case MAX_EIGENVALUE:
+      COUNT_PER_POINT = 2;
+      break;
+    case SENSOR:
+      COUNT_PER_POINT = 1;
+      break;
+    default:
+      SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.", CURRENT_FUNCTION);
+      break;
+  }
+  
+  return COUNT_PER_POINT;
+  
+}
+
+void CSolver::InitiateComms(CGeometry *geometry, CConfig *config, unsigned short commType) {
+  
+  unsigned short iVar, iDim;
+  unsigned long iSend, iPoint, buf_offset, nPointSend;
+  
+  const unsigned short COUNT_PER_POINT = GetCommCountPerPoint(commType);
+  
+  /*--- The pattern is normally built by the driver right after partitioning,
+   but build it here for tools that never went through that step. ---*/
+  
+  if (!geometry->P2PComms_Preprocessed) geometry->PreprocessP2PComms(config);
+  
+  geometry->AllocateP2PComms(COUNT_PER_POINT);
+  
+  su2double *bufDSend = geometry->bufD_P2PSend;
+  nPointSend = geometry->nPoint_P2PSend[geometry->nP2PSend];
+  
+  /*--- Pack the send buffer (point-major) for all the neighbors. ---*/
+  
+  for (iSend = 0; iSend < nPointSend; iSend++) {
+    
+    iPoint     = geometry->Local_Point_P2PSend[iSend];
+    buf_offset = iSend*COUNT_PER_POINT;
+    
+    switch (commType) {
+      case SOLUTION:
+        for (iVar = 0; iVar < nVar; iVar++)
+          bufDSend[buf_offset+iVar] = node[iPoint]->GetSolution(iVar);
+        break;
+      case SOLUTION_OLD:
+        for (iVar = 0; iVar < nVar; iVar++)
+          bufDSend[buf_offset+iVar] = node[iPoint]->GetSolution_Old(iVar);
+        break;
+      case SOLUTION_EDDY:
+        for (iVar = 0; iVar < nVar; iVar++)
+          bufDSend[buf_offset+iVar] = node[iPoint]->GetSolution(iVar);
+        bufDSend[buf_offset+nVar] = node[iPoint]->GetmuT();
+        break;
+      case UNDIVIDED_LAPLACIAN:
+        for (iVar = 0; iVar < nVar; iVar++)
+          bufDSend[buf_offset+iVar] = node[iPoint]->GetUndivided_Laplacian(iVar);
+        break;
+      case SOLUTION_LIMITER:
+        for (iVar = 0; iVar < nVar; iVar++)
+          bufDSend[buf_offset+iVar] = node[iPoint]->GetLimiter(iVar);
+        break;
+      case PRIMITIVE_LIMITER:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+          bufDSend[buf_offset+iVar] = node[iPoint]->GetLimiter_Primitive(iVar);
+        break;
+      case SOLUTION_GRADIENT:
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            bufDSend[buf_offset+iVar*nDim+iDim] = node[iPoint]->GetGradient(iVar, iDim);
+        break;
+      case PRIMITIVE_GRADIENT:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            bufDSend[buf_offset+iVar*nDim+iDim] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+        break;
+      case MAX_EIGENVALUE:
+        bufDSend[buf_offset]   = node[iPoint]->GetLambda();
+        bufDSend[buf_offset+1] = su2double(geometry->node[iPoint]->GetnPoint());
+        break;
+      case SENSOR:
+        bufDSend[buf_offset] = node[iPoint]->GetSensor();
+        break;
+      default:
+        break;
+    }
+  }
+  
+  /*--- Post all the receives and sends at once. ---*/
+  
+  geometry->StartP2PComms(COUNT_PER_POINT);
+  
+}
+
+void CSolver::CompleteComms(CGeometry *geometry, CConfig *config, unsigned short commType) {
+  
+  unsigned short iVar, iDim, jDim, iPeriodic_Index, iLast_Index = 0, iStart = 0, nBlock = 0;
+  unsigned long iRecv, iPoint, buf_offset, nPointRecv;
+  su2double rotMatrix[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}, rotBuf[3],
+  *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi;
+  bool rotate = false, gradient = false;
+  
+  const unsigned short COUNT_PER_POINT = GetCommCountPerPoint(commType);
+  
+  /*--- Decide which blocks of nDim values must be rotated. Gradients are always
+   rotated (one block per variable); states only when they hold a velocity. ---*/
+  
+  switch (commType) {
+    case SOLUTION: case SOLUTION_OLD: case UNDIVIDED_LAPLACIAN:
+    case SOLUTION_LIMITER: case PRIMITIVE_LIMITER:
+      rotate = GetRotate_Periodic(); nBlock = 1;
+      break;
+    case SOLUTION_GRADIENT:
+      rotate = true; gradient = true; nBlock = nVar;
+      break;
+    case PRIMITIVE_GRADIENT:
+      rotate = true; gradient = true; nBlock = nPrimVarGrad;
+      break;
+    default:
+      break;
+  }
+  
+  /*--- Wait for the data of all the neighbors. ---*/
+  
+  geometry->CompleteP2PComms();
+  
+  su2double *bufDRecv = geometry->bufD_P2PRecv;
+  nPointRecv = geometry->nPoint_P2PRecv[geometry->nP2PRecv];
+  
+  for (iRecv = 0; iRecv < nPointRecv; iRecv++) {
+    
+    iPoint     = geometry->Local_Point_P2PRecv[iRecv];
+    buf_offset = iRecv*COUNT_PER_POINT;
+    
+    /*--- Periodic transformation, the matrix is only rebuilt when the
+     rotation type changes (halo points are grouped by marker). ---*/
+    
+    iPeriodic_Index = geometry->Local_Rotation_P2PRecv[iRecv];
+    
+    if (rotate && (iPeriodic_Index != 0)) {
+      
+      if (iPeriodic_Index != iLast_Index) {
+        
+        /*--- Retrieve the supplied periodic information. ---*/
+        
+        angles = config->GetPeriodicRotation(iPeriodic_Index);
+        
+        /*--- Store angles separately for clarity. ---*/
+        
+        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+        
+        /*--- Compute the rotation matrix. Note that the implicit
+         ordering is rotation about the x-axis, y-axis,
+         then z-axis. Note that this is the transpose of the matrix
+         used during the preprocessing stage. ---*/
+        
+        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
+        
+        iLast_Index = iPeriodic_Index;
+      }
+      
+      /*--- Rotate in place, for states the velocity/momentum sits at 1..nDim. ---*/
+      
+      for (iVar = 0; iVar < nBlock; iVar++) {
+        iStart = gradient ? iVar*nDim : 1;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          rotBuf[iDim] = 0.0;
+          for (jDim = 0; jDim < nDim; jDim++)
+            rotBuf[iDim] += rotMatrix[iDim][jDim]*bufDRecv[buf_offset+iStart+jDim];
+        }
+        for (iDim = 0; iDim < nDim; iDim++)
+          bufDRecv[buf_offset+iStart+iDim] = rotBuf[iDim];
+      }
+    }
+    
+    /*--- Store the received information. ---*/
+    
+    switch (commType) {
+      case SOLUTION:
+        for (iVar = 0; iVar < nVar; iVar++)
+          node[iPoint]->SetSolution(iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case SOLUTION_OLD:
+        for (iVar = 0; iVar < nVar; iVar++)
+          node[iPoint]->SetSolution_Old(iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case SOLUTION_EDDY:
+        for (iVar = 0; iVar < nVar; iVar++)
+          node[iPoint]->SetSolution(iVar, bufDRecv[buf_offset+iVar]);
+        node[iPoint]->SetmuT(bufDRecv[buf_offset+nVar]);
+        break;
+      case UNDIVIDED_LAPLACIAN:
+        for (iVar = 0; iVar < nVar; iVar++)
+          node[iPoint]->SetUndivided_Laplacian(iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case SOLUTION_LIMITER:
+        for (iVar = 0; iVar < nVar; iVar++)
+          node[iPoint]->SetLimiter(iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case PRIMITIVE_LIMITER:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+          node[iPoint]->SetLimiter_Primitive(iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case SOLUTION_GRADIENT:
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            node[iPoint]->SetGradient(iVar, iDim, bufDRecv[buf_offset+iVar*nDim+iDim]);
+        break;
+      case PRIMITIVE_GRADIENT:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            node[iPoint]->SetGradient_Primitive(iVar, iDim, bufDRecv[buf_offset+iVar*nDim+iDim]);
+        break;
+      case MAX_EIGENVALUE:
+        node[iPoint]->SetLambda(bufDRecv[buf_offset]);
+        geometry->node[iPoint]->SetnNeighbor(SU2_TYPE::Short(bufDRecv[buf_offset+1]));
+        break;
+      case SENSOR:
+        node[iPoint]->SetSensor(bufDRecv[buf_offset]);
+        break;
+      default:
+        break;
+    }
+  }
+  
+}
+
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   unsigned short iVar;
   
@@ -299,6 +658,37 @@ void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   
 }
 
+void CSolver::SetJacobian_Reuse(CConfig *config) {
+
+  const unsigned long Reuse_Freq = config->GetJacobian_Reuse_Freq();
+
+  /*--- Statistics of the iteration that was just completed. ---*/
+
+  nIter_Jacobian++;
+  if (Jacobian.GetFrozen()) nReuse_Jacobian++;
+
+  if (Reuse_Freq <= 1) return;
+
+  /*--- The residual of the first variable (already reduced over all the ranks) measures
+   the progress of the iteration, a Jacobian that no longer reduces it is assembled again. ---*/
+
+  const su2double Res = Residual_RMS[0];
+  const bool stall = (Res_Jacobian_Old <= 0.0) || (Res > config->GetJacobian_Reuse_Stall()*Res_Jacobian_Old);
+
+  Jacobian_Age++;
+  Res_Jacobian_Old = Res;
+
+  const bool assemble = stall || (Jacobian_Age >= Reuse_Freq);
+
+  if (assemble) Jacobian_Age = 0;
+
+  /*--- A frozen matrix keeps its values and preconditioner factors until it is released,
+   the residual routines and the linear solver skip the assembly in the meantime. ---*/
+
+  Jacobian.SetFrozen(!assemble);
+
+}
+
 void CSolver::SetResidual_BGS(CGeometry *geometry, CConfig *config) {
   unsigned short iVar;
 
@@ -647,119 +1037,48 @@ void CSolver::SetAuxVar_Gradient_GG(CGeometry *geometry, CConfig *config) {
 
 void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
-  unsigned short iDim, jDim, iNeigh;
+  unsigned short iDim, iNeigh;
   unsigned short nDim = geometry->GetnDim();
   unsigned long iPoint, jPoint;
-  su2double *Coord_i, *Coord_j, AuxVar_i, AuxVar_j, weight, r11, r12, r13, r22, r23, r23_a,
-  r23_b, r33, z11, z12, z13, z22, z23, z33, detR2, product;
-  bool singular = false;
+  su2double AuxVar_i, AuxVar_j, *Weight;
   
   su2double *Cvector = new su2double [nDim];
   
-  /*--- Loop over points of the grid ---*/
+  /*--- The geometric part of the least-squares problem is shared by all
+   the solvers of the zone and only recomputed after the grid moved. ---*/
   
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+  geometry->SetLSWeights(config);
+  
+  /*--- Loop over points of the grid, the halo points are set by the MPI
+   communication of the gradient. ---*/
+  
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
     
-    Coord_i = geometry->node[iPoint]->GetCoord();
     AuxVar_i = node[iPoint]->GetAuxVar();
     
-    /*--- Inizialization of variables ---*/
     for (iDim = 0; iDim < nDim; iDim++)
       Cvector[iDim] = 0.0;
     
-    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
-    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+    AD::StartPreacc();
+    AD::SetPreaccIn(AuxVar_i);
     
     for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
       jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-      Coord_j = geometry->node[jPoint]->GetCoord();
       AuxVar_j = node[jPoint]->GetAuxVar();
+      Weight = geometry->GetLSWeights(iPoint, iNeigh);
       
-      weight = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-      
-      /*--- Sumations for entries of upper triangular matrix R ---*/
+      AD::SetPreaccIn(AuxVar_j);
+      AD::SetPreaccIn(Weight, nDim);
       
-      if (fabs(weight) > EPS) {
-        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-        if (nDim == 3) {
-          r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
-        }
-        
-        /*--- Entries of c:= transpose(A)*b ---*/
-        
-        for (iDim = 0; iDim < nDim; iDim++)
-          Cvector[iDim] += (Coord_j[iDim]-Coord_i[iDim])*(AuxVar_j-AuxVar_i)/(weight);
-      }
-      
-    }
-    
-    /*--- Entries of upper triangular matrix R ---*/
-    
-    if (fabs(r11) < EPS) r11 = EPS;
-    r11 = sqrt(r11);
-    r12 = r12/r11;
-    r22 = sqrt(r22-r12*r12);
-    if (fabs(r22) < EPS) r22 = EPS;
-    if (nDim == 3) {
-      r13 = r13/r11;
-      r23 = r23_a/(r22) - r23_b*r12/(r11*r22);
-      r33 = sqrt(r33-r23*r23-r13*r13);
-    }
-    
-    /*--- Compute determinant ---*/
-    
-    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
-    else detR2 = (r11*r22*r33)*(r11*r22*r33);
-    
-    /*--- Detect singular matrices ---*/
-    
-    if (fabs(detR2) < EPS) singular = true;
-    
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    
-    if (singular) {
       for (iDim = 0; iDim < nDim; iDim++)
-        for (jDim = 0; jDim < nDim; jDim++)
-          Smatrix[iDim][jDim] = 0.0;
-    }
-    else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
-        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
+        Cvector[iDim] += Weight[iDim]*(AuxVar_j-AuxVar_i);
     }
     
-    /*--- Computation of the gradient: S*c ---*/
+    for (iDim = 0; iDim < nDim; iDim++)
+      node[iPoint]->SetAuxVarGradient(iDim, Cvector[iDim]);
     
-    for (iDim = 0; iDim < nDim; iDim++) {
-      product = 0.0;
-      for (jDim = 0; jDim < nDim; jDim++)
-        product += Smatrix[iDim][jDim]*Cvector[jDim];
-      if (geometry->node[iPoint]->GetDomain())
-        node[iPoint]->SetAuxVarGradient(iDim, product);
-    }
+    AD::SetPreaccOut(node[iPoint]->GetAuxVarGradient(), nDim);
+    AD::EndPreacc();
   }
   
   delete [] Cvector;
@@ -834,28 +1153,23 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
 
 void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
-  unsigned short iDim, jDim, iVar, iNeigh;
+  unsigned short iDim, iVar, iNeigh;
   unsigned long iPoint, jPoint;
-  su2double *Coord_i, *Coord_j, *Solution_i, *Solution_j,
-  r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
-  z22, z23, z33, product;
-  bool singular = false;
+  su2double *Solution_i, *Solution_j, *Weight, Delta;
   
   su2double **Cvector = new su2double* [nVar];
   for (iVar = 0; iVar < nVar; iVar++)
     Cvector[iVar] = new su2double [nDim];
   
+  /*--- The geometric part of the least-squares problem is shared by all
+   the solvers of the zone and only recomputed after the grid moved. ---*/
+  
+  geometry->SetLSWeights(config);
+  
   /*--- Loop over points of the grid ---*/
   
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
     
-    /*--- Set the value of the singular ---*/
-    singular = false;
-    
-    /*--- Get coordinates ---*/
-    
-    Coord_i = geometry->node[iPoint]->GetCoord();
-    
     /*--- Get consevative solution ---*/
     
     Solution_i = node[iPoint]->GetSolution();
@@ -866,110 +1180,30 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
       for (iDim = 0; iDim < nDim; iDim++)
         Cvector[iVar][iDim] = 0.0;
     
-    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
-    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
-
     AD::StartPreacc();
     AD::SetPreaccIn(Solution_i, nVar);
-    AD::SetPreaccIn(Coord_i, nDim);
-
+    
+    /*--- Computation of the gradient: sum of the weights times the differences ---*/
+    
     for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
       jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-      Coord_j = geometry->node[jPoint]->GetCoord();
-      
       Solution_j = node[jPoint]->GetSolution();
-
-      AD::SetPreaccIn(Coord_j, nDim);
-      AD::SetPreaccIn(Solution_j, nVar);
-
-      weight = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+      Weight = geometry->GetLSWeights(iPoint, iNeigh);
       
-      /*--- Sumations for entries of upper triangular matrix R ---*/
+      AD::SetPreaccIn(Solution_j, nVar);
+      AD::SetPreaccIn(Weight, nDim);
       
-      if (weight != 0.0) {
-        
-        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-        if (nDim == 3) {
-          r13   += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r33   += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
-        }
-        
-        /*--- Entries of c:= transpose(A)*b ---*/
-        
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Cvector[iVar][iDim] += (Coord_j[iDim]-Coord_i[iDim])*(Solution_j[iVar]-Solution_i[iVar])/weight;
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Delta = Solution_j[iVar]-Solution_i[iVar];
+        for (iDim = 0; iDim < nDim; iDim++)
+          Cvector[iVar][iDim] += Weight[iDim]*Delta;
       }
-      
-    }
-    
-    /*--- Entries of upper triangular matrix R ---*/
-    
-    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
-    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
-    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
-    
-    if (nDim == 3) {
-      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
-      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
-      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
     }
     
-    /*--- Compute determinant ---*/
-    
-    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
-    else detR2 = (r11*r22*r33)*(r11*r22*r33);
-    
-    /*--- Detect singular matrices ---*/
-    
-    if (abs(detR2) <= EPS) { detR2 = 1.0; singular = true; }
-    
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    
-    if (singular) {
+    for (iVar = 0; iVar < nVar; iVar++)
       for (iDim = 0; iDim < nDim; iDim++)
-        for (jDim = 0; jDim < nDim; jDim++)
-          Smatrix[iDim][jDim] = 0.0;
-    }
-    else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
-        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
-    }
+        node[iPoint]->SetGradient(iVar, iDim, Cvector[iVar][iDim]);
     
-    /*--- Computation of the gradient: S*c ---*/
-    
-    for (iVar = 0; iVar < nVar; iVar++) {
-      for (iDim = 0; iDim < nDim; iDim++) {
-        product = 0.0;
-        for (jDim = 0; jDim < nDim; jDim++)
-          product += Smatrix[iDim][jDim]*Cvector[iVar][jDim];
-        node[iPoint]->SetGradient(iVar, iDim, product);
-      }
-    }
-
     AD::SetPreaccOut(node[iPoint]->GetGradient(), nVar, nDim);
     AD::EndPreacc();
   }
@@ -2232,7 +2466,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber)) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2270,7 +2504,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber)) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2342,7 +2576,8 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
 
 }
 
-void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename) {
+void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename,
+                                      unsigned short val_iField, unsigned short val_nField) {
 
   char str_buf[CGNS_STRING_SIZE], fname[100];
   unsigned short iVar;
@@ -2351,6 +2586,38 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   Restart_Vars = new int[5];
   config->fields.clear();
 
+  /*--- Chunked restart files, only the requested fields are read and decompressed. ---*/
+
+  if (CChunkedRestart::IsChunked(fname)) {
+
+    unsigned long *Point_Global = new unsigned long[geometry->GetnPointDomain()];
+    unsigned long iPoint_Global, counter = 0;
+    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
+      if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+        Point_Global[counter] = iPoint_Global;
+        counter++;
+      }
+    }
+
+    vector<string> Field_Names;
+    CChunkedRestart::Read(config, fname, counter, Point_Global, val_iField, val_nField,
+                          Restart_Vars, Field_Names, Restart_Data);
+
+    /*--- Same convention for the names as the plain binary files. ---*/
+
+    config->fields.push_back("Point_ID");
+    for (iVar = 0; iVar < Field_Names.size(); iVar++) {
+#ifdef HAVE_MPI
+      config->fields.push_back("\"" + Field_Names[iVar] + "\"");
+#else
+      config->fields.push_back(Field_Names[iVar]);
+#endif
+    }
+
+    delete [] Point_Global;
+    return;
+  }
+
 #ifndef HAVE_MPI
 
   /*--- Serial binary input. ---*/
@@ -2417,24 +2684,18 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
 #else
 
-  /*--- Parallel binary input using MPI I/O. ---*/
+  /*--- Parallel binary input using MPI I/O. The I/O aggregators read large contiguous
+   parts of the file and hand the points to the ranks that own them. ---*/
 
-  MPI_File fhw;
-  SU2_MPI::Status status;
-  MPI_Datatype etype, filetype;
   MPI_Offset disp;
   unsigned long iPoint_Global, index, iChar;
   string field_buf;
 
-  int ierr;
-
-  /*--- All ranks open the file using MPI. ---*/
-
-  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+  CIOAggregator IO_Aggregator(config->GetnIO_Aggregators(), config->GetIO_Stripe_Size());
 
   /*--- Error check opening the file. ---*/
 
-  if (ierr) {
+  if (!IO_Aggregator.Open(fname, false)) {
     SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
   }
 
@@ -2443,7 +2704,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
    variable string names here. Only the master rank reads the header. ---*/
 
   if (rank == MASTER_NODE)
-    MPI_File_read(fhw, Restart_Vars, nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
+    IO_Aggregator.ReadAt_Master(0, Restart_Vars, nRestart_Vars*sizeof(int));
 
   /*--- Broadcast the number of variables to all procs and store clearly. ---*/
 
@@ -2470,8 +2731,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   char *mpi_str_buf = new char[nFields*CGNS_STRING_SIZE];
   if (rank == MASTER_NODE) {
     disp = nRestart_Vars*sizeof(int);
-    MPI_File_read_at(fhw, disp, mpi_str_buf, nFields*CGNS_STRING_SIZE,
-                     MPI_CHAR, MPI_STATUS_IGNORE);
+    IO_Aggregator.ReadAt_Master(disp, mpi_str_buf, nFields*CGNS_STRING_SIZE*sizeof(char));
   }
 
   /*--- Broadcast the string names of the variables. ---*/
@@ -2499,56 +2759,38 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   delete [] mpi_str_buf;
 
-  /*--- We're writing only su2doubles in the data portion of the file. ---*/
-
-  etype = MPI_DOUBLE;
-
   /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
    along with the string names of the variables. ---*/
 
   disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-  /*--- Define a derived datatype for this rank's set of non-contiguous data
-   that will be placed in the restart. Here, we are collecting each one of the
-   points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+  /*--- The points of this rank, in ascending global order, each one is a record
+   of nFields doubles in the file. ---*/
 
-  int *blocklen = new int[geometry->GetnPointDomain()];
-  int *displace = new int[geometry->GetnPointDomain()];
-  int counter = 0;
+  unsigned long *Point_Global = new unsigned long[geometry->GetnPointDomain()];
+  unsigned long counter = 0;
   for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
     if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-      blocklen[counter] = nFields;
-      displace[counter] = iPoint_Global*nFields;
+      Point_Global[counter] = iPoint_Global;
       counter++;
     }
   }
-  MPI_Type_indexed(geometry->GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-  MPI_Type_commit(&filetype);
-
-  /*--- Set the view for the MPI file write, i.e., describe the location in
-   the file that this rank "sees" for writing its piece of the restart file. ---*/
-
-  MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
 
   /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
   Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
 
-  /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+  /*--- Collective call for all ranks to read their points. ---*/
 
-  MPI_File_read_all(fhw, Restart_Data, nFields*geometry->GetnPointDomain(), MPI_DOUBLE, &status);
+  IO_Aggregator.ReadRecords_All(disp, nFields*sizeof(passivedouble), geometry->GetGlobal_nPointDomain(),
+                                counter, Point_Global, Restart_Data);
 
-  /*--- All ranks close the file after writing. ---*/
+  /*--- All ranks close the file after reading. ---*/
 
-  MPI_File_close(&fhw);
+  IO_Aggregator.Close();
 
-  /*--- Free the derived datatype and release temp memory. ---*/
+  delete [] Point_Global;
 
-  MPI_Type_free(&filetype);
-
-  delete [] blocklen;
-  delete [] displace;
-  
 #endif
   
 }
@@ -2601,7 +2843,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532) {
+    if ((var_buf[0] != 535532) && (var_buf[0] != CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2666,7 +2908,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532) {
+    if ((var_buf[0] != 535532) && (var_buf[0] != CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2677,16 +2919,20 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
 
 		if (rank == MASTER_NODE) {
 
-      /*--- External iteration. ---*/
+      /*--- External iteration. The metadata is the footer of the file, for the
+       chunked format its offset depends on the compressed size of the data. ---*/
 
       disp = (nVar_Buf*sizeof(int) + var_buf[1]*CGNS_STRING_SIZE*sizeof(char) +
               var_buf[1]*var_buf[2]*sizeof(passivedouble));
+      if (var_buf[0] == CChunkedRestart::MagicNumber) {
+        MPI_File_get_size(fhw, &disp);
+        disp -= sizeof(int) + 8*sizeof(passivedouble);
+      }
       MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
 
 			/*--- Additional doubles for AoA, AoS, etc. ---*/
 
-      disp = (nVar_Buf*sizeof(int) + var_buf[1]*CGNS_STRING_SIZE*sizeof(char) +
-              var_buf[1]*var_buf[2]*sizeof(passivedouble) + 1*sizeof(int));
+      disp += 1*sizeof(int);
       MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
 
 		}
@@ -2752,7 +2998,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2790,7 +3036,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3562,7 +3808,7 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532) {
+    if ((var_buf[0] != 535532) && (var_buf[0] != CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3605,7 +3851,7 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532) {
+    if ((var_buf[0] != 535532) && (var_buf[0] != CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3655,7 +3901,7 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3693,7 +3939,7 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -4277,7 +4523,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532)
+    if ((var_buf[0] != 535532) && (var_buf[0] != CChunkedRestart::MagicNumber))
       SU2_MPI::Error(string("File ") + filename + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -4320,7 +4566,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532)
+    if ((var_buf[0] != 535532) && (var_buf[0] != CChunkedRestart::MagicNumber))
       SU2_MPI::Error(string("File ") + filename + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -4367,7 +4613,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532)
+    if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber))
       SU2_MPI::Error(string("File ") + filename + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -4405,7 +4651,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532)
+    if ((magic_number == 535532) || (magic_number == CChunkedRestart::MagicNumber))
       SU2_MPI::Error(string("File ") + filename + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
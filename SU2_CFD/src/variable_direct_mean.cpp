@@ -137,7 +137,7 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
   
-  Limiter_Primitive = new su2double [nPrimVarGrad];
+  Limiter_Primitive = AllocateField(FIELD_LIMITER_PRIMITIVE, nPrimVarGrad);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++)
     Limiter_Primitive[iVar] = 0.0;
   
@@ -145,7 +145,7 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
     Limiter_Secondary[iVar] = 0.0;
 
-  Limiter = new su2double [nVar];
+  Limiter = AllocateField(FIELD_LIMITER, nVar);
   for (iVar = 0; iVar < nVar; iVar++)
     Limiter[iVar] = 0.0;
   
@@ -208,7 +208,7 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   
   /*--- Incompressible flow, primitive variables nDim+3, (P, vx, vy, vz, rho, beta) ---*/
   
-  Primitive = new su2double [nPrimVar];
+  Primitive = AllocateField(FIELD_PRIMITIVE, nPrimVar);
   for (iVar = 0; iVar < nPrimVar; iVar++) Primitive[iVar] = 0.0;
   
   Secondary = new su2double [nSecondaryVar];
@@ -217,9 +217,8 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   /*--- Compressible flow, gradients primitive variables nDim+4, (T, vx, vy, vz, P, rho, h)
         We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
+  Gradient_Primitive = AllocateFieldMatrix(FIELD_GRADIENT_PRIMITIVE, nPrimVarGrad, nDim);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim++)
       Gradient_Primitive[iVar][iDim] = 0.0;
   }
@@ -312,7 +311,7 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
 
-  Limiter_Primitive = new su2double [nPrimVarGrad];
+  Limiter_Primitive = AllocateField(FIELD_LIMITER_PRIMITIVE, nPrimVarGrad);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++)
     Limiter_Primitive[iVar] = 0.0;
 
@@ -320,7 +319,7 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
     Limiter_Secondary[iVar] = 0.0;
 
-  Limiter = new su2double [nVar];
+  Limiter = AllocateField(FIELD_LIMITER, nVar);
   for (iVar = 0; iVar < nVar; iVar++)
     Limiter[iVar] = 0.0;
   
@@ -375,7 +374,7 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   
   /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c) ---*/
   
-  Primitive = new su2double [nPrimVar];
+  Primitive = AllocateField(FIELD_PRIMITIVE, nPrimVar);
   for (iVar = 0; iVar < nPrimVar; iVar++) Primitive[iVar] = 0.0;
   
   Secondary = new su2double [nSecondaryVar];
@@ -385,9 +384,8 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   /*--- Compressible flow, gradients primitive variables nDim+4, (T, vx, vy, vz, P, rho, h)
         We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
+  Gradient_Primitive = AllocateFieldMatrix(FIELD_GRADIENT_PRIMITIVE, nPrimVarGrad, nDim);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim++)
       Gradient_Primitive[iVar][iDim] = 0.0;
   }
@@ -413,16 +411,23 @@ CEulerVariable::~CEulerVariable(void) {
     unsigned short iVar;
 
   if (HB_Source         != NULL) delete [] HB_Source;
-  if (Primitive         != NULL) delete [] Primitive;
+
+  /*--- Fields held by the contiguous storage of the solver are not owned. ---*/
+
+  if (!External_Storage) {
+    if (Primitive         != NULL) delete [] Primitive;
+    if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
+  }
+
   if (Secondary         != NULL) delete [] Secondary;
-  if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
   if (Limiter_Secondary != NULL) delete [] Limiter_Secondary;
   if (WindGust          != NULL) delete [] WindGust;
   if (WindGustDer       != NULL) delete [] WindGustDer;
 
   if (Gradient_Primitive != NULL) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-      if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
+    if (!External_Storage)
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
     delete [] Gradient_Primitive;
   }
   if (Gradient_Secondary != NULL) {
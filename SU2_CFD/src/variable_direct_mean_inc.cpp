@@ -117,11 +117,11 @@ CIncEulerVariable::CIncEulerVariable(su2double val_pressure, su2double *val_velo
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
 
-  Limiter_Primitive = new su2double [nPrimVarGrad];
+  Limiter_Primitive = AllocateField(FIELD_LIMITER_PRIMITIVE, nPrimVarGrad);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++)
     Limiter_Primitive[iVar] = 0.0;
 
-  Limiter = new su2double [nVar];
+  Limiter = AllocateField(FIELD_LIMITER, nVar);
   for (iVar = 0; iVar < nVar; iVar++)
     Limiter[iVar] = 0.0;
   
@@ -158,15 +158,14 @@ CIncEulerVariable::CIncEulerVariable(su2double val_pressure, su2double *val_velo
 
   /*--- Incompressible flow, primitive variables nDim+9, (P, vx, vy, vz, T, rho, beta, lamMu, EddyMu, Kt_eff, Cp, Cv) ---*/
   
-  Primitive = new su2double [nPrimVar];
+  Primitive = AllocateField(FIELD_PRIMITIVE, nPrimVar);
   for (iVar = 0; iVar < nPrimVar; iVar++) Primitive[iVar] = 0.0;
 
   /*--- Incompressible flow, gradients primitive variables nDim+4, (P, vx, vy, vz, T, rho, beta)
    * We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
+  Gradient_Primitive = AllocateFieldMatrix(FIELD_GRADIENT_PRIMITIVE, nPrimVarGrad, nDim);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim++)
       Gradient_Primitive[iVar][iDim] = 0.0;
   }
@@ -243,11 +242,11 @@ CIncEulerVariable::CIncEulerVariable(su2double *val_solution, unsigned short val
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
   
-  Limiter_Primitive = new su2double [nPrimVarGrad];
+  Limiter_Primitive = AllocateField(FIELD_LIMITER_PRIMITIVE, nPrimVarGrad);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++)
     Limiter_Primitive[iVar] = 0.0;
 
-  Limiter = new su2double [nVar];
+  Limiter = AllocateField(FIELD_LIMITER, nVar);
   for (iVar = 0; iVar < nVar; iVar++)
     Limiter[iVar] = 0.0;
   
@@ -279,15 +278,14 @@ CIncEulerVariable::CIncEulerVariable(su2double *val_solution, unsigned short val
   
   /*--- Incompressible flow, primitive variables nDim+9, (P, vx, vy, vz, T, rho, beta, lamMu, EddyMu, Kt_eff, Cp, Cv) ---*/
 
-  Primitive = new su2double [nPrimVar];
+  Primitive = AllocateField(FIELD_PRIMITIVE, nPrimVar);
   for (iVar = 0; iVar < nPrimVar; iVar++) Primitive[iVar] = 0.0;
 
   /*--- Incompressible flow, gradients primitive variables nDim+4, (P, vx, vy, vz, T, rho, beta),
         We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
+  Gradient_Primitive = AllocateFieldMatrix(FIELD_GRADIENT_PRIMITIVE, nPrimVarGrad, nDim);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim++)
       Gradient_Primitive[iVar][iDim] = 0.0;
   }
@@ -310,12 +308,17 @@ CIncEulerVariable::CIncEulerVariable(su2double *val_solution, unsigned short val
 CIncEulerVariable::~CIncEulerVariable(void) {
   unsigned short iVar;
 
-  if (Primitive         != NULL) delete [] Primitive;
-  if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
+  /*--- Fields held by the contiguous storage of the solver are not owned. ---*/
+
+  if (!External_Storage) {
+    if (Primitive         != NULL) delete [] Primitive;
+    if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
+  }
 
   if (Gradient_Primitive != NULL) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-      if (Gradient_Primitive!=NULL) delete [] Gradient_Primitive[iVar];
+    if (!External_Storage)
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
     delete [] Gradient_Primitive;
   }
 
@@ -64,7 +64,7 @@ CTurbVariable::CTurbVariable(unsigned short val_nDim, unsigned short val_nvar, C
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
 
-  Limiter = new su2double [nVar];
+  Limiter = AllocateField(FIELD_LIMITER, nVar);
   for (iVar = 0; iVar < nVar; iVar++)
     Limiter[iVar] = 0.0;
   
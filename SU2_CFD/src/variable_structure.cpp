@@ -38,6 +38,50 @@
 #include "../include/variable_structure.hpp"
 
 unsigned short CVariable::nDim = 0;
+CVariableStorage* CVariable::Construction_Storage = NULL;
+
+CVariableStorage::CVariableStorage(unsigned long val_npoint) {
+  
+  nPoint = val_npoint;
+  
+  for (unsigned short iField = 0; iField < N_VARIABLE_FIELDS; iField++) {
+    Field[iField]     = NULL;
+    FieldSize[iField] = 0;
+    NextPoint[iField] = 0;
+  }
+  
+}
+
+CVariableStorage::~CVariableStorage(void) {
+  
+  for (unsigned short iField = 0; iField < N_VARIABLE_FIELDS; iField++)
+    if (Field[iField] != NULL) delete [] Field[iField];
+  
+}
+
+su2double *CVariableStorage::GetPointer(unsigned short val_field, unsigned long val_point, unsigned long val_size) {
+  
+  /*--- Allocate the field the first time it is requested. ---*/
+  
+  if (Field[val_field] == NULL) {
+    FieldSize[val_field] = val_size;
+    Field[val_field] = new su2double [nPoint*val_size];
+    for (unsigned long iVal = 0; iVal < nPoint*val_size; iVal++)
+      Field[val_field][iVal] = 0.0;
+  }
+  
+  if ((val_size != FieldSize[val_field]) || (val_point >= nPoint))
+    SU2_MPI::Error("Inconsistent size or point index for a contiguous field.", CURRENT_FUNCTION);
+  
+  return &Field[val_field][val_point*val_size];
+  
+}
+
+su2double *CVariableStorage::GetNextPointer(unsigned short val_field, unsigned long val_size) {
+  
+  return GetPointer(val_field, NextPoint[val_field]++, val_size);
+  
+}
 
 CVariable::CVariable(void) {
 
@@ -56,6 +100,7 @@ CVariable::CVariable(void) {
   Residual_Old = NULL;
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  External_Storage = false;
   
 }
 
@@ -76,6 +121,7 @@ CVariable::CVariable(unsigned short val_nvar, CConfig *config) {
   Residual_Old = NULL;
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  External_Storage = false;
 
   /*--- Initialize the number of solution variables. This version
    of the constructor will be used primarily for converting the
@@ -110,25 +156,28 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
   Residual_Old = NULL;
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  External_Storage = false;
   
   /*--- Initializate the number of dimension and number of variables ---*/
   nDim = val_nDim;
   nVar = val_nvar;
   
+  /*--- The main fields are taken from the contiguous storage of the solver, if it is active ---*/
+  External_Storage = (Construction_Storage != NULL);
+  
   /*--- Allocate solution, solution old, residual and gradient 
    which is common for all the problems, here it is also possible 
    to allocate some extra flow variables that do not participate 
    in the simulation ---*/
-  Solution = new su2double [nVar];
+  Solution = AllocateField(FIELD_SOLUTION, nVar);
   
   for (iVar = 0; iVar < nVar; iVar++)
     Solution[iVar] = 0.0;
 
-  Solution_Old = new su2double [nVar];
+  Solution_Old = AllocateField(FIELD_SOLUTION_OLD, nVar);
   
-  Gradient = new su2double* [nVar];
+  Gradient = AllocateFieldMatrix(FIELD_GRADIENT, nVar, nDim);
   for (iVar = 0; iVar < nVar; iVar++) {
-    Gradient[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim ++)
       Gradient[iVar][iDim] = 0.0;
   }
@@ -151,11 +200,16 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
 CVariable::~CVariable(void) {
   unsigned short iVar;
 
-  if (Solution            != NULL) delete [] Solution;
-  if (Solution_Old        != NULL) delete [] Solution_Old;
+  /*--- Fields held by the contiguous storage of the solver are not owned. ---*/
+  
+  if (!External_Storage) {
+    if (Solution     != NULL) delete [] Solution;
+    if (Solution_Old != NULL) delete [] Solution_Old;
+    if (Limiter      != NULL) delete [] Limiter;
+  }
+  
   if (Solution_time_n     != NULL) delete [] Solution_time_n;
   if (Solution_time_n1    != NULL) delete [] Solution_time_n1;
-  if (Limiter             != NULL) delete [] Limiter;
   if (Solution_Max        != NULL) delete [] Solution_Max;
   if (Solution_Min        != NULL) delete [] Solution_Min;
   if (Grad_AuxVar         != NULL) delete [] Grad_AuxVar;
@@ -166,13 +220,46 @@ CVariable::~CVariable(void) {
   if (Solution_Adj_Old    != NULL) delete [] Solution_Adj_Old;
   
   if (Gradient != NULL) {
-    for (iVar = 0; iVar < nVar; iVar++)
-      delete [] Gradient[iVar];
+    if (!External_Storage)
+      for (iVar = 0; iVar < nVar; iVar++)
+        delete [] Gradient[iVar];
     delete [] Gradient;
   }
 
 }
 
+void CVariable::SetConstructionStorage(CVariableStorage *storage) { Construction_Storage = storage; }
+
+su2double *CVariable::AllocateField(unsigned short val_field, unsigned long val_size) {
+  
+  if (Construction_Storage != NULL)
+    return Construction_Storage->GetNextPointer(val_field, val_size);
+  
+  return new su2double [val_size];
+  
+}
+
+su2double **CVariable::AllocateFieldMatrix(unsigned short val_field, unsigned short val_nrow, unsigned short val_ncol) {
+  
+  unsigned short iRow;
+  su2double **matrix = new su2double* [val_nrow];
+  
+  /*--- The rows of a point are consecutive in the storage. ---*/
+  
+  if (Construction_Storage != NULL) {
+    su2double *block = Construction_Storage->GetNextPointer(val_field, val_nrow*val_ncol);
+    for (iRow = 0; iRow < val_nrow; iRow++)
+      matrix[iRow] = &block[iRow*val_ncol];
+  }
+  else {
+    for (iRow = 0; iRow < val_nrow; iRow++)
+      matrix[iRow] = new su2double [val_ncol];
+  }
+  
+  return matrix;
+  
+}
+
 void CVariable::AddUnd_Lapl(su2double *val_und_lapl) {
   for (unsigned short iVar = 0; iVar < nVar; iVar++)
     Undivided_Laplacian[iVar] += val_und_lapl[iVar];
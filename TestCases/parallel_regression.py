@@ -785,6 +785,17 @@ def main():
     edge_PPR.timeout   = 1600
     edge_PPR.tol       = 0.00001
     test_list.append(edge_PPR)
+
+    # Rarefaction shock wave edge_LUT (tabulated PR_GAS, shared by the multigrid levels)
+    edge_LUT           = TestCase('edge_LUT')
+    edge_LUT.cfg_dir   = "nicf/edge"
+    edge_LUT.cfg_file  = "edge_LUT.cfg"
+    edge_LUT.test_iter = 100
+    edge_LUT.test_vals = [-5.474846, 0.666610, -0.000037, 0.000000] #last 4 columns
+    edge_LUT.su2_exec  = "parallel_computation.py -f"
+    edge_LUT.timeout   = 1600
+    edge_LUT.tol       = 0.001
+    test_list.append(edge_LUT)
     
     ######################################
     ### Turbomachinery                 ###
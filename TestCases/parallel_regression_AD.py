@@ -183,6 +183,18 @@ def main():
     discadj_cylinder.unsteady  = True
     test_list.append(discadj_cylinder)
 
+    # Same case, the direct solutions are recomputed from every 4th restart file
+    discadj_cylinder_ckpt           = TestCase('unsteady_cylinder_checkpoint')
+    discadj_cylinder_ckpt.cfg_dir   = "disc_adj_rans/cylinder"
+    discadj_cylinder_ckpt.cfg_file  = "cylinder_checkpoint.cfg"
+    discadj_cylinder_ckpt.test_iter = 9
+    discadj_cylinder_ckpt.test_vals = [3.746900, -1.544893, -8.3447e-03, 1.3808e-05] #last 4 columns
+    discadj_cylinder_ckpt.su2_exec  = "parallel_computation.py -f"
+    discadj_cylinder_ckpt.timeout   = 1600
+    discadj_cylinder_ckpt.tol       = 0.0001
+    discadj_cylinder_ckpt.unsteady  = True
+    test_list.append(discadj_cylinder_ckpt)
+
     ##########################################################################
     ### Unsteady Disc. adj. compressible RANS DualTimeStepping 1st order   ###
     ##########################################################################
@@ -182,6 +182,18 @@ def main():
     discadj_cylinder.tol       = 0.00001
     discadj_cylinder.unsteady  = True
     test_list.append(discadj_cylinder)
+
+    # Same case, the direct solutions are recomputed from every 4th restart file
+    discadj_cylinder_ckpt           = TestCase('unsteady_cylinder_checkpoint')
+    discadj_cylinder_ckpt.cfg_dir   = "disc_adj_rans/cylinder"
+    discadj_cylinder_ckpt.cfg_file  = "cylinder_checkpoint.cfg"
+    discadj_cylinder_ckpt.test_iter = 9
+    discadj_cylinder_ckpt.test_vals = [3.746904, -1.544886, -0.008345, 0.000014] #last 4 columns
+    discadj_cylinder_ckpt.su2_exec  = "SU2_CFD_AD"
+    discadj_cylinder_ckpt.timeout   = 1600
+    discadj_cylinder_ckpt.tol       = 0.0001
+    discadj_cylinder_ckpt.unsteady  = True
+    test_list.append(discadj_cylinder_ckpt)
     
     ##########################################################################
     ### Unsteady Disc. adj. compressible RANS DualTimeStepping 1st order   ###